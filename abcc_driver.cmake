@@ -8,7 +8,9 @@ endif()
 set(abcc_driver_SRCS
     ${ABCC_DRIVER_DIR}/src/application_select_firmware.c
     ${ABCC_DRIVER_DIR}/src/application_abcc_handler.c
+    ${ABCC_DRIVER_DIR}/src/abcc_adi_index.c
     ${ABCC_DRIVER_DIR}/src/abcc_command_sequencer.c
+    ${ABCC_DRIVER_DIR}/src/abcc_context.c
     ${ABCC_DRIVER_DIR}/src/abcc_copy.c
     ${ABCC_DRIVER_DIR}/src/abcc_debug_error.c
     ${ABCC_DRIVER_DIR}/src/abcc_handler.c
@@ -18,6 +20,7 @@ set(abcc_driver_SRCS
     ${ABCC_DRIVER_DIR}/src/abcc_segmentation.c
     ${ABCC_DRIVER_DIR}/src/abcc_setup.c
     ${ABCC_DRIVER_DIR}/src/abcc_timer.c
+    ${ABCC_DRIVER_DIR}/src/abcc_trace.c
     ${ABCC_DRIVER_DIR}/src/par/abcc_handler_parallel.c
     ${ABCC_DRIVER_DIR}/src/par/abcc_parallel_driver.c
     ${ABCC_DRIVER_DIR}/src/serial/abcc_crc16.c
@@ -26,6 +29,7 @@ set(abcc_driver_SRCS
     ${ABCC_DRIVER_DIR}/src/spi/abcc_crc32.c
     ${ABCC_DRIVER_DIR}/src/spi/abcc_handler_spi.c
     ${ABCC_DRIVER_DIR}/src/spi/abcc_spi_driver.c
+    ${ABCC_DRIVER_DIR}/src/host_objects/abcc_host_attribute.c
     ${ABCC_DRIVER_DIR}/src/host_objects/application_data_object.c
     ${ABCC_DRIVER_DIR}/src/host_objects/anybus_file_system_interface_object.c
     ${ABCC_DRIVER_DIR}/src/host_objects/application_object.c
@@ -59,6 +63,7 @@ set(abcc_driver_INCS
     ${ABCC_DRIVER_DIR}/src/abcc_segmentation.h
     ${ABCC_DRIVER_DIR}/src/abcc_setup.h
     ${ABCC_DRIVER_DIR}/src/abcc_timer.h
+    ${ABCC_DRIVER_DIR}/src/abcc_trace.h
     ${ABCC_DRIVER_DIR}/src/par/abcc_driver_parallel_interface.h
     ${ABCC_DRIVER_DIR}/src/spi/abcc_crc32.h
     ${ABCC_DRIVER_DIR}/src/spi/abcc_driver_spi_interface.h
@@ -68,7 +73,9 @@ set(abcc_driver_INCS
     ${ABCC_DRIVER_DIR}/inc/abcc_application_data_interface.h
     ${ABCC_DRIVER_DIR}/inc/abcc_command_sequencer_interface.h
     ${ABCC_DRIVER_DIR}/inc/abcc_config.h
+    ${ABCC_DRIVER_DIR}/inc/abcc_context.h
     ${ABCC_DRIVER_DIR}/inc/abcc_identification.h
+    ${ABCC_DRIVER_DIR}/inc/abcc_instance.h
     ${ABCC_DRIVER_DIR}/inc/abcc_object_config.h
     ${ABCC_DRIVER_DIR}/inc/abcc_port.h
     ${ABCC_DRIVER_DIR}/inc/abcc_hardware_abstraction.h
@@ -78,6 +85,7 @@ set(abcc_driver_INCS
     ${ABCC_DRIVER_DIR}/inc/application_abcc_handler.h
     ${ABCC_DRIVER_DIR}/inc/application_data_instance_config.h
     ${ABCC_DRIVER_DIR}/inc/application_select_firmware.h
+    ${ABCC_DRIVER_DIR}/inc/host_objects/abcc_host_attribute.h
     ${ABCC_DRIVER_DIR}/inc/host_objects/anybus_file_system_interface_object.h
     ${ABCC_DRIVER_DIR}/inc/host_objects/application_data_object.h
     ${ABCC_DRIVER_DIR}/inc/host_objects/application_object.h
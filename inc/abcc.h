@@ -154,6 +154,8 @@ typedef enum ABCC_ErrorCodeType
    ABCC_EC_UNSUPPORTED_DATA_TYPE,
    ABCC_EC_CHECKSUM_MISMATCH,
    ABCC_EC_SETUP_FAILED,
+   ABCC_EC_CMD_SEQ_RESP_TMO,
+   ABCC_EC_SEGMENTATION_TMO,
    ABCC_EC_SET_ENUM_ANSI_SIZE       = 0x7FFF
 }
 ABCC_ErrorCodeType;
@@ -241,6 +243,77 @@ typedef enum ParameterSupportType
 }
 ParameterSupportType;
 
+#if ABCC_CFG_TRACE_ENABLED
+/*------------------------------------------------------------------------------
+** Trace event identifiers, see ABCC_CFG_TRACE_ENABLED.
+**
+** Each driver stage has a BEGIN and an END event where END = BEGIN + 1. The
+** time spent in a stage is the difference between the timestamps of matching
+** BEGIN and END records. Stages may nest, e.g. ABCC_TRACE_DRV_RX_BEGIN/END is
+** recorded within ABCC_TRACE_RUN_DRIVER_BEGIN/END.
+** The argument of each event is:
+**    ABCC_TRACE_RUN_DRIVER_*      - Driver main state.
+**    ABCC_TRACE_DRV_TX_*          - 0.
+**    ABCC_TRACE_DRV_RX_*          - END: 1 if a sent message was released,
+**                                   else 0.
+**    ABCC_TRACE_RD_PD_*           - 0.
+**    ABCC_TRACE_NEW_READ_PD_*     - 0.
+**    ABCC_TRACE_SEND_MSG_*        - 0.
+**    ABCC_TRACE_RECEIVE_MSG_*     - END: Destination object and command octet
+**                                   (including the C and E bits) of the
+**                                   received message (object << 8 | cmd), 0 if
+**                                   no message was received.
+**    ABCC_TRACE_CMD_SEQ_*         - 0.
+** Application events can be added with ABCC_TraceEvent() using identifiers
+** from ABCC_TRACE_USER and upwards.
+**------------------------------------------------------------------------------
+*/
+typedef enum ABCC_TraceEventType
+{
+   ABCC_TRACE_RUN_DRIVER_BEGIN   = 0x00,
+   ABCC_TRACE_RUN_DRIVER_END     = 0x01,
+   ABCC_TRACE_DRV_TX_BEGIN       = 0x02,
+   ABCC_TRACE_DRV_TX_END         = 0x03,
+   ABCC_TRACE_DRV_RX_BEGIN       = 0x04,
+   ABCC_TRACE_DRV_RX_END         = 0x05,
+   ABCC_TRACE_RD_PD_BEGIN        = 0x06,
+   ABCC_TRACE_RD_PD_END          = 0x07,
+   ABCC_TRACE_NEW_READ_PD_BEGIN  = 0x08,
+   ABCC_TRACE_NEW_READ_PD_END    = 0x09,
+   ABCC_TRACE_SEND_MSG_BEGIN     = 0x0A,
+   ABCC_TRACE_SEND_MSG_END       = 0x0B,
+   ABCC_TRACE_RECEIVE_MSG_BEGIN  = 0x0C,
+   ABCC_TRACE_RECEIVE_MSG_END    = 0x0D,
+   ABCC_TRACE_CMD_SEQ_BEGIN      = 0x0E,
+   ABCC_TRACE_CMD_SEQ_END        = 0x0F,
+   ABCC_TRACE_USER               = 0x80
+}
+ABCC_TraceEventType;
+
+/*------------------------------------------------------------------------------
+** Trace record. The layout is fixed so that a raw dump of records can be
+** decoded on a host, see tools/abcc_trace_decode.py.
+**------------------------------------------------------------------------------
+** lTimestamp  - Value of ABCC_PORT_GetTimestamp() when the event occurred.
+** iEvent      - Event identifier, see ABCC_TraceEventType.
+** iArg        - Event argument.
+** iSeq        - Sequence number of the record, wraps at 65536. A gap between
+**               two records read by ABCC_TraceRead() means that records were
+**               lost in between.
+** iReserved   - Reserved, always 0.
+**------------------------------------------------------------------------------
+*/
+typedef struct ABCC_TraceRecordType
+{
+   UINT32 lTimestamp;
+   UINT16 iEvent;
+   UINT16 iArg;
+   UINT16 iSeq;
+   UINT16 iReserved;
+}
+ABCC_TraceRecordType;
+#endif
+
 /*------------------------------------------------------------------------------
 ** Macros for basic endian swap. Used by conversion macros below.
 **------------------------------------------------------------------------------
@@ -554,6 +627,37 @@ void ABCC_DebugPrintf( const char *fmt, ... );
 #define ABCC_DebugPrintf( ... ) ABCC_PORT_printf( __VA_ARGS__ )
 #endif
 
+#if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+/*------------------------------------------------------------------------------
+** Prints the entries stored in the deferred log with ABCC_PORT_printf(), see
+** ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED. Entries stored while the function runs
+** are printed by the next call. Shall only be called from one context,
+** preferably a low priority one.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_LogFlush( void );
+
+/*------------------------------------------------------------------------------
+** Returns the number of deferred log entries that have been dropped because
+** the log buffer was full or was in use by another context. The counter wraps
+** at 65536.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    Number of dropped entries.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT16 ABCC_LogGetLostCount( void );
+#endif
+
 /*------------------------------------------------------------------------------
 ** Called when an error is detected. Used by the following support macros:
 ** ABCC_ASSERT()
@@ -851,6 +955,19 @@ EXTFUNC void ( *ABCC_ISR )( void );
 */
 EXTFUNC void ABCC_RunTimerSystem( const INT16 iDeltaTimeMs );
 
+/*------------------------------------------------------------------------------
+** Same as ABCC_RunTimerSystem() but with the delta time in microseconds. Use
+** this function if ABCC_CFG_TIMER_RESOLUTION_US is set below 1000.
+**------------------------------------------------------------------------------
+** Arguments:
+**    lDeltaTimeUs - Microseconds since last call.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_RunTimerSystemUs( const UINT32 lDeltaTimeUs );
+
 /*------------------------------------------------------------------------------
 ** This function returns the uptime of the driver.
 **
@@ -928,7 +1045,8 @@ EXTFUNC void ABCC_UserInitComplete( void );
 /*------------------------------------------------------------------------------
 ** Sends a command message to the ABCC.
 ** The function ABCC_GetCmdMsgBuffer() must be used to allocate the message
-** buffer. It is OK to re-use a previously received response buffer
+** buffer. It is OK to re-use a previously received response buffer, as long
+** as the command fits in it (see ABCC_CFG_NUM_SMALL_MSG_RESOURCES).
 ** The driver will use the sourceId to map the response to the correct response
 ** handler. ABCC_GetNewSourceId() could be used to provide an new source id.
 ** Example where ABCC_CbfMessageReceived() function is used as response handler:
@@ -961,6 +1079,42 @@ EXTFUNC ABCC_ErrorCodeType ABCC_SendCmdMsg( ABP_MsgType* psCmdMsg,
 */
 EXTFUNC UINT16 ABCC_GetCmdQueueSize( void );
 
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+/*------------------------------------------------------------------------------
+** Registers the handler of received commands to an object. Commands to the
+** object are then passed to pnMsgHandler instead of ABCC_CbfReceiveMsg(). The
+** handler must send a response, like ABCC_CbfReceiveMsg().
+** Registering the handler that is already registered is allowed.
+** Note! Must not be called while a command to the same object is being
+** handled, normally objects are registered before ABCC_StartDriver().
+**------------------------------------------------------------------------------
+** Arguments:
+**    bObject      - Object number.
+**    pnMsgHandler - Pointer to the function to handle commands to the object.
+**
+** Returns:
+**    ABCC_EC_NO_ERROR
+**    ABCC_EC_PARAMETER_NOT_VALID - pnMsgHandler is NULL or another handler is
+**                                  registered for the object.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC ABCC_ErrorCodeType ABCC_RegisterObject( UINT8 bObject,
+                                                ABCC_MsgHandlerFuncType pnMsgHandler );
+
+/*------------------------------------------------------------------------------
+** Removes the handler of an object. Commands to the object are passed to
+** ABCC_CbfReceiveMsg() again.
+**------------------------------------------------------------------------------
+** Arguments:
+**    bObject      - Object number.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_UnregisterObject( UINT8 bObject );
+#endif
+
 /*------------------------------------------------------------------------------
 ** Sends a response message to the ABCC.
 ** Note! The received command buffer can be reused as a response buffer. If a
@@ -1074,6 +1228,23 @@ EXTFUNC void ABCC_SetAppStatus( ABP_AppStatusType eAppStatus  );
 */
 EXTFUNC ABP_MsgType* ABCC_GetCmdMsgBuffer( void );
 
+/*------------------------------------------------------------------------------
+** Retrieves a message buffer for a command with at most iMaxDataSize octets of
+** message data. The buffer is taken from the smallest configured size class
+** that fits (see ABCC_CFG_NUM_SMALL_MSG_RESOURCES and
+** ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES), or from a larger class if that one is
+** empty. The buffer must not be used for more data than requested.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iMaxDataSize - Max message data size in octets.
+**
+** Returns:
+**    ABP_MsgType* - Pointer to the message buffer.
+**                   NULL is returned if no resource is available.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC ABP_MsgType* ABCC_GetCmdMsgBufferOfSize( UINT16 iMaxDataSize );
+
 /*------------------------------------------------------------------------------
 ** Returns the message buffer to the driver's message pool.
 ** Note! This function may only be used in combination with
@@ -1375,6 +1546,7 @@ EXTFUNC void ABCC_CbfReceiveMsg( ABP_MsgType* psReceivedMsg );
 ** buffer before returning from the function.
 ** The data will only be sent to the ABCC if the return value is TRUE.
 ** Regarding callback context, see comment for callback section above.
+** Not used if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED is enabled.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    pxWritePd - Pointer to the process data to be sent.
@@ -1392,6 +1564,7 @@ EXTFUNC BOOL ABCC_CbfUpdateWriteProcessData( void* pxWritePd );
 ** be copied to the application ADI:s before returning from the function. Note
 ** that the data may not be changed since last time.
 ** Regarding callback context, see comment for callback section above.
+** Not used if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED is enabled.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    pxReadPd - Pointer to the received process data.
@@ -1582,6 +1755,124 @@ EXTFUNC void ABCC_TriggerAnbStatusUpdate( void );
 */
 EXTFUNC void ABCC_TriggerTransmitMessage( void );
 
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+/*------------------------------------------------------------------------------
+** Process data triple buffer functions, see ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED.
+** The read functions shall only be used from one application context and the
+** write functions shall only be used from one application context. The
+** contexts do not need to be synchronized with the driver.
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Acquires the latest read process data image published by the driver. The
+** image is not modified until ABCC_PdReleaseRead() has been called. If no new
+** image has been published since the last call, the same image is returned
+** again.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    Pointer to the read process data image. NULL if no image has been
+**    published since the driver was started.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void* ABCC_PdAcquireRead( void );
+
+/*------------------------------------------------------------------------------
+** Releases the image acquired by ABCC_PdAcquireRead().
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_PdReleaseRead( void );
+
+/*------------------------------------------------------------------------------
+** Acquires a write process data buffer. The content of the buffer is
+** undefined, the complete write process data image shall be written before it
+** is released.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    Pointer to the write process data buffer.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void* ABCC_PdAcquireWrite( void );
+
+/*------------------------------------------------------------------------------
+** Publishes the buffer acquired by ABCC_PdAcquireWrite(). The latest published
+** image is sent to the ABCC on the next ABCC_TriggerWrPdUpdate(). An image that
+** is overwritten by a newer one before it has been sent is dropped.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_PdReleaseWrite( void );
+#endif
+
+#if ABCC_CFG_TRACE_ENABLED
+/*******************************************************************************
+** Trace functions, see ABCC_CFG_TRACE_ENABLED.
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Adds a record to the trace ring. Can be called from any context.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iEvent - Event identifier, ABCC_TRACE_USER and upwards for application
+**             events.
+**    iArg   - Event argument.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_TraceEvent( UINT16 iEvent, UINT16 iArg );
+
+/*------------------------------------------------------------------------------
+** Copies the oldest unread records from the trace ring. Shall only be called
+** from one context. Records overwritten before they were read are counted,
+** see ABCC_TraceGetLostCount(). Only completely written records are copied.
+** If a probe in another context is still writing the oldest unread record the
+** function returns and that record is copied by the next call.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pasRecord    - Destination for the records.
+**    iMaxRecords  - Maximum number of records to copy.
+**
+** Returns:
+**    Number of records copied.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT16 ABCC_TraceRead( ABCC_TraceRecordType* pasRecord, UINT16 iMaxRecords );
+
+/*------------------------------------------------------------------------------
+** Returns the number of records that were overwritten before they were read
+** by ABCC_TraceRead() since the driver was started. The count is only exact if
+** ABCC_TraceRead() is called at least once per 65536 records.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    Number of lost records.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT32 ABCC_TraceGetLostCount( void );
+#endif
+
 /*******************************************************************************
 ** Message support functions
 ********************************************************************************
@@ -1739,4 +2030,46 @@ EXTFUNC UINT16 ABCC_GetMessageChannelSize( void );
 */
 EXTFUNC UINT16 ABCC_GetMaxMessageSize( void );
 
+/*******************************************************************************
+** ADI lookup support functions
+********************************************************************************
+*/
+
+/*
+** Returned by ABCC_AdiIndexFind() if the instance is not in the ADI list.
+*/
+#define ABCC_ADI_INDEX_NOT_FOUND             ( 0xffff )
+
+/*------------------------------------------------------------------------------
+** Builds the ADI lookup index for an ADI list (see ABCC_CFG_ADI_INDEX_SIZE).
+** Nothing is done if the index is already built for the list. The ADI list
+** must be sorted in ascending instance number order.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psAdiEntry - ADI entry table.
+**    iNumAdi    - Number of entries in psAdiEntry.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_AdiIndexBuild( const AD_AdiEntryType* psAdiEntry, UINT16 iNumAdi );
+
+/*------------------------------------------------------------------------------
+** Finds the ADI entry table index of an instance number. Uses the ADI lookup
+** index if it is built for psAdiEntry, otherwise a binary search.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psAdiEntry - ADI entry table.
+**    iNumAdi    - Number of entries in psAdiEntry.
+**    iInstance  - Instance number.
+**
+** Returns:
+**    Index in ADI entry table, or ABCC_ADI_INDEX_NOT_FOUND.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT16 ABCC_AdiIndexFind( const AD_AdiEntryType* psAdiEntry,
+                                  UINT16 iNumAdi,
+                                  UINT16 iInstance );
+
 #endif  /* inclusion lock */
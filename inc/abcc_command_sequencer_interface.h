@@ -30,21 +30,59 @@
 ** {
 **    ABCC_CMD_SEQ( CmdBuilder1,      RespHandler1 ),
 **    ABCC_CMD_SEQ( CmdBuilder2,      NULL         ),
-**    ABCC_CMD_SEQ( CmdBuilder3,      RespHandler3 ),
+**    ABCC_CMD_SEQ_TMO( CmdBuilder3,  RespHandler3, 500, TmoHandler3 ),
+**    ABCC_CMD_SEQ_PIPELINED( CmdBuilder4, RespHandler4 ),
 **    ABCC_CMD_SEQ_END()
 ** };
 **
+** ABCC_CMD_SEQ()           - Step using the ABCC_CFG_CMD_SEQ_RESP_TMO_MS
+**                            response timeout (default none).
+** ABCC_CMD_SEQ_TMO()       - Step with its own response timeout in ms (0 means
+**                            no timeout) and an optional timeout handler (see
+**                            ABCC_CmdSeqTmoHandler). A retry after a timeout
+**                            calls the command handler again.
+** ABCC_CMD_SEQ_PIPELINED() - Step sending a series of independent commands. The
+**                            command handler is called again for the next
+**                            command without waiting for the response of the
+**                            previous one, until it returns
+**                            ABCC_CMDSEQ_CMD_SKIP. The step is done when the
+**                            responses of all commands have been received. Both
+**                            ABCC_CMDSEQ_RESP_EXEC_NEXT and
+**                            ABCC_CMDSEQ_RESP_EXEC_CURRENT from the response
+**                            handler continue the step. See
+**                            ABCC_CFG_CMD_SEQ_MAX_PIPELINED.
+** ABCC_CMD_SEQ_PIPELINED_ONCE() - Pipelined step whose commands must not be
+**                            sent twice, e.g. because they are not idempotent
+**                            or their order matters. A response timeout ends
+**                            the sequence with ABCC_CMDSEQ_RESULT_ABORT_TMO
+**                            instead of sending the commands again.
+** ABCC_CMD_SEQ_SHORT()     - Step whose command carries at most
+**                            ABCC_CFG_SMALL_MSG_SIZE octets of message data,
+**                            e.g. a Get_Attribute or the Set_Attribute of a
+**                            simple value. The command buffer is taken from
+**                            the small message buffers if configured (see
+**                            ABCC_CFG_NUM_SMALL_MSG_RESOURCES).
 */
+#define ABCC_CMDSEQ_FLAG_PIPELINED     0x01
+#define ABCC_CMDSEQ_FLAG_SHORT_CMD     0x02
+#define ABCC_CMDSEQ_FLAG_NO_TMO_RETRY  0x04
+
 #if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
-#define ABCC_CMD_SEQ( cmd, resp ) { cmd, resp, #cmd, #resp }
+#define ABCC_CMD_SEQ_ENTRY( cmd, resp, tmo, tmoh, flags ) { cmd, resp, tmo, tmoh, flags, #cmd, #resp }
 #else
-#define ABCC_CMD_SEQ( cmd, resp ) { cmd, resp }
+#define ABCC_CMD_SEQ_ENTRY( cmd, resp, tmo, tmoh, flags ) { cmd, resp, tmo, tmoh, flags }
 #endif
 
+#define ABCC_CMD_SEQ( cmd, resp )                   ABCC_CMD_SEQ_ENTRY( cmd, resp, ABCC_CFG_CMD_SEQ_RESP_TMO_MS, NULL, 0 )
+#define ABCC_CMD_SEQ_TMO( cmd, resp, tmo, tmoh )    ABCC_CMD_SEQ_ENTRY( cmd, resp, tmo, tmoh, 0 )
+#define ABCC_CMD_SEQ_PIPELINED( cmd, resp )         ABCC_CMD_SEQ_ENTRY( cmd, resp, ABCC_CFG_CMD_SEQ_RESP_TMO_MS, NULL, ABCC_CMDSEQ_FLAG_PIPELINED )
+#define ABCC_CMD_SEQ_PIPELINED_ONCE( cmd, resp )    ABCC_CMD_SEQ_ENTRY( cmd, resp, ABCC_CFG_CMD_SEQ_RESP_TMO_MS, NULL, ABCC_CMDSEQ_FLAG_PIPELINED | ABCC_CMDSEQ_FLAG_NO_TMO_RETRY )
+#define ABCC_CMD_SEQ_SHORT( cmd, resp )             ABCC_CMD_SEQ_ENTRY( cmd, resp, ABCC_CFG_CMD_SEQ_RESP_TMO_MS, NULL, ABCC_CMDSEQ_FLAG_SHORT_CMD )
+
 #if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
-#define ABCC_CMD_SEQ_END()    { NULL, NULL, NULL, NULL }
+#define ABCC_CMD_SEQ_END()    { NULL, NULL, 0, NULL, 0, NULL, NULL }
 #else
-#define ABCC_CMD_SEQ_END()    { NULL, NULL }
+#define ABCC_CMD_SEQ_END()    { NULL, NULL, 0, NULL, 0 }
 #endif
 
 /*
@@ -81,7 +119,8 @@ typedef enum ABCC_CmdSeqResult
 {
    ABCC_CMDSEQ_RESULT_COMPLETED,
    ABCC_CMDSEQ_RESULT_ABORT_INT,
-   ABCC_CMDSEQ_RESULT_ABORT_EXT
+   ABCC_CMDSEQ_RESULT_ABORT_EXT,
+   ABCC_CMDSEQ_RESULT_ABORT_TMO
 }
 ABCC_CmdSeqResultType;
 
@@ -137,6 +176,28 @@ typedef ABCC_CmdSeqRespStatusType (*ABCC_CmdSeqRespHandler)( ABP_MsgType* psResp
 */
 typedef void (*ABCC_CmdSeqDoneHandler)( const ABCC_CmdSeqResultType eSeqResult, void* pxUserData );
 
+/*------------------------------------------------------------------------------
+** Type for response timeout callback used by command sequencer.
+** Called from ABCC_RunDriver() context when no response has been received
+** within the timeout of the current step. Late responses to the timed out
+** commands are not passed to the response handler.
+** See also description of ABCC_CMD_SEQ_TMO().
+**------------------------------------------------------------------------------
+** Arguments:
+**    pxUserData - Pointer to user-defined data. This is given in the
+**                 ABCC_CmdSeqAdd() call.
+**
+** Returns:
+**    ABCC_CmdSeqRespStatusType:
+**    ABCC_CMDSEQ_RESP_EXEC_NEXT    - Move to next command in sequence
+**    ABCC_CMDSEQ_RESP_EXEC_CURRENT - Execute current command again. A
+**                                    pipelined step sends the timed out
+**                                    commands again.
+**    ABCC_CMDSEQ_RESP_ABORT        - Abort whole sequence
+**------------------------------------------------------------------------------
+*/
+typedef ABCC_CmdSeqRespStatusType (*ABCC_CmdSeqTmoHandler)( void* pxUserData );
+
 /*------------------------------------------------------------------------------
 ** Type used by command sequencer to define command-response callback pairs.
 ** See also description of ABCC_CmdSeqAdd().
@@ -146,6 +207,9 @@ typedef struct ABCC_CmdSeq
 {
    ABCC_CmdSeqCmdHandler   pnCmdHandler;
    ABCC_CmdSeqRespHandler  pnRespHandler;
+   UINT16                  iTmoMs;
+   ABCC_CmdSeqTmoHandler   pnTmoHandler;
+   UINT8                   bFlags;
 #if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
    char*                   pcCmdName;
    char*                   pcRespName;
@@ -166,7 +230,11 @@ ABCC_CmdSeqType;
 ** An array of ABCC_CmdSeqType's is provided and defines the command sequence to
 ** be executed. The last entry in the array is indicated by NULL pointers.
 ** The next command in the sequence will be executed when the previous command
-** has successfully received a response.
+** has successfully received a response. A step declared with
+** ABCC_CMD_SEQ_PIPELINED() may have several commands waiting for responses.
+** If a step has a response timeout and no response is received in time, the
+** step is retried or the sequence is ended with ABCC_CMDSEQ_RESULT_ABORT_TMO,
+** see ABCC_CMD_SEQ_TMO() and ABCC_CFG_CMD_SEQ_RESP_TMO_MS.
 **
 ** If a command sequence response handler exists the response will be passed to
 ** the application.
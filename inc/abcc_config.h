@@ -57,6 +57,31 @@
     #define ABCC_CFG_PAR_EXT_BUS_ENDIAN_DIFF 0
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_INSTANCE_PREFIX   <C identifier>
+**
+** Not defined by default (single instance).
+**
+** Used to run several ABCC modules from one host, for example a gateway with
+** one module on each of its SPI buses. The driver sources, and the application
+** sources belonging to one module, are compiled once per module with a unique
+** prefix defined on the compiler command line (e.g. -DABCC_CFG_INSTANCE_PREFIX=
+** ABCC1). All external symbols are then renamed to <prefix>_<name> (see
+** abcc_instance.h), which gives each module its own driver state, memory pool,
+** message queues, timers, ADI tables and host objects.
+**
+** The ABCC_SYS_* hardware abstraction functions, the ABCC_Cbf* and APPL_*
+** callbacks and the application data (ADI tables etc.) are renamed the same
+** way and must be implemented once per instance. The ABCC_PORT_* functions are
+** shared by all instances and must be safe to call from all of them.
+**
+** abcc_context.h provides a context handle API (ABCC_Ctx*) with which one loop,
+** or one thread per module, can handle all instances through a pointer to the
+** context of each instance.
+**------------------------------------------------------------------------------
+*/
+#include "abcc_instance.h"
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_DRV_SPI_ENABLED        1 - Enable / 0 - Disable
 ** #define ABCC_CFG_DRV_PARALLEL_ENABLED   1 - Enable / 0 - Disable
@@ -230,6 +255,40 @@
     #define ABCC_CFG_SPI_MSG_FRAG_LEN ( 16 )
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_SPI_CRC32_BYTE_TABLE_ENABLED   1 - Enable / 0 - Disable
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** Selects how the SPI frame CRC32 is calculated. If enabled a 256 entry table
+** (1 kB) is used and the checksum is calculated one octet per lookup. If
+** disabled a 16 entry table is used and the checksum is calculated one nibble
+** per lookup, which is slower but requires less memory. Both give the same
+** result. See also ABCC_PORT_Crc32 in abcc_port.h for how to use a hardware
+** CRC unit instead.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_SPI_CRC32_BYTE_TABLE_ENABLED
+    #define ABCC_CFG_SPI_CRC32_BYTE_TABLE_ENABLED 1
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_SPI_SCATTER_GATHER_ENABLED   1 - Enable / 0 - Disable
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** If enabled the SPI driver uses ABCC_SYS_SpiSendReceiveVec() instead of
+** ABCC_SYS_SpiSendReceive(), see abcc_hardware_abstraction_spi.h. Write message
+** fragments are then sent directly from the message buffer and read message
+** fragments are, when possible, received directly into the message buffer
+** instead of being copied via the SPI frame buffers. The CRC32 is calculated
+** per segment with CRC_Crc32Update(), so ABCC_PORT_Crc32 is not used.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+    #define ABCC_CFG_SPI_SCATTER_GATHER_ENABLED 0
+#endif
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED  1 - Enable / 0 - Disable
 **
@@ -310,6 +369,36 @@ ABCC_CFG_DRV_PARALLEL_ENABLED and ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED are enab
     #define ABCC_CFG_SERIAL_TMO_625 ( 20 )
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_SERIAL_TMO_625_US             ( ABCC_CFG_SERIAL_TMO_625 * 1000 )
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** Serial telegram timeout in microseconds for 625 kbit/s. Only gives a finer
+** timeout than ABCC_CFG_SERIAL_TMO_625 if ABCC_CFG_TIMER_RESOLUTION_US is set
+** below 1000.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_SERIAL_TMO_625_US
+    #define ABCC_CFG_SERIAL_TMO_625_US ( ABCC_CFG_SERIAL_TMO_625 * 1000UL )
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED   1 - Enable / 0 - Disable
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** If enabled the serial driver calculates the CRC of the RX telegram while it
+** is received instead of after the complete telegram has arrived. This
+** requires that the serial HAL implements ABCC_SYS_SerRegPartialDataReceived()
+** and reports received octets as they arrive, see
+** abcc_hardware_abstraction_serial.h.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+    #define ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED 0
+#endif
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_MODULE_ID_PINS_CONN       1 - Enable / 0 - Disable
 **
@@ -365,6 +454,136 @@ ABCC_CFG_DRV_PARALLEL_ENABLED and ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED are enab
     #define ABCC_CFG_MAX_NUM_ABCC_CMDS ( 2 )
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED     1 - Enable / 0 - Disable
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** If enabled the command and response send queues of the link layer are
+** implemented as lock-free single-producer/single-consumer rings. Queueing a
+** message and checking for messages to send then no longer disables
+** interrupts, only a flag test-and-set and the actual driver write are done
+** in critical sections.
+** Requirements:
+** - Commands must be sent from one context only, and responses must be sent
+**   from one context only (the two may differ).
+** - ABCC_PORT_MemoryBarrier() must be available, see abcc_port.h.
+** Note! The maximum queue sizes (ABCC_CFG_MAX_NUM_APPL_CMDS and
+** ABCC_CFG_MAX_NUM_ABCC_CMDS) must be less than 255 when enabled.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED
+    #define ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED 0
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_OBJ_REGISTRY_ENABLED     1 - Enable / 0 - Disable
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** If enabled the driver keeps a table with one command handler per object
+** number (256 function pointers of RAM). Handlers are added with
+** ABCC_RegisterObject() and removed with ABCC_UnregisterObject(). Received
+** commands to a registered object are passed directly to its handler, all
+** other commands are passed to ABCC_CbfReceiveMsg() as before.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_OBJ_REGISTRY_ENABLED
+    #define ABCC_CFG_OBJ_REGISTRY_ENABLED 1
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_SRC_ID_INDEX_ENABLED     1 - Enable / 0 - Disable
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** If enabled the response handlers of sent commands are stored in a table
+** indexed by source id, and the source ids in use are kept in a bitmap. Mapping
+** and looking up a response handler, and allocating a new source id with
+** ABCC_GetNewSourceId(), then take constant time independent of the number of
+** outstanding commands. The command sequencer maps responses to sequences the
+** same way. Costs 256 function pointers and about 300 bytes of RAM.
+** If disabled the handlers are searched linearly, which is sufficient for a
+** small ABCC_CFG_MAX_NUM_APPL_CMDS.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_SRC_ID_INDEX_ENABLED
+    #define ABCC_CFG_SRC_ID_INDEX_ENABLED 1
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_NUM_SMALL_MSG_RESOURCES     ( 0 )
+** #define ABCC_CFG_SMALL_MSG_SIZE              ( 16 )
+** #define ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES    ( 0 )
+** #define ABCC_CFG_MEDIUM_MSG_SIZE             ( 64 )
+**
+** Default values below can be overridden in abcc_driver_config.h
+**
+** Number and message data size (in octets) of additional small and medium
+** message buffers. These are used by ABCC_GetCmdMsgBufferOfSize() for
+** commands whose size is known in advance, e.g. get/set attribute commands.
+** The driver itself uses them for the short commands of its command sequences
+** (the ABCC_CMD_SEQ_SHORT() steps of setup, exception and address/baud rate
+** handling) and for the copies of pipelined commands.
+** The SPI and parallel drivers also receive responses in them, sized by the
+** message header. Received commands, responses received by the serial driver
+** and ABCC_GetCmdMsgBuffer() always use the ABCC_CFG_MAX_MSG_SIZE buffers.
+** Note! A received response is then only re-usable as a command buffer for
+** commands that fit in it, otherwise ABCC_SendCmdMsg() returns
+** ABCC_EC_WRMSG_SIZE_ERR.
+** If the best fitting class is empty a larger class is used. A class with 0
+** buffers is not allocated. The free buffers are kept in lock-free stacks,
+** see ABCC_PORT_AtomicCompareExchange32() in abcc_port.h.
+**
+** ABCC_CFG_SMALL_MSG_SIZE must hold the largest short command of the driver, a
+** 4 octet IP address. A message larger than its buffer is rejected by the link
+** layer with ABCC_EC_WRMSG_SIZE_ERR.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_NUM_SMALL_MSG_RESOURCES
+    #define ABCC_CFG_NUM_SMALL_MSG_RESOURCES ( 0 )
+#endif
+#ifndef ABCC_CFG_SMALL_MSG_SIZE
+    #define ABCC_CFG_SMALL_MSG_SIZE ( 16 )
+#endif
+#if ( ABCC_CFG_SMALL_MSG_SIZE < 4 )
+    #error "ABCC_CFG_SMALL_MSG_SIZE must be at least 4."
+#endif
+#ifndef ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES
+    #define ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES ( 0 )
+#endif
+#ifndef ABCC_CFG_MEDIUM_MSG_SIZE
+    #define ABCC_CFG_MEDIUM_MSG_SIZE ( 64 )
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED     1 - Enable / 0 - Disable
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** If enabled the process data is exchanged with the application through
+** triple buffers instead of the ABCC_CbfNewReadPd() and
+** ABCC_CbfUpdateWriteProcessData() callbacks. The driver publishes each valid
+** read process data image and consumes the latest published write process
+** data image, and the application accesses the images with
+** ABCC_PdAcquireRead()/ABCC_PdReleaseRead() and
+** ABCC_PdAcquireWrite()/ABCC_PdReleaseWrite() from its own context. Only a
+** buffer index is exchanged atomically, the process data itself is never
+** accessed by both sides at the same time. See ABCC_PORT_AtomicExchange8 in
+** abcc_port.h.
+** The option bypasses the AD object (AD_UpdatePdReadData() and
+** AD_UpdatePdWriteData() are not called), so the images are the raw process
+** data as exchanged with the ABCC: in the network data format, packed in map
+** order including bit and pad elements, with the sizes of the current map
+** (see AD_GetPresentPdSizeInOctets()). The application is responsible for the
+** conversion to and from its ADI values.
+** Requires 2 * 3 * ABCC_CFG_MAX_PROCESS_DATA_SIZE octets of RAM.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+    #define ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED 0
+#endif
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_MAX_MSG_SIZE                       ( 1524 )
 **
@@ -527,6 +746,36 @@ ABCC_CFG_DRV_PARALLEL_ENABLED and ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED are enab
     #define ABCC_CFG_WD_TIMEOUT_MS ( 1000 )
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_MAX_NUM_TIMERS                     ( 3 )
+** #define ABCC_CFG_TIMER_WHEEL_SIZE                   ( 16 )
+** #define ABCC_CFG_TIMER_RESOLUTION_US                ( 1000 )
+**
+** Default values below can be overridden in abcc_driver_config.h
+**
+** ABCC_CFG_MAX_NUM_TIMERS is the number of timers that can be created with
+** ABCC_TimerCreate(). The driver itself uses up to 3 timers. Must be less
+** than 255.
+** ABCC_CFG_TIMER_WHEEL_SIZE is the number of slots in the timer wheel. Must be
+** a power of two. Starting and stopping a timer takes constant time, and each
+** timer tick visits the slots passed since the previous tick. More slots give
+** fewer timers per slot.
+** ABCC_CFG_TIMER_RESOLUTION_US is the length of one timer wheel tick in
+** microseconds. Set it below 1000 together with ABCC_RunTimerSystemUs() to
+** get sub-millisecond timeouts, e.g. for serial telegram timeouts at 625
+** kbit/s (see ABCC_CFG_SERIAL_TMO_625_US).
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_MAX_NUM_TIMERS
+    #define ABCC_CFG_MAX_NUM_TIMERS ( 3 )
+#endif
+#ifndef ABCC_CFG_TIMER_WHEEL_SIZE
+    #define ABCC_CFG_TIMER_WHEEL_SIZE ( 16 )
+#endif
+#ifndef ABCC_CFG_TIMER_RESOLUTION_US
+    #define ABCC_CFG_TIMER_RESOLUTION_US ( 1000 )
+#endif
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_REMAP_SUPPORT_ENABLED   1 - Enable / 0 - Disable
 **
@@ -590,6 +839,29 @@ ABCC_CFG_DRV_PARALLEL_ENABLED and ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED are enab
     #define ABCC_CFG_ADI_TRANS_SET_CALLBACK_ENABLED 0
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_ADI_INDEX_SIZE                     ( 512 )
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** Number of slots in the ADI lookup index used by the driver and the AD object
+** to find the ADI entry of an instance number. Must be 0 or a power of two.
+** Each slot uses 2 octets of RAM.
+** If the instance numbers of the ADI list span no more than this number of
+** slots the index maps instance numbers directly to entries. Otherwise an open
+** addressing hash table is used if the number of ADIs is at most 3/4 of the
+** slots.
+** If 0, or if the ADI list does not fit, each lookup does a binary search in
+** the ADI list instead.
+** The default (1 kB of RAM) indexes up to 384 ADIs with any instance numbers.
+** Use at least 4/3 of the number of ADIs, rounded up to a power of two, for
+** larger ADI lists.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_ADI_INDEX_SIZE
+    #define ABCC_CFG_ADI_INDEX_SIZE ( 512 )
+#endif
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED   1 - Enable / 0 - Disable
 **
@@ -732,6 +1004,35 @@ ABCC_CFG_DRV_PARALLEL_ENABLED and ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED are enab
     #define ABCC_CFG_DEBUG_HEXDUMP_UART_ENABLED 0
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED         1 - Enable / 0 - Disable
+** #define ABCC_CFG_DEBUG_LOG_BUFFER_SIZE              ( 2048 )
+**
+** Default values below can be overridden in abcc_driver_config.h
+**
+** If 1 the printouts enabled by ABCC_CFG_DEBUG_MESSAGING_ENABLED and
+** ABCC_CFG_DEBUG_HEXDUMP_xxx_ENABLED are not printed where they occur. Instead
+** the format string pointer and the raw arguments, or a copy of the message or
+** frame data, are stored in a log buffer. The entries are printed later when
+** the application calls ABCC_LogFlush(), preferably from a low priority
+** context. Storing an entry never blocks and uses no critical section. If the
+** buffer is full, or if another context is storing an entry at the same time,
+** the entry is dropped and counted (see ABCC_LogGetLostCount()).
+** Note that %s arguments of the stored entries must point to strings that
+** still exist when ABCC_LogFlush() is called, e.g. string literals. Deferred
+** entries are printed without timestamps.
+** When ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED is 1, ABCC_PORT_AtomicExchange8()
+** and ABCC_PORT_AtomicIncrement16() must be available (see abcc_port.h).
+** ABCC_CFG_DEBUG_LOG_BUFFER_SIZE is the size of the log buffer in octets.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+    #define ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED 0
+#endif
+#ifndef ABCC_CFG_DEBUG_LOG_BUFFER_SIZE
+    #define ABCC_CFG_DEBUG_LOG_BUFFER_SIZE ( 2048 )
+#endif
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_DEBUG_CRC_ERROR_CNT_ENABLED        1 - Enable / 0 - Disable
 **
@@ -849,6 +1150,33 @@ ABCC_CFG_DRV_PARALLEL_ENABLED and ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED are enab
     #define ABCC_CFG_SYNC_MEASUREMENT_OP_ENABLED 0
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_TRACE_ENABLED         1 - Enable / 0 - Disable
+** #define ABCC_CFG_TRACE_NUM_RECORDS     ( 256 )
+**
+** Default values below can be overridden in abcc_driver_config.h
+**
+** Enable/disable the binary trace ring. When enabled the driver stores a
+** timestamped record (see ABCC_TraceRecordType in abcc.h) at the start and end
+** of each stage of the driver cycle, e.g. ABCC_RunDriver(), the operating mode
+** driver Tx/Rx, read process data handling, message sending/receiving and the
+** command sequencer. The records are read out with ABCC_TraceRead().
+** When disabled the trace probes are removed at compile time.
+** When ABCC_CFG_TRACE_ENABLED is 1 ABCC_PORT_GetTimestamp() must be ported.
+** ABCC_CFG_TRACE_NUM_RECORDS is the size of the ring in records and must be a
+** power of two. Each record uses 12 octets of RAM. When the ring is full the
+** oldest records are overwritten.
+** tools/abcc_trace_decode.py decodes a raw dump of the records read with
+** ABCC_TraceRead() and prints per-stage latency histograms.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_TRACE_ENABLED
+    #define ABCC_CFG_TRACE_ENABLED 0
+#endif
+#ifndef ABCC_CFG_TRACE_NUM_RECORDS
+    #define ABCC_CFG_TRACE_NUM_RECORDS ( 256 )
+#endif
+
 /*------------------------------------------------------------------------------
 ** #define ABCC_CFG_DRV_CMD_SEQ_ENABLED   1 - Enable / 0 - Disable
 **
@@ -894,4 +1222,103 @@ ABCC_CFG_DRV_PARALLEL_ENABLED and ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED are enab
     #define ABCC_CFG_CMD_SEQ_MAX_NUM_RETRIES ( 0 )
 #endif
 
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_CMD_SEQ_RESP_TMO_MS          ( UINT16 0-65535 )
+** #define ABCC_CFG_CMD_SEQ_MAX_NUM_TMO_RETRIES  ( UINT8 0-254 )
+**
+** Default values below can be overridden in abcc_driver_config.h
+**
+** ABCC_CFG_CMD_SEQ_RESP_TMO_MS is the response timeout used for command
+** sequence steps declared with ABCC_CMD_SEQ() and ABCC_CMD_SEQ_PIPELINED().
+** 0 means no timeout. Steps declared with ABCC_CMD_SEQ_TMO() use their own
+** timeout, which is the way to opt in for a single sequence.
+** If a step without a timeout handler times out, the command is sent again up
+** to ABCC_CFG_CMD_SEQ_MAX_NUM_TMO_RETRIES times before the sequence is ended
+** with ABCC_CMDSEQ_RESULT_ABORT_TMO. Sending the command of an ordinary step
+** again calls its command handler again, so the handler must be able to build
+** the same command more than once. A pipelined step instead keeps a copy of
+** each command waiting for a response and sends the copy, which uses one
+** extra message buffer per command (see ABCC_CFG_MAX_NUM_MSG_RESOURCES).
+** The timeouts are supervised by ABCC_RunDriver() and rely on
+** ABCC_RunTimerSystem() being called. A timed out command keeps its command
+** resource until the late response to it has been received and dropped, so
+** a retry waits for a free command resource like any other command and a
+** pipelined step is aborted if there are not enough of them.
+**
+** Default is 0 (no timeout) and 2. A non-zero ABCC_CFG_CMD_SEQ_RESP_TMO_MS
+** applies to the driver's own setup sequences as well. The ADI mapping step of
+** the setup is not retried, a timeout there ends the setup.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_CMD_SEQ_RESP_TMO_MS
+    #define ABCC_CFG_CMD_SEQ_RESP_TMO_MS ( 0 )
+#endif
+#ifndef ABCC_CFG_CMD_SEQ_MAX_NUM_TMO_RETRIES
+    #define ABCC_CFG_CMD_SEQ_MAX_NUM_TMO_RETRIES ( 2 )
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_CMD_SEQ_MAX_PIPELINED        ( UINT8 1-254 )
+**
+** Default value below can be overridden in abcc_driver_config.h
+**
+** Max number of commands a step declared with ABCC_CMD_SEQ_PIPELINED() may
+** have waiting for responses at the same time. The number is also limited by
+** the free command resources, see ABCC_CFG_MAX_NUM_APPL_CMDS.
+**
+** Default is 4.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_CMD_SEQ_MAX_PIPELINED
+    #define ABCC_CFG_CMD_SEQ_MAX_PIPELINED ( 4 )
+#endif
+
+/*------------------------------------------------------------------------------
+** #define ABCC_CFG_NUM_SEG_SESSIONS             ( UINT8 1-254 )
+** #define ABCC_CFG_SEG_HASH_SIZE                ( 1-256, power of two )
+** #define ABCC_CFG_SEG_SESSION_TMO_MS           ( 5000 )
+**
+** Default values below can be overridden in abcc_driver_config.h
+**
+** ABCC_CFG_NUM_SEG_SESSIONS is the number of segmented responses (see
+** ABCC_StartServerRespSegmentationSession()) that can be in progress at the
+** same time. The older ABCC_NUM_SEGMENTATION_SESSIONS is used if defined.
+** The host objects of the driver that respond segmented are:
+**    - Application object, Get_Data_Notification
+**      (APP_CMD_GET_DATA_NOTIFICATION_ENABLE).
+**    - Application data object, Get of a large ADI value (AD_SEG_VALUE_ENABLE).
+**    - EtherCAT object, the ENUM ADIs list and the ADI and object/subindex
+**      translation attributes (ECT_IA_ENUM_ADIS_ENABLE,
+**      ECT_IA_ADI_TRANS_ENABLE and ECT_IA_OBJ_SUB_TRANS_ENABLE).
+** The module may request these in parallel, so use one session for each of
+** them that is enabled, plus any used by the application. A request that
+** finds no free session is answered with ABP_ERR_NO_RESOURCES. A session
+** costs about 40 bytes of RAM on a 32-bit target.
+** ABCC_CFG_SEG_HASH_SIZE is the number of slots in the hash table that
+** received commands are matched against active sessions with.
+** ABCC_CFG_SEG_SESSION_TMO_MS is the time a session may wait for the next
+** segment request before it is reclaimed and its done function called. 0
+** means no timeout, in which case a session the module abandons is never
+** freed. The segment requests follow the pace of the network client, so the
+** timeout must be longer than the client's own request timeout. The timeouts
+** are supervised by ABCC_RunDriver() and rely on ABCC_RunTimerSystem() being
+** called.
+**
+** Default is 3, 8 and 5000 ms.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_CFG_NUM_SEG_SESSIONS
+    #ifdef ABCC_NUM_SEGMENTATION_SESSIONS
+        #define ABCC_CFG_NUM_SEG_SESSIONS ( ABCC_NUM_SEGMENTATION_SESSIONS )
+    #else
+        #define ABCC_CFG_NUM_SEG_SESSIONS ( 3 )
+    #endif
+#endif
+#ifndef ABCC_CFG_SEG_HASH_SIZE
+    #define ABCC_CFG_SEG_HASH_SIZE ( 8 )
+#endif
+#ifndef ABCC_CFG_SEG_SESSION_TMO_MS
+    #define ABCC_CFG_SEG_SESSION_TMO_MS ( 5000 )
+#endif
+
 #endif  /* inclusion lock */
@@ -0,0 +1,142 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Context handle API for hosts running several ABCC modules.
+**
+** Each driver instance (see ABCC_CFG_INSTANCE_PREFIX in abcc_config.h) exports
+** a context with the entry points of that instance. The ABCC_Ctx* functions
+** below take a context handle and call the corresponding function of the
+** instance, so that the application can handle all modules with the same
+** code, either from one loop or from one thread per module.
+**
+** Example with two instances built with the prefixes ABCC1 and ABCC2:
+**
+**    ABCC_CTX_DECLARE( ABCC1 );
+**    ABCC_CTX_DECLARE( ABCC2 );
+**
+**    static const ABCC_CtxType* const apsModule[] =
+**    {
+**       ABCC_CTX( ABCC1 ),
+**       ABCC_CTX( ABCC2 )
+**    };
+**
+**    for( i = 0; i < 2; i++ )
+**    {
+**       ABCC_CtxRunDriver( apsModule[ i ] );
+**    }
+**
+** In a single instance build the existing API is used as before, and the
+** context of the only instance is available as ABCC_CTX_INSTANCE.
+********************************************************************************
+*/
+
+#ifndef ABCC_CONTEXT_H_
+#define ABCC_CONTEXT_H_
+
+#include "abcc_config.h"
+#include "abcc_types.h"
+#include "abcc.h"
+#include "application_abcc_handler.h"
+
+/*------------------------------------------------------------------------------
+** Entry points of one driver instance.
+**------------------------------------------------------------------------------
+** Function pointers that are variables in the driver (ABCC_RunDriver, ABCC_ISR
+** and ABCC_TriggerWrPdUpdate) are referenced through their address since the
+** driver sets them up when it is started.
+**------------------------------------------------------------------------------
+*/
+typedef struct ABCC_Ctx
+{
+   ABCC_ErrorCodeType ( *pnHwInit )( void );
+   ABCC_ErrorCodeType ( *pnStartDriver )( UINT32 lMaxStartupTimeMs );
+   void ( *pnShutdownDriver )( void );
+   ABCC_CommunicationStateType ( *pnIsReadyForCommunication )( void );
+   ABCC_ErrorCodeType ( **ppnRunDriver )( void );
+   void ( **ppnISR )( void );
+   void ( *pnRunTimerSystem )( const INT16 iDeltaTimeMs );
+   void ( *pnHWReset )( void );
+   void ( *pnHWReleaseReset )( void );
+   BOOL ( *pnModuleDetect )( void );
+   UINT8 ( *pnAnbState )( void );
+   UINT16 ( *pnNetworkType )( void );
+   ABP_MsgType* ( *pnGetCmdMsgBuffer )( void );
+   ABCC_ErrorCodeType ( *pnSendCmdMsg )( ABP_MsgType* psCmdMsg,
+                                         ABCC_MsgHandlerFuncType pnMsgHandler );
+   ABCC_ErrorCodeType ( *pnSendRespMsg )( ABP_MsgType* psMsgResp );
+   ABCC_ErrorCodeType ( *pnReturnMsgBuffer )( ABP_MsgType** ppsBuffer );
+   void ( **ppnTriggerWrPdUpdate )( void );
+   APPL_AbccHandlerStatusType ( *pnHandleAbcc )( void );
+   void ( *pnRestartAbcc )( void );
+   void ( *pnShutdown )( void );
+   void ( *pnReset )( void );
+}
+ABCC_CtxType;
+
+/*------------------------------------------------------------------------------
+** Context of the driver instance that is being compiled. In a single instance
+** build this is the context of the only instance.
+**------------------------------------------------------------------------------
+*/
+EXTVAR const ABCC_CtxType ABCC_sContext;
+
+#define ABCC_CTX_INSTANCE                       ( &ABCC_sContext )
+
+/*------------------------------------------------------------------------------
+** Access to the context of another instance from code compiled without, or
+** with another, instance prefix.
+**------------------------------------------------------------------------------
+** ABCC_CTX_DECLARE( prefix ) - Declares the context of instance <prefix>.
+** ABCC_CTX( prefix )         - Pointer to the context of instance <prefix>.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_CTX_DECLARE( prefix )              \
+   EXTVAR const ABCC_CtxType ABCC_INSTANCE_PASTE( prefix, ABCC_sContext )
+
+#define ABCC_CTX( prefix )                      \
+   ( &ABCC_INSTANCE_PASTE( prefix, ABCC_sContext ) )
+
+/*------------------------------------------------------------------------------
+** Context handle versions of the driver API. See the function without "Ctx"
+** in abcc.h and application_abcc_handler.h for a description. psCtx is a
+** pointer to the context of the instance to access.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_CtxHwInit( psCtx )                 ( (psCtx)->pnHwInit() )
+#define ABCC_CtxStartDriver( psCtx, lMaxStartupTimeMs )                        \
+   ( (psCtx)->pnStartDriver( lMaxStartupTimeMs ) )
+#define ABCC_CtxShutdownDriver( psCtx )         ( (psCtx)->pnShutdownDriver() )
+#define ABCC_CtxIsReadyForCommunication( psCtx )                               \
+   ( (psCtx)->pnIsReadyForCommunication() )
+#define ABCC_CtxRunDriver( psCtx )              ( ( *(psCtx)->ppnRunDriver )() )
+#define ABCC_CtxISR( psCtx )                    ( ( *(psCtx)->ppnISR )() )
+#define ABCC_CtxRunTimerSystem( psCtx, iDeltaTimeMs )                          \
+   ( (psCtx)->pnRunTimerSystem( iDeltaTimeMs ) )
+#define ABCC_CtxHWReset( psCtx )                ( (psCtx)->pnHWReset() )
+#define ABCC_CtxHWReleaseReset( psCtx )         ( (psCtx)->pnHWReleaseReset() )
+#define ABCC_CtxModuleDetect( psCtx )           ( (psCtx)->pnModuleDetect() )
+#define ABCC_CtxAnbState( psCtx )               ( (psCtx)->pnAnbState() )
+#define ABCC_CtxNetworkType( psCtx )            ( (psCtx)->pnNetworkType() )
+#define ABCC_CtxGetCmdMsgBuffer( psCtx )        ( (psCtx)->pnGetCmdMsgBuffer() )
+#define ABCC_CtxSendCmdMsg( psCtx, psCmdMsg, pnMsgHandler )                    \
+   ( (psCtx)->pnSendCmdMsg( psCmdMsg, pnMsgHandler ) )
+#define ABCC_CtxSendRespMsg( psCtx, psMsgResp ) ( (psCtx)->pnSendRespMsg( psMsgResp ) )
+#define ABCC_CtxReturnMsgBuffer( psCtx, ppsBuffer )                            \
+   ( (psCtx)->pnReturnMsgBuffer( ppsBuffer ) )
+#define ABCC_CtxTriggerWrPdUpdate( psCtx )      ( ( *(psCtx)->ppnTriggerWrPdUpdate )() )
+#define APPL_CtxHandleAbcc( psCtx )             ( (psCtx)->pnHandleAbcc() )
+#define APPL_CtxRestartAbcc( psCtx )            ( (psCtx)->pnRestartAbcc() )
+#define APPL_CtxShutdown( psCtx )               ( (psCtx)->pnShutdown() )
+#define APPL_CtxReset( psCtx )                  ( (psCtx)->pnReset() )
+
+#endif  /* inclusion lock */
@@ -42,6 +42,35 @@ typedef void ( *ABCC_SYS_SerDataReceivedCbfType )( void );
 */
 EXTFUNC void ABCC_SYS_SerRegDataReceived( ABCC_SYS_SerDataReceivedCbfType pnDataReceived );
 
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+/*------------------------------------------------------------------------------
+** Function pointer type for RX telegram progress callback.
+**------------------------------------------------------------------------------
+*/
+typedef void ( *ABCC_SYS_SerPartialDataReceivedCbfType )( UINT16 iNumOctetsReceived );
+
+/*------------------------------------------------------------------------------
+** ABCC_SYS_SerRegPartialDataReceived()
+** Registers a callback function that indicates that part of the RX telegram
+** has been received. Only required if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+** is enabled.
+** The callback shall be called with the total number of octets received so far
+** in the buffer provided when ABCC_SYS_SerSendReceive() was called, e.g. from
+** the UART RX interrupt or when a DMA half transfer is done. It is not
+** required to call it for every octet. It shall not be called after the
+** callback registered in ABCC_SYS_SerRegDataReceived() has been called for
+** the same telegram.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pnPartialDataReceived: Function to call when RX octets have arrived.
+**
+** Returns:
+**          -
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_SYS_SerRegPartialDataReceived( ABCC_SYS_SerPartialDataReceivedCbfType pnPartialDataReceived );
+#endif
+
 /*------------------------------------------------------------------------------
 ** Send TX telegram and prepare for RX telegram reception. The the RX telegram
 ** will be stored in the pbRxDataBuffer.
@@ -62,4 +62,49 @@ EXTFUNC void ABCC_SYS_SpiRegDataReceived( ABCC_SYS_SpiDataReceivedCbfType pnData
 */
 EXTFUNC void ABCC_SYS_SpiSendReceive( void* pxSendDataBuffer, void* pxReceiveDataBuffer, UINT16 iLength );
 
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+/*------------------------------------------------------------------------------
+** Segment descriptor for ABCC_SYS_SpiSendReceiveVec().
+**------------------------------------------------------------------------------
+** pxBase   - Start of the segment. 16 bit aligned.
+** iLength  - Length of the segment ( in bytes, always even ).
+**------------------------------------------------------------------------------
+*/
+typedef struct ABCC_SYS_SpiIoVecType
+{
+   void*  pxBase;
+   UINT16 iLength;
+}
+ABCC_SYS_SpiIoVecType;
+
+/*------------------------------------------------------------------------------
+** ABCC_SYS_SpiSendReceiveVec()
+** Scatter/gather variant of ABCC_SYS_SpiSendReceive(), used instead of it if
+** ABCC_CFG_SPI_SCATTER_GATHER_ENABLED is enabled.
+** The MOSI frame is the concatenation of the MOSI segments and the received
+** MISO frame shall be stored in the MISO segments in order. The segments allow
+** the SPI driver to transfer message fragments directly from and to the
+** message buffers, e.g. with a chained DMA descriptor list, instead of copying
+** them to and from a frame buffer. The sum of the segment lengths is the same
+** for both directions, but the segment boundaries differ.
+** The descriptor lists are valid until the MISO frame received callback has
+** been invoked.
+** Same rules as for ABCC_SYS_SpiSendReceive() apply regarding the MISO frame
+** received callback.
+**------------------------------------------------------------------------------
+** Arguments:
+**             pasMosiVec           MOSI segments to send.
+**             bNumMosiVec          Number of MOSI segments.
+**             pasMisoVec           MISO segments to receive into.
+**             bNumMisoVec          Number of MISO segments.
+** Returns:
+**          None.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_SYS_SpiSendReceiveVec( const ABCC_SYS_SpiIoVecType* pasMosiVec,
+                                         UINT8 bNumMosiVec,
+                                         const ABCC_SYS_SpiIoVecType* pasMisoVec,
+                                         UINT8 bNumMisoVec );
+#endif
+
 #endif  /* inclusion lock */
@@ -0,0 +1,463 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Symbol prefixing used to build several driver instances into one image.
+**
+** When ABCC_CFG_INSTANCE_PREFIX is defined every external symbol of the
+** driver, and every function or object the driver expects the application to
+** provide, is renamed to <prefix>_<name>. Sources compiled with the same
+** prefix form one driver instance with its own state, memory pool, queues,
+** timers and ADI tables. See ABCC_CFG_INSTANCE_PREFIX in abcc_config.h.
+**
+** All external symbols of the driver must be listed here.
+********************************************************************************
+*/
+
+#ifndef ABCC_INSTANCE_H_
+#define ABCC_INSTANCE_H_
+
+/*------------------------------------------------------------------------------
+** Creates the instance specific name of a symbol.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_INSTANCE_PASTE( prefix, name )   prefix##_##name
+#define ABCC_INSTANCE_EXPAND( prefix, name )  ABCC_INSTANCE_PASTE( prefix, name )
+#define ABCC_INSTANCE_NAME( name )            ABCC_INSTANCE_EXPAND( ABCC_CFG_INSTANCE_PREFIX, name )
+
+#ifdef ABCC_CFG_INSTANCE_PREFIX
+
+/*------------------------------------------------------------------------------
+** Functions and data defined by the driver and the host objects.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_AdiIndexBuild                        ABCC_INSTANCE_NAME( ABCC_AdiIndexBuild )
+#define ABCC_AdiIndexFind                         ABCC_INSTANCE_NAME( ABCC_AdiIndexFind )
+#define ABCC_AnbState                             ABCC_INSTANCE_NAME( ABCC_AnbState )
+#define ABCC_CbfAdiMappingReq                     ABCC_INSTANCE_NAME( ABCC_CbfAdiMappingReq )
+#define ABCC_CbfAnbStateChanged                   ABCC_INSTANCE_NAME( ABCC_CbfAnbStateChanged )
+#define ABCC_CbfDriverError                       ABCC_INSTANCE_NAME( ABCC_CbfDriverError )
+#define ABCC_CbfEvent                             ABCC_INSTANCE_NAME( ABCC_CbfEvent )
+#define ABCC_CbfNewReadPd                         ABCC_INSTANCE_NAME( ABCC_CbfNewReadPd )
+#define ABCC_CbfReceiveMsg                        ABCC_INSTANCE_NAME( ABCC_CbfReceiveMsg )
+#define ABCC_CbfRemapDone                         ABCC_INSTANCE_NAME( ABCC_CbfRemapDone )
+#define ABCC_CbfSyncIsr                           ABCC_INSTANCE_NAME( ABCC_CbfSyncIsr )
+#define ABCC_CbfUpdateWriteProcessData            ABCC_INSTANCE_NAME( ABCC_CbfUpdateWriteProcessData )
+#define ABCC_CbfUserInitReq                       ABCC_INSTANCE_NAME( ABCC_CbfUserInitReq )
+#define ABCC_CbfWdTimeout                         ABCC_INSTANCE_NAME( ABCC_CbfWdTimeout )
+#define ABCC_CbfWdTimeoutRecovered                ABCC_INSTANCE_NAME( ABCC_CbfWdTimeoutRecovered )
+#define ABCC_CheckWrPdUpdate                      ABCC_INSTANCE_NAME( ABCC_CheckWrPdUpdate )
+#define ABCC_CmdSeqAbort                          ABCC_INSTANCE_NAME( ABCC_CmdSeqAbort )
+#define ABCC_CmdSeqAdd                            ABCC_INSTANCE_NAME( ABCC_CmdSeqAdd )
+#define ABCC_CmdSequencerExec                     ABCC_INSTANCE_NAME( ABCC_CmdSequencerExec )
+#define ABCC_CmdSequencerInit                     ABCC_INSTANCE_NAME( ABCC_CmdSequencerInit )
+#define ABCC_Copy16WithEndianSwapImpl             ABCC_INSTANCE_NAME( ABCC_Copy16WithEndianSwapImpl )
+#define ABCC_Copy32WithEndianSwapImpl             ABCC_INSTANCE_NAME( ABCC_Copy32WithEndianSwapImpl )
+#define ABCC_Copy64WithEndianSwapImpl             ABCC_INSTANCE_NAME( ABCC_Copy64WithEndianSwapImpl )
+#define ABCC_CopyImpl                             ABCC_INSTANCE_NAME( ABCC_CopyImpl )
+#define ABCC_CopyOctetsImpl                       ABCC_INSTANCE_NAME( ABCC_CopyOctetsImpl )
+#define ABCC_DebugHexdumpMsg                      ABCC_INSTANCE_NAME( ABCC_DebugHexdumpMsg )
+#define ABCC_DebugHexdumpSpi                      ABCC_INSTANCE_NAME( ABCC_DebugHexdumpSpi )
+#define ABCC_DebugHexdumpUart                     ABCC_INSTANCE_NAME( ABCC_DebugHexdumpUart )
+#define ABCC_DebugPrintMsg                        ABCC_INSTANCE_NAME( ABCC_DebugPrintMsg )
+#define ABCC_DebugPrintMsgEvent                   ABCC_INSTANCE_NAME( ABCC_DebugPrintMsgEvent )
+#define ABCC_DebugPrintf                          ABCC_INSTANCE_NAME( ABCC_DebugPrintf )
+#define ABCC_DrvParGetAnbStatus                   ABCC_INSTANCE_NAME( ABCC_DrvParGetAnbStatus )
+#define ABCC_DrvParGetAnybusState                 ABCC_INSTANCE_NAME( ABCC_DrvParGetAnybusState )
+#define ABCC_DrvParGetIntStatus                   ABCC_INSTANCE_NAME( ABCC_DrvParGetIntStatus )
+#define ABCC_DrvParGetLedStatus                   ABCC_INSTANCE_NAME( ABCC_DrvParGetLedStatus )
+#define ABCC_DrvParGetModCap                      ABCC_INSTANCE_NAME( ABCC_DrvParGetModCap )
+#define ABCC_DrvParGetWrPdBuffer                  ABCC_INSTANCE_NAME( ABCC_DrvParGetWrPdBuffer )
+#define ABCC_DrvParISR                            ABCC_INSTANCE_NAME( ABCC_DrvParISR )
+#define ABCC_DrvParInit                           ABCC_INSTANCE_NAME( ABCC_DrvParInit )
+#define ABCC_DrvParIsReadyForCmd                  ABCC_INSTANCE_NAME( ABCC_DrvParIsReadyForCmd )
+#define ABCC_DrvParIsReadyForWrPd                 ABCC_INSTANCE_NAME( ABCC_DrvParIsReadyForWrPd )
+#define ABCC_DrvParIsReadyForWriteMessage         ABCC_INSTANCE_NAME( ABCC_DrvParIsReadyForWriteMessage )
+#define ABCC_DrvParIsSupervised                   ABCC_INSTANCE_NAME( ABCC_DrvParIsSupervised )
+#define ABCC_DrvParPrepareWriteMessage            ABCC_INSTANCE_NAME( ABCC_DrvParPrepareWriteMessage )
+#define ABCC_DrvParReadMessage                    ABCC_INSTANCE_NAME( ABCC_DrvParReadMessage )
+#define ABCC_DrvParReadProcessData                ABCC_INSTANCE_NAME( ABCC_DrvParReadProcessData )
+#define ABCC_DrvParRunDriverRx                    ABCC_INSTANCE_NAME( ABCC_DrvParRunDriverRx )
+#define ABCC_DrvParRunDriverTx                    ABCC_INSTANCE_NAME( ABCC_DrvParRunDriverTx )
+#define ABCC_DrvParSetAppStatus                   ABCC_INSTANCE_NAME( ABCC_DrvParSetAppStatus )
+#define ABCC_DrvParSetIntMask                     ABCC_INSTANCE_NAME( ABCC_DrvParSetIntMask )
+#define ABCC_DrvParSetMsgReceiverBuffer           ABCC_INSTANCE_NAME( ABCC_DrvParSetMsgReceiverBuffer )
+#define ABCC_DrvParSetNbrOfCmds                   ABCC_INSTANCE_NAME( ABCC_DrvParSetNbrOfCmds )
+#define ABCC_DrvParSetPdSize                      ABCC_INSTANCE_NAME( ABCC_DrvParSetPdSize )
+#define ABCC_DrvParWriteMessage                   ABCC_INSTANCE_NAME( ABCC_DrvParWriteMessage )
+#define ABCC_DrvParWriteProcessData               ABCC_INSTANCE_NAME( ABCC_DrvParWriteProcessData )
+#define ABCC_DrvSerGetAnbStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSerGetAnbStatus )
+#define ABCC_DrvSerGetAnybusState                 ABCC_INSTANCE_NAME( ABCC_DrvSerGetAnybusState )
+#define ABCC_DrvSerGetIntStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSerGetIntStatus )
+#define ABCC_DrvSerGetLedStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSerGetLedStatus )
+#define ABCC_DrvSerGetModCap                      ABCC_INSTANCE_NAME( ABCC_DrvSerGetModCap )
+#define ABCC_DrvSerGetWrPdBuffer                  ABCC_INSTANCE_NAME( ABCC_DrvSerGetWrPdBuffer )
+#define ABCC_DrvSerISR                            ABCC_INSTANCE_NAME( ABCC_DrvSerISR )
+#define ABCC_DrvSerInit                           ABCC_INSTANCE_NAME( ABCC_DrvSerInit )
+#define ABCC_DrvSerIsReadyForCmd                  ABCC_INSTANCE_NAME( ABCC_DrvSerIsReadyForCmd )
+#define ABCC_DrvSerIsReadyForWrPd                 ABCC_INSTANCE_NAME( ABCC_DrvSerIsReadyForWrPd )
+#define ABCC_DrvSerIsReadyForWriteMessage         ABCC_INSTANCE_NAME( ABCC_DrvSerIsReadyForWriteMessage )
+#define ABCC_DrvSerIsSupervised                   ABCC_INSTANCE_NAME( ABCC_DrvSerIsSupervised )
+#define ABCC_DrvSerReadMessage                    ABCC_INSTANCE_NAME( ABCC_DrvSerReadMessage )
+#define ABCC_DrvSerReadProcessData                ABCC_INSTANCE_NAME( ABCC_DrvSerReadProcessData )
+#define ABCC_DrvSerRunDriverRx                    ABCC_INSTANCE_NAME( ABCC_DrvSerRunDriverRx )
+#define ABCC_DrvSerRunDriverTx                    ABCC_INSTANCE_NAME( ABCC_DrvSerRunDriverTx )
+#define ABCC_DrvSerSetAppStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSerSetAppStatus )
+#define ABCC_DrvSerSetIntMask                     ABCC_INSTANCE_NAME( ABCC_DrvSerSetIntMask )
+#define ABCC_DrvSerSetMsgReceiverBuffer           ABCC_INSTANCE_NAME( ABCC_DrvSerSetMsgReceiverBuffer )
+#define ABCC_DrvSerSetNbrOfCmds                   ABCC_INSTANCE_NAME( ABCC_DrvSerSetNbrOfCmds )
+#define ABCC_DrvSerSetPdSize                      ABCC_INSTANCE_NAME( ABCC_DrvSerSetPdSize )
+#define ABCC_DrvSerWriteMessage                   ABCC_INSTANCE_NAME( ABCC_DrvSerWriteMessage )
+#define ABCC_DrvSerWriteProcessData               ABCC_INSTANCE_NAME( ABCC_DrvSerWriteProcessData )
+#define ABCC_DrvSpiGetAnbStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSpiGetAnbStatus )
+#define ABCC_DrvSpiGetAnybusState                 ABCC_INSTANCE_NAME( ABCC_DrvSpiGetAnybusState )
+#define ABCC_DrvSpiGetIntStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSpiGetIntStatus )
+#define ABCC_DrvSpiGetLedStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSpiGetLedStatus )
+#define ABCC_DrvSpiGetModCap                      ABCC_INSTANCE_NAME( ABCC_DrvSpiGetModCap )
+#define ABCC_DrvSpiGetWrPdBuffer                  ABCC_INSTANCE_NAME( ABCC_DrvSpiGetWrPdBuffer )
+#define ABCC_DrvSpiISR                            ABCC_INSTANCE_NAME( ABCC_DrvSpiISR )
+#define ABCC_DrvSpiInit                           ABCC_INSTANCE_NAME( ABCC_DrvSpiInit )
+#define ABCC_DrvSpiIsReadyForCmd                  ABCC_INSTANCE_NAME( ABCC_DrvSpiIsReadyForCmd )
+#define ABCC_DrvSpiIsReadyForWrPd                 ABCC_INSTANCE_NAME( ABCC_DrvSpiIsReadyForWrPd )
+#define ABCC_DrvSpiIsReadyForWriteMessage         ABCC_INSTANCE_NAME( ABCC_DrvSpiIsReadyForWriteMessage )
+#define ABCC_DrvSpiIsSupervised                   ABCC_INSTANCE_NAME( ABCC_DrvSpiIsSupervised )
+#define ABCC_DrvSpiReadMessage                    ABCC_INSTANCE_NAME( ABCC_DrvSpiReadMessage )
+#define ABCC_DrvSpiReadProcessData                ABCC_INSTANCE_NAME( ABCC_DrvSpiReadProcessData )
+#define ABCC_DrvSpiRunDriverRx                    ABCC_INSTANCE_NAME( ABCC_DrvSpiRunDriverRx )
+#define ABCC_DrvSpiRunDriverTx                    ABCC_INSTANCE_NAME( ABCC_DrvSpiRunDriverTx )
+#define ABCC_DrvSpiSetAppStatus                   ABCC_INSTANCE_NAME( ABCC_DrvSpiSetAppStatus )
+#define ABCC_DrvSpiSetIntMask                     ABCC_INSTANCE_NAME( ABCC_DrvSpiSetIntMask )
+#define ABCC_DrvSpiSetMsgReceiverBuffer           ABCC_INSTANCE_NAME( ABCC_DrvSpiSetMsgReceiverBuffer )
+#define ABCC_DrvSpiSetNbrOfCmds                   ABCC_INSTANCE_NAME( ABCC_DrvSpiSetNbrOfCmds )
+#define ABCC_DrvSpiSetPdSize                      ABCC_INSTANCE_NAME( ABCC_DrvSpiSetPdSize )
+#define ABCC_DrvSpiWriteMessage                   ABCC_INSTANCE_NAME( ABCC_DrvSpiWriteMessage )
+#define ABCC_DrvSpiWriteProcessData               ABCC_INSTANCE_NAME( ABCC_DrvSpiWriteProcessData )
+#define ABCC_ErrorHandler                         ABCC_INSTANCE_NAME( ABCC_ErrorHandler )
+#define ABCC_FirmwareVersion                      ABCC_INSTANCE_NAME( ABCC_FirmwareVersion )
+#define ABCC_GetAppStatus                         ABCC_INSTANCE_NAME( ABCC_GetAppStatus )
+#define ABCC_GetAttribute                         ABCC_INSTANCE_NAME( ABCC_GetAttribute )
+#define ABCC_GetCmdMsgBuffer                      ABCC_INSTANCE_NAME( ABCC_GetCmdMsgBuffer )
+#define ABCC_GetCmdMsgBufferOfSize                ABCC_INSTANCE_NAME( ABCC_GetCmdMsgBufferOfSize )
+#define ABCC_GetCmdQueueSize                      ABCC_INSTANCE_NAME( ABCC_GetCmdQueueSize )
+#define ABCC_GetData16                            ABCC_INSTANCE_NAME( ABCC_GetData16 )
+#define ABCC_GetData32                            ABCC_INSTANCE_NAME( ABCC_GetData32 )
+#define ABCC_GetData64                            ABCC_INSTANCE_NAME( ABCC_GetData64 )
+#define ABCC_GetData8                             ABCC_INSTANCE_NAME( ABCC_GetData8 )
+#define ABCC_GetDataTypeSize                      ABCC_INSTANCE_NAME( ABCC_GetDataTypeSize )
+#define ABCC_GetDataTypeSizeInBits                ABCC_INSTANCE_NAME( ABCC_GetDataTypeSizeInBits )
+#define ABCC_GetDriverError                       ABCC_INSTANCE_NAME( ABCC_GetDriverError )
+#define ABCC_GetMainState                         ABCC_INSTANCE_NAME( ABCC_GetMainState )
+#define ABCC_GetMaxMessageSize                    ABCC_INSTANCE_NAME( ABCC_GetMaxMessageSize )
+#define ABCC_GetMessageChannelSize                ABCC_INSTANCE_NAME( ABCC_GetMessageChannelSize )
+#define ABCC_GetNewSourceId                       ABCC_INSTANCE_NAME( ABCC_GetNewSourceId )
+#define ABCC_GetOpmode                            ABCC_INSTANCE_NAME( ABCC_GetOpmode )
+#define ABCC_GetString                            ABCC_INSTANCE_NAME( ABCC_GetString )
+#define ABCC_GetUptimeMs                          ABCC_INSTANCE_NAME( ABCC_GetUptimeMs )
+#define ABCC_GpioReset                            ABCC_INSTANCE_NAME( ABCC_GpioReset )
+#define ABCC_GpioSet                              ABCC_INSTANCE_NAME( ABCC_GpioSet )
+#define ABCC_HWReleaseReset                       ABCC_INSTANCE_NAME( ABCC_HWReleaseReset )
+#define ABCC_HWReset                              ABCC_INSTANCE_NAME( ABCC_HWReset )
+#define ABCC_HandleSegmentAck                     ABCC_INSTANCE_NAME( ABCC_HandleSegmentAck )
+#define ABCC_HostAttrCommand                      ABCC_INSTANCE_NAME( ABCC_HostAttrCommand )
+#define ABCC_HostAttrFind                         ABCC_INSTANCE_NAME( ABCC_HostAttrFind )
+#define ABCC_HwInit                               ABCC_INSTANCE_NAME( ABCC_HwInit )
+#define ABCC_ISR                                  ABCC_INSTANCE_NAME( ABCC_ISR )
+#define ABCC_IsFirstCommandPending                ABCC_INSTANCE_NAME( ABCC_IsFirstCommandPending )
+#define ABCC_IsSupervised                         ABCC_INSTANCE_NAME( ABCC_IsSupervised )
+#define ABCC_LedStatus                            ABCC_INSTANCE_NAME( ABCC_LedStatus )
+#define ABCC_LinkCheckSendMessage                 ABCC_INSTANCE_NAME( ABCC_LinkCheckSendMessage )
+#define ABCC_LinkFree                             ABCC_INSTANCE_NAME( ABCC_LinkFree )
+#define ABCC_LinkGetFreeSrcId                     ABCC_INSTANCE_NAME( ABCC_LinkGetFreeSrcId )
+#define ABCC_LinkGetMsgHandler                    ABCC_INSTANCE_NAME( ABCC_LinkGetMsgHandler )
+#define ABCC_LinkGetNumCmdQueueEntries            ABCC_INSTANCE_NAME( ABCC_LinkGetNumCmdQueueEntries )
+#define ABCC_LinkInit                             ABCC_INSTANCE_NAME( ABCC_LinkInit )
+#define ABCC_LinkIsSrcIdUsed                      ABCC_INSTANCE_NAME( ABCC_LinkIsSrcIdUsed )
+#define ABCC_LinkMapMsgHandler                    ABCC_INSTANCE_NAME( ABCC_LinkMapMsgHandler )
+#define ABCC_LinkReadMessage                      ABCC_INSTANCE_NAME( ABCC_LinkReadMessage )
+#define ABCC_LinkRetireCmd                        ABCC_INSTANCE_NAME( ABCC_LinkRetireCmd )
+#define ABCC_LinkRunDriverRx                      ABCC_INSTANCE_NAME( ABCC_LinkRunDriverRx )
+#define ABCC_LinkWrMsgWithNotification            ABCC_INSTANCE_NAME( ABCC_LinkWrMsgWithNotification )
+#define ABCC_LinkWriteMessage                     ABCC_INSTANCE_NAME( ABCC_LinkWriteMessage )
+#define ABCC_LogData                              ABCC_INSTANCE_NAME( ABCC_LogData )
+#define ABCC_LogFlush                             ABCC_INSTANCE_NAME( ABCC_LogFlush )
+#define ABCC_LogGetLostCount                      ABCC_INSTANCE_NAME( ABCC_LogGetLostCount )
+#define ABCC_LogMsg                               ABCC_INSTANCE_NAME( ABCC_LogMsg )
+#define ABCC_LogPrintf                            ABCC_INSTANCE_NAME( ABCC_LogPrintf )
+#define ABCC_MemAlloc                             ABCC_INSTANCE_NAME( ABCC_MemAlloc )
+#define ABCC_MemAllocSize                         ABCC_INSTANCE_NAME( ABCC_MemAllocSize )
+#define ABCC_MemAllocRxMsg                        ABCC_INSTANCE_NAME( ABCC_MemAllocRxMsg )
+#define ABCC_MemCreatePool                        ABCC_INSTANCE_NAME( ABCC_MemCreatePool )
+#define ABCC_MemFree                              ABCC_INSTANCE_NAME( ABCC_MemFree )
+#define ABCC_MemGetBufferStatus                   ABCC_INSTANCE_NAME( ABCC_MemGetBufferStatus )
+#define ABCC_MemGetMaxDataSize                    ABCC_INSTANCE_NAME( ABCC_MemGetMaxDataSize )
+#define ABCC_MemSetBufferStatus                   ABCC_INSTANCE_NAME( ABCC_MemSetBufferStatus )
+#define ABCC_ModCap                               ABCC_INSTANCE_NAME( ABCC_ModCap )
+#define ABCC_ModuleDetect                         ABCC_INSTANCE_NAME( ABCC_ModuleDetect )
+#define ABCC_ModuleType                           ABCC_INSTANCE_NAME( ABCC_ModuleType )
+#define ABCC_NetFormatType                        ABCC_INSTANCE_NAME( ABCC_NetFormatType )
+#define ABCC_NetworkType                          ABCC_INSTANCE_NAME( ABCC_NetworkType )
+#define ABCC_ParISR                               ABCC_INSTANCE_NAME( ABCC_ParISR )
+#define ABCC_ParRunDriver                         ABCC_INSTANCE_NAME( ABCC_ParRunDriver )
+#define ABCC_ParameterSupport                     ABCC_INSTANCE_NAME( ABCC_ParameterSupport )
+#define ABCC_PdAcquireRead                        ABCC_INSTANCE_NAME( ABCC_PdAcquireRead )
+#define ABCC_PdAcquireWrite                       ABCC_INSTANCE_NAME( ABCC_PdAcquireWrite )
+#define ABCC_PdReleaseRead                        ABCC_INSTANCE_NAME( ABCC_PdReleaseRead )
+#define ABCC_PdReleaseWrite                       ABCC_INSTANCE_NAME( ABCC_PdReleaseWrite )
+#define ABCC_ReadModuleId                         ABCC_INSTANCE_NAME( ABCC_ReadModuleId )
+#define ABCC_RegisterObject                       ABCC_INSTANCE_NAME( ABCC_RegisterObject )
+#define ABCC_ReturnMsgBuffer                      ABCC_INSTANCE_NAME( ABCC_ReturnMsgBuffer )
+#define ABCC_RunDriver                            ABCC_INSTANCE_NAME( ABCC_RunDriver )
+#define ABCC_RunTimerSystem                       ABCC_INSTANCE_NAME( ABCC_RunTimerSystem )
+#define ABCC_RunTimerSystemUs                     ABCC_INSTANCE_NAME( ABCC_RunTimerSystemUs )
+#define ABCC_SegmentationExec                     ABCC_INSTANCE_NAME( ABCC_SegmentationExec )
+#define ABCC_SegmentationInit                     ABCC_INSTANCE_NAME( ABCC_SegmentationInit )
+#define ABCC_SendCmdMsg                           ABCC_INSTANCE_NAME( ABCC_SendCmdMsg )
+#define ABCC_SendRemapRespMsg                     ABCC_INSTANCE_NAME( ABCC_SendRemapRespMsg )
+#define ABCC_SendRespMsg                          ABCC_INSTANCE_NAME( ABCC_SendRespMsg )
+#define ABCC_SerISR                               ABCC_INSTANCE_NAME( ABCC_SerISR )
+#define ABCC_SerRunDriver                         ABCC_INSTANCE_NAME( ABCC_SerRunDriver )
+#define ABCC_SetAppStatus                         ABCC_INSTANCE_NAME( ABCC_SetAppStatus )
+#define ABCC_SetByteAttribute                     ABCC_INSTANCE_NAME( ABCC_SetByteAttribute )
+#define ABCC_SetData16                            ABCC_INSTANCE_NAME( ABCC_SetData16 )
+#define ABCC_SetData32                            ABCC_INSTANCE_NAME( ABCC_SetData32 )
+#define ABCC_SetData64                            ABCC_INSTANCE_NAME( ABCC_SetData64 )
+#define ABCC_SetData8                             ABCC_INSTANCE_NAME( ABCC_SetData8 )
+#define ABCC_SetMainStateError                    ABCC_INSTANCE_NAME( ABCC_SetMainStateError )
+#define ABCC_SetMsgHeader                         ABCC_INSTANCE_NAME( ABCC_SetMsgHeader )
+#define ABCC_SetPdSize                            ABCC_INSTANCE_NAME( ABCC_SetPdSize )
+#define ABCC_SetReadyForCommunication             ABCC_INSTANCE_NAME( ABCC_SetReadyForCommunication )
+#define ABCC_SetString                            ABCC_INSTANCE_NAME( ABCC_SetString )
+#define ABCC_SetupInit                            ABCC_INSTANCE_NAME( ABCC_SetupInit )
+#define ABCC_ShutdownDriver                       ABCC_INSTANCE_NAME( ABCC_ShutdownDriver )
+#define ABCC_SpiISR                               ABCC_INSTANCE_NAME( ABCC_SpiISR )
+#define ABCC_SpiRunDriver                         ABCC_INSTANCE_NAME( ABCC_SpiRunDriver )
+#define ABCC_StartDriver                          ABCC_INSTANCE_NAME( ABCC_StartDriver )
+#define ABCC_StartServerRespSegmentationSession   ABCC_INSTANCE_NAME( ABCC_StartServerRespSegmentationSession )
+#define ABCC_StartSetup                           ABCC_INSTANCE_NAME( ABCC_StartSetup )
+#define ABCC_StrCpyToNativeImpl                   ABCC_INSTANCE_NAME( ABCC_StrCpyToNativeImpl )
+#define ABCC_StrCpyToPackedImpl                   ABCC_INSTANCE_NAME( ABCC_StrCpyToPackedImpl )
+#define ABCC_TakeMsgBufferOwnership               ABCC_INSTANCE_NAME( ABCC_TakeMsgBufferOwnership )
+#define ABCC_TimerCreate                          ABCC_INSTANCE_NAME( ABCC_TimerCreate )
+#define ABCC_TimerDisable                         ABCC_INSTANCE_NAME( ABCC_TimerDisable )
+#define ABCC_TimerGetUptimeMs                     ABCC_INSTANCE_NAME( ABCC_TimerGetUptimeMs )
+#define ABCC_TimerInit                            ABCC_INSTANCE_NAME( ABCC_TimerInit )
+#define ABCC_TimerStart                           ABCC_INSTANCE_NAME( ABCC_TimerStart )
+#define ABCC_TimerStartUs                         ABCC_INSTANCE_NAME( ABCC_TimerStartUs )
+#define ABCC_TimerStop                            ABCC_INSTANCE_NAME( ABCC_TimerStop )
+#define ABCC_TimerTick                            ABCC_INSTANCE_NAME( ABCC_TimerTick )
+#define ABCC_TimerTickUs                          ABCC_INSTANCE_NAME( ABCC_TimerTickUs )
+#define ABCC_TraceEvent                           ABCC_INSTANCE_NAME( ABCC_TraceEvent )
+#define ABCC_TraceGetLostCount                    ABCC_INSTANCE_NAME( ABCC_TraceGetLostCount )
+#define ABCC_TraceInit                            ABCC_INSTANCE_NAME( ABCC_TraceInit )
+#define ABCC_TraceRead                            ABCC_INSTANCE_NAME( ABCC_TraceRead )
+#define ABCC_TriggerAnbStatusUpdate               ABCC_INSTANCE_NAME( ABCC_TriggerAnbStatusUpdate )
+#define ABCC_TriggerRdPdUpdate                    ABCC_INSTANCE_NAME( ABCC_TriggerRdPdUpdate )
+#define ABCC_TriggerReceiveMessage                ABCC_INSTANCE_NAME( ABCC_TriggerReceiveMessage )
+#define ABCC_TriggerTransmitMessage               ABCC_INSTANCE_NAME( ABCC_TriggerTransmitMessage )
+#define ABCC_TriggerWrPdUpdate                    ABCC_INSTANCE_NAME( ABCC_TriggerWrPdUpdate )
+#define ABCC_UnregisterObject                     ABCC_INSTANCE_NAME( ABCC_UnregisterObject )
+#define ABCC_UserInitComplete                     ABCC_INSTANCE_NAME( ABCC_UserInitComplete )
+#define ABCC_VerifyMessage                        ABCC_INSTANCE_NAME( ABCC_VerifyMessage )
+#define ABCC_WaitForFwUpdate                      ABCC_INSTANCE_NAME( ABCC_WaitForFwUpdate )
+#define ABCC_iInterruptEnableMask                 ABCC_INSTANCE_NAME( ABCC_iInterruptEnableMask )
+#define ABCC_isReadyForCommunication              ABCC_INSTANCE_NAME( ABCC_isReadyForCommunication )
+#define ABCC_sContext                             ABCC_INSTANCE_NAME( ABCC_sContext )
+#define AD_AdiMappingReq                          ABCC_INSTANCE_NAME( AD_AdiMappingReq )
+#define AD_CopyPresentPdToExtBuffer               ABCC_INSTANCE_NAME( AD_CopyPresentPdToExtBuffer )
+#define AD_GetAdiInstEntry                        ABCC_INSTANCE_NAME( AD_GetAdiInstEntry )
+#define AD_GetAdiValue                            ABCC_INSTANCE_NAME( AD_GetAdiValue )
+#define AD_GetMapSizeOctets                       ABCC_INSTANCE_NAME( AD_GetMapSizeOctets )
+#define AD_GetNumAdisInMap                        ABCC_INSTANCE_NAME( AD_GetNumAdisInMap )
+#define AD_GetPresentPdSizeInOctets               ABCC_INSTANCE_NAME( AD_GetPresentPdSizeInOctets )
+#define AD_Init                                   ABCC_INSTANCE_NAME( AD_Init )
+#define AD_MarkAdiDirty                           ABCC_INSTANCE_NAME( AD_MarkAdiDirty )
+#define AD_MarkAllAdisDirty                       ABCC_INSTANCE_NAME( AD_MarkAllAdisDirty )
+#define AD_ProcObjectRequest                      ABCC_INSTANCE_NAME( AD_ProcObjectRequest )
+#define AD_RemapDone                              ABCC_INSTANCE_NAME( AD_RemapDone )
+#define AD_UpdatePdReadData                       ABCC_INSTANCE_NAME( AD_UpdatePdReadData )
+#define AD_UpdatePdWriteData                      ABCC_INSTANCE_NAME( AD_UpdatePdWriteData )
+#define AD_WriteBufferFromPdMap                   ABCC_INSTANCE_NAME( AD_WriteBufferFromPdMap )
+#define AD_WritePdMapFromBuffer                   ABCC_INSTANCE_NAME( AD_WritePdMapFromBuffer )
+#define ANB_FSI_Create                            ABCC_INSTANCE_NAME( ANB_FSI_Create )
+#define ANB_FSI_Delete                            ABCC_INSTANCE_NAME( ANB_FSI_Delete )
+#define ANB_FSI_DirectoryChange                   ABCC_INSTANCE_NAME( ANB_FSI_DirectoryChange )
+#define ANB_FSI_DirectoryClose                    ABCC_INSTANCE_NAME( ANB_FSI_DirectoryClose )
+#define ANB_FSI_DirectoryCreate                   ABCC_INSTANCE_NAME( ANB_FSI_DirectoryCreate )
+#define ANB_FSI_DirectoryDelete                   ABCC_INSTANCE_NAME( ANB_FSI_DirectoryDelete )
+#define ANB_FSI_DirectoryOpen                     ABCC_INSTANCE_NAME( ANB_FSI_DirectoryOpen )
+#define ANB_FSI_DirectoryRead                     ABCC_INSTANCE_NAME( ANB_FSI_DirectoryRead )
+#define ANB_FSI_FileClose                         ABCC_INSTANCE_NAME( ANB_FSI_FileClose )
+#define ANB_FSI_FileCopy                          ABCC_INSTANCE_NAME( ANB_FSI_FileCopy )
+#define ANB_FSI_FileDelete                        ABCC_INSTANCE_NAME( ANB_FSI_FileDelete )
+#define ANB_FSI_FileOpen                          ABCC_INSTANCE_NAME( ANB_FSI_FileOpen )
+#define ANB_FSI_FileRead                          ABCC_INSTANCE_NAME( ANB_FSI_FileRead )
+#define ANB_FSI_FileRename                        ABCC_INSTANCE_NAME( ANB_FSI_FileRename )
+#define ANB_FSI_FileWrite                         ABCC_INSTANCE_NAME( ANB_FSI_FileWrite )
+#define ANB_FSI_Init                              ABCC_INSTANCE_NAME( ANB_FSI_Init )
+#define APPL_HandleAbcc                           ABCC_INSTANCE_NAME( APPL_HandleAbcc )
+#define APPL_Reset                                ABCC_INSTANCE_NAME( APPL_Reset )
+#define APPL_RestartAbcc                          ABCC_INSTANCE_NAME( APPL_RestartAbcc )
+#define APPL_SelectFirmware                       ABCC_INSTANCE_NAME( APPL_SelectFirmware )
+#define APPL_SetAddress                           ABCC_INSTANCE_NAME( APPL_SetAddress )
+#define APPL_SetBaudrate                          ABCC_INSTANCE_NAME( APPL_SetBaudrate )
+#define APPL_SetCommSettings                      ABCC_INSTANCE_NAME( APPL_SetCommSettings )
+#define APPL_Shutdown                             ABCC_INSTANCE_NAME( APPL_Shutdown )
+#define APPL_UnexpectedError                      ABCC_INSTANCE_NAME( APPL_UnexpectedError )
+#define APP_GetCandidateFwAvailable               ABCC_INSTANCE_NAME( APP_GetCandidateFwAvailable )
+#define APP_GetDataNotifValuePtr                  ABCC_INSTANCE_NAME( APP_GetDataNotifValuePtr )
+#define APP_HwConfAddress                         ABCC_INSTANCE_NAME( APP_HwConfAddress )
+#define APP_PrepareDataNotifAsmInst               ABCC_INSTANCE_NAME( APP_PrepareDataNotifAsmInst )
+#define APP_PrepareDataNotifSingleAdi             ABCC_INSTANCE_NAME( APP_PrepareDataNotifSingleAdi )
+#define APP_PrepareDataNotifTransparent           ABCC_INSTANCE_NAME( APP_PrepareDataNotifTransparent )
+#define APP_ProcResetRequest                      ABCC_INSTANCE_NAME( APP_ProcResetRequest )
+#define APP_ProcessCmdMsg                         ABCC_INSTANCE_NAME( APP_ProcessCmdMsg )
+#define APP_SendDataNotification                  ABCC_INSTANCE_NAME( APP_SendDataNotification )
+#define ASM_GetData                               ABCC_INSTANCE_NAME( ASM_GetData )
+#define ASM_Init                                  ABCC_INSTANCE_NAME( ASM_Init )
+#define ASM_ProcessCmdMsg                         ABCC_INSTANCE_NAME( ASM_ProcessCmdMsg )
+#define BAC_Init                                  ABCC_INSTANCE_NAME( BAC_Init )
+#define BAC_ProcessCmdMsg                         ABCC_INSTANCE_NAME( BAC_ProcessCmdMsg )
+#define CCL_ProcessCmdMsg                         ABCC_INSTANCE_NAME( CCL_ProcessCmdMsg )
+#define CFN_ProcessCmdMsg                         ABCC_INSTANCE_NAME( CFN_ProcessCmdMsg )
+#define CIET_ProcessCmdMsg                        ABCC_INSTANCE_NAME( CIET_ProcessCmdMsg )
+#define COP_ProcessCmdMsg                         ABCC_INSTANCE_NAME( COP_ProcessCmdMsg )
+#define CRC_Crc16                                 ABCC_INSTANCE_NAME( CRC_Crc16 )
+#define CRC_Crc16Finish                           ABCC_INSTANCE_NAME( CRC_Crc16Finish )
+#define CRC_Crc16Start                            ABCC_INSTANCE_NAME( CRC_Crc16Start )
+#define CRC_Crc16Update                           ABCC_INSTANCE_NAME( CRC_Crc16Update )
+#define CRC_Crc32                                 ABCC_INSTANCE_NAME( CRC_Crc32 )
+#define CRC_Crc32Finish                           ABCC_INSTANCE_NAME( CRC_Crc32Finish )
+#define CRC_Crc32Start                            ABCC_INSTANCE_NAME( CRC_Crc32Start )
+#define CRC_Crc32Update                           ABCC_INSTANCE_NAME( CRC_Crc32Update )
+#define DEBUG_iCrcErrorCnt                        ABCC_INSTANCE_NAME( DEBUG_iCrcErrorCnt )
+#define DEV_ProcessCmdMsg                         ABCC_INSTANCE_NAME( DEV_ProcessCmdMsg )
+#define DPV1_ProcessCmdMsg                        ABCC_INSTANCE_NAME( DPV1_ProcessCmdMsg )
+#define ECT_GetActualEctState                     ABCC_INSTANCE_NAME( ECT_GetActualEctState )
+#define ECT_Init                                  ABCC_INSTANCE_NAME( ECT_Init )
+#define ECT_ProcessCmdMsg                         ABCC_INSTANCE_NAME( ECT_ProcessCmdMsg )
+#define EIP_ProcessCmdMsg                         ABCC_INSTANCE_NAME( EIP_ProcessCmdMsg )
+#define EPL_ProcessCmdMsg                         ABCC_INSTANCE_NAME( EPL_ProcessCmdMsg )
+#define ETN_GetIpConfig                           ABCC_INSTANCE_NAME( ETN_GetIpConfig )
+#define ETN_GetNwStatus                           ABCC_INSTANCE_NAME( ETN_GetNwStatus )
+#define ETN_ProcessCmdMsg                         ABCC_INSTANCE_NAME( ETN_ProcessCmdMsg )
+#define GetDefaultProperties                      ABCC_INSTANCE_NAME( GetDefaultProperties )
+#define MOD_ProcessCmdMsg                         ABCC_INSTANCE_NAME( MOD_ProcessCmdMsg )
+#define MQTT_ProcessCmdMsg                        ABCC_INSTANCE_NAME( MQTT_ProcessCmdMsg )
+#define OPCUA_GetServerStatus                     ABCC_INSTANCE_NAME( OPCUA_GetServerStatus )
+#define OPCUA_ProcessCmdMsg                       ABCC_INSTANCE_NAME( OPCUA_ProcessCmdMsg )
+#define PRT_ProcessCmdMsg                         ABCC_INSTANCE_NAME( PRT_ProcessCmdMsg )
+#define SAFE_ProcessCmdMsg                        ABCC_INSTANCE_NAME( SAFE_ProcessCmdMsg )
+#define SAFE_SetSafetyEnable                      ABCC_INSTANCE_NAME( SAFE_SetSafetyEnable )
+#define SYNC_GetCycleTime                         ABCC_INSTANCE_NAME( SYNC_GetCycleTime )
+#define SYNC_GetInputCaptureTime                  ABCC_INSTANCE_NAME( SYNC_GetInputCaptureTime )
+#define SYNC_GetMode                              ABCC_INSTANCE_NAME( SYNC_GetMode )
+#define SYNC_GetOutputValidTime                   ABCC_INSTANCE_NAME( SYNC_GetOutputValidTime )
+#define SYNC_ProcessCmdMsg                        ABCC_INSTANCE_NAME( SYNC_ProcessCmdMsg )
+#define SYNC_SetInputProcessingTime               ABCC_INSTANCE_NAME( SYNC_SetInputProcessingTime )
+#define SYNC_SetMinCycleTime                      ABCC_INSTANCE_NAME( SYNC_SetMinCycleTime )
+#define SYNC_SetOutputProcessingTime              ABCC_INSTANCE_NAME( SYNC_SetOutputProcessingTime )
+#define abCrc16Hi                                 ABCC_INSTANCE_NAME( abCrc16Hi )
+#define abCrc16Lo                                 ABCC_INSTANCE_NAME( abCrc16Lo )
+#define aiBitReverseTable16                       ABCC_INSTANCE_NAME( aiBitReverseTable16 )
+#define crc_table32                               ABCC_INSTANCE_NAME( crc_table32 )
+#define fAbccUserSyncMeasurementIp                ABCC_INSTANCE_NAME( fAbccUserSyncMeasurementIp )
+#define pnABCC_DrvCbfReadRemapDone                ABCC_INSTANCE_NAME( pnABCC_DrvCbfReadRemapDone )
+#define pnABCC_DrvGetAnbStatus                    ABCC_INSTANCE_NAME( pnABCC_DrvGetAnbStatus )
+#define pnABCC_DrvGetAnybusState                  ABCC_INSTANCE_NAME( pnABCC_DrvGetAnybusState )
+#define pnABCC_DrvGetIntStatus                    ABCC_INSTANCE_NAME( pnABCC_DrvGetIntStatus )
+#define pnABCC_DrvGetLedStatus                    ABCC_INSTANCE_NAME( pnABCC_DrvGetLedStatus )
+#define pnABCC_DrvGetModCap                       ABCC_INSTANCE_NAME( pnABCC_DrvGetModCap )
+#define pnABCC_DrvGetWrPdBuffer                   ABCC_INSTANCE_NAME( pnABCC_DrvGetWrPdBuffer )
+#define pnABCC_DrvISR                             ABCC_INSTANCE_NAME( pnABCC_DrvISR )
+#define pnABCC_DrvISReadyForCmd                   ABCC_INSTANCE_NAME( pnABCC_DrvISReadyForCmd )
+#define pnABCC_DrvISReadyForWrPd                  ABCC_INSTANCE_NAME( pnABCC_DrvISReadyForWrPd )
+#define pnABCC_DrvISReadyForWriteMessage          ABCC_INSTANCE_NAME( pnABCC_DrvISReadyForWriteMessage )
+#define pnABCC_DrvInit                            ABCC_INSTANCE_NAME( pnABCC_DrvInit )
+#define pnABCC_DrvIsSupervised                    ABCC_INSTANCE_NAME( pnABCC_DrvIsSupervised )
+#define pnABCC_DrvPrepareWriteMessage             ABCC_INSTANCE_NAME( pnABCC_DrvPrepareWriteMessage )
+#define pnABCC_DrvReadMessage                     ABCC_INSTANCE_NAME( pnABCC_DrvReadMessage )
+#define pnABCC_DrvReadProcessData                 ABCC_INSTANCE_NAME( pnABCC_DrvReadProcessData )
+#define pnABCC_DrvRunDriverRx                     ABCC_INSTANCE_NAME( pnABCC_DrvRunDriverRx )
+#define pnABCC_DrvRunDriverTx                     ABCC_INSTANCE_NAME( pnABCC_DrvRunDriverTx )
+#define pnABCC_DrvSetAppStatus                    ABCC_INSTANCE_NAME( pnABCC_DrvSetAppStatus )
+#define pnABCC_DrvSetIntMask                      ABCC_INSTANCE_NAME( pnABCC_DrvSetIntMask )
+#define pnABCC_DrvSetNbrOfCmds                    ABCC_INSTANCE_NAME( pnABCC_DrvSetNbrOfCmds )
+#define pnABCC_DrvSetPdSize                       ABCC_INSTANCE_NAME( pnABCC_DrvSetPdSize )
+#define pnABCC_DrvWriteMessage                    ABCC_INSTANCE_NAME( pnABCC_DrvWriteMessage )
+#define pnABCC_DrvWriteProcessData                ABCC_INSTANCE_NAME( pnABCC_DrvWriteProcessData )
+
+/*------------------------------------------------------------------------------
+** Hardware abstraction functions provided by the application. Each instance
+** has its own implementation, typically accessing its own SPI bus, UART or
+** parallel interface.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_SYS_AbccInterruptDisable             ABCC_INSTANCE_NAME( ABCC_SYS_AbccInterruptDisable )
+#define ABCC_SYS_AbccInterruptEnable              ABCC_INSTANCE_NAME( ABCC_SYS_AbccInterruptEnable )
+#define ABCC_SYS_Close                            ABCC_INSTANCE_NAME( ABCC_SYS_Close )
+#define ABCC_SYS_GetOpmode                        ABCC_INSTANCE_NAME( ABCC_SYS_GetOpmode )
+#define ABCC_SYS_GpioReset                        ABCC_INSTANCE_NAME( ABCC_SYS_GpioReset )
+#define ABCC_SYS_GpioSet                          ABCC_INSTANCE_NAME( ABCC_SYS_GpioSet )
+#define ABCC_SYS_HWReleaseReset                   ABCC_INSTANCE_NAME( ABCC_SYS_HWReleaseReset )
+#define ABCC_SYS_HWReset                          ABCC_INSTANCE_NAME( ABCC_SYS_HWReset )
+#define ABCC_SYS_HwInit                           ABCC_INSTANCE_NAME( ABCC_SYS_HwInit )
+#define ABCC_SYS_Init                             ABCC_INSTANCE_NAME( ABCC_SYS_Init )
+#define ABCC_SYS_IsAbccInterruptActive            ABCC_INSTANCE_NAME( ABCC_SYS_IsAbccInterruptActive )
+#define ABCC_SYS_ModuleDetect                     ABCC_INSTANCE_NAME( ABCC_SYS_ModuleDetect )
+#define ABCC_SYS_ParallelGetRdPdBuffer            ABCC_INSTANCE_NAME( ABCC_SYS_ParallelGetRdPdBuffer )
+#define ABCC_SYS_ParallelGetWrPdBuffer            ABCC_INSTANCE_NAME( ABCC_SYS_ParallelGetWrPdBuffer )
+#define ABCC_SYS_ParallelRead                     ABCC_INSTANCE_NAME( ABCC_SYS_ParallelRead )
+#define ABCC_SYS_ParallelRead16                   ABCC_INSTANCE_NAME( ABCC_SYS_ParallelRead16 )
+#define ABCC_SYS_ParallelWrite                    ABCC_INSTANCE_NAME( ABCC_SYS_ParallelWrite )
+#define ABCC_SYS_ParallelWrite16                  ABCC_INSTANCE_NAME( ABCC_SYS_ParallelWrite16 )
+#define ABCC_SYS_ReadModuleId                     ABCC_INSTANCE_NAME( ABCC_SYS_ReadModuleId )
+#define ABCC_SYS_SerRegDataReceived               ABCC_INSTANCE_NAME( ABCC_SYS_SerRegDataReceived )
+#define ABCC_SYS_SerRegPartialDataReceived        ABCC_INSTANCE_NAME( ABCC_SYS_SerRegPartialDataReceived )
+#define ABCC_SYS_SerRestart                       ABCC_INSTANCE_NAME( ABCC_SYS_SerRestart )
+#define ABCC_SYS_SerSendReceive                   ABCC_INSTANCE_NAME( ABCC_SYS_SerSendReceive )
+#define ABCC_SYS_SetOpmode                        ABCC_INSTANCE_NAME( ABCC_SYS_SetOpmode )
+#define ABCC_SYS_SpiRegDataReceived               ABCC_INSTANCE_NAME( ABCC_SYS_SpiRegDataReceived )
+#define ABCC_SYS_SpiSendReceive                   ABCC_INSTANCE_NAME( ABCC_SYS_SpiSendReceive )
+#define ABCC_SYS_SpiSendReceiveVec                ABCC_INSTANCE_NAME( ABCC_SYS_SpiSendReceiveVec )
+#define ABCC_SYS_SyncInterruptDisable             ABCC_INSTANCE_NAME( ABCC_SYS_SyncInterruptDisable )
+#define ABCC_SYS_SyncInterruptEnable              ABCC_INSTANCE_NAME( ABCC_SYS_SyncInterruptEnable )
+
+/*------------------------------------------------------------------------------
+** Callbacks and data provided by the application.
+**------------------------------------------------------------------------------
+*/
+#define APPL_CyclicalProcessing                   ABCC_INSTANCE_NAME( APPL_CyclicalProcessing )
+#define APPL_GetAsmInstances                      ABCC_INSTANCE_NAME( APPL_GetAsmInstances )
+#define APPL_GetNumAdi                            ABCC_INSTANCE_NAME( APPL_GetNumAdi )
+#define APPL_GetNumAsmInstances                   ABCC_INSTANCE_NAME( APPL_GetNumAsmInstances )
+#define APPL_Init                                 ABCC_INSTANCE_NAME( APPL_Init )
+#define APPL_SyncIsr                              ABCC_INSTANCE_NAME( APPL_SyncIsr )
+#define APPL_asAdObjDefaultMap                    ABCC_INSTANCE_NAME( APPL_asAdObjDefaultMap )
+#define APPL_asAdiEntryList                       ABCC_INSTANCE_NAME( APPL_asAdiEntryList )
+#define APP_OnDataNotificationReqCfn              ABCC_INSTANCE_NAME( APP_OnDataNotificationReqCfn )
+#define BAC_asObjectList                          ABCC_INSTANCE_NAME( BAC_asObjectList )
+#define DEV_aiConsInstNumList                     ABCC_INSTANCE_NAME( DEV_aiConsInstNumList )
+#define DEV_aiProdInstNumList                     ABCC_INSTANCE_NAME( DEV_aiProdInstNumList )
+#define DEV_iConsInstNumListSize                  ABCC_INSTANCE_NAME( DEV_iConsInstNumListSize )
+#define DEV_iProdInstNumListSize                  ABCC_INSTANCE_NAME( DEV_iProdInstNumListSize )
+#define ETN_SetAttrSuccessCallback                ABCC_INSTANCE_NAME( ETN_SetAttrSuccessCallback )
+#define MQTT_GetPublishConfigurationCfn           ABCC_INSTANCE_NAME( MQTT_GetPublishConfigurationCfn )
+#define OPCUA_CbfGetApplModelFilenameList         ABCC_INSTANCE_NAME( OPCUA_CbfGetApplModelFilenameList )
+#define OPCUA_CbfGetApplModelFilenameListNum      ABCC_INSTANCE_NAME( OPCUA_CbfGetApplModelFilenameListNum )
+#define OPCUA_CbfGetApplModelList                 ABCC_INSTANCE_NAME( OPCUA_CbfGetApplModelList )
+#define OPCUA_CbfGetApplModelListNum              ABCC_INSTANCE_NAME( OPCUA_CbfGetApplModelListNum )
+#define OPCUA_CbfGetApplModelNamespaceList        ABCC_INSTANCE_NAME( OPCUA_CbfGetApplModelNamespaceList )
+#define OPCUA_CbfGetApplModelNamespaceListNum     ABCC_INSTANCE_NAME( OPCUA_CbfGetApplModelNamespaceListNum )
+
+#endif  /* ABCC_CFG_INSTANCE_PREFIX */
+
+#endif  /* inclusion lock */
@@ -440,6 +440,37 @@
    #define BAC_IA_SUPPORT_ADV_MAPPING_VALUE        FALSE
 #endif
 
+/*
+** Advanced mapping lookup index.
+**
+** Number of slots in each of the two hash tables built by BAC_Init(), one on
+** BACnet object type and instance and one on ADI name. Lookups then take
+** constant time instead of a scan of the object list. Must be a power of two,
+** and the load factor is kept at or below 3/4, so the size should be at least
+** 4/3 of the number of ADIs. If 0, or if the ADIs do not fit, the object list
+** is scanned for each request.
+** The BACnet object of an ADI is found with ABCC_AdiIndexFind(), see
+** ABCC_CFG_ADI_INDEX_SIZE.
+** Only allocated when advanced mapping is supported. The default (512 octets
+** of RAM) indexes up to 96 ADIs.
+*/
+#ifndef BAC_ADV_MAPPING_INDEX_SIZE
+   #define BAC_ADV_MAPPING_INDEX_SIZE              ( 128 )
+#endif
+
+/*
+** Advanced mapping object instance bitmaps.
+**
+** Number of BACnet object types for which BAC_Init() builds the
+** Get_All_BACnet_Object_Instances response (255 bytes each). Other types are
+** answered by a scan of the object list. If 0, all requests scan the list.
+** Only allocated when advanced mapping is supported. The default covers the
+** analog, binary and multi-state value objects ADIs are mapped to.
+*/
+#ifndef BAC_ADV_MAPPING_BITMAP_TYPES
+   #define BAC_ADV_MAPPING_BITMAP_TYPES            ( 3 )
+#endif
+
 /*
 ** Attribute 8: Current Date and Time
 **
@@ -566,6 +597,21 @@
    #define ECT_IA_ENUM_ADIS_ENABLE                 0
 #endif
 
+/*
+** ENUM ADI list size.
+**
+** Number of UINT16 entries reserved for the ENUM ADI list (attribute 9). The
+** list is built by ECT_Init() and each request is then answered with one copy
+** instead of a scan of the ADI list. A list that does not fit in one message
+** is sent as a segmented response. If 0, or if there are more ENUM ADIs than
+** this, the ADI list is scanned for each request. A list that does not fit in
+** one message is then sent as a segmented response that reads the ADI list
+** one block at a time, so the number of ENUM ADIs is not limited.
+*/
+#ifndef ECT_IA_ENUM_ADIS_LIST_SIZE
+   #define ECT_IA_ENUM_ADIS_LIST_SIZE              ( 0 )
+#endif
+
 /*
 ** Attribute 11: Write PD assembly instance translation
 ** (Array of UINT16 - {0x1A00-0x1BFF})
@@ -588,6 +634,9 @@
 
 /*
 ** Attribute 13: ADI translation (Array of (Struct of {UINT16, UINT16}))
+**
+** Serialized to message format by ECT_Init(). A table that does not fit in one
+** message is sent as a segmented response.
 */
 #ifndef ECT_IA_ADI_TRANS_ENABLE
    #define ECT_IA_ADI_TRANS_ENABLE                 0
@@ -598,6 +647,9 @@
 /*
 ** Attribute 15: Object subindex translation
 ** (Array of (Struct of {UINT16, UINT16, UINT8 }))
+**
+** Serialized to message format by ECT_Init(). A table that does not fit in one
+** message is sent as a segmented response.
 */
 #ifndef ECT_IA_OBJ_SUB_TRANS_ENABLE
    #define ECT_IA_OBJ_SUB_TRANS_ENABLE             0
@@ -1416,6 +1468,112 @@
    #define AD_MAX_NUM_READ_MAP_ENTRIES              ( 64 )
 #endif
 
+/*
+** Precompiled process data copy plan.
+**
+** When enabled the read and write process data maps are compiled into a flat
+** list of copy operations when the AD object is initialised and each time a
+** remap is finished. AD_UpdatePdReadData() and AD_UpdatePdWriteData() then
+** only execute that list instead of walking the map and resolving the data
+** type, endian swap and structure layout of each mapped ADI every cycle.
+** Octet copies of ADIs that are adjacent both in the process data and in
+** memory are merged into a single copy.
+**
+** AD_MAX_NUM_READ_COPY_OPS and AD_MAX_NUM_WRITE_COPY_OPS set the number of
+** operations that can be held by each plan. Each mapped ADI requires at most
+** one operation (structured ADIs one per mapped element, plus one per ADI if
+** a get/set callback is registered). If a map does not fit the driver falls
+** back to the map walk for that direction.
+**
+** Each operation takes 12-24 octets of RAM depending on pointer size and the
+** enabled features, about 1.5-3 kB with the default number of map entries.
+** Enabled by default. Disable it, or lower the number of operations, when RAM
+** matters more than the per cycle CPU time. The bench target of the host
+** tests (test/) compares the two (variant copy_plan_off).
+*/
+#ifndef AD_PD_COPY_PLAN_ENABLE
+   #define AD_PD_COPY_PLAN_ENABLE                   1
+#endif
+#ifndef AD_MAX_NUM_WRITE_COPY_OPS
+   #define AD_MAX_NUM_WRITE_COPY_OPS                ( AD_MAX_NUM_WRITE_MAP_ENTRIES )
+#endif
+#ifndef AD_MAX_NUM_READ_COPY_OPS
+   #define AD_MAX_NUM_READ_COPY_OPS                 ( AD_MAX_NUM_READ_MAP_ENTRIES )
+#endif
+
+/*
+** Write process data change tracking.
+**
+** When enabled AD_UpdatePdWriteData() only copies the mapped ADIs that the
+** application has marked as changed with AD_MarkAdiDirty() since the last
+** update. If nothing has changed the buffer is left untouched and FALSE is
+** returned, which makes the driver skip the write process data transfer.
+**
+** The application must call AD_MarkAdiDirty() each time it changes the value
+** of a write mapped ADI, or AD_MarkAllAdisDirty() to force a full update.
+** ADIs set by an explicit request from the network are marked automatically.
+** ADIs with a get callback (pnGetAdiValue) are copied in every update.
+**
+** Copy plan operations (AD_PD_COPY_PLAN_ENABLE) are not merged across write
+** map entries then, so unchanged entries are left untouched by the update.
+**
+** The partial update relies on the write process data buffer keeping its
+** content between updates. All mapped ADIs are copied after each (re)mapping
+** and each time a different buffer is passed to AD_UpdatePdWriteData().
+*/
+#ifndef AD_WRPD_DIRTY_TRACKING_ENABLE
+   #define AD_WRPD_DIRTY_TRACKING_ENABLE            0
+#endif
+
+/*
+** Ordinal ADI lists.
+**
+** Number of UINT16 entries reserved for the ADI lists returned by the
+** Get_Instance_Numbers command (all ADIs, read PD mappable, write PD mappable
+** and NVS parameters). The lists are built by AD_Init() and each request is
+** then answered with one copy instead of a scan of the ADI list. All four
+** lists must fit, which requires at most 4 entries per ADI. Must not exceed
+** 32767. If 0, or if the lists do not fit, the ADI list is scanned for each
+** request.
+** The number of ADIs in each list (attributes 11-13 of the object) is always
+** counted once by AD_Init().
+** The default (512 octets of RAM) holds the lists of at least 64 ADIs, and of
+** 128 ADIs if each ADI is in at most one of the other three lists.
+*/
+#ifndef AD_ORDINAL_LIST_SIZE
+   #define AD_ORDINAL_LIST_SIZE                     ( 256 )
+#endif
+
+/*
+** Segmented ADI values.
+**
+** When enabled, Get_Attribute of the value of an ADI that does not fit in one
+** message is answered with a segmented response. Non-structured ADIs that need
+** no conversion are sent straight from the ADI storage. Structures, bit types
+** and endian swapped values are converted AD_SEG_GET_BLOCK_SIZE octets at a
+** time, each element (or structure member) must fit in one block. The value is
+** read from the ADI storage as the segments are sent.
+**
+** AD_SEG_SET_BUFFER_SIZE is the size in octets of the buffer that segmented
+** Set_Attribute requests of the value are collected in. The ADI is set when
+** the last segment is received, ADIs larger than the buffer are rejected. If
+** 0, segmented Set_Attribute requests are not supported.
+**
+** If disabled, a value larger than one message is rejected with
+** ABP_ERR_MSG_CHANNEL_TOO_SMALL.
+*/
+#ifndef AD_SEG_VALUE_ENABLE
+   #define AD_SEG_VALUE_ENABLE                      0
+#endif
+
+#ifndef AD_SEG_GET_BLOCK_SIZE
+   #define AD_SEG_GET_BLOCK_SIZE                    ( 32 )
+#endif
+
+#ifndef AD_SEG_SET_BUFFER_SIZE
+   #define AD_SEG_SET_BUFFER_SIZE                   ( 0 )
+#endif
+
 /*
 ** Attributes 5, 6, 7: Min, max and default attributes
 **
@@ -17,6 +17,7 @@
 
 #include "abcc_software_port.h"
 #include "abcc_config.h"
+#include "abcc_types.h"
 
 #ifndef ABCC_PORT_H_
 #define ABCC_PORT_H_
@@ -235,6 +236,150 @@
 #define ABCC_PORT_TIMER_ExitCritical() ABCC_PORT_ExitCritical()
 #endif
 
+/*------------------------------------------------------------------------------
+** Full memory barrier.
+**
+** Define ABCC_PORT_MemoryBarrier in abcc_software_port.h to override default
+** implementation.
+**
+** Only required if ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED is enabled. Memory
+** accesses before the barrier must be completed and visible to other contexts
+** before any memory access after the barrier. The default implementation uses
+** C11 atomics if available. On a single core MCU where the only concurrency is
+** interrupts, a compiler barrier is enough.
+** The trace ring (ABCC_CFG_TRACE_ENABLED) also uses the barrier if it is
+** available. It is then safe to read the trace from another CPU core.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+#if ( ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED || ABCC_CFG_TRACE_ENABLED )
+#ifndef ABCC_PORT_MemoryBarrier
+#if defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112L ) && !defined( __STDC_NO_ATOMICS__ )
+#include <stdatomic.h>
+#define ABCC_PORT_MemoryBarrier() atomic_thread_fence( memory_order_seq_cst )
+#elif ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED
+#error "ABCC_PORT_MemoryBarrier must be ported if ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED\
+ is enabled and C11 atomics are not available."
+#endif
+#endif
+#endif
+
+/*------------------------------------------------------------------------------
+** Atomically write an 8 bit value and return the previous value.
+**
+** Define ABCC_PORT_AtomicExchange8 in abcc_software_port.h to override default
+** implementation.
+**
+** Only used if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED or
+** ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED is enabled. The default implementation
+** uses C11 atomics if available. If not defined at all the triple buffer makes
+** the exchange in a short critical section instead, while the deferred log
+** requires it to be ported.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pbTarget       - Pointer to the ( volatile UINT8 ) value to exchange.
+**    bValue         - New value.
+**
+** Returns:
+**    UINT8          - Previous value.
+**------------------------------------------------------------------------------
+*/
+#if ( ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED || ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED )
+#ifndef ABCC_PORT_AtomicExchange8
+#if defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112L ) && !defined( __STDC_NO_ATOMICS__ )
+#include <stdatomic.h>
+#define ABCC_PORT_AtomicExchange8( pbTarget, bValue ) \
+   (UINT8)atomic_exchange( (volatile atomic_uchar*)( pbTarget ), ( bValue ) )
+#endif
+#endif
+#endif
+
+/*------------------------------------------------------------------------------
+** Atomically increment a 16 bit value and return the previous value.
+**
+** Define ABCC_PORT_AtomicIncrement16 in abcc_software_port.h to override
+** default implementation.
+**
+** Only used if ABCC_CFG_TRACE_ENABLED or ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+** is enabled. The default implementation uses C11 atomics if available. If not
+** defined at all the trace makes the increment in a short critical section
+** instead, while the deferred log requires it to be ported.
+**------------------------------------------------------------------------------
+** Arguments:
+**    piTarget       - Pointer to the ( volatile UINT16 ) value to increment.
+**
+** Returns:
+**    UINT16         - Previous value.
+**------------------------------------------------------------------------------
+*/
+#if ( ABCC_CFG_TRACE_ENABLED || ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED )
+#ifndef ABCC_PORT_AtomicIncrement16
+#if defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112L ) && !defined( __STDC_NO_ATOMICS__ )
+#include <stdatomic.h>
+#define ABCC_PORT_AtomicIncrement16( piTarget ) \
+   (UINT16)atomic_fetch_add( (volatile atomic_ushort*)( piTarget ), 1 )
+#endif
+#endif
+#endif
+
+/*------------------------------------------------------------------------------
+** Atomically replace a 32 bit value if it still holds an expected value.
+**
+** Define ABCC_PORT_AtomicCompareExchange32 in abcc_software_port.h to override
+** default implementation.
+**
+** Used by the message buffer pool to pop and push free buffers without
+** disabling interrupts. The default implementation uses C11 atomics if
+** available. If not defined at all the pool makes the compare and exchange in
+** a short critical section instead.
+**------------------------------------------------------------------------------
+** Arguments:
+**    plTarget       - Pointer to the ( volatile UINT32 ) value to exchange.
+**    plExpected     - Pointer to the expected value. Updated with the current
+**                     value if it did not match.
+**    lDesired       - New value.
+**
+** Returns:
+**    BOOL           - TRUE if the value matched and was replaced.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_PORT_AtomicCompareExchange32
+#if defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112L ) && !defined( __STDC_NO_ATOMICS__ )
+#include <stdatomic.h>
+#define ABCC_PORT_AtomicCompareExchange32( plTarget, plExpected, lDesired ) \
+   (BOOL)atomic_compare_exchange_weak( (volatile _Atomic( UINT32 )*)( plTarget ), \
+                                       ( plExpected ), ( lDesired ) )
+#endif
+#endif
+
+/*------------------------------------------------------------------------------
+** Read a free running timestamp counter, e.g. a CPU cycle counter or a
+** hardware timer. The unit is up to the port. Stage durations are calculated
+** as unsigned differences, so the counter should wrap around at 2^32.
+**
+** Must be defined in abcc_software_port.h if ABCC_CFG_TRACE_ENABLED is enabled.
+** It is called from the driver cycle, including interrupt context, and should
+** be as fast as possible.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    UINT32         - Current timestamp.
+**------------------------------------------------------------------------------
+*/
+#if ABCC_CFG_TRACE_ENABLED
+#ifndef ABCC_PORT_GetTimestamp
+#error "ABCC_PORT_GetTimestamp must be ported if ABCC_CFG_TRACE_ENABLED\
+ is enabled."
+#endif
+#endif
+
 /*------------------------------------------------------------------------------
 ** Copy a number of octets, from the source pointer to the destination pointer.
 **
@@ -498,6 +643,83 @@ void ABCC_CopyOctetsImpl( void* pxDest, UINT16 iDestOctetOffset,
 #endif
 #endif
 
+/*------------------------------------------------------------------------------
+** Copy a number of 16, 32 or 64 bit values from a source to a destination and
+** endian swap each value.
+**
+** Define ABCC_PORT_Copy16WithEndianSwap, ABCC_PORT_Copy32WithEndianSwap and
+** ABCC_PORT_Copy64WithEndianSwap in abcc_software_port.h to override default
+** implementation.
+**
+** Used for ADI values when the network data format differs from the host
+** endianess. The default implementations in abcc_copy.c swap 16 octets at a
+** time with SSE2/SSSE3 or NEON if the compiler targets it, otherwise 4 octets
+** at a time, and handle the remaining values one by one. This function can be
+** modified to use e.g. a byte reversing DMA or platform specific instructions.
+**
+** Source and destination must not overlap. Octet alignment support (the octet
+** offset is odd) need to be considered when porting these macros.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pxDest            - Base pointer to the destination.
+**    iDestOctetOffset  - Octet offset to the destination where the copy will
+**                        begin.
+**    pxSrc             - Base pointer to source data.
+**    iSrcOctetOffset   - Octet offset to the source where the copy will begin.
+**    iNumElem          - Number of values to copy.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_PORT_Copy16WithEndianSwap
+void ABCC_Copy16WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem );
+#define ABCC_PORT_Copy16WithEndianSwap ABCC_Copy16WithEndianSwapImpl
+#endif
+
+#ifndef ABCC_PORT_Copy32WithEndianSwap
+void ABCC_Copy32WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem );
+#define ABCC_PORT_Copy32WithEndianSwap ABCC_Copy32WithEndianSwapImpl
+#endif
+
+#if ( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
+#ifndef ABCC_PORT_Copy64WithEndianSwap
+void ABCC_Copy64WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem );
+#define ABCC_PORT_Copy64WithEndianSwap ABCC_Copy64WithEndianSwapImpl
+#endif
+#endif
+
+/*------------------------------------------------------------------------------
+** Calculate the CRC32 checksum of a SPI frame.
+**
+** Define ABCC_PORT_Crc32 in abcc_software_port.h to override default
+** implementation.
+**
+** This function can be modified to use a CRC peripheral or platform specific
+** CRC instructions. The result must be identical to CRC_Crc32(), which is
+** CRC-32/BZIP2 (polynomial 0x04C11DB7, initial value and final XOR 0xFFFFFFFF,
+** not reflected) on the frame octets, with the four octets of the result in
+** reversed order.
+**------------------------------------------------------------------------------
+** Arguments:
+**    piBufferStart     - Pointer to the start of the frame.
+**    iLength           - Number of octets to include (even).
+**
+** Returns:
+**    The CRC32 checksum.
+**------------------------------------------------------------------------------
+*/
+#ifndef ABCC_PORT_Crc32
+#define ABCC_PORT_Crc32( piBufferStart, iLength )                              \
+        CRC_Crc32( piBufferStart, iLength )
+#endif
+
 /*------------------------------------------------------------------------------
 ** Functions for copying native UINT8 arrays to and from packed octet strings.
 ** There should be no need to override these.
@@ -0,0 +1,229 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Table driven Get_Attribute/Set_Attribute handling for host objects.
+**
+** A host object describes the attributes of an object or instance with a
+** constant table of ABCC_HostAttrType entries, built with the
+** ABCC_HOST_ATTR_xxx() macros below, and passes Get_Attribute and
+** Set_Attribute requests to ABCC_HostAttrCommand(). Constant values, their
+** sizes and string lengths are resolved at compile time. Attributes that need
+** code (variable data, values that may be function calls, critical sections,
+** side effects) use a get and/or set function.
+**
+** Example:
+**
+**    static const ABCC_HostAttrType xxx_asObjAttr[] =
+**    {
+**       ABCC_HOST_ATTR_OBJECT( "Name", 1, 1, 1 ),
+**       ABCC_HOST_ATTR_END
+**    };
+**
+**    case ABP_CMD_GET_ATTR:
+**       ABCC_HostAttrCommand( psNewMessage, xxx_asObjAttr,
+**                             ABCC_HOST_ATTR_TABLE_SIZE( xxx_asObjAttr ) );
+**       break;
+********************************************************************************
+*/
+
+#ifndef ABCC_HOST_ATTRIBUTE_H_
+#define ABCC_HOST_ATTRIBUTE_H_
+
+#include "abcc_types.h"
+#include "abp.h"
+
+/*------------------------------------------------------------------------------
+** Attribute value kinds.
+**------------------------------------------------------------------------------
+*/
+typedef enum ABCC_HostAttrKindType
+{
+   ABCC_HOST_ATTR_KIND_END,      /* Table terminator. */
+   ABCC_HOST_ATTR_KIND_UINT8,    /* Constant in lValue. */
+   ABCC_HOST_ATTR_KIND_UINT16,   /* Constant in lValue. */
+   ABCC_HOST_ATTR_KIND_UINT32,   /* Constant in lValue. */
+   ABCC_HOST_ATTR_KIND_OCTETS,   /* iSize octets (UINT8 array) at pxData. */
+   ABCC_HOST_ATTR_KIND_STRING,   /* iSize characters at pxData. */
+   ABCC_HOST_ATTR_KIND_CSTRING,  /* Zero terminated string at pxData, at */
+                                 /* most iSize characters. */
+   ABCC_HOST_ATTR_KIND_FUNC      /* Handled by pnGet/pnSet. */
+}
+ABCC_HostAttrKindType;
+
+/*------------------------------------------------------------------------------
+** Get/set function for ABCC_HOST_ATTR_KIND_FUNC attributes. The function
+** builds the response (or error response) in the message. The message is sent
+** by the caller of ABCC_HostAttrCommand().
+**------------------------------------------------------------------------------
+*/
+typedef void (*ABCC_HostAttrFuncType)( ABP_MsgType* psNewMessage );
+
+/*------------------------------------------------------------------------------
+** Attribute descriptor.
+**------------------------------------------------------------------------------
+** bAttr    - Attribute number.
+** bKind    - ABCC_HostAttrKindType.
+** iSize    - Size in octets of the attribute value (not used by FUNC).
+** lValue   - Value of constant UINT8/UINT16/UINT32 attributes.
+** pxData   - Value of OCTETS and STRING attributes.
+** pnGet    - Get_Attribute handler of FUNC attributes, NULL if not getable.
+** pnSet    - Set_Attribute handler of FUNC attributes, NULL if not setable.
+**------------------------------------------------------------------------------
+*/
+typedef struct ABCC_HostAttrType
+{
+   UINT8                   bAttr;
+   UINT8                   bKind;
+   UINT16                  iSize;
+   UINT32                  lValue;
+   const void*             pxData;
+   ABCC_HostAttrFuncType   pnGet;
+   ABCC_HostAttrFuncType   pnSet;
+}
+ABCC_HostAttrType;
+
+/*------------------------------------------------------------------------------
+** Attribute table entries. Tables must be sorted on ascending attribute number
+** and end with ABCC_HOST_ATTR_END. Lookup is a direct index when the attribute
+** numbers are consecutive and a binary search otherwise.
+**
+** ABCC_HOST_ATTR_STR() takes the length of a string literal or a char array
+** with sizeof. A char pointer is rejected at compile time by compilers with
+** __builtin_types_compatible_p() (GCC, Clang). Other compilers cannot tell a
+** pointer from an array, the length is then taken at run time instead.
+** ABCC_HOST_ATTR_STR_MAX() limits the length to iMaxLen characters.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_HOST_ATTR_U8( bAttr, bValue )                                     \
+   { (bAttr), ABCC_HOST_ATTR_KIND_UINT8, ABP_UINT8_SIZEOF,                     \
+     (UINT32)(bValue), NULL, NULL, NULL }
+
+#define ABCC_HOST_ATTR_U16( bAttr, iValue )                                    \
+   { (bAttr), ABCC_HOST_ATTR_KIND_UINT16, ABP_UINT16_SIZEOF,                   \
+     (UINT32)(iValue), NULL, NULL, NULL }
+
+#define ABCC_HOST_ATTR_U32( bAttr, lValue )                                    \
+   { (bAttr), ABCC_HOST_ATTR_KIND_UINT32, ABP_UINT32_SIZEOF,                   \
+     (UINT32)(lValue), NULL, NULL, NULL }
+
+/*
+** Two values packed in one attribute, first value at the lowest offset.
+*/
+#define ABCC_HOST_ATTR_U8X2( bAttr, bFirst, bSecond )                          \
+   ABCC_HOST_ATTR_U16( bAttr, (UINT16)( (UINT8)(bFirst) |                      \
+                                        ( (UINT16)(UINT8)(bSecond) << 8 ) ) )
+
+#define ABCC_HOST_ATTR_U16X2( bAttr, iFirst, iSecond )                         \
+   ABCC_HOST_ATTR_U32( bAttr, (UINT32)( (UINT16)(iFirst) |                     \
+                                        ( (UINT32)(UINT16)(iSecond) << 16 ) ) )
+
+#define ABCC_HOST_ATTR_OCT( bAttr, pbData, iSize )                             \
+   { (bAttr), ABCC_HOST_ATTR_KIND_OCTETS, (iSize),                             \
+     0, (pbData), NULL, NULL }
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+/*
+** Length of a string literal or char array. Fails to compile (negative array
+** size) if pcStr is a pointer.
+*/
+#define ABCC_HOST_ATTR_STR_LEN( pcStr )                                        \
+   ( sizeof( pcStr ) - 1 +                                                     \
+     0 * sizeof( char[ 1 - 2 * __builtin_types_compatible_p(                   \
+                                  __typeof__( pcStr ),                         \
+                                  __typeof__( &( pcStr )[ 0 ] ) ) ] ) )
+
+#define ABCC_HOST_ATTR_STR( bAttr, pcStr )                                     \
+   { (bAttr), ABCC_HOST_ATTR_KIND_STRING,                                      \
+     (UINT16)ABCC_HOST_ATTR_STR_LEN( pcStr ),                                  \
+     0, (pcStr), NULL, NULL }
+
+#define ABCC_HOST_ATTR_STR_MAX( bAttr, pcStr, iMaxLen )                        \
+   { (bAttr), ABCC_HOST_ATTR_KIND_STRING,                                      \
+     (UINT16)( ( ABCC_HOST_ATTR_STR_LEN( pcStr ) < (iMaxLen) ) ?               \
+               ABCC_HOST_ATTR_STR_LEN( pcStr ) : (iMaxLen) ),                  \
+     0, (pcStr), NULL, NULL }
+#else
+#define ABCC_HOST_ATTR_STR( bAttr, pcStr )                                     \
+   { (bAttr), ABCC_HOST_ATTR_KIND_CSTRING, 0xFFFF,                             \
+     0, (pcStr), NULL, NULL }
+
+#define ABCC_HOST_ATTR_STR_MAX( bAttr, pcStr, iMaxLen )                        \
+   { (bAttr), ABCC_HOST_ATTR_KIND_CSTRING, (UINT16)(iMaxLen),                  \
+     0, (pcStr), NULL, NULL }
+#endif
+
+#define ABCC_HOST_ATTR_FUNC( bAttr, pnGet, pnSet )                             \
+   { (bAttr), ABCC_HOST_ATTR_KIND_FUNC, 0, 0, NULL, (pnGet), (pnSet) }
+
+#define ABCC_HOST_ATTR_END                                                     \
+   { 0, ABCC_HOST_ATTR_KIND_END, 0, 0, NULL, NULL, NULL }
+
+/*------------------------------------------------------------------------------
+** The four object attributes (instance 0) that all host objects have: name,
+** revision, number of instances and highest instance number.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_HOST_ATTR_OBJECT( pcName, bRev, iNumInst, iHighestInst )          \
+   ABCC_HOST_ATTR_STR( ABP_OA_NAME, pcName ),                                  \
+   ABCC_HOST_ATTR_U8( ABP_OA_REV, bRev ),                                      \
+   ABCC_HOST_ATTR_U16( ABP_OA_NUM_INST, iNumInst ),                            \
+   ABCC_HOST_ATTR_U16( ABP_OA_HIGHEST_INST, iHighestInst )
+
+/*------------------------------------------------------------------------------
+** Number of attributes in a table, not counting ABCC_HOST_ATTR_END.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_HOST_ATTR_TABLE_SIZE( asAttr )                                    \
+   (UINT8)( ( sizeof( asAttr ) / sizeof( ( asAttr )[ 0 ] ) ) - 1 )
+
+/*------------------------------------------------------------------------------
+** Looks up an attribute in a table.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pasAttr           - Attribute table.
+**    bNumAttr          - Number of attributes in the table.
+**    bAttr             - Attribute number.
+**
+** Returns:
+**    Pointer to the attribute descriptor, NULL if not found.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC const ABCC_HostAttrType* ABCC_HostAttrFind( const ABCC_HostAttrType* pasAttr,
+                                                   UINT8 bNumAttr,
+                                                   UINT8 bAttr );
+
+/*------------------------------------------------------------------------------
+** Handles a Get_Attribute or Set_Attribute request from an attribute table.
+** The response is written to the message but not sent.
+**
+** Errors:
+**    ABP_ERR_INV_CMD_EXT_0      - Attribute not in the table.
+**    ABP_ERR_ATTR_NOT_GETABLE   - FUNC attribute without get function.
+**    ABP_ERR_ATTR_NOT_SETABLE   - Set_Attribute on a constant or a FUNC
+**                                 attribute without set function.
+**    ABP_ERR_UNSUP_CMD          - Any other command.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**    pasAttr           - Attribute table.
+**    bNumAttr          - Number of attributes in the table.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_HostAttrCommand( ABP_MsgType* psNewMessage,
+                                   const ABCC_HostAttrType* pasAttr,
+                                   UINT8 bNumAttr );
+
+#endif  /* inclusion lock */
@@ -103,12 +103,44 @@ EXTFUNC void AD_UpdatePdReadData( void* pxPdDataBuf );
 **
 ** Returns:
 **    TRUE  -  Write process data buffer is updated.
-**    FALSE -  No update was made.
+**    FALSE -  No update was made. With AD_WRPD_DIRTY_TRACKING_ENABLE this is
+**             also returned when no mapped ADI has changed since the last
+**             update.
 **
 **------------------------------------------------------------------------------
 */
 EXTFUNC BOOL AD_UpdatePdWriteData( void* pxPdDataBuf );
 
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+/*------------------------------------------------------------------------------
+** Indicate to AD object that the value of an ADI has been changed by the
+** application. The ADI is copied to the write process data buffer in the
+** next AD_UpdatePdWriteData(). Instances not mapped as write process data are
+** ignored.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iInstance       - ADI instance.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void AD_MarkAdiDirty( UINT16 iInstance );
+
+/*------------------------------------------------------------------------------
+** Indicate to AD object that all ADI:s shall be copied to the write process
+** data buffer in the next AD_UpdatePdWriteData().
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void AD_MarkAllAdisDirty( void );
+#endif
+
 /*------------------------------------------------------------------------------
 ** Get pointer to ADI entry table from ADI instance number
 **------------------------------------------------------------------------------
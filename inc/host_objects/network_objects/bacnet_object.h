@@ -67,6 +67,22 @@ EXTVAR const BAC_ObjectListType BAC_asObjectList[];
 
 #endif /* BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE */
 
+/*------------------------------------------------------------------------------
+** Initializes the BACnet object. Builds the Advanced Mapping lookup index (see
+** BAC_ADV_MAPPING_INDEX_SIZE and BAC_ADV_MAPPING_BITMAP_TYPES) from the ADI
+** list and BAC_asObjectList. Shall be called after AD_Init() and again if the
+** lists are changed.
+**------------------------------------------------------------------------------
+** Arguments:
+**       None.
+**
+** Returns:
+**       None.
+**
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void BAC_Init( void );
+
 /*------------------------------------------------------------------------------
 ** Processes commands sent to the BACnet object.
 **------------------------------------------------------------------------------
@@ -35,6 +35,24 @@ ECT_StateType;
 
 #endif
 
+/*------------------------------------------------------------------------------
+** void ECT_Init()
+** Initializes the ECT object. Serializes the ENUM ADI list (see
+** ECT_IA_ENUM_ADIS_LIST_SIZE) and the ADI and object subindex translations to
+** message format. Shall be called after AD_Init().
+**------------------------------------------------------------------------------
+** Arguments:
+**       None.
+**
+** Returns:
+**       None.
+**
+** Usage:
+**       ECT_Init();
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ECT_Init( void );
+
 /*------------------------------------------------------------------------------
 ** void ECT_ProcessCmdMsg()
 ** Processes commands sent to the ECT object.
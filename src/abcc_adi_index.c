@@ -0,0 +1,272 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** ADI instance number to ADI entry table index lookup.
+********************************************************************************
+*/
+
+#include "abcc_config.h"
+#include "abcc_types.h"
+#include "abcc.h"
+#include "abcc_application_data_interface.h"
+
+#if( ABCC_CFG_ADI_INDEX_SIZE > 0 )
+
+#if( ( ABCC_CFG_ADI_INDEX_SIZE & ( ABCC_CFG_ADI_INDEX_SIZE - 1 ) ) != 0 )
+#error "ABCC_CFG_ADI_INDEX_SIZE must be a power of two"
+#endif
+
+/*
+** Multiplier used when hashing instance numbers (Fibonacci hashing, 2^16/phi).
+*/
+#define ADI_INDEX_HASH_MULTIPLIER            ( 40503UL )
+
+/*------------------------------------------------------------------------------
+** Index organisation.
+**------------------------------------------------------------------------------
+*/
+typedef enum ADI_IndexMode
+{
+   ADI_INDEX_NONE,   /* No index, lookups use binary search. */
+   ADI_INDEX_DIRECT, /* Slot = instance - lowest instance. */
+   ADI_INDEX_HASH    /* Open addressing hash table, linear probing. */
+}
+ADI_IndexModeType;
+
+/*------------------------------------------------------------------------------
+** Lookup index state.
+**------------------------------------------------------------------------------
+** psAdiEntry     - ADI entry table the index was built for.
+** iNumAdi        - Number of entries in psAdiEntry.
+** eMode          - Index organisation.
+** iBaseInstance  - Lowest instance number (direct mode).
+** iNumSlots      - Number of slots in use.
+** bHashShift     - Right shift applied to the hash product (hash mode).
+** aiSlot         - ADI entry table index per slot, ABCC_ADI_INDEX_NOT_FOUND if
+**                  the slot is empty.
+**------------------------------------------------------------------------------
+*/
+typedef struct ADI_IndexType
+{
+   const AD_AdiEntryType* psAdiEntry;
+   UINT16                 iNumAdi;
+   ADI_IndexModeType      eMode;
+   UINT16                 iBaseInstance;
+   UINT16                 iNumSlots;
+   UINT8                  bHashShift;
+   UINT16                 aiSlot[ ABCC_CFG_ADI_INDEX_SIZE ];
+}
+ADI_IndexType;
+
+static ADI_IndexType adi_sIndex;
+
+/*------------------------------------------------------------------------------
+** Calculates the home slot of an instance number in the hash table.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iInstance         -  Instance number.
+**
+** Returns:
+**    Slot number.
+**------------------------------------------------------------------------------
+*/
+static UINT16 HashSlot( UINT16 iInstance )
+{
+   return( (UINT16)( ( ( (UINT32)iInstance * ADI_INDEX_HASH_MULTIPLIER ) & 0xffffUL ) >>
+                     adi_sIndex.bHashShift ) );
+}
+#endif
+
+/*------------------------------------------------------------------------------
+** Binary search in an ADI entry table sorted on instance number.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psAdiEntry        -  ADI entry table.
+**    iNumAdi           -  Number of entries in psAdiEntry.
+**    iInstance         -  Instance number.
+**
+** Returns:
+**    Index in ADI entry table, or ABCC_ADI_INDEX_NOT_FOUND.
+**------------------------------------------------------------------------------
+*/
+static UINT16 BinarySearch( const AD_AdiEntryType* psAdiEntry,
+                            UINT16 iNumAdi,
+                            UINT16 iInstance )
+{
+   UINT16   iLow;
+   UINT16   iMid;
+   UINT16   iHigh;
+
+   if( ( psAdiEntry == NULL ) || ( iNumAdi == 0 ) )
+   {
+      return( ABCC_ADI_INDEX_NOT_FOUND );
+   }
+
+   iLow = 0;
+   iHigh = iNumAdi - 1;
+
+   while( iLow != iHigh )
+   {
+      iMid = iLow + ( ( iHigh - iLow + 1 ) / 2 );
+      if( psAdiEntry[ iMid ].iInstance > iInstance )
+      {
+         iHigh = iMid - 1;
+      }
+      else
+      {
+         iLow = iMid;
+      }
+   }
+
+   if( psAdiEntry[ iLow ].iInstance != iInstance )
+   {
+      iLow = ABCC_ADI_INDEX_NOT_FOUND;
+   }
+
+   return( iLow );
+}
+
+void ABCC_AdiIndexBuild( const AD_AdiEntryType* psAdiEntry, UINT16 iNumAdi )
+{
+#if( ABCC_CFG_ADI_INDEX_SIZE > 0 )
+   UINT16 i;
+   UINT16 iSlot;
+   UINT32 lSpan;
+
+   if( ( adi_sIndex.eMode != ADI_INDEX_NONE ) &&
+       ( adi_sIndex.psAdiEntry == psAdiEntry ) &&
+       ( adi_sIndex.iNumAdi == iNumAdi ) )
+   {
+      /*
+      ** Already built for this table.
+      */
+      return;
+   }
+
+   adi_sIndex.psAdiEntry = psAdiEntry;
+   adi_sIndex.iNumAdi = iNumAdi;
+   adi_sIndex.eMode = ADI_INDEX_NONE;
+
+   if( ( psAdiEntry == NULL ) || ( iNumAdi == 0 ) )
+   {
+      return;
+   }
+
+   /*
+   ** The table is sorted, so the span of instance numbers is given by the
+   ** first and last entry.
+   */
+   lSpan = (UINT32)psAdiEntry[ iNumAdi - 1 ].iInstance -
+           (UINT32)psAdiEntry[ 0 ].iInstance + 1;
+
+   if( lSpan <= ABCC_CFG_ADI_INDEX_SIZE )
+   {
+      adi_sIndex.eMode = ADI_INDEX_DIRECT;
+      adi_sIndex.iBaseInstance = psAdiEntry[ 0 ].iInstance;
+      adi_sIndex.iNumSlots = (UINT16)lSpan;
+   }
+   else if( ( (UINT32)iNumAdi * 4 ) <= ( (UINT32)ABCC_CFG_ADI_INDEX_SIZE * 3 ) )
+   {
+      /*
+      ** Sparse instance numbers. Use the smallest power of two number of slots
+      ** that keeps the load factor at or below 3/4.
+      */
+      adi_sIndex.eMode = ADI_INDEX_HASH;
+      adi_sIndex.iNumSlots = 1;
+      adi_sIndex.bHashShift = 16;
+      while( ( (UINT32)adi_sIndex.iNumSlots * 3 ) < ( (UINT32)iNumAdi * 4 ) )
+      {
+         adi_sIndex.iNumSlots <<= 1;
+         adi_sIndex.bHashShift--;
+      }
+   }
+   else
+   {
+      /*
+      ** Does not fit, lookups fall back to binary search.
+      */
+      return;
+   }
+
+   for( i = 0; i < adi_sIndex.iNumSlots; i++ )
+   {
+      adi_sIndex.aiSlot[ i ] = ABCC_ADI_INDEX_NOT_FOUND;
+   }
+
+   for( i = 0; i < iNumAdi; i++ )
+   {
+      if( adi_sIndex.eMode == ADI_INDEX_DIRECT )
+      {
+         iSlot = psAdiEntry[ i ].iInstance - adi_sIndex.iBaseInstance;
+         if( iSlot >= adi_sIndex.iNumSlots )
+         {
+            /*
+            ** The table is not sorted. Fall back to binary search.
+            */
+            adi_sIndex.eMode = ADI_INDEX_NONE;
+            return;
+         }
+      }
+      else
+      {
+         iSlot = HashSlot( psAdiEntry[ i ].iInstance );
+         while( adi_sIndex.aiSlot[ iSlot ] != ABCC_ADI_INDEX_NOT_FOUND )
+         {
+            iSlot = ( iSlot + 1 ) & ( adi_sIndex.iNumSlots - 1 );
+         }
+      }
+      adi_sIndex.aiSlot[ iSlot ] = i;
+   }
+#else
+   (void)psAdiEntry;
+   (void)iNumAdi;
+#endif
+}
+
+UINT16 ABCC_AdiIndexFind( const AD_AdiEntryType* psAdiEntry,
+                          UINT16 iNumAdi,
+                          UINT16 iInstance )
+{
+#if( ABCC_CFG_ADI_INDEX_SIZE > 0 )
+   UINT16 iSlot;
+   UINT16 iIndex;
+
+   if( ( adi_sIndex.eMode != ADI_INDEX_NONE ) &&
+       ( adi_sIndex.psAdiEntry == psAdiEntry ) &&
+       ( adi_sIndex.iNumAdi == iNumAdi ) )
+   {
+      if( adi_sIndex.eMode == ADI_INDEX_DIRECT )
+      {
+         iSlot = iInstance - adi_sIndex.iBaseInstance;
+         if( iSlot >= adi_sIndex.iNumSlots )
+         {
+            return( ABCC_ADI_INDEX_NOT_FOUND );
+         }
+         return( adi_sIndex.aiSlot[ iSlot ] );
+      }
+
+      iSlot = HashSlot( iInstance );
+      while( ( iIndex = adi_sIndex.aiSlot[ iSlot ] ) != ABCC_ADI_INDEX_NOT_FOUND )
+      {
+         if( psAdiEntry[ iIndex ].iInstance == iInstance )
+         {
+            return( iIndex );
+         }
+         iSlot = ( iSlot + 1 ) & ( adi_sIndex.iNumSlots - 1 );
+      }
+      return( ABCC_ADI_INDEX_NOT_FOUND );
+   }
+#endif
+
+   return( BinarySearch( psAdiEntry, iNumAdi, iInstance ) );
+}
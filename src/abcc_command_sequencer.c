@@ -22,7 +22,9 @@
 #include "abcc_software_port.h"
 #include "abcc_debug_error.h"
 #include "abcc_link.h"
+#include "abcc_handler.h"
 #include "abcc_memory.h"
+#include "abcc_trace.h"
 
 #if ABCC_CFG_DRV_CMD_SEQ_ENABLED
 
@@ -30,6 +32,19 @@
 #error "ABCC_CFG_MAX_NUM_CMD_SEQ larger than 255 not supported"
 #endif
 
+#if ( ABCC_CFG_CMD_SEQ_MAX_PIPELINED < 1 ) || ( ABCC_CFG_CMD_SEQ_MAX_PIPELINED > 254 )
+#error "ABCC_CFG_CMD_SEQ_MAX_PIPELINED must be in the range 1-254"
+#endif
+
+/*
+** Size in octets of the message header.
+*/
+#ifdef ABCC_SYS_16_BIT_CHAR
+#define CMD_SEQ_MSG_HEADER_OCTETS   ( sizeof( ABP_MsgHeaderType16 ) * 2 )
+#else
+#define CMD_SEQ_MSG_HEADER_OCTETS   ( sizeof( ABP_MsgHeaderType ) )
+#endif
+
 /*******************************************************************************
 ** Typedefs
 ********************************************************************************
@@ -44,14 +59,32 @@ typedef enum CmdSeqState
 }
 CmdSeqStateType;
 
+/*
+** abSourceId     - Source ids of the commands of the current step waiting for
+**                  a response. Only pipelined steps use more than one.
+** apsCmdCopy     - Copies of the commands in abSourceId[] of a pipelined step
+**                  with a response timeout, used to send them again if the
+**                  step times out. NULL if no buffer was available.
+** fStepCmdsDone  - The command handler of the current pipelined step has
+**                  returned ABCC_CMDSEQ_CMD_SKIP, the step is done when the
+**                  last response has been received.
+** fTmoActive     - lTmoDeadlineMs is valid ( the current step has a timeout ).
+** bTmoRetryCount - Number of consecutive response timeouts of current step.
+*/
 typedef struct CmdSeqHandler
 {
    const ABCC_CmdSeqType*  pasCmdSeq;
    ABCC_CmdSeqDoneHandler  pnSeqDone;
    CmdSeqStateType         eState;
    UINT8                   bCurrSeqIndex;
-   UINT8                   bSourceId;
+   UINT8                   abSourceId[ ABCC_CFG_CMD_SEQ_MAX_PIPELINED ];
+   ABP_MsgType*            apsCmdCopy[ ABCC_CFG_CMD_SEQ_MAX_PIPELINED ];
+   UINT8                   bNumInFlight;
+   BOOL                    fStepCmdsDone;
+   BOOL                    fTmoActive;
+   UINT32                  lTmoDeadlineMs;
    UINT8                   bRetryCount;
+   UINT8                   bTmoRetryCount;
    void*                   pxUserData;
    ABCC_CmdSeqResultType   eSeqResult;
 }
@@ -64,6 +97,15 @@ CmdSeqEntryType;
 static UINT16 abcc_iNeedReTriggerCount;
 static CmdSeqEntryType abcc_asCmdSeq[ ABCC_CFG_MAX_NUM_CMD_SEQ ];
 
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+/*
+** Index in abcc_asCmdSeq[] of the sequence that last sent a command with a
+** given source id. Entries are not cleared, FindCmdSeqEntryFromSourceId()
+** checks that the sequence still waits for a response with the source id.
+*/
+static UINT8 abcc_abSrcIdToCmdSeq[ 256 ];
+#endif
+
 /*******************************************************************************
 ** Forward declarations
 ********************************************************************************
@@ -74,6 +116,7 @@ static CmdSeqEntryType* AllocCmdSeqEntry( const ABCC_CmdSeqType* pasCmdSeq );
 static BOOL CheckAndSetState( CmdSeqEntryType* psCmdSeqHandler,
                               CmdSeqStateType eCheckState,
                               CmdSeqStateType eNewState );
+static void FinishCmdSequence( CmdSeqEntryType* psEntry );
 
 /*******************************************************************************
 ** Private services
@@ -128,6 +171,8 @@ static CmdSeqEntryType* AllocCmdSeqEntry( const ABCC_CmdSeqType* pasCmdSeq )
 */
 static void ResetCmdSeqEntry( CmdSeqEntryType* psEntry, BOOL fInitial )
 {
+   UINT8 i;
+
    if( psEntry != NULL )
    {
       if( fInitial )
@@ -148,8 +193,16 @@ static void ResetCmdSeqEntry( CmdSeqEntryType* psEntry, BOOL fInitial )
       psEntry->pasCmdSeq = NULL;
       psEntry->pnSeqDone = NULL;
       psEntry->bCurrSeqIndex = 0;
-      psEntry->bSourceId = 0;
+      psEntry->bNumInFlight = 0;
+      for( i = 0; i < ABCC_CFG_CMD_SEQ_MAX_PIPELINED; i++ )
+      {
+         psEntry->apsCmdCopy[ i ] = NULL;
+      }
+      psEntry->fStepCmdsDone = FALSE;
+      psEntry->fTmoActive = FALSE;
+      psEntry->lTmoDeadlineMs = 0;
       psEntry->bRetryCount = 0;
+      psEntry->bTmoRetryCount = 0;
       psEntry->pxUserData = NULL;
       psEntry->eSeqResult = ABCC_CMDSEQ_RESULT_COMPLETED;
    }
@@ -161,28 +214,213 @@ static void ResetCmdSeqEntry( CmdSeqEntryType* psEntry, BOOL fInitial )
 **------------------------------------------------------------------------------
 ** Arguments:
 **    bSourceId - Source id
+**    pbSlot    - Returns the index of the source id in abSourceId[].
 **
 ** Returns:
 **    CmdSeqEntryType* - Mapped handler. NULL if not found.
 **------------------------------------------------------------------------------
 */
-static CmdSeqEntryType* FindCmdSeqEntryFromSourceId( UINT8 bSourceId )
+static CmdSeqEntryType* FindCmdSeqEntryFromSourceId( UINT8 bSourceId, UINT8* pbSlot )
 {
    UINT8 i;
+   UINT8 bSlot;
 
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+   i = abcc_abSrcIdToCmdSeq[ bSourceId ];
+   if( i < ABCC_CFG_MAX_NUM_CMD_SEQ )
+#else
    for( i = 0; i < ABCC_CFG_MAX_NUM_CMD_SEQ; i++ )
+#endif
    {
       if( ( abcc_asCmdSeq[ i ].eState == CMD_SEQ_STATE_WAIT_RESP ) &&
-          ( abcc_asCmdSeq[ i ].pasCmdSeq != NULL ) &&
-            abcc_asCmdSeq[ i ].bSourceId == bSourceId )
+          ( abcc_asCmdSeq[ i ].pasCmdSeq != NULL ) )
       {
-         return( &abcc_asCmdSeq[ i ] );
+         for( bSlot = 0; bSlot < abcc_asCmdSeq[ i ].bNumInFlight; bSlot++ )
+         {
+            if( abcc_asCmdSeq[ i ].abSourceId[ bSlot ] == bSourceId )
+            {
+               *pbSlot = bSlot;
+               return( &abcc_asCmdSeq[ i ] );
+            }
+         }
       }
    }
 
    return( NULL );
 }
 
+/*------------------------------------------------------------------------------
+** Max message data size of the commands of a step, see ABCC_CMD_SEQ_SHORT().
+**------------------------------------------------------------------------------
+** Arguments:
+**    psCmdSeq - Step
+**
+** Returns:
+**    Max message data size in octets.
+**------------------------------------------------------------------------------
+*/
+static UINT16 GetStepMaxDataSize( const ABCC_CmdSeqType* psCmdSeq )
+{
+   if( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_SHORT_CMD )
+   {
+      return( ABCC_CFG_SMALL_MSG_SIZE );
+   }
+
+   return( ABCC_CFG_MAX_MSG_SIZE );
+}
+
+/*------------------------------------------------------------------------------
+** Allocates a command buffer for the current step of a sequence.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to entry
+**
+** Returns:
+**    ABP_MsgType* - The buffer. NULL if no buffer is available.
+**------------------------------------------------------------------------------
+*/
+static ABP_MsgType* GetStepMsgBuffer( const CmdSeqEntryType* psEntry )
+{
+   return( ABCC_GetCmdMsgBufferOfSize(
+              GetStepMaxDataSize( &psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ] ) ) );
+}
+
+/*------------------------------------------------------------------------------
+** Returns a copy of a command message in a newly allocated buffer of the
+** smallest class that fits the command.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psMsg - Command to copy
+**
+** Returns:
+**    ABP_MsgType* - The copy. NULL if no buffer is available.
+**------------------------------------------------------------------------------
+*/
+static ABP_MsgType* CopyCmdMsg( ABP_MsgType* psMsg )
+{
+   ABP_MsgType* psCopy;
+
+   psCopy = ABCC_GetCmdMsgBufferOfSize( ABCC_GetMsgDataSize( psMsg ) );
+   if( psCopy != NULL )
+   {
+      ABCC_PORT_CopyOctets( psCopy, 0, psMsg, 0,
+                            CMD_SEQ_MSG_HEADER_OCTETS + ABCC_GetMsgDataSize( psMsg ) );
+   }
+
+   return( psCopy );
+}
+
+/*------------------------------------------------------------------------------
+** Frees the copy of a command waiting for a response, if any.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to entry
+**    bSlot   - Index in abSourceId[]
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void FreeCmdCopy( CmdSeqEntryType* psEntry, UINT8 bSlot )
+{
+   if( psEntry->apsCmdCopy[ bSlot ] != NULL )
+   {
+      ABCC_ReturnMsgBuffer( &psEntry->apsCmdCopy[ bSlot ] );
+      psEntry->apsCmdCopy[ bSlot ] = NULL;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Releases the response handlers of all commands of the current step that are
+** waiting for a response. Late responses will be passed to
+** ABCC_CbfReceiveMsg() unless the commands have been retired by
+** RetireInFlight(). Must not be called in a critical section.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to entry
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void ReleaseInFlight( CmdSeqEntryType* psEntry )
+{
+   while( psEntry->bNumInFlight > 0 )
+   {
+      psEntry->bNumInFlight--;
+      (void)ABCC_LinkGetMsgHandler( psEntry->abSourceId[ psEntry->bNumInFlight ] );
+      FreeCmdCopy( psEntry, psEntry->bNumInFlight );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Stops waiting for the responses of the commands of the current step that
+** have timed out. The commands occupy command resources until their late
+** responses have been dropped by the link layer. Must not be called in a critical
+** section.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to entry
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void RetireInFlight( CmdSeqEntryType* psEntry )
+{
+   UINT8 i;
+
+   for( i = 0; i < psEntry->bNumInFlight; i++ )
+   {
+      ABCC_LinkRetireCmd( psEntry->abSourceId[ i ] );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Moves to the next step in the sequence.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to entry
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void NextStep( CmdSeqEntryType* psEntry )
+{
+   psEntry->bCurrSeqIndex++;
+   psEntry->fStepCmdsDone = FALSE;
+   psEntry->bTmoRetryCount = 0;
+}
+
+/*------------------------------------------------------------------------------
+** Sets the entry in CMD_SEQ_STATE_WAIT_RESP and starts the response timeout
+** of the current step.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to entry
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void WaitForResponse( CmdSeqEntryType* psEntry )
+{
+   UINT16 iTmoMs;
+
+   iTmoMs = psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ].iTmoMs;
+   psEntry->fTmoActive = ( iTmoMs != 0 );
+   if( psEntry->fTmoActive )
+   {
+      psEntry->lTmoDeadlineMs = (UINT32)ABCC_GetUptimeMs() + iTmoMs;
+   }
+
+   if( !CheckAndSetState( psEntry, CMD_SEQ_STATE_ANY, CMD_SEQ_STATE_WAIT_RESP ) )
+   {
+      ABCC_ASSERT( FALSE );
+   }
+}
+
 /*------------------------------------------------------------------------------
 ** Check if the given handle corresponds to an active command sequence.
 **------------------------------------------------------------------------------
@@ -277,13 +515,14 @@ static BOOL CheckAndSetState( CmdSeqEntryType* psCmdSeqHandler,
 */
 static void DoAbort( CmdSeqEntryType* psEntry )
 {
-   BOOL fFreeSourceId;
-   UINT8 bSourceId = 0;
+   UINT8 abSourceId[ ABCC_CFG_CMD_SEQ_MAX_PIPELINED ];
+   ABP_MsgType* apsCmdCopy[ ABCC_CFG_CMD_SEQ_MAX_PIPELINED ];
+   UINT8 bNumSourceId;
    ABCC_CmdSeqDoneHandler pnSeqDone;
    void *pxUserData;
    ABCC_PORT_UseCritical();
 
-   fFreeSourceId = FALSE;
+   bNumSourceId = 0;
    ABCC_PORT_EnterCritical();
 
    if( psEntry->eState == CMD_SEQ_STATE_BUSY )
@@ -302,8 +541,12 @@ static void DoAbort( CmdSeqEntryType* psEntry )
       }
       if( psEntry->eState == CMD_SEQ_STATE_WAIT_RESP )
       {
-         bSourceId = psEntry->bSourceId;
-         fFreeSourceId = TRUE;
+         while( bNumSourceId < psEntry->bNumInFlight )
+         {
+            abSourceId[ bNumSourceId ] = psEntry->abSourceId[ bNumSourceId ];
+            apsCmdCopy[ bNumSourceId ] = psEntry->apsCmdCopy[ bNumSourceId ];
+            bNumSourceId++;
+         }
       }
 
 #if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
@@ -327,12 +570,16 @@ static void DoAbort( CmdSeqEntryType* psEntry )
    ABCC_PORT_ExitCritical();
 
    /*
-   ** Free of sourceId is done outside critical section to avoid nested
-   ** critical sections. Result can be ignored
+   ** Free of sourceId and command copies is done outside critical section to
+   ** avoid nested critical sections. Result can be ignored
    */
-   if( fFreeSourceId )
+   while( bNumSourceId > 0 )
    {
-      (void)ABCC_LinkGetMsgHandler( bSourceId );
+      (void)ABCC_LinkGetMsgHandler( abSourceId[ --bNumSourceId ] );
+      if( apsCmdCopy[ bNumSourceId ] != NULL )
+      {
+         ABCC_ReturnMsgBuffer( &apsCmdCopy[ bNumSourceId ] );
+      }
    }
 }
 
@@ -350,12 +597,16 @@ static void DoAbort( CmdSeqEntryType* psEntry )
 static void HandleResponse( ABP_MsgType* psMsg )
 {
    UINT8 bSourceId;
+   UINT8 bSlot;
+   BOOL fPipelined;
+   BOOL fStepDone;
    CmdSeqEntryType* psEntry;
+   const ABCC_CmdSeqType* psCmdSeq;
    ABCC_CmdSeqRespStatusType eStatus;
 
 
    bSourceId = ABCC_GetMsgSourceId( psMsg );
-   psEntry = FindCmdSeqEntryFromSourceId( bSourceId );
+   psEntry = FindCmdSeqEntryFromSourceId( bSourceId, &bSlot );
 
    if( psEntry != NULL )
    {
@@ -364,7 +615,18 @@ static void HandleResponse( ABP_MsgType* psMsg )
       */
       if( CheckAndSetState( psEntry, CMD_SEQ_STATE_WAIT_RESP, CMD_SEQ_STATE_BUSY ) )
       {
-         if( psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ].pnRespHandler != NULL )
+         psCmdSeq = &psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ];
+         fPipelined = ( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_PIPELINED ) != 0;
+         fStepDone = FALSE;
+
+         FreeCmdCopy( psEntry, bSlot );
+         psEntry->bNumInFlight--;
+         psEntry->abSourceId[ bSlot ] = psEntry->abSourceId[ psEntry->bNumInFlight ];
+         psEntry->apsCmdCopy[ bSlot ] = psEntry->apsCmdCopy[ psEntry->bNumInFlight ];
+         psEntry->apsCmdCopy[ psEntry->bNumInFlight ] = NULL;
+         psEntry->bTmoRetryCount = 0;
+
+         if( psCmdSeq->pnRespHandler != NULL )
          {
             /*
             ** Pass the response message to the application.
@@ -372,16 +634,19 @@ static void HandleResponse( ABP_MsgType* psMsg )
 #if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
             ABCC_DebugPrintf( "CmdSeq(%p)->%s()\n",
                (void*)psEntry->pasCmdSeq,
-               psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ].pcRespName );
+               psCmdSeq->pcRespName );
 #endif
-            eStatus = psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ].pnRespHandler( psMsg, psEntry->pxUserData );
+            eStatus = psCmdSeq->pnRespHandler( psMsg, psEntry->pxUserData );
 
-            if( eStatus == ABCC_CMDSEQ_RESP_EXEC_NEXT )
+            if( ( eStatus == ABCC_CMDSEQ_RESP_EXEC_NEXT ) ||
+                ( fPipelined && ( eStatus == ABCC_CMDSEQ_RESP_EXEC_CURRENT ) ) )
             {
                /*
-               ** Move to next command in sequence
+               ** Move to next command in sequence. A pipelined step is done
+               ** when all its commands have been sent and responded to.
                */
-               psEntry->bCurrSeqIndex++;
+               fStepDone = !fPipelined ||
+                           ( psEntry->fStepCmdsDone && ( psEntry->bNumInFlight == 0 ) );
             }
             else if( eStatus == ABCC_CMDSEQ_RESP_ABORT )
             {
@@ -390,8 +655,10 @@ static void HandleResponse( ABP_MsgType* psMsg )
                      (void*)psEntry->pasCmdSeq );
 #endif
                /*
-               ** Loop until end of sequence.
+               ** Drop the other outstanding commands and loop until end of
+               ** sequence.
                */
+               ReleaseInFlight( psEntry );
                while( psEntry->pasCmdSeq[ ++psEntry->bCurrSeqIndex ].pnCmdHandler != NULL );
 
                psEntry->eSeqResult = ABCC_CMDSEQ_RESULT_ABORT_INT;
@@ -420,7 +687,22 @@ static void HandleResponse( ABP_MsgType* psMsg )
             */
             ABCC_ASSERT_ERR( ABCC_VerifyMessage( psMsg ) == ABCC_EC_NO_ERROR,
                              ABCC_SEV_WARNING, ABCC_EC_RESP_MSG_E_BIT_SET, 0 );
-            psEntry->bCurrSeqIndex++;
+            fStepDone = !fPipelined ||
+                        ( psEntry->fStepCmdsDone && ( psEntry->bNumInFlight == 0 ) );
+         }
+
+         if( fStepDone )
+         {
+            NextStep( psEntry );
+         }
+         else if( psEntry->fStepCmdsDone && ( psEntry->bNumInFlight > 0 ) )
+         {
+            /*
+            ** Pipelined step with all commands sent. Wait for the remaining
+            ** responses, the buffer is freed by the caller.
+            */
+            WaitForResponse( psEntry );
+            return;
          }
 
          if( ABCC_MemGetBufferStatus( psMsg ) != ABCC_MEM_BUFSTAT_IN_APPL_HANDLER )
@@ -428,7 +710,7 @@ static void HandleResponse( ABP_MsgType* psMsg )
             /*
             ** The application has used the buffer for other things.
             */
-            psMsg = ABCC_GetCmdMsgBuffer();
+            psMsg = GetStepMsgBuffer( psEntry );
          }
 
          /*
@@ -441,6 +723,186 @@ static void HandleResponse( ABP_MsgType* psMsg )
    }
 }
 
+/*------------------------------------------------------------------------------
+** Sends the timed out commands of a pipelined step again with new source ids.
+** The entry must be in CMD_SEQ_STATE_BUSY.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to handler
+**
+** Returns:
+**    TRUE  - Commands sent, the entry waits for the responses.
+**    FALSE - A command has no copy or no buffer or command resource was
+**            available. Nothing sent.
+**------------------------------------------------------------------------------
+*/
+static BOOL ReissueInFlight( CmdSeqEntryType* psEntry )
+{
+   ABP_MsgType* apsSendMsg[ ABCC_CFG_CMD_SEQ_MAX_PIPELINED ];
+   ABCC_MsgType sMsg;
+   UINT8 bNumSendMsg;
+   UINT8 i;
+
+   /*
+   ** The timed out commands are still held by the module and occupy command
+   ** resources until their late responses arrive.
+   */
+   if( ABCC_GetCmdQueueSize() < psEntry->bNumInFlight )
+   {
+      return( FALSE );
+   }
+
+   for( bNumSendMsg = 0; bNumSendMsg < psEntry->bNumInFlight; bNumSendMsg++ )
+   {
+      apsSendMsg[ bNumSendMsg ] = NULL;
+      if( psEntry->apsCmdCopy[ bNumSendMsg ] != NULL )
+      {
+         apsSendMsg[ bNumSendMsg ] = CopyCmdMsg( psEntry->apsCmdCopy[ bNumSendMsg ] );
+      }
+
+      if( apsSendMsg[ bNumSendMsg ] == NULL )
+      {
+         while( bNumSendMsg > 0 )
+         {
+            ABCC_ReturnMsgBuffer( &apsSendMsg[ --bNumSendMsg ] );
+         }
+         return( FALSE );
+      }
+   }
+
+   for( i = 0; i < bNumSendMsg; i++ )
+   {
+      sMsg.psMsg = apsSendMsg[ i ];
+      ABCC_SetLowAddrOct( sMsg.psMsg16->sHeader.iSourceIdDestObj, ABCC_GetNewSourceId() );
+      psEntry->abSourceId[ i ] = ABCC_GetMsgSourceId( sMsg.psMsg );
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+      abcc_abSrcIdToCmdSeq[ psEntry->abSourceId[ i ] ] =
+         (UINT8)( psEntry - abcc_asCmdSeq );
+#endif
+   }
+
+#if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
+   ABCC_DebugPrintf( "CmdSeq(%p)->Sending %d timed out commands again\n",
+         (void*)psEntry->pasCmdSeq, (int)bNumSendMsg );
+#endif
+
+   WaitForResponse( psEntry );
+
+   for( i = 0; i < bNumSendMsg; i++ )
+   {
+      (void)ABCC_SendCmdMsg( apsSendMsg[ i ], HandleResponse );
+   }
+
+   return( TRUE );
+}
+
+/*------------------------------------------------------------------------------
+** Handles a response timeout of the current step. The entry must be in
+** CMD_SEQ_STATE_BUSY.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to handler
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void HandleRespTmo( CmdSeqEntryType* psEntry )
+{
+   const ABCC_CmdSeqType* psCmdSeq;
+   ABCC_CmdSeqRespStatusType eStatus;
+
+   psCmdSeq = &psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ];
+
+#if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
+   ABCC_DebugPrintf( "CmdSeq(%p)->Response timeout in %s()\n",
+         (void*)psEntry->pasCmdSeq,
+         psCmdSeq->pcCmdName );
+#endif
+
+   RetireInFlight( psEntry );
+   psEntry->fTmoActive = FALSE;
+
+   if( psCmdSeq->pnTmoHandler != NULL )
+   {
+      eStatus = psCmdSeq->pnTmoHandler( psEntry->pxUserData );
+   }
+   else if( ( psEntry->bTmoRetryCount < ABCC_CFG_CMD_SEQ_MAX_NUM_TMO_RETRIES ) &&
+            !( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_NO_TMO_RETRY ) )
+   {
+      eStatus = ABCC_CMDSEQ_RESP_EXEC_CURRENT;
+   }
+   else
+   {
+      eStatus = ABCC_CMDSEQ_RESP_ABORT;
+   }
+   psEntry->bTmoRetryCount++;
+
+   if( ( eStatus == ABCC_CMDSEQ_RESP_EXEC_CURRENT ) &&
+       ( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_PIPELINED ) )
+   {
+      /*
+      ** The command handler of a pipelined step has already moved on, the
+      ** timed out commands are sent again from their copies.
+      */
+      if( ReissueInFlight( psEntry ) )
+      {
+         return;
+      }
+      eStatus = ABCC_CMDSEQ_RESP_ABORT;
+   }
+
+   ReleaseInFlight( psEntry );
+
+   if( eStatus == ABCC_CMDSEQ_RESP_EXEC_CURRENT )
+   {
+      (void)ExecCmdSequence( psEntry, GetStepMsgBuffer( psEntry ) );
+   }
+   else if( eStatus == ABCC_CMDSEQ_RESP_EXEC_NEXT )
+   {
+      NextStep( psEntry );
+      (void)ExecCmdSequence( psEntry, GetStepMsgBuffer( psEntry ) );
+   }
+   else
+   {
+      ABCC_ERROR( ABCC_SEV_WARNING, ABCC_EC_CMD_SEQ_RESP_TMO, (UINT32)(uintptr_t)psEntry->pasCmdSeq );
+      psEntry->eSeqResult = ABCC_CMDSEQ_RESULT_ABORT_TMO;
+      FinishCmdSequence( psEntry );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Ends the command sequence and calls the done callback.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry - Pointer to handler
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void FinishCmdSequence( CmdSeqEntryType* psEntry )
+{
+   ABCC_CmdSeqDoneHandler pnSeqDone;
+   void *pxUserData;
+   ABCC_CmdSeqResultType eSeqResult;
+
+#if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
+   ABCC_DebugPrintf( "CmdSeq(%p)->Done\n",
+         (void*)psEntry->pasCmdSeq );
+#endif
+   pnSeqDone = psEntry->pnSeqDone;
+   pxUserData = psEntry->pxUserData;
+   eSeqResult = psEntry->eSeqResult;
+
+   ResetCmdSeqEntry( psEntry, FALSE );
+
+   if( pnSeqDone != NULL )
+   {
+      pnSeqDone( eSeqResult, pxUserData );
+   }
+}
+
 /*------------------------------------------------------------------------------
 ** Execute the command sequence
 **------------------------------------------------------------------------------
@@ -456,18 +918,42 @@ static void HandleResponse( ABP_MsgType* psMsg )
 static BOOL ExecCmdSequence( CmdSeqEntryType* psEntry, ABP_MsgType* psMsg )
 {
    BOOL fCmdBufferConsumed;
+   BOOL fAbort;
+   BOOL fBufferTooSmall;
    const ABCC_CmdSeqType* psCmdSeq;
    ABCC_CmdSeqCmdStatusType eStatus;
+   ABP_MsgType* apsSendMsg[ ABCC_CFG_CMD_SEQ_MAX_PIPELINED ];
+   UINT8 bNumSendMsg;
+   UINT8 i;
 
    fCmdBufferConsumed = FALSE;
+   fAbort = FALSE;
+   fBufferTooSmall = FALSE;
+   bNumSendMsg = 0;
 
    if( psMsg != NULL )
    {
       psEntry->bRetryCount = 0;
       psCmdSeq = &psEntry->pasCmdSeq[ psEntry->bCurrSeqIndex ];
 
-      while( ( psCmdSeq->pnCmdHandler != NULL ) && !fCmdBufferConsumed )
+      while( ( psCmdSeq->pnCmdHandler != NULL ) && ( psMsg != NULL ) && !fAbort )
       {
+         if( ABCC_MemGetMaxDataSize( psMsg ) < GetStepMaxDataSize( psCmdSeq ) )
+         {
+            /*
+            ** The buffer is a short received response, or was taken for a
+            ** short command of a skipped step. Swap it for one that fits.
+            */
+            ABCC_ReturnMsgBuffer( &psMsg );
+            psMsg = GetStepMsgBuffer( psEntry );
+
+            if( psMsg == NULL )
+            {
+               fBufferTooSmall = TRUE;
+               break;
+            }
+         }
+
 #if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
          ABCC_DebugPrintf( "CmdSeq(%p)->%s()\n",
                (void*)psEntry->pasCmdSeq,
@@ -477,6 +963,16 @@ static BOOL ExecCmdSequence( CmdSeqEntryType* psEntry, ABP_MsgType* psMsg )
          eStatus = psCmdSeq->pnCmdHandler( psMsg, psEntry->pxUserData );
          if( eStatus == ABCC_CMDSEQ_CMD_SKIP )
          {
+            if( ( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_PIPELINED ) &&
+                ( psEntry->bNumInFlight > 0 ) )
+            {
+               /*
+               ** No more commands in this pipelined step. Wait for the
+               ** outstanding responses before moving on.
+               */
+               psEntry->fStepCmdsDone = TRUE;
+               break;
+            }
 #if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
             ABCC_DebugPrintf( "CmdSeq(%p)->Command not sent, jump to next sequence step\n",
                   (void*)psEntry->pasCmdSeq );
@@ -485,17 +981,35 @@ static BOOL ExecCmdSequence( CmdSeqEntryType* psEntry, ABP_MsgType* psMsg )
             ** User has chosen not to execute this command. Move to next.
             */
             psCmdSeq++;
-            psEntry->bCurrSeqIndex++;
+            NextStep( psEntry );
          }
          else if( eStatus == ABCC_CMDSEQ_CMD_SEND )
          {
-            psEntry->bSourceId = ABCC_GetMsgSourceId( psMsg );
-            if( !CheckAndSetState( psEntry, CMD_SEQ_STATE_ANY, CMD_SEQ_STATE_WAIT_RESP ) )
+            psEntry->apsCmdCopy[ psEntry->bNumInFlight ] = NULL;
+            if( ( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_PIPELINED ) &&
+                !( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_NO_TMO_RETRY ) &&
+                ( psCmdSeq->iTmoMs != 0 ) )
             {
-               ABCC_ASSERT( FALSE );
+               psEntry->apsCmdCopy[ psEntry->bNumInFlight ] = CopyCmdMsg( psMsg );
+            }
+            psEntry->abSourceId[ psEntry->bNumInFlight++ ] = ABCC_GetMsgSourceId( psMsg );
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+            abcc_abSrcIdToCmdSeq[ ABCC_GetMsgSourceId( psMsg ) ] =
+               (UINT8)( psEntry - abcc_asCmdSeq );
+#endif
+            apsSendMsg[ bNumSendMsg++ ] = psMsg;
+            psMsg = NULL;
+
+            /*
+            ** A pipelined step continues with the next command as long as
+            ** there are free command resources.
+            */
+            if( ( psCmdSeq->bFlags & ABCC_CMDSEQ_FLAG_PIPELINED ) &&
+                ( psEntry->bNumInFlight < ABCC_CFG_CMD_SEQ_MAX_PIPELINED ) &&
+                ( ABCC_GetCmdQueueSize() > bNumSendMsg ) )
+            {
+               psMsg = ABCC_GetCmdMsgBufferOfSize( GetStepMaxDataSize( psCmdSeq ) );
             }
-            (void)ABCC_SendCmdMsg( psMsg, HandleResponse );
-            fCmdBufferConsumed = TRUE;
          }
          else if( eStatus == ABCC_CMDSEQ_CMD_ABORT )
          {
@@ -503,11 +1017,7 @@ static BOOL ExecCmdSequence( CmdSeqEntryType* psEntry, ABP_MsgType* psMsg )
             ABCC_DebugPrintf( "CmdSeq(%p)->Aborted\n",
                   (void*)psEntry->pasCmdSeq );
 #endif
-            /*
-            ** Abort move to end of sequence
-            */
-            while( (++psCmdSeq)->pnCmdHandler != NULL );
-            psEntry->eSeqResult = ABCC_CMDSEQ_RESULT_ABORT_INT;
+            fAbort = TRUE;
          }
          else
          {
@@ -515,37 +1025,74 @@ static BOOL ExecCmdSequence( CmdSeqEntryType* psEntry, ABP_MsgType* psMsg )
          }
       }
 
+      if( fBufferTooSmall )
+      {
+         /*
+         ** Try again with a buffer of the right size at next call of
+         ** ABCC_CmdSequencerExec().
+         */
+         if( !CheckAndSetState( psEntry, CMD_SEQ_STATE_ANY, CMD_SEQ_STATE_RETRIGGER ) )
+         {
+            ABCC_ASSERT( FALSE );
+         }
+         return( TRUE );
+      }
+
+      if( fAbort )
+      {
+         /*
+         ** Drop the commands of this step that have not been sent yet and the
+         ** ones waiting for responses, then move to end of sequence.
+         */
+         while( bNumSendMsg > 0 )
+         {
+            ABCC_ReturnMsgBuffer( &apsSendMsg[ --bNumSendMsg ] );
+            psEntry->bNumInFlight--;
+            FreeCmdCopy( psEntry, psEntry->bNumInFlight );
+         }
+         ReleaseInFlight( psEntry );
+         while( (++psCmdSeq)->pnCmdHandler != NULL );
+         psEntry->eSeqResult = ABCC_CMDSEQ_RESULT_ABORT_INT;
+      }
+
+      /*
+      ** Free a buffer that was not used for a command.
+      */
+      if( psMsg != NULL )
+      {
+         ABCC_ReturnMsgBuffer( &psMsg );
+      }
+      fCmdBufferConsumed = TRUE;
+
       /*
       ** Check end of sequence
       */
       if( psCmdSeq->pnCmdHandler == NULL )
       {
-         ABCC_CmdSeqDoneHandler pnSeqDone;
-         void *pxUserData;
-         ABCC_CmdSeqResultType eSeqResult;
-
+         FinishCmdSequence( psEntry );
+      }
+      else
+      {
          /*
-         ** Free resource before calling done callback
+         ** All bookkeeping of the step is done before the state is changed
+         ** since the responses may be handled in another context.
          */
-         ABCC_ReturnMsgBuffer( &psMsg );
-         fCmdBufferConsumed = TRUE;
-
-#if ABCC_CFG_DEBUG_CMD_SEQ_ENABLED
-         ABCC_DebugPrintf( "CmdSeq(%p)->Done\n",
-               (void*)psEntry->pasCmdSeq );
-#endif
-         pnSeqDone = psEntry->pnSeqDone;
-         pxUserData = psEntry->pxUserData;
-         eSeqResult = psEntry->eSeqResult;
-
-         ResetCmdSeqEntry( psEntry, FALSE );
+         WaitForResponse( psEntry );
 
-         if( pnSeqDone != NULL )
+         for( i = 0; i < bNumSendMsg; i++ )
          {
-            pnSeqDone( eSeqResult, pxUserData );
+            (void)ABCC_SendCmdMsg( apsSendMsg[ i ], HandleResponse );
          }
       }
    }
+   else if( psEntry->bNumInFlight > 0 )
+   {
+      /*
+      ** Out of resources in a pipelined step. The next response will trigger
+      ** a new attempt.
+      */
+      WaitForResponse( psEntry );
+   }
    else
    {
       /*
@@ -588,7 +1135,7 @@ ABCC_ErrorCodeType ABCC_CmdSeqAdd(
          *pxHandle = (ABCC_CmdSeqHandle)psEntry;
       }
 
-      psMsg = ABCC_GetCmdMsgBuffer();
+      psMsg = GetStepMsgBuffer( psEntry );
       (void)ExecCmdSequence( psEntry, psMsg );
    }
    else
@@ -641,14 +1188,20 @@ void ABCC_CmdSequencerExec( void )
 {
    UINT8 i;
    ABP_MsgType* psMsg;
+   CmdSeqEntryType* psEntry;
+   BOOL fTmoActive;
+   BOOL fUptimeRead;
+   UINT32 lNowMs;
+   UINT32 lDeadlineMs;
+   ABCC_PORT_UseCritical();
+
+   ABCC_TRACE( ABCC_TRACE_CMD_SEQ_BEGIN, 0 );
 
    /*
    ** Only execute if any sequence requires re-trigger.
    */
    if( abcc_iNeedReTriggerCount > 0 )
    {
-      psMsg = NULL;
-
       for( i = 0; i < ABCC_CFG_MAX_NUM_CMD_SEQ; i++ )
       {
          if( CheckAndSetState( &abcc_asCmdSeq[ i ], CMD_SEQ_STATE_RETRIGGER, CMD_SEQ_STATE_BUSY ) )
@@ -659,25 +1212,61 @@ void ABCC_CmdSequencerExec( void )
                ABCC_ERROR( ABCC_SEV_WARNING, ABCC_EC_OUT_OF_MSG_BUFFERS, (UINT32)abcc_asCmdSeq[ i ].pasCmdSeq );
             }
 
-            if( psMsg == NULL )
-            {
-               psMsg = ABCC_GetCmdMsgBuffer();
-            }
-
-            if( ExecCmdSequence( &abcc_asCmdSeq[ i ], psMsg ) == TRUE )
+            /*
+            ** Each sequence gets a buffer sized for its current step.
+            */
+            psMsg = GetStepMsgBuffer( &abcc_asCmdSeq[ i ] );
+            if( ( ExecCmdSequence( &abcc_asCmdSeq[ i ], psMsg ) == FALSE ) &&
+                ( psMsg != NULL ) )
             {
-               /*
-               ** Message buffer consumed
-               */
-               psMsg = NULL;
+               ABCC_ReturnMsgBuffer( &psMsg );
             }
          }
       }
+   }
 
-      if( psMsg != NULL )
+   /*
+   ** Supervise response timeouts.
+   */
+   fUptimeRead = FALSE;
+   lNowMs = 0;
+
+   for( i = 0; i < ABCC_CFG_MAX_NUM_CMD_SEQ; i++ )
+   {
+      psEntry = &abcc_asCmdSeq[ i ];
+
+      ABCC_PORT_EnterCritical();
+      fTmoActive = ( psEntry->eState == CMD_SEQ_STATE_WAIT_RESP ) && psEntry->fTmoActive;
+      lDeadlineMs = psEntry->lTmoDeadlineMs;
+      ABCC_PORT_ExitCritical();
+
+      if( fTmoActive )
       {
-         ABCC_ReturnMsgBuffer( &psMsg );
+         if( !fUptimeRead )
+         {
+            lNowMs = (UINT32)ABCC_GetUptimeMs();
+            fUptimeRead = TRUE;
+         }
+
+         if( ( (INT32)( lNowMs - lDeadlineMs ) >= 0 ) &&
+             CheckAndSetState( psEntry, CMD_SEQ_STATE_WAIT_RESP, CMD_SEQ_STATE_BUSY ) )
+         {
+            /*
+            ** A response may have moved the sequence to a new step after the
+            ** deadline was read.
+            */
+            if( psEntry->fTmoActive &&
+                ( (INT32)( lNowMs - psEntry->lTmoDeadlineMs ) >= 0 ) )
+            {
+               HandleRespTmo( psEntry );
+            }
+            else if( !CheckAndSetState( psEntry, CMD_SEQ_STATE_BUSY, CMD_SEQ_STATE_WAIT_RESP ) )
+            {
+               ABCC_ASSERT( FALSE );
+            }
+         }
       }
    }
+   ABCC_TRACE( ABCC_TRACE_CMD_SEQ_END, 0 );
 }
 #endif
@@ -0,0 +1,51 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Context of this driver instance, see abcc_context.h.
+********************************************************************************
+*/
+
+#include "abcc_config.h"
+#include "abcc_types.h"
+#include "abcc.h"
+#include "application_abcc_handler.h"
+#include "abcc_context.h"
+
+/*
+** Compiled once per instance. The instance prefix renames both the context and
+** all functions referenced here.
+*/
+const ABCC_CtxType ABCC_sContext =
+{
+   ABCC_HwInit,
+   ABCC_StartDriver,
+   ABCC_ShutdownDriver,
+   ABCC_isReadyForCommunication,
+   &ABCC_RunDriver,
+   &ABCC_ISR,
+   ABCC_RunTimerSystem,
+   ABCC_HWReset,
+   ABCC_HWReleaseReset,
+   ABCC_ModuleDetect,
+   ABCC_AnbState,
+   ABCC_NetworkType,
+   ABCC_GetCmdMsgBuffer,
+   ABCC_SendCmdMsg,
+   ABCC_SendRespMsg,
+   ABCC_ReturnMsgBuffer,
+   &ABCC_TriggerWrPdUpdate,
+   APPL_HandleAbcc,
+   APPL_RestartAbcc,
+   APPL_Shutdown,
+   APPL_Reset
+};
@@ -18,6 +18,16 @@
 #include "abcc_types.h"
 #include "abcc.h"
 
+#ifndef ABCC_SYS_16_BIT_CHAR
+#if defined( __SSSE3__ )
+#include <tmmintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+#endif
+
 #ifdef ABCC_SYS_16_BIT_CHAR
 void ABCC_CopyOctetsImpl( void* pxDest, UINT16 iDestOctetOffset,
                           const void* pxSrc, UINT16 iSrcOctetOffset,
@@ -135,3 +145,266 @@ void * ABCC_PORT_CopyImpl( void *pbDest, const void *pbSource, int iNbrOfOctets
 }
 #endif
 #endif
+
+#ifdef ABCC_SYS_16_BIT_CHAR
+void ABCC_Copy16WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem )
+{
+   UINT16 i;
+   UINT16 iConv;
+
+   for( i = 0; i < iNumElem; i++ )
+   {
+      ABCC_PORT_Copy16( &iConv, 0, pxSrc, iSrcOctetOffset + ( i << 1 ) );
+      iConv = ABCC_iEndianSwap( iConv );
+      ABCC_PORT_Copy16( pxDest, iDestOctetOffset + ( i << 1 ), &iConv, 0 );
+   }
+}
+
+void ABCC_Copy32WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem )
+{
+   UINT16 i;
+   UINT32 lConv;
+
+   for( i = 0; i < iNumElem; i++ )
+   {
+      ABCC_PORT_Copy32( &lConv, 0, pxSrc, iSrcOctetOffset + ( i << 2 ) );
+      lConv = ABCC_lEndianSwap( lConv );
+      ABCC_PORT_Copy32( pxDest, iDestOctetOffset + ( i << 2 ), &lConv, 0 );
+   }
+}
+
+#if ( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
+void ABCC_Copy64WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem )
+{
+   UINT16 i;
+   UINT64 lConv;
+
+   for( i = 0; i < iNumElem; i++ )
+   {
+      ABCC_PORT_Copy64( &lConv, 0, pxSrc, iSrcOctetOffset + ( i << 3 ) );
+      lConv = ABCC_l64EndianSwap( lConv );
+      ABCC_PORT_Copy64( pxDest, iDestOctetOffset + ( i << 3 ), &lConv, 0 );
+   }
+}
+#endif
+#else
+/*------------------------------------------------------------------------------
+** Endian swaps as many complete 16 octet blocks as possible from pbSrc to
+** pbDest using the SIMD instructions available on the target. Loads and stores
+** are unaligned since the octet offsets of process data are arbitrary.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pbDest            - Pointer to the destination.
+**    pbSrc             - Pointer to the source.
+**    iNumOctets        - Number of octets available in source and destination.
+**    bElemSize         - Size of each value in octets (2, 4 or 8).
+**
+** Returns:
+**    Number of octets swapped (a multiple of 16).
+**------------------------------------------------------------------------------
+*/
+static UINT16 SwapBlocks( UINT8* pbDest, const UINT8* pbSrc,
+                          UINT16 iNumOctets, UINT8 bElemSize )
+{
+   UINT16 iDone;
+
+   iDone = 0;
+#if defined( __SSSE3__ )
+   {
+      __m128i xMask;
+      __m128i xData;
+
+      if( bElemSize == 2 )
+      {
+         xMask = _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6,
+                                9, 8, 11, 10, 13, 12, 15, 14 );
+      }
+      else if( bElemSize == 4 )
+      {
+         xMask = _mm_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4,
+                                11, 10, 9, 8, 15, 14, 13, 12 );
+      }
+      else
+      {
+         xMask = _mm_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0,
+                                15, 14, 13, 12, 11, 10, 9, 8 );
+      }
+
+      for( ; ( iNumOctets - iDone ) >= 16; iDone += 16 )
+      {
+         xData = _mm_loadu_si128( (const __m128i*)&pbSrc[ iDone ] );
+         xData = _mm_shuffle_epi8( xData, xMask );
+         _mm_storeu_si128( (__m128i*)&pbDest[ iDone ], xData );
+      }
+   }
+#elif defined( __SSE2__ )
+   {
+      __m128i xData;
+
+      for( ; ( iNumOctets - iDone ) >= 16; iDone += 16 )
+      {
+         xData = _mm_loadu_si128( (const __m128i*)&pbSrc[ iDone ] );
+         xData = _mm_or_si128( _mm_slli_epi16( xData, 8 ),
+                               _mm_srli_epi16( xData, 8 ) );
+         if( bElemSize == 4 )
+         {
+            xData = _mm_shufflelo_epi16( xData, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+            xData = _mm_shufflehi_epi16( xData, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+         }
+         else if( bElemSize == 8 )
+         {
+            xData = _mm_shufflelo_epi16( xData, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+            xData = _mm_shufflehi_epi16( xData, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+         }
+         _mm_storeu_si128( (__m128i*)&pbDest[ iDone ], xData );
+      }
+   }
+#elif defined( __ARM_NEON )
+   for( ; ( iNumOctets - iDone ) >= 16; iDone += 16 )
+   {
+      uint8x16_t xData;
+
+      xData = vld1q_u8( &pbSrc[ iDone ] );
+      if( bElemSize == 2 )
+      {
+         xData = vrev16q_u8( xData );
+      }
+      else if( bElemSize == 4 )
+      {
+         xData = vrev32q_u8( xData );
+      }
+      else
+      {
+         xData = vrev64q_u8( xData );
+      }
+      vst1q_u8( &pbDest[ iDone ], xData );
+   }
+#else
+   (void)pbDest;
+   (void)pbSrc;
+   (void)iNumOctets;
+   (void)bElemSize;
+#endif
+
+   return( iDone );
+}
+
+/*------------------------------------------------------------------------------
+** Endian swaps the remaining values one octet at a time.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pbDest            - Pointer to the destination.
+**    pbSrc             - Pointer to the source.
+**    iNumOctets        - Number of octets to swap.
+**    bElemSize         - Size of each value in octets.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void SwapOctets( UINT8* pbDest, const UINT8* pbSrc,
+                        UINT16 iNumOctets, UINT8 bElemSize )
+{
+   UINT16 i;
+   UINT8  b;
+
+   for( i = 0; i < iNumOctets; i += bElemSize )
+   {
+      for( b = 0; b < bElemSize; b++ )
+      {
+         pbDest[ i + b ] = pbSrc[ i + bElemSize - 1 - b ];
+      }
+   }
+}
+
+void ABCC_Copy16WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem )
+{
+   UINT8*       pbDest;
+   const UINT8* pbSrc;
+   UINT16       iNumOctets;
+   UINT16       iDone;
+   UINT32       lData;
+
+   pbDest = (UINT8*)pxDest + iDestOctetOffset;
+   pbSrc = (const UINT8*)pxSrc + iSrcOctetOffset;
+   iNumOctets = iNumElem << 1;
+
+   iDone = SwapBlocks( pbDest, pbSrc, iNumOctets, 2 );
+
+   /*
+   ** Two values per 32 bit word.
+   */
+   for( ; ( iNumOctets - iDone ) >= 4; iDone += 4 )
+   {
+      ABCC_PORT_MemCpy( &lData, &pbSrc[ iDone ], 4 );
+      lData = ( ( lData & 0x00FF00FFUL ) << 8 ) | ( ( lData >> 8 ) & 0x00FF00FFUL );
+      ABCC_PORT_MemCpy( &pbDest[ iDone ], &lData, 4 );
+   }
+
+   SwapOctets( &pbDest[ iDone ], &pbSrc[ iDone ], iNumOctets - iDone, 2 );
+}
+
+void ABCC_Copy32WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem )
+{
+   UINT8*       pbDest;
+   const UINT8* pbSrc;
+   UINT16       iNumOctets;
+   UINT16       iDone;
+   UINT32       lData;
+
+   pbDest = (UINT8*)pxDest + iDestOctetOffset;
+   pbSrc = (const UINT8*)pxSrc + iSrcOctetOffset;
+   iNumOctets = iNumElem << 2;
+
+   iDone = SwapBlocks( pbDest, pbSrc, iNumOctets, 4 );
+
+   for( ; iDone < iNumOctets; iDone += 4 )
+   {
+      ABCC_PORT_MemCpy( &lData, &pbSrc[ iDone ], 4 );
+      lData = ABCC_lEndianSwap( lData );
+      ABCC_PORT_MemCpy( &pbDest[ iDone ], &lData, 4 );
+   }
+}
+
+#if ( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
+void ABCC_Copy64WithEndianSwapImpl( void* pxDest, UINT16 iDestOctetOffset,
+                                    const void* pxSrc, UINT16 iSrcOctetOffset,
+                                    UINT16 iNumElem )
+{
+   UINT8*       pbDest;
+   const UINT8* pbSrc;
+   UINT16       iNumOctets;
+   UINT16       iDone;
+   UINT32       alData[ 2 ];
+   UINT32       lData;
+
+   pbDest = (UINT8*)pxDest + iDestOctetOffset;
+   pbSrc = (const UINT8*)pxSrc + iSrcOctetOffset;
+   iNumOctets = iNumElem << 3;
+
+   iDone = SwapBlocks( pbDest, pbSrc, iNumOctets, 8 );
+
+   /*
+   ** Swap each 32 bit half and exchange them.
+   */
+   for( ; iDone < iNumOctets; iDone += 8 )
+   {
+      ABCC_PORT_MemCpy( alData, &pbSrc[ iDone ], 8 );
+      lData = ABCC_lEndianSwap( alData[ 0 ] );
+      alData[ 0 ] = ABCC_lEndianSwap( alData[ 1 ] );
+      alData[ 1 ] = lData;
+      ABCC_PORT_MemCpy( &pbDest[ iDone ], alData, 8 );
+   }
+}
+#endif
+#endif
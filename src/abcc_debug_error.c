@@ -16,6 +16,8 @@
 */
 
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "abcc_config.h"
 #include "abcc.h"
@@ -172,7 +174,18 @@ void ABCC_DebugPrintf( const char *format, ... )
 #endif
 
 #if ABCC_CFG_DEBUG_MESSAGING_ENABLED
-void ABCC_DebugPrintMsg( char* pcInfo, ABP_MsgType* psMsg )
+/*------------------------------------------------------------------------------
+** Prints ABCC message content without timestamp.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pcInfo   - General information about the debug print.
+**    pxMsgBuf - Address of the message buffer to print.
+**    psMsg    - ABCC message, or a copy of it.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void PrintMsg( char* pcInfo, const void* pxMsgBuf, ABP_MsgType* psMsg )
 {
    UINT16 i;
    UINT16 iDataSize;
@@ -180,11 +193,9 @@ void ABCC_DebugPrintMsg( char* pcInfo, ABP_MsgType* psMsg )
 
    iDataSize = ABCC_GetMsgDataSize( psMsg );
 
-   ABCC_DebugPrintTimestamp();
-
    ABCC_PORT_printf( "\n%s:\n", pcInfo );
    ABCC_PORT_printf( "[ MsgBuf:0x%p Size:0x%04x SrcId  :0x%02x DestObj:0x%02x\n  Inst  :0x%04x     Cmd :0x%02x   CmdExt0:0x%02x CmdExt1:0x%02x ]\n",
-                     (void*)psMsg,
+                     pxMsgBuf,
                      ABCC_GetMsgDataSize( psMsg ),
                      ABCC_GetMsgSourceId( psMsg ),
                      ABCC_GetMsgDestObj( psMsg ),
@@ -208,6 +219,12 @@ void ABCC_DebugPrintMsg( char* pcInfo, ABP_MsgType* psMsg )
    ABCC_PORT_printf( ( "]\n\n" ) );
 }
 
+void ABCC_DebugPrintMsg( char* pcInfo, ABP_MsgType* psMsg )
+{
+   ABCC_DebugPrintTimestamp();
+   PrintMsg( pcInfo, (void*)psMsg, psMsg );
+}
+
 void ABCC_DebugPrintMsgEvent( char* pcInfo, ABP_MsgType* psMsg )
 {
    ABCC_DebugPrintf( "%s: MsgBuf:0x%p SrcId:0x%02x\n",
@@ -274,13 +291,21 @@ void ABCC_ErrorHandler( ABCC_SeverityType eSeverity,
 
 
 #if ABCC_CFG_DEBUG_HEXDUMP_MSG_ENABLED
-void ABCC_DebugHexdumpMsg( char* pcInfo, ABP_MsgType* psMsg )
+/*------------------------------------------------------------------------------
+** Hexdump of an ABCC message without timestamp.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pcInfo - Tag to prepend to the output.
+**    psMsg  - ABCC message, or a copy of it.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void PrintHexdumpMsg( char* pcInfo, ABP_MsgType* psMsg )
 {
    UINT16   iIndex;
    UINT16   iSizeInBytes;
 
-   ABCC_DebugPrintTimestamp();
-
    ABCC_PORT_printf( "%s", pcInfo );
 
    iSizeInBytes = ABCC_GetMsgDataSize( psMsg );
@@ -316,14 +341,29 @@ void ABCC_DebugHexdumpMsg( char* pcInfo, ABP_MsgType* psMsg )
 
    ABCC_PORT_printf( "\n" );
 }
+
+void ABCC_DebugHexdumpMsg( char* pcInfo, ABP_MsgType* psMsg )
+{
+   ABCC_DebugPrintTimestamp();
+   PrintHexdumpMsg( pcInfo, psMsg );
+}
 #endif
 
 
 #if ABCC_CFG_DEBUG_HEXDUMP_SPI_ENABLED
-void ABCC_DebugHexdumpSpi( char* pcInfo, UINT16* piData, UINT16 iSizeInWords )
+/*------------------------------------------------------------------------------
+** Hexdump of SPI frame data without timestamp.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pcInfo       - Tag to prepend to the output.
+**    piData       - Pointer to SPI frame data.
+**    iSizeInWords - SPI frame size in words.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void PrintHexdumpSpi( char* pcInfo, const UINT16* piData, UINT16 iSizeInWords )
 {
-   ABCC_DebugPrintTimestamp();
-
    ABCC_PORT_printf( "%s", pcInfo );
 
    while( iSizeInWords )
@@ -335,14 +375,29 @@ void ABCC_DebugHexdumpSpi( char* pcInfo, UINT16* piData, UINT16 iSizeInWords )
 
    ABCC_PORT_printf( "\n" );
 }
+
+void ABCC_DebugHexdumpSpi( char* pcInfo, UINT16* piData, UINT16 iSizeInWords )
+{
+   ABCC_DebugPrintTimestamp();
+   PrintHexdumpSpi( pcInfo, piData, iSizeInWords );
+}
 #endif
 
 
 #if ABCC_CFG_DEBUG_HEXDUMP_UART_ENABLED
-void ABCC_DebugHexdumpUart( char* pcInfo, UINT8* pbData, UINT16 iSizeInBytes )
+/*------------------------------------------------------------------------------
+** Hexdump of UART telegram data without timestamp.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pcInfo       - Tag to prepend to the output.
+**    pbData       - Pointer to UART telegram data.
+**    iSizeInBytes - UART telegram size in bytes.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void PrintHexdumpUart( char* pcInfo, const UINT8* pbData, UINT16 iSizeInBytes )
 {
-   ABCC_DebugPrintTimestamp();
-
    ABCC_PORT_printf( "%s", pcInfo );
 
    while( iSizeInBytes )
@@ -354,4 +409,658 @@ void ABCC_DebugHexdumpUart( char* pcInfo, UINT8* pbData, UINT16 iSizeInBytes )
 
    ABCC_PORT_printf( "\n" );
 }
+
+void ABCC_DebugHexdumpUart( char* pcInfo, UINT8* pbData, UINT16 iSizeInBytes )
+{
+   ABCC_DebugPrintTimestamp();
+   PrintHexdumpUart( pcInfo, pbData, iSizeInBytes );
+}
+#endif
+
+
+#if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+#ifndef ABCC_PORT_AtomicExchange8
+#error "ABCC_PORT_AtomicExchange8 must be ported if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED is enabled."
+#endif
+#ifndef ABCC_PORT_AtomicIncrement16
+#error "ABCC_PORT_AtomicIncrement16 must be ported if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED is enabled."
+#endif
+
+/*
+** Max number of arguments (including '*' width and precision arguments) of a
+** deferred printf entry. Entries with more arguments are dropped.
+*/
+#define LOG_MAX_NUM_ARGS         8
+
+/*
+** Max length of a single conversion specification, including the '%' and the
+** terminating zero, after '*' has been replaced by its value.
+*/
+#define LOG_MAX_SPEC_LEN         32
+
+#ifdef ABCC_SYS_16_BIT_CHAR
+#define LOG_OCTETS_PER_CHAR      2
+#define LOG_MSG_HEADER_OCTETS    ( sizeof( ABP_MsgHeaderType16 ) * 2 )
+#else
+#define LOG_OCTETS_PER_CHAR      1
+#define LOG_MSG_HEADER_OCTETS    ( sizeof( ABP_MsgHeaderType ) )
+#endif
+
+/*------------------------------------------------------------------------------
+** Argument classes of printf conversion specifications.
+**------------------------------------------------------------------------------
+*/
+typedef enum LogArgClass
+{
+   LOG_ARG_NONE,
+   LOG_ARG_INT,
+   LOG_ARG_LONG,
+   LOG_ARG_LLONG,
+   LOG_ARG_INTMAX,
+   LOG_ARG_PTRDIFF,
+   LOG_ARG_UINT,
+   LOG_ARG_ULONG,
+   LOG_ARG_ULLONG,
+   LOG_ARG_UINTMAX,
+   LOG_ARG_SIZE,
+   LOG_ARG_PTR,
+   LOG_ARG_DOUBLE,
+   LOG_ARG_LDOUBLE,
+   LOG_ARG_COUNT
+}
+LogArgClassType;
+
+/*------------------------------------------------------------------------------
+** Log buffer unit. Each entry starts with a header unit followed by entry type
+** specific units:
+**
+** ABCC_LOG_PAD         - Unused units up to the end of the buffer.
+** ABCC_LOG_PRINTF      - Format string, one unit per argument.
+** ABCC_LOG_MSG_EVENT   - Info string, message buffer address, source id.
+** ABCC_LOG_MSG_DATA    - Info string, message buffer address, message copy.
+** ABCC_LOG_HEXDUMP_MSG - Info string, message buffer address, message copy.
+** ABCC_LOG_HEXDUMP_SPI - Info string, data copy.
+** ABCC_LOG_HEXDUMP_UART- Info string, data copy.
+**------------------------------------------------------------------------------
+*/
+typedef union LogUnit
+{
+   struct
+   {
+      UINT16 iNumUnits;
+      UINT16 iNumOctets;
+      UINT8  bType;
+      UINT8  bNumArgs;
+   }
+   sHdr;
+   const void*          pxPtr;
+   long long            llInt;
+   unsigned long long   llUint;
+   double               dFloat;
+}
+LogUnitType;
+
+#define LOG_NUM_UNITS            ( ABCC_CFG_DEBUG_LOG_BUFFER_SIZE / sizeof( LogUnitType ) )
+#define LOG_OCTETS_PER_UNIT      ( sizeof( LogUnitType ) * LOG_OCTETS_PER_CHAR )
+
+/*
+** Log buffer and its indexes (in units). Entries are stored between
+** log_iRead and log_iWrite. One unit is always left unused to tell a full
+** buffer from an empty one.
+** log_iWrite is only written by the context holding log_bLock and log_iRead
+** only by ABCC_LogFlush().
+*/
+static LogUnitType      log_asBuffer[ LOG_NUM_UNITS ];
+static volatile UINT16  log_iWrite = 0;
+static volatile UINT16  log_iRead = 0;
+static UINT16           log_iPendingWrite;
+static volatile UINT8   log_bLock = 0;
+static volatile UINT16  log_iLostCount = 0;
+static UINT16           log_iReportedLostCount = 0;
+
+/*------------------------------------------------------------------------------
+** Parses a printf conversion specification.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pcSpec      - Pointer to the character after the '%'.
+**    peClass     - Argument class of the conversion.
+**    pbNumStars  - Number of '*' width/precision arguments.
+** Returns:
+**    Pointer to the character after the conversion specifier.
+**------------------------------------------------------------------------------
+*/
+static const char* ParseSpec( const char* pcSpec, LogArgClassType* peClass, UINT8* pbNumStars )
+{
+   UINT8 bLength;
+   BOOL fSigned;
+
+   *pbNumStars = 0;
+
+   while( ( *pcSpec == '-' ) || ( *pcSpec == '+' ) || ( *pcSpec == ' ' ) ||
+          ( *pcSpec == '#' ) || ( *pcSpec == '0' ) )
+   {
+      pcSpec++;
+   }
+   while( ( ( *pcSpec >= '0' ) && ( *pcSpec <= '9' ) ) || ( *pcSpec == '*' ) ||
+          ( *pcSpec == '.' ) )
+   {
+      if( *pcSpec == '*' )
+      {
+         (*pbNumStars)++;
+      }
+      pcSpec++;
+   }
+
+   /*
+   ** Length modifier: 'h', 'l', 'L', 'j', 'z', 't' or 'hh'/'ll'.
+   */
+   bLength = 0;
+   while( ( *pcSpec == 'h' ) || ( *pcSpec == 'l' ) || ( *pcSpec == 'L' ) ||
+          ( *pcSpec == 'j' ) || ( *pcSpec == 'z' ) || ( *pcSpec == 't' ) )
+   {
+      if( ( bLength == 0 ) || ( *pcSpec == 'l' ) )
+      {
+         bLength = ( bLength == 'l' ) ? 'q' : (UINT8)*pcSpec;
+      }
+      pcSpec++;
+   }
+
+   fSigned = FALSE;
+   switch( *pcSpec )
+   {
+   case 'd':
+   case 'i':
+      fSigned = TRUE;
+      /* Fall through */
+   case 'u':
+   case 'o':
+   case 'x':
+   case 'X':
+   case 'c':
+      switch( bLength )
+      {
+      case 'l':
+         *peClass = fSigned ? LOG_ARG_LONG : LOG_ARG_ULONG;
+         break;
+      case 'q':
+         *peClass = fSigned ? LOG_ARG_LLONG : LOG_ARG_ULLONG;
+         break;
+      case 'j':
+         *peClass = fSigned ? LOG_ARG_INTMAX : LOG_ARG_UINTMAX;
+         break;
+      case 'z':
+         *peClass = LOG_ARG_SIZE;
+         break;
+      case 't':
+         *peClass = LOG_ARG_PTRDIFF;
+         break;
+      default:
+         *peClass = fSigned ? LOG_ARG_INT : LOG_ARG_UINT;
+         break;
+      }
+      break;
+   case 's':
+   case 'p':
+      *peClass = LOG_ARG_PTR;
+      break;
+   case 'n':
+      *peClass = LOG_ARG_COUNT;
+      break;
+   case 'f':
+   case 'F':
+   case 'e':
+   case 'E':
+   case 'g':
+   case 'G':
+   case 'a':
+   case 'A':
+      *peClass = ( bLength == 'L' ) ? LOG_ARG_LDOUBLE : LOG_ARG_DOUBLE;
+      break;
+   default:
+      /*
+      ** '%%' or unknown conversion, no argument.
+      */
+      *peClass = LOG_ARG_NONE;
+      break;
+   }
+
+   if( *pcSpec != '\0' )
+   {
+      pcSpec++;
+   }
+
+   return( pcSpec );
+}
+
+/*------------------------------------------------------------------------------
+** Reserves space for an entry in the log buffer. Must be called with log_bLock
+** held. The entry is published by CommitEntry().
+**------------------------------------------------------------------------------
+** Arguments:
+**    iNumUnits   - Size of the entry in units, including the header.
+** Returns:
+**    Pointer to the first unit of the entry, NULL if the buffer is full.
+**------------------------------------------------------------------------------
+*/
+static LogUnitType* ReserveEntry( UINT16 iNumUnits )
+{
+   UINT16 iWrite;
+   UINT16 iFree;
+   UINT16 iToEnd;
+
+   iWrite = log_iWrite;
+   iFree = (UINT16)( ( log_iRead + LOG_NUM_UNITS - iWrite - 1 ) % LOG_NUM_UNITS );
+   iToEnd = (UINT16)( LOG_NUM_UNITS - iWrite );
+
+   if( iNumUnits > iToEnd )
+   {
+      /*
+      ** Entries are contiguous. Pad the rest of the buffer and start over.
+      */
+      if( ( (UINT32)iToEnd + iNumUnits ) > iFree )
+      {
+         return( NULL );
+      }
+      log_asBuffer[ iWrite ].sHdr.iNumUnits = iToEnd;
+      log_asBuffer[ iWrite ].sHdr.bType = (UINT8)ABCC_LOG_PAD;
+      iWrite = 0;
+   }
+   else if( iNumUnits > iFree )
+   {
+      return( NULL );
+   }
+
+   log_iPendingWrite = (UINT16)( ( iWrite + iNumUnits ) % LOG_NUM_UNITS );
+   log_asBuffer[ iWrite ].sHdr.iNumUnits = iNumUnits;
+
+   return( &log_asBuffer[ iWrite ] );
+}
+
+/*------------------------------------------------------------------------------
+** Publishes the entry reserved by ReserveEntry() to ABCC_LogFlush().
+**------------------------------------------------------------------------------
+*/
+static void CommitEntry( void )
+{
+#ifdef ABCC_PORT_MemoryBarrier
+   ABCC_PORT_MemoryBarrier();
+#endif
+   log_iWrite = log_iPendingWrite;
+}
+
+/*------------------------------------------------------------------------------
+** Tries to take the log buffer lock. Counts the entry as lost if another
+** context holds it.
+**------------------------------------------------------------------------------
+** Returns:
+**    TRUE if the lock was taken.
+**------------------------------------------------------------------------------
+*/
+static BOOL TryLock( void )
+{
+   if( ABCC_PORT_AtomicExchange8( &log_bLock, 1 ) != 0 )
+   {
+      (void)ABCC_PORT_AtomicIncrement16( &log_iLostCount );
+      return( FALSE );
+   }
+   return( TRUE );
+}
+
+/*------------------------------------------------------------------------------
+** Releases the log buffer lock taken by TryLock().
+**------------------------------------------------------------------------------
+** Arguments:
+**    fStored     - FALSE if the entry did not fit and shall be counted as lost.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void Unlock( BOOL fStored )
+{
+   if( !fStored )
+   {
+      (void)ABCC_PORT_AtomicIncrement16( &log_iLostCount );
+   }
+   (void)ABCC_PORT_AtomicExchange8( &log_bLock, 0 );
+}
+
+void ABCC_LogPrintf( const char* pcFormat, ... )
+{
+   va_list argp;
+   LogUnitType asArg[ LOG_MAX_NUM_ARGS ];
+   LogUnitType* psEntry;
+   const char* pcPos;
+   LogArgClassType eClass;
+   UINT8 bNumStars;
+   UINT8 bNumArgs;
+   UINT8 i;
+   BOOL fStored;
+
+   /*
+   ** Collect the arguments before taking the lock to keep the time it is held
+   ** short.
+   */
+   bNumArgs = 0;
+   pcPos = pcFormat;
+   va_start( argp, pcFormat );
+   while( *pcPos != '\0' )
+   {
+      if( *pcPos++ != '%' )
+      {
+         continue;
+      }
+
+      pcPos = ParseSpec( pcPos, &eClass, &bNumStars );
+
+      if( ( bNumArgs + bNumStars + ( eClass != LOG_ARG_NONE ? 1 : 0 ) ) > LOG_MAX_NUM_ARGS )
+      {
+         va_end( argp );
+         (void)ABCC_PORT_AtomicIncrement16( &log_iLostCount );
+         return;
+      }
+
+      while( bNumStars-- > 0 )
+      {
+         asArg[ bNumArgs++ ].llInt = va_arg( argp, int );
+      }
+
+      switch( eClass )
+      {
+      case LOG_ARG_INT:     asArg[ bNumArgs++ ].llInt = va_arg( argp, int ); break;
+      case LOG_ARG_LONG:    asArg[ bNumArgs++ ].llInt = va_arg( argp, long ); break;
+      case LOG_ARG_LLONG:   asArg[ bNumArgs++ ].llInt = va_arg( argp, long long ); break;
+      case LOG_ARG_INTMAX:  asArg[ bNumArgs++ ].llInt = va_arg( argp, intmax_t ); break;
+      case LOG_ARG_PTRDIFF: asArg[ bNumArgs++ ].llInt = va_arg( argp, ptrdiff_t ); break;
+      case LOG_ARG_UINT:    asArg[ bNumArgs++ ].llUint = va_arg( argp, unsigned int ); break;
+      case LOG_ARG_ULONG:   asArg[ bNumArgs++ ].llUint = va_arg( argp, unsigned long ); break;
+      case LOG_ARG_ULLONG:  asArg[ bNumArgs++ ].llUint = va_arg( argp, unsigned long long ); break;
+      case LOG_ARG_UINTMAX: asArg[ bNumArgs++ ].llUint = va_arg( argp, uintmax_t ); break;
+      case LOG_ARG_SIZE:    asArg[ bNumArgs++ ].llUint = va_arg( argp, size_t ); break;
+      case LOG_ARG_PTR:
+      case LOG_ARG_COUNT:   asArg[ bNumArgs++ ].pxPtr = va_arg( argp, void* ); break;
+      case LOG_ARG_DOUBLE:  asArg[ bNumArgs++ ].dFloat = va_arg( argp, double ); break;
+      case LOG_ARG_LDOUBLE: asArg[ bNumArgs++ ].dFloat = (double)va_arg( argp, long double ); break;
+      default: break;
+      }
+   }
+   va_end( argp );
+
+   if( !TryLock() )
+   {
+      return;
+   }
+
+   psEntry = ReserveEntry( (UINT16)( 2 + bNumArgs ) );
+   fStored = ( psEntry != NULL );
+   if( fStored )
+   {
+      psEntry[ 0 ].sHdr.bType = (UINT8)ABCC_LOG_PRINTF;
+      psEntry[ 0 ].sHdr.bNumArgs = bNumArgs;
+      psEntry[ 1 ].pxPtr = pcFormat;
+      for( i = 0; i < bNumArgs; i++ )
+      {
+         psEntry[ 2 + i ] = asArg[ i ];
+      }
+      CommitEntry();
+   }
+
+   Unlock( fStored );
+}
+
+void ABCC_LogMsg( ABCC_LogEntryType eType, char* pcInfo, ABP_MsgType* psMsg )
+{
+   LogUnitType* psEntry;
+   UINT16 iNumOctets;
+   UINT16 iNumUnits;
+   BOOL fStored;
+
+   if( eType == ABCC_LOG_MSG_EVENT )
+   {
+      iNumOctets = 0;
+      iNumUnits = 4;
+   }
+   else
+   {
+      iNumOctets = (UINT16)( ABCC_GetMsgDataSize( psMsg ) + LOG_MSG_HEADER_OCTETS );
+      iNumUnits = (UINT16)( 3 + ( iNumOctets + LOG_OCTETS_PER_UNIT - 1 ) / LOG_OCTETS_PER_UNIT );
+   }
+
+   if( !TryLock() )
+   {
+      return;
+   }
+
+   psEntry = ReserveEntry( iNumUnits );
+   fStored = ( psEntry != NULL );
+   if( fStored )
+   {
+      psEntry[ 0 ].sHdr.bType = (UINT8)eType;
+      psEntry[ 0 ].sHdr.iNumOctets = iNumOctets;
+      psEntry[ 1 ].pxPtr = pcInfo;
+      psEntry[ 2 ].pxPtr = psMsg;
+      if( eType == ABCC_LOG_MSG_EVENT )
+      {
+         psEntry[ 3 ].llUint = ABCC_GetMsgSourceId( psMsg );
+      }
+      else
+      {
+         ABCC_PORT_MemCpy( &psEntry[ 3 ], psMsg, iNumOctets );
+      }
+      CommitEntry();
+   }
+
+   Unlock( fStored );
+}
+
+void ABCC_LogData( ABCC_LogEntryType eType, char* pcInfo, const void* pxData, UINT16 iNumOctets )
+{
+   LogUnitType* psEntry;
+   BOOL fStored;
+
+   if( !TryLock() )
+   {
+      return;
+   }
+
+   psEntry = ReserveEntry( (UINT16)( 2 + ( iNumOctets + LOG_OCTETS_PER_UNIT - 1 ) / LOG_OCTETS_PER_UNIT ) );
+   fStored = ( psEntry != NULL );
+   if( fStored )
+   {
+      psEntry[ 0 ].sHdr.bType = (UINT8)eType;
+      psEntry[ 0 ].sHdr.iNumOctets = iNumOctets;
+      psEntry[ 1 ].pxPtr = pcInfo;
+      ABCC_PORT_MemCpy( &psEntry[ 2 ], pxData, iNumOctets );
+      CommitEntry();
+   }
+
+   Unlock( fStored );
+}
+
+/*------------------------------------------------------------------------------
+** Prints a deferred printf entry. Literal text is printed as is and each
+** conversion specification is printed separately with its stored argument.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psEntry  - Entry header unit.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void PrintPrintfEntry( const LogUnitType* psEntry )
+{
+   const char* pcPos;
+   const char* pcStart;
+   const char* pcEnd;
+   const LogUnitType* psArg;
+   LogArgClassType eClass;
+   UINT8 bNumStars;
+   char acSpec[ LOG_MAX_SPEC_LEN ];
+   UINT16 iLen;
+   int iStar;
+   char acDigits[ 12 ];
+   UINT8 bNumDigits;
+   BOOL fNegative;
+
+   pcPos = (const char*)psEntry[ 1 ].pxPtr;
+   psArg = &psEntry[ 2 ];
+
+   while( *pcPos != '\0' )
+   {
+      pcStart = pcPos;
+      while( ( *pcPos != '\0' ) && ( *pcPos != '%' ) )
+      {
+         pcPos++;
+      }
+      if( pcPos != pcStart )
+      {
+         ABCC_PORT_printf( "%.*s", (int)( pcPos - pcStart ), pcStart );
+      }
+      if( *pcPos == '\0' )
+      {
+         break;
+      }
+
+      pcEnd = ParseSpec( pcPos + 1, &eClass, &bNumStars );
+
+      /*
+      ** Copy the specification, replacing '*' with the stored value and
+      ** removing the 'L' modifier since the value is stored as a double.
+      */
+      iLen = 0;
+      for( ; ( pcPos != pcEnd ) && ( iLen < ( LOG_MAX_SPEC_LEN - 12 ) ); pcPos++ )
+      {
+         if( *pcPos == '*' )
+         {
+            iStar = (int)( psArg++ )->llInt;
+            fNegative = ( iStar < 0 );
+            bNumDigits = 0;
+            do
+            {
+               acDigits[ bNumDigits++ ] = (char)( '0' + ( fNegative ? -( iStar % 10 ) : ( iStar % 10 ) ) );
+               iStar /= 10;
+            }
+            while( iStar != 0 );
+            if( fNegative )
+            {
+               acSpec[ iLen++ ] = '-';
+            }
+            while( bNumDigits > 0 )
+            {
+               acSpec[ iLen++ ] = acDigits[ --bNumDigits ];
+            }
+         }
+         else if( ( *pcPos != 'L' ) || ( eClass != LOG_ARG_LDOUBLE ) )
+         {
+            acSpec[ iLen++ ] = *pcPos;
+         }
+      }
+      acSpec[ iLen ] = '\0';
+      pcPos = pcEnd;
+
+      switch( eClass )
+      {
+      case LOG_ARG_INT:     ABCC_PORT_printf( acSpec, (int)psArg->llInt ); break;
+      case LOG_ARG_LONG:    ABCC_PORT_printf( acSpec, (long)psArg->llInt ); break;
+      case LOG_ARG_LLONG:   ABCC_PORT_printf( acSpec, (long long)psArg->llInt ); break;
+      case LOG_ARG_INTMAX:  ABCC_PORT_printf( acSpec, (intmax_t)psArg->llInt ); break;
+      case LOG_ARG_PTRDIFF: ABCC_PORT_printf( acSpec, (ptrdiff_t)psArg->llInt ); break;
+      case LOG_ARG_UINT:    ABCC_PORT_printf( acSpec, (unsigned int)psArg->llUint ); break;
+      case LOG_ARG_ULONG:   ABCC_PORT_printf( acSpec, (unsigned long)psArg->llUint ); break;
+      case LOG_ARG_ULLONG:  ABCC_PORT_printf( acSpec, (unsigned long long)psArg->llUint ); break;
+      case LOG_ARG_UINTMAX: ABCC_PORT_printf( acSpec, (uintmax_t)psArg->llUint ); break;
+      case LOG_ARG_SIZE:    ABCC_PORT_printf( acSpec, (size_t)psArg->llUint ); break;
+      case LOG_ARG_PTR:     ABCC_PORT_printf( acSpec, psArg->pxPtr ); break;
+      case LOG_ARG_DOUBLE:
+      case LOG_ARG_LDOUBLE: ABCC_PORT_printf( acSpec, psArg->dFloat ); break;
+      case LOG_ARG_COUNT:   break;
+      default:
+         /*
+         ** "%%" or unknown conversion, print it as is.
+         */
+         ABCC_PORT_printf( "%s", acSpec[ 1 ] == '%' ? "%" : acSpec );
+         break;
+      }
+
+      if( eClass != LOG_ARG_NONE )
+      {
+         psArg++;
+      }
+   }
+}
+
+void ABCC_LogFlush( void )
+{
+   UINT16 iRead;
+   UINT16 iWrite;
+   UINT16 iLostCount;
+   const LogUnitType* psEntry;
+
+   iLostCount = log_iLostCount;
+   if( iLostCount != log_iReportedLostCount )
+   {
+      ABCC_PORT_printf( "ABCC log: %u entries lost\n",
+                        (unsigned int)(UINT16)( iLostCount - log_iReportedLostCount ) );
+      log_iReportedLostCount = iLostCount;
+   }
+
+   iRead = log_iRead;
+   iWrite = log_iWrite;
+#ifdef ABCC_PORT_MemoryBarrier
+   ABCC_PORT_MemoryBarrier();
+#endif
+
+   while( iRead != iWrite )
+   {
+      psEntry = &log_asBuffer[ iRead ];
+
+      switch( (ABCC_LogEntryType)psEntry->sHdr.bType )
+      {
+      case ABCC_LOG_PRINTF:
+         PrintPrintfEntry( psEntry );
+         break;
+
+#if ABCC_CFG_DEBUG_MESSAGING_ENABLED
+      case ABCC_LOG_MSG_EVENT:
+         ABCC_PORT_printf( "%s: MsgBuf:0x%p SrcId:0x%02x\n",
+                           (const char*)psEntry[ 1 ].pxPtr,
+                           psEntry[ 2 ].pxPtr,
+                           (unsigned int)psEntry[ 3 ].llUint );
+         break;
+
+      case ABCC_LOG_MSG_DATA:
+         PrintMsg( (char*)psEntry[ 1 ].pxPtr, psEntry[ 2 ].pxPtr, (ABP_MsgType*)&psEntry[ 3 ] );
+         break;
+#endif
+
+#if ABCC_CFG_DEBUG_HEXDUMP_MSG_ENABLED
+      case ABCC_LOG_HEXDUMP_MSG:
+         PrintHexdumpMsg( (char*)psEntry[ 1 ].pxPtr, (ABP_MsgType*)&psEntry[ 3 ] );
+         break;
+#endif
+
+#if ABCC_CFG_DEBUG_HEXDUMP_SPI_ENABLED
+      case ABCC_LOG_HEXDUMP_SPI:
+         PrintHexdumpSpi( (char*)psEntry[ 1 ].pxPtr, (const UINT16*)&psEntry[ 2 ], psEntry->sHdr.iNumOctets >> 1 );
+         break;
+#endif
+
+#if ABCC_CFG_DEBUG_HEXDUMP_UART_ENABLED
+      case ABCC_LOG_HEXDUMP_UART:
+         PrintHexdumpUart( (char*)psEntry[ 1 ].pxPtr, (const UINT8*)&psEntry[ 2 ], psEntry->sHdr.iNumOctets );
+         break;
+#endif
+
+      default:
+         break;
+      }
+
+      iRead = (UINT16)( ( iRead + psEntry->sHdr.iNumUnits ) % LOG_NUM_UNITS );
+      log_iRead = iRead;
+   }
+}
+
+UINT16 ABCC_LogGetLostCount( void )
+{
+   return( log_iLostCount );
+}
 #endif
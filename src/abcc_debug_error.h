@@ -49,6 +49,67 @@ EXTVAR UINT16 DEBUG_iCrcErrorCnt;
 #endif
 #endif
 
+#if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+/*------------------------------------------------------------------------------
+** Deferred log entry types, see ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED.
+**------------------------------------------------------------------------------
+*/
+typedef enum ABCC_LogEntryType
+{
+   ABCC_LOG_PAD = 0,
+   ABCC_LOG_PRINTF,
+   ABCC_LOG_MSG_DATA,
+   ABCC_LOG_MSG_EVENT,
+   ABCC_LOG_HEXDUMP_MSG,
+   ABCC_LOG_HEXDUMP_SPI,
+   ABCC_LOG_HEXDUMP_UART
+}
+ABCC_LogEntryType;
+
+/*------------------------------------------------------------------------------
+** Stores a printf style entry in the deferred log. Only the format string
+** pointer and the argument values are stored.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pcFormat - Format string. Must exist until the entry has been flushed.
+**    ...      - Arguments. %s arguments must exist until the entry has been
+**               flushed.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_LogPrintf( const char* pcFormat, ... );
+
+/*------------------------------------------------------------------------------
+** Stores a message entry in the deferred log. For ABCC_LOG_MSG_EVENT only the
+** buffer address and source id is stored, otherwise a copy of the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    eType  - ABCC_LOG_MSG_DATA, ABCC_LOG_MSG_EVENT or ABCC_LOG_HEXDUMP_MSG.
+**    pcInfo - Information string. Must exist until the entry has been flushed.
+**    psMsg  - ABCC message.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_LogMsg( ABCC_LogEntryType eType, char* pcInfo, ABP_MsgType* psMsg );
+
+/*------------------------------------------------------------------------------
+** Stores a copy of SPI frame or UART telegram data in the deferred log.
+**------------------------------------------------------------------------------
+** Arguments:
+**    eType       - ABCC_LOG_HEXDUMP_SPI or ABCC_LOG_HEXDUMP_UART.
+**    pcInfo      - Information string. Must exist until the entry has been
+**                  flushed.
+**    pxData      - Data to copy.
+**    iNumOctets  - Size of the data in octets.
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_LogData( ABCC_LogEntryType eType, char* pcInfo, const void* pxData, UINT16 iNumOctets );
+#endif
+
 #if ABCC_CFG_DEBUG_MESSAGING_ENABLED
 /*------------------------------------------------------------------------------
 ** Prints ABCC message content using ABCC_DebugPrintf().
@@ -75,9 +136,15 @@ void ABCC_DebugPrintMsg( char* pcInfo, ABP_MsgType* psMsg );
 */
 void ABCC_DebugPrintMsgEvent( char* pcInfo, ABP_MsgType* psMsg );
 
+#if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+#define ABCC_DEBUG_MSG_DATA( pcInfo, psMsg )  ABCC_LogMsg( ABCC_LOG_MSG_DATA, pcInfo, psMsg )
+#define ABCC_DEBUG_MSG_EVENT( pcInfo, psMsg ) ABCC_LogMsg( ABCC_LOG_MSG_EVENT, pcInfo, psMsg )
+#define ABCC_DEBUG_MSG_GENERAL( ... )         ABCC_LogPrintf( __VA_ARGS__ )
+#else
 #define ABCC_DEBUG_MSG_DATA( pcInfo, psMsg )  ABCC_DebugPrintMsg( pcInfo, psMsg )
 #define ABCC_DEBUG_MSG_EVENT( pcInfo, psMsg ) ABCC_DebugPrintMsgEvent( pcInfo, psMsg )
 #define ABCC_DEBUG_MSG_GENERAL( ... )         ABCC_DebugPrintf( __VA_ARGS__ )
+#endif
 #else
 #define ABCC_DEBUG_MSG_DATA( pcInfo, psMsg )
 #define ABCC_DEBUG_MSG_EVENT( pcInfo, psMsg )
@@ -104,21 +171,33 @@ void ABCC_DebugPrintMsgEvent( char* pcInfo, ABP_MsgType* psMsg );
 */
 #if ABCC_CFG_DEBUG_HEXDUMP_MSG_ENABLED
 EXTFUNC void ABCC_DebugHexdumpMsg( char* pcInfo, ABP_MsgType* psMsg );
+#if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+#define ABCC_DEBUG_HEXDUMP_MSG( pcInfo, psMsg ) ABCC_LogMsg( ABCC_LOG_HEXDUMP_MSG, pcInfo, psMsg )
+#else
 #define ABCC_DEBUG_HEXDUMP_MSG( pcInfo, psMsg ) ABCC_DebugHexdumpMsg( pcInfo, psMsg )
+#endif
 #else
 #define ABCC_DEBUG_HEXDUMP_MSG( pcInfo, psMsg )
 #endif
 
 #if ABCC_CFG_DEBUG_HEXDUMP_SPI_ENABLED
 EXTFUNC void ABCC_DebugHexdumpSpi( char* pcInfo, UINT16* piData, UINT16 iSizeInWords );
+#if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+#define ABCC_DEBUG_HEXDUMP_SPI( pcInfo, piData, iSizeInWords ) ABCC_LogData( ABCC_LOG_HEXDUMP_SPI, pcInfo, piData, (UINT16)( ( iSizeInWords ) << 1 ) )
+#else
 #define ABCC_DEBUG_HEXDUMP_SPI( pcInfo, piData, iSizeInWords ) ABCC_DebugHexdumpSpi( pcInfo, piData, iSizeInWords )
+#endif
 #else
 #define ABCC_DEBUG_HEXDUMP_SPI( pcInfo, piData, iSizeInWords )
 #endif
 
 #if ABCC_CFG_DEBUG_HEXDUMP_UART_ENABLED
 EXTFUNC void ABCC_DebugHexdumpUart( char* pcInfo, UINT8* pbData, UINT16 iSizeInBytes );
+#if ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED
+#define ABCC_DEBUG_HEXDUMP_UART( pcInfo, pbData, iSizeInBytes ) ABCC_LogData( ABCC_LOG_HEXDUMP_UART, pcInfo, pbData, iSizeInBytes )
+#else
 #define ABCC_DEBUG_HEXDUMP_UART( pcInfo, pbData, iSizeInBytes ) ABCC_DebugHexdumpUart( pcInfo, pbData, iSizeInBytes )
+#endif
 #else
 #define ABCC_DEBUG_HEXDUMP_UART( pcInfo, pbData, iSizeInBytes )
 #endif
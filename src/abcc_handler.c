@@ -31,6 +31,7 @@
 #include "abcc_setup.h"
 #include "abcc_port.h"
 #include "abcc_segmentation.h"
+#include "abcc_trace.h"
 
 #if ABCC_CFG_DRV_SPI_ENABLED
 #include "spi/abcc_driver_spi_interface.h"
@@ -159,9 +160,143 @@ static volatile ABP_AppStatusType abcc_eAppStatus = ABP_APPSTAT_NO_ERROR;
 */
 static UINT16 abcc_iMessageChannelSize = 0;
 
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+/*
+** Command handlers indexed by object number, NULL if not registered.
+*/
+static ABCC_MsgHandlerFuncType abcc_apnObjHandler[ 256 ];
+#endif
+
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+/*
+** Process data triple buffer.
+** Each side owns one buffer index, the third index is in bShared together with
+** the ABCC_PD_TB_NEW flag that indicates that it holds an image not yet taken
+** by the consumer. Ownership is only transferred by exchanging bShared.
+*/
+#define ABCC_PD_TB_INDEX_MASK 0x03
+#define ABCC_PD_TB_NEW        0x04
+
+typedef struct ABCC_PdTripleBufferType
+{
+   UINT32         alBuffer[ 3 ][ ( ABCC_CFG_MAX_PROCESS_DATA_SIZE + 3 ) / 4 ];
+   volatile UINT8 bShared;
+   UINT8          bProducer;
+   UINT8          bConsumer;
+   BOOL           fConsumerValid;
+}
+ABCC_PdTripleBufferType;
+
+static ABCC_PdTripleBufferType abcc_sRdPdTb;
+static ABCC_PdTripleBufferType abcc_sWrPdTb;
+
+/*
+** Current read process data size in octets.
+*/
+static UINT16 abcc_iRdPdSize;
+#endif
+
+/*
+** Current write process data size in octets, 0 until the setup is complete.
+*/
+static UINT16 abcc_iWrPdSize;
+
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+/*------------------------------------------------------------------------------
+** Exchanges the shared index of a process data triple buffer.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psTb   - Triple buffer.
+**    bValue - New value of the shared index.
+**
+** Returns:
+**    Previous value of the shared index.
+**------------------------------------------------------------------------------
+*/
+static UINT8 PdTbExchange( ABCC_PdTripleBufferType* psTb, UINT8 bValue )
+{
+#ifdef ABCC_PORT_AtomicExchange8
+   return( ABCC_PORT_AtomicExchange8( &psTb->bShared, bValue ) );
+#else
+   UINT8 bPrevious;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   bPrevious = psTb->bShared;
+   psTb->bShared = bValue;
+   ABCC_PORT_ExitCritical();
+
+   return( bPrevious );
+#endif
+}
+
+/*------------------------------------------------------------------------------
+** Initializes a process data triple buffer.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psTb   - Triple buffer.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void PdTbInit( ABCC_PdTripleBufferType* psTb )
+{
+   psTb->bProducer = 0;
+   psTb->bShared = 1;
+   psTb->bConsumer = 2;
+   psTb->fConsumerValid = FALSE;
+}
+
+/*------------------------------------------------------------------------------
+** Publishes the producer buffer and takes over the previously shared buffer.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psTb   - Triple buffer.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void PdTbPublish( ABCC_PdTripleBufferType* psTb )
+{
+   psTb->bProducer = PdTbExchange( psTb, psTb->bProducer | ABCC_PD_TB_NEW ) &
+                     ABCC_PD_TB_INDEX_MASK;
+}
+
+/*------------------------------------------------------------------------------
+** Takes over the shared buffer if it holds a new image.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psTb   - Triple buffer.
+**
+** Returns:
+**    TRUE if a new image was taken over.
+**------------------------------------------------------------------------------
+*/
+static BOOL PdTbTakeNew( ABCC_PdTripleBufferType* psTb )
+{
+   if( !( psTb->bShared & ABCC_PD_TB_NEW ) )
+   {
+      return( FALSE );
+   }
+
+   psTb->bConsumer = PdTbExchange( psTb, psTb->bConsumer ) & ABCC_PD_TB_INDEX_MASK;
+   psTb->fConsumerValid = TRUE;
+
+   return( TRUE );
+}
+#endif
+
 static void TriggerWrPdUpdateNow( void )
 {
-   if( ABCC_GetMainState() == ABCC_DRV_RUNNING )
+   /*
+   ** Until the setup is complete there is no write process data to send.
+   ** Updating it anyway would let an application that only copies changed
+   ** ADIs (AD_WRPD_DIRTY_TRACKING_ENABLE) spend its first full update on a
+   ** frame that never carries it.
+   */
+   if( ( ABCC_GetMainState() == ABCC_DRV_RUNNING ) && ( abcc_iWrPdSize != 0 ) )
    {
       /*
       ** Send new "write process data" to the Anybus-CC.
@@ -169,8 +304,16 @@ static void TriggerWrPdUpdateNow( void )
       ** The application converts the data accordingly.
       */
 
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+      if( PdTbTakeNew( &abcc_sWrPdTb ) )
+      {
+         ABCC_PORT_MemCpy( abcc_pbWrPdBuffer,
+                           abcc_sWrPdTb.alBuffer[ abcc_sWrPdTb.bConsumer ],
+                           abcc_iWrPdSize );
+#else
       if( ABCC_CbfUpdateWriteProcessData( abcc_pbWrPdBuffer ) )
       {
+#endif
          pnABCC_DrvWriteProcessData( abcc_pbWrPdBuffer );
 #if ABCC_CFG_SYNC_MEASUREMENT_IP_ENABLED
          if( ABCC_GetOpmode() == ABP_OP_MODE_SPI )
@@ -521,6 +664,9 @@ ABCC_ErrorCodeType ABCC_StartDriver( UINT32 lMaxStartupTimeMs )
    }
 
    ABCC_TimerInit();
+#if ABCC_CFG_TRACE_ENABLED
+   ABCC_TraceInit();
+#endif
    pnABCC_DrvInit( abcc_bOpmode );
 
    ABCC_LinkInit();
@@ -536,6 +682,13 @@ ABCC_ErrorCodeType ABCC_StartDriver( UINT32 lMaxStartupTimeMs )
 
    abcc_pbWrPdBuffer = pnABCC_DrvGetWrPdBuffer();
 
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+   PdTbInit( &abcc_sRdPdTb );
+   PdTbInit( &abcc_sWrPdTb );
+   abcc_iRdPdSize = 0;
+#endif
+   abcc_iWrPdSize = 0;
+
    if( !ABCC_ModuleDetect() )
    {
       ABCC_ERROR(ABCC_SEV_WARNING, ABCC_EC_MODULE_NOT_DECTECTED, 0);
@@ -655,6 +808,7 @@ void ABCC_TriggerRdPdUpdate( void )
 #if ABCC_CFG_SYNC_MEASUREMENT_OP_ENABLED
    ABCC_SYS_GpioSet();
 #endif
+   ABCC_TRACE( ABCC_TRACE_RD_PD_BEGIN, 0 );
 
    bpRdPd = pnABCC_DrvReadProcessData();
 
@@ -668,9 +822,19 @@ void ABCC_TriggerRdPdUpdate( void )
          ** The data format of the process data is network specific.
          ** Convert it to our native format.
          */
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+         ABCC_PORT_MemCpy( abcc_sRdPdTb.alBuffer[ abcc_sRdPdTb.bProducer ],
+                           bpRdPd,
+                           abcc_iRdPdSize );
+         PdTbPublish( &abcc_sRdPdTb );
+#else
+         ABCC_TRACE( ABCC_TRACE_NEW_READ_PD_BEGIN, 0 );
          ABCC_CbfNewReadPd( bpRdPd );
+         ABCC_TRACE( ABCC_TRACE_NEW_READ_PD_END, 0 );
+#endif
       }
    }
+   ABCC_TRACE( ABCC_TRACE_RD_PD_END, 0 );
 
 #if ABCC_CFG_SYNC_MEASUREMENT_OP_ENABLED
    /*
@@ -685,14 +849,24 @@ void ABCC_TriggerRdPdUpdate( void )
 void ABCC_TriggerReceiveMessage ( void )
 {
    ABCC_MsgType sRdMsg;
+#if ABCC_CFG_TRACE_ENABLED
+   UINT16 iTraceArg;
+#endif
 
+   ABCC_TRACE( ABCC_TRACE_RECEIVE_MSG_BEGIN, 0 );
    sRdMsg.psMsg = ABCC_LinkReadMessage();
 
    if( sRdMsg.psMsg == NULL )
    {
+      ABCC_TRACE( ABCC_TRACE_RECEIVE_MSG_END, 0 );
       return;
    }
 
+#if ABCC_CFG_TRACE_ENABLED
+   iTraceArg = (UINT16)( ( ABCC_GetMsgDestObj( sRdMsg.psMsg ) << 8 ) |
+                         ABCC_GetLowAddrOct( sRdMsg.psMsg16->sHeader.iCmdReserved ) );
+#endif
+
    ABCC_DEBUG_HEXDUMP_MSG( "HEXDUMP_MRD:", sRdMsg.psMsg );
    ABCC_DEBUG_MSG_DATA( "Msg received", sRdMsg.psMsg );
    /*
@@ -725,10 +899,22 @@ void ABCC_TriggerReceiveMessage ( void )
          */
          if( !ABCC_HandleSegmentAck( sRdMsg.psMsg ) )
          {
-            /*
-            ** The message is a new command, let the application respond.
-            */
-            ABCC_CbfReceiveMsg( sRdMsg.psMsg );
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+            ABCC_MsgHandlerFuncType pnObjHandler;
+
+            pnObjHandler = abcc_apnObjHandler[ ABCC_GetMsgDestObj( sRdMsg.psMsg ) ];
+            if( pnObjHandler )
+            {
+               pnObjHandler( sRdMsg.psMsg );
+            }
+            else
+#endif
+            {
+               /*
+               ** The message is a new command, let the application respond.
+               */
+               ABCC_CbfReceiveMsg( sRdMsg.psMsg );
+            }
          }
       }
    }
@@ -770,6 +956,7 @@ void ABCC_TriggerReceiveMessage ( void )
       */
       ABCC_ReturnMsgBuffer( &sRdMsg.psMsg );
    }
+   ABCC_TRACE( ABCC_TRACE_RECEIVE_MSG_END, iTraceArg );
 }
 
 ABCC_ErrorCodeType ABCC_SendCmdMsg( ABP_MsgType*  psCmdMsg, ABCC_MsgHandlerFuncType pnMsgHandler )
@@ -813,6 +1000,28 @@ UINT16 ABCC_GetCmdQueueSize( void )
    return( ABCC_LinkGetNumCmdQueueEntries() );
 }
 
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+ABCC_ErrorCodeType ABCC_RegisterObject( UINT8 bObject,
+                                        ABCC_MsgHandlerFuncType pnMsgHandler )
+{
+   if( ( pnMsgHandler == NULL ) ||
+       ( ( abcc_apnObjHandler[ bObject ] != NULL ) &&
+         ( abcc_apnObjHandler[ bObject ] != pnMsgHandler ) ) )
+   {
+      return( ABCC_EC_PARAMETER_NOT_VALID );
+   }
+
+   abcc_apnObjHandler[ bObject ] = pnMsgHandler;
+
+   return( ABCC_EC_NO_ERROR );
+}
+
+void ABCC_UnregisterObject( UINT8 bObject )
+{
+   abcc_apnObjHandler[ bObject ] = NULL;
+}
+#endif
+
 
 ABCC_ErrorCodeType ABCC_SendRespMsg( ABP_MsgType* psMsgResp )
 {
@@ -828,6 +1037,15 @@ ABP_MsgType* ABCC_GetCmdMsgBuffer( void )
    return( ABCC_MemAlloc() );
 }
 
+ABP_MsgType* ABCC_GetCmdMsgBufferOfSize( UINT16 iMaxDataSize )
+{
+   if( ABCC_GetCmdQueueSize() == 0 )
+   {
+      return( NULL );
+   }
+   return( ABCC_MemAllocSize( iMaxDataSize ) );
+}
+
 ABCC_ErrorCodeType ABCC_ReturnMsgBuffer( ABP_MsgType** ppsBuffer )
 {
    ABCC_LinkFree( ppsBuffer );
@@ -844,8 +1062,44 @@ void ABCC_SetPdSize( const UINT16 iReadPdSize, const UINT16 iWritePdSize )
 {
    DEBUG_EVENT( "New process data sizes RdPd %" PRIu16 " WrPd %" PRIu16 "\n", iReadPdSize, iWritePdSize );
    pnABCC_DrvSetPdSize( iReadPdSize, iWritePdSize );
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+   abcc_iRdPdSize = iReadPdSize;
+#endif
+   abcc_iWrPdSize = iWritePdSize;
+}
+
+#if ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED
+void* ABCC_PdAcquireRead( void )
+{
+   PdTbTakeNew( &abcc_sRdPdTb );
+
+   if( !abcc_sRdPdTb.fConsumerValid )
+   {
+      return( NULL );
+   }
+
+   return( abcc_sRdPdTb.alBuffer[ abcc_sRdPdTb.bConsumer ] );
+}
+
+void ABCC_PdReleaseRead( void )
+{
+   /*
+   ** The consumer buffer is only handed back by the next take over in
+   ** ABCC_PdAcquireRead() so nothing needs to be done here.
+   */
+}
+
+void* ABCC_PdAcquireWrite( void )
+{
+   return( abcc_sWrPdTb.alBuffer[ abcc_sWrPdTb.bProducer ] );
 }
 
+void ABCC_PdReleaseWrite( void )
+{
+   PdTbPublish( &abcc_sWrPdTb );
+}
+#endif
+
 
 void ABCC_HWReset( void )
 {
@@ -937,6 +1191,11 @@ void ABCC_RunTimerSystem( const INT16 iDeltaTimeMs )
    ABCC_TimerTick( iDeltaTimeMs );
 }
 
+void ABCC_RunTimerSystemUs( const UINT32 lDeltaTimeUs )
+{
+   ABCC_TimerTickUs( lDeltaTimeUs );
+}
+
 UINT64 ABCC_GetUptimeMs( void )
 {
    return( ABCC_TimerGetUptimeMs() );
@@ -948,12 +1207,24 @@ UINT8 ABCC_GetNewSourceId( void )
    UINT8 bTempSrcId;
    ABCC_PORT_UseCritical();
 
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+   /*
+   ** Skip source ids in use. The search is part of the same critical section
+   ** as the counter update, so concurrent callers get different ids and the
+   ** counter only moves forward.
+   */
+   ABCC_PORT_EnterCritical();
+   bTempSrcId = ABCC_LinkGetFreeSrcId( (UINT8)( bSourceId + 1 ) );
+   bSourceId = bTempSrcId;
+   ABCC_PORT_ExitCritical();
+#else
    do
    {
       ABCC_PORT_EnterCritical();
       bTempSrcId = ++bSourceId;
       ABCC_PORT_ExitCritical();
    } while( ABCC_LinkIsSrcIdUsed( bTempSrcId ) );
+#endif
 
    return( bTempSrcId );
 }
@@ -26,6 +26,7 @@
 #include "abcc_timer.h"
 #include "abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_trace.h"
 
 /*
 ** Max number of messages in each send queue.
@@ -49,6 +50,30 @@
 /*
 ** Message queue type for queueing cmds and responses.
 */
+#if ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED
+/*
+** Lock-free single-producer/single-consumer ring. One slot is always left
+** unused to tell a full queue from an empty one. bReadIndex is only written
+** by the consumer and bWriteIndex only by the producer.
+*/
+#define LINK_NUM_CMD_Q_SLOTS              ( LINK_MAX_NUM_CMDS_IN_Q + 1 )
+#define LINK_NUM_RESP_Q_SLOTS             ( LINK_MAX_NUM_RESP_IN_Q + 1 )
+
+#if ( LINK_NUM_CMD_Q_SLOTS > 255 ) || ( LINK_NUM_RESP_Q_SLOTS > 255 )
+#error "Too large queues for ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED"
+#endif
+
+typedef struct MsgQueueType
+{
+   ABP_MsgType** queue;
+   volatile UINT8 bReadIndex;
+   volatile UINT8 bWriteIndex;
+   UINT8 bNumSlots;
+} MsgQueueType;
+#else
+#define LINK_NUM_CMD_Q_SLOTS              LINK_MAX_NUM_CMDS_IN_Q
+#define LINK_NUM_RESP_Q_SLOTS             LINK_MAX_NUM_RESP_IN_Q
+
 typedef struct MsgQueueType
 {
    ABP_MsgType** queue;
@@ -56,6 +81,7 @@ typedef struct MsgQueueType
    INT8 bQueueSize;
    INT8 bNumInQueue;
 } MsgQueueType;
+#endif
 
 /*
 ** Callback function used by serial driver to indicate that a read remap is ready
@@ -73,8 +99,8 @@ static UINT16 link_iMaxMsgSize;
 /*
 ** Command and response queues
 */
-static ABP_MsgType* link_psCmds[LINK_MAX_NUM_CMDS_IN_Q ];
-static ABP_MsgType* link_psResponses[LINK_MAX_NUM_RESP_IN_Q];
+static ABP_MsgType* link_psCmds[ LINK_NUM_CMD_Q_SLOTS ];
+static ABP_MsgType* link_psResponses[ LINK_NUM_RESP_Q_SLOTS ];
 
 static MsgQueueType link_sCmdQueue;
 static MsgQueueType link_sRespQueue;
@@ -82,8 +108,31 @@ static MsgQueueType link_sRespQueue;
 /*
 ** Response handlers
 */
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+/*
+** link_pnMsgHandler[] is indexed by source id. link_alSrcIdUsed[] has one bit
+** per source id that is set when a handler is mapped, used to find free source
+** ids 32 at a time. link_iNumMsgHdl limits the number of mapped handlers to
+** LINK_MAX_NUM_MSG_HDL as in the non-indexed implementation.
+*/
+#define LINK_NUM_SRC_ID                   256
+#define LINK_NUM_SRC_ID_WORDS             ( LINK_NUM_SRC_ID / 32 )
+
+/*
+** Source ids of retired commands are kept in use as well, see
+** ABCC_LinkRetireCmd().
+*/
+#if ( LINK_MAX_NUM_MSG_HDL + LINK_MAX_NUM_CMDS_IN_Q ) >= LINK_NUM_SRC_ID
+#error "ABCC_CFG_MAX_NUM_APPL_CMDS must be less than 128 when ABCC_CFG_SRC_ID_INDEX_ENABLED is enabled"
+#endif
+
+static ABCC_MsgHandlerFuncType link_pnMsgHandler[ LINK_NUM_SRC_ID ];
+static UINT32             link_alSrcIdUsed[ LINK_NUM_SRC_ID_WORDS ];
+static UINT16             link_iNumMsgHdl;
+#else
 static ABCC_MsgHandlerFuncType link_pnMsgHandler[ LINK_MAX_NUM_MSG_HDL ];
 static UINT8              link_bMsgSrcId[ LINK_MAX_NUM_MSG_HDL ];
+#endif
 
 static ABCC_LinkNotifyIndType pnMsgSentHandler;
 static ABP_MsgType* link_psNotifyMsg;
@@ -93,6 +142,15 @@ static ABP_MsgType* link_psNotifyMsg;
 */
 static UINT8 link_bNumberOfOutstandingCommands = 0;
 
+/*
+** Source ids of commands retired by ABCC_LinkRetireCmd() that are still
+** waiting for a late response, oldest first. A retired command stays counted
+** as outstanding until its late response is dropped. When the list is full
+** the oldest entry is forgotten and no longer counted.
+*/
+static UINT8 link_abRetiredSrcId[ LINK_MAX_NUM_CMDS_IN_Q ];
+static UINT8 link_bNumRetired;
+
 /*
 ** Flag used to ensure that a context have exclusive access to
 ** the driver write message interface. The flag is used as an
@@ -100,6 +158,72 @@ static UINT8 link_bNumberOfOutstandingCommands = 0;
 */
 static BOOL link_fDrvWriteMsgLock = FALSE;
 
+#if ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED
+static UINT8 link_NumInQueue( const MsgQueueType* psMsgQueue )
+{
+   UINT8 bReadIndex;
+   UINT8 bWriteIndex;
+
+   bReadIndex = psMsgQueue->bReadIndex;
+   bWriteIndex = psMsgQueue->bWriteIndex;
+
+   return( (UINT8)( ( bWriteIndex + psMsgQueue->bNumSlots - bReadIndex ) %
+                    psMsgQueue->bNumSlots ) );
+}
+
+/*
+** Must only be called by the consumer, i.e. the context holding
+** link_fDrvWriteMsgLock.
+*/
+static ABP_MsgType* link_DeQueue( MsgQueueType* psMsgQueue )
+{
+   ABP_MsgType* psMsg = NULL;
+   UINT8 bReadIndex;
+
+   bReadIndex = psMsgQueue->bReadIndex;
+
+   if( bReadIndex != psMsgQueue->bWriteIndex )
+   {
+      /*
+      ** The slot must not be read before the write index is, and must be read
+      ** before it is handed back to the producer.
+      */
+      ABCC_PORT_MemoryBarrier();
+      psMsg = psMsgQueue->queue[ bReadIndex ];
+      ABCC_PORT_MemoryBarrier();
+      psMsgQueue->bReadIndex = (UINT8)( ( bReadIndex + 1 ) % psMsgQueue->bNumSlots );
+   }
+
+   return( psMsg );
+}
+
+/*
+** Must only be called by the producer of the queue.
+*/
+static BOOL link_EnQueue( MsgQueueType* psMsgQueue, ABP_MsgType* psMsg )
+{
+   UINT8 bWriteIndex;
+   UINT8 bNextWriteIndex;
+
+   bWriteIndex = psMsgQueue->bWriteIndex;
+   bNextWriteIndex = (UINT8)( ( bWriteIndex + 1 ) % psMsgQueue->bNumSlots );
+
+   if( bNextWriteIndex == psMsgQueue->bReadIndex )
+   {
+      return( FALSE );
+   }
+
+   /*
+   ** The slot must be written before it is published to the consumer.
+   */
+   ABCC_PORT_MemoryBarrier();
+   psMsgQueue->queue[ bWriteIndex ] = psMsg;
+   ABCC_PORT_MemoryBarrier();
+   psMsgQueue->bWriteIndex = bNextWriteIndex;
+
+   return( TRUE );
+}
+#else
 static ABP_MsgType* link_DeQueue( MsgQueueType* psMsgQueue )
 {
    ABP_MsgType* psMsg = NULL;
@@ -125,6 +249,45 @@ static BOOL link_EnQueue( MsgQueueType* psMsgQueue, ABP_MsgType* psMsg )
    }
    return( FALSE );
 }
+#endif
+
+/*------------------------------------------------------------------------------
+** Removes a source id from the list of retired commands. Must be called in a
+** critical section.
+**------------------------------------------------------------------------------
+** Arguments:
+**          bSrcId:  Source id.
+**
+** Returns:
+**          TRUE if the source id was retired.
+**------------------------------------------------------------------------------
+*/
+static BOOL link_RemoveRetiredSrcId( UINT8 bSrcId )
+{
+   UINT8 bIndex;
+
+   for( bIndex = 0; bIndex < link_bNumRetired; bIndex++ )
+   {
+      if( link_abRetiredSrcId[ bIndex ] == bSrcId )
+      {
+         link_bNumRetired--;
+         while( bIndex < link_bNumRetired )
+         {
+            link_abRetiredSrcId[ bIndex ] = link_abRetiredSrcId[ bIndex + 1 ];
+            bIndex++;
+         }
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+         if( link_pnMsgHandler[ bSrcId ] == NULL )
+         {
+            link_alSrcIdUsed[ bSrcId >> 5 ] &= ~( (UINT32)1 << ( bSrcId & 31 ) );
+         }
+#endif
+         return( TRUE );
+      }
+   }
+
+   return( FALSE );
+}
 
 static void link_CheckNotification( const ABP_MsgType* const psMsg )
 {
@@ -143,6 +306,17 @@ void ABCC_LinkInit( void )
    /*
    ** Init Queue structures.
    */
+#if ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED
+   link_sCmdQueue.bReadIndex = 0;
+   link_sCmdQueue.bWriteIndex = 0;
+   link_sCmdQueue.bNumSlots = LINK_NUM_CMD_Q_SLOTS;
+   link_sCmdQueue.queue = link_psCmds;
+
+   link_sRespQueue.bReadIndex = 0;
+   link_sRespQueue.bWriteIndex = 0;
+   link_sRespQueue.bNumSlots = LINK_NUM_RESP_Q_SLOTS;
+   link_sRespQueue.queue = link_psResponses;
+#else
    link_sCmdQueue.bNumInQueue = 0;
    link_sCmdQueue.bQueueSize = LINK_MAX_NUM_CMDS_IN_Q;
    link_sCmdQueue.bReadIndex = 0;
@@ -152,19 +326,33 @@ void ABCC_LinkInit( void )
    link_sRespQueue.bQueueSize = LINK_MAX_NUM_RESP_IN_Q;
    link_sRespQueue.bReadIndex = 0;
    link_sRespQueue.queue = link_psResponses;
+#endif
 
    ABCC_MemCreatePool();
 
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+   for( iCount = 0; iCount < LINK_NUM_SRC_ID; iCount++ )
+   {
+      link_pnMsgHandler[ iCount ] = 0;
+   }
+   for( iCount = 0; iCount < LINK_NUM_SRC_ID_WORDS; iCount++ )
+   {
+      link_alSrcIdUsed[ iCount ] = 0;
+   }
+   link_iNumMsgHdl = 0;
+#else
    for( iCount = 0; iCount < LINK_MAX_NUM_CMDS_IN_Q; iCount++  )
    {
       link_pnMsgHandler[ iCount ] = 0;
       link_bMsgSrcId[iCount ] = 0;
    }
+#endif
 
    /*
    ** Initialize driver privates and states to default values.
    */
    link_bNumberOfOutstandingCommands = 0;
+   link_bNumRetired = 0;
 
    pnMsgSentHandler = NULL;
    link_psNotifyMsg = NULL;
@@ -185,6 +373,7 @@ void ABCC_LinkInit( void )
 ABP_MsgType* ABCC_LinkReadMessage( void )
 {
    ABCC_MsgType psReadMessage;
+   BOOL fLateResp;
    ABCC_PORT_UseCritical();
 
    psReadMessage.psMsg = pnABCC_DrvReadMessage();
@@ -194,25 +383,176 @@ ABP_MsgType* ABCC_LinkReadMessage( void )
       if( ( ABCC_GetLowAddrOct( psReadMessage.psMsg16->sHeader.iCmdReserved ) & ABP_MSG_HEADER_C_BIT ) == 0 )
       {
          /*
-         ** Decrement number of outstanding commands if a response is received
+         ** Decrement number of outstanding commands if a response is received.
+         ** A command retired by ABCC_LinkRetireCmd() is counted until its late
+         ** response arrives, the module holds it until then.
          */
          ABCC_PORT_EnterCritical();
-         link_bNumberOfOutstandingCommands--;
+         fLateResp = ( link_bNumRetired > 0 ) &&
+                     link_RemoveRetiredSrcId( ABCC_GetLowAddrOct( psReadMessage.psMsg16->sHeader.iSourceIdDestObj ) );
+         if( link_bNumberOfOutstandingCommands > 0 )
+         {
+            link_bNumberOfOutstandingCommands--;
+         }
          ABCC_PORT_ExitCritical();
-         ABCC_DEBUG_MSG_GENERAL( "Outstanding commands: %" PRIu8 "\n",
-                                 link_bNumberOfOutstandingCommands );
+
+         if( fLateResp )
+         {
+            /*
+            ** Nobody waits for this response any longer.
+            */
+            ABCC_DEBUG_MSG_EVENT( "Late response dropped", psReadMessage.psMsg );
+            ABCC_LinkFree( &psReadMessage.psMsg );
+         }
+         else
+         {
+            ABCC_DEBUG_MSG_GENERAL( "Outstanding commands: %" PRIu8 "\n",
+                                    link_bNumberOfOutstandingCommands );
+         }
       }
    }
    return( psReadMessage.psMsg );
 }
 
 
+#if ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED
+/*------------------------------------------------------------------------------
+** Takes link_fDrvWriteMsgLock if it is free. The context holding the lock is
+** the only consumer of the send queues.
+**------------------------------------------------------------------------------
+*/
+static BOOL link_TryLockDrvWriteMsg( void )
+{
+   BOOL fLocked = FALSE;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   if( !link_fDrvWriteMsgLock )
+   {
+      link_fDrvWriteMsgLock = TRUE;
+      fLocked = TRUE;
+   }
+   ABCC_PORT_ExitCritical();
+
+   return( fLocked );
+}
+
+/*------------------------------------------------------------------------------
+** Checks if there is a queued message that the driver is ready to send.
+**------------------------------------------------------------------------------
+*/
+static BOOL link_IsQueuedMsgReadyToSend( void )
+{
+   return( ( ( link_NumInQueue( &link_sRespQueue ) > 0 ) && pnABCC_DrvISReadyForWriteMessage() ) ||
+           ( ( link_NumInQueue( &link_sCmdQueue ) > 0 ) && pnABCC_DrvISReadyForCmd() ) );
+}
+
+/*------------------------------------------------------------------------------
+** Writes a dequeued message to the driver and releases
+** link_fDrvWriteMsgLock.
+**------------------------------------------------------------------------------
+*/
+static void link_WriteMsgToDrv( ABP_MsgType* psWriteMessage )
+{
+   BOOL fMsgWritten;
+   ABCC_PORT_UseCritical();
+
+   /*
+   ** Only call ABCC_DrvPrepareWriteMessage if it's implemented by the
+   ** driver. Note that this function will not deliver the message to the
+   ** ABCC just copy the message data to the memory.
+   */
+   if( pnABCC_DrvPrepareWriteMessage != NULL )
+   {
+      pnABCC_DrvPrepareWriteMessage( psWriteMessage );
+   }
+
+   ABCC_PORT_EnterCritical();
+   /*
+   ** Do the actual write of the message and unlock the driver to enable
+   ** use from other contexts. Both these actions need to be done within the
+   ** same critical section.
+   */
+   fMsgWritten = pnABCC_DrvWriteMessage( psWriteMessage );
+   link_fDrvWriteMsgLock = FALSE;
+   ABCC_PORT_ExitCritical();
+
+   if( fMsgWritten )
+   {
+      /*
+      ** The message was successfully written and can be deallocated now.
+      */
+      ABCC_DEBUG_HEXDUMP_MSG( "HEXDUMP_MWR:", psWriteMessage );
+      ABCC_DEBUG_MSG_DATA( "Msg sent", psWriteMessage );
+      link_CheckNotification( psWriteMessage );
+      ABCC_LinkFree( &psWriteMessage );
+   }
+}
+
+void ABCC_LinkCheckSendMessage( void )
+{
+   ABP_MsgType* psWriteMessage;
+   ABCC_PORT_UseCritical();
+
+   ABCC_TRACE( ABCC_TRACE_SEND_MSG_BEGIN, 0 );
+
+   /*
+   ** If another context holds the lock it will check the queues again when
+   ** it releases it.
+   */
+   while( link_TryLockDrvWriteMsg() )
+   {
+      psWriteMessage = NULL;
+
+      /*
+      ** Response messages are prioritized over command messages.
+      */
+      if( ( link_NumInQueue( &link_sRespQueue ) > 0 ) && pnABCC_DrvISReadyForWriteMessage() )
+      {
+         psWriteMessage = link_DeQueue( &link_sRespQueue );
+         ABCC_DEBUG_MSG_EVENT( "Response dequeued", psWriteMessage );
+         ABCC_DEBUG_MSG_GENERAL( "RespQ status: %" PRIu8 "(%" PRIu8 ")\n",
+               link_NumInQueue( &link_sRespQueue ),
+               (UINT8)LINK_MAX_NUM_RESP_IN_Q );
+      }
+      else if( ( link_NumInQueue( &link_sCmdQueue ) > 0 ) && pnABCC_DrvISReadyForCmd() )
+      {
+         psWriteMessage = link_DeQueue( &link_sCmdQueue );
+         ABCC_DEBUG_MSG_EVENT( "Command dequeued", psWriteMessage );
+         ABCC_DEBUG_MSG_GENERAL( "CmdQ status: %" PRIu8 "(%" PRIu8 ")\n",
+               link_NumInQueue( &link_sCmdQueue ),
+               (UINT8)LINK_MAX_NUM_CMDS_IN_Q );
+      }
+
+      if( psWriteMessage != NULL )
+      {
+         link_WriteMsgToDrv( psWriteMessage );
+      }
+      else
+      {
+         ABCC_PORT_EnterCritical();
+         link_fDrvWriteMsgLock = FALSE;
+         ABCC_PORT_ExitCritical();
+
+         /*
+         ** A producer may have queued a message while the lock was held.
+         */
+         if( !link_IsQueuedMsgReadyToSend() )
+         {
+            break;
+         }
+      }
+   }
+   ABCC_TRACE( ABCC_TRACE_SEND_MSG_END, 0 );
+}
+#else
 void ABCC_LinkCheckSendMessage( void )
 {
    BOOL fMsgWritten;
    ABP_MsgType* psWriteMessage;
    ABCC_PORT_UseCritical();
 
+   ABCC_TRACE( ABCC_TRACE_SEND_MSG_BEGIN, 0 );
    psWriteMessage = NULL;
 
    ABCC_PORT_EnterCritical();
@@ -292,13 +632,16 @@ void ABCC_LinkCheckSendMessage( void )
          ABCC_LinkFree( &psWriteMessage );
       }
    }
+   ABCC_TRACE( ABCC_TRACE_SEND_MSG_END, 0 );
 }
+#endif
 
 
 void ABCC_LinkRunDriverRx( void )
 {
    ABP_MsgType* psSentMsg;
 
+   ABCC_TRACE( ABCC_TRACE_DRV_RX_BEGIN, 0 );
    psSentMsg = pnABCC_DrvRunDriverRx();
    /*
    ** If a write message was sent, free the buffer.
@@ -309,6 +652,11 @@ void ABCC_LinkRunDriverRx( void )
       ABCC_DEBUG_MSG_DATA( "Msg sent", psSentMsg );
       link_CheckNotification( psSentMsg );
       ABCC_LinkFree( &psSentMsg );
+      ABCC_TRACE( ABCC_TRACE_DRV_RX_END, 1 );
+   }
+   else
+   {
+      ABCC_TRACE( ABCC_TRACE_DRV_RX_END, 0 );
    }
 }
 
@@ -321,6 +669,113 @@ UINT16 ABCC_LinkGetNumCmdQueueEntries( void )
 }
 
 
+#if ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED
+ABCC_ErrorCodeType ABCC_LinkWriteMessage( ABP_MsgType* psWriteMsg )
+{
+   ABCC_ErrorCodeType eErrorCode;
+#if ABCC_CFG_ERR_REPORTING_ENABLED
+   UINT32 lAddErrorInfo;
+#endif
+
+   ABCC_PORT_UseCritical();
+
+   eErrorCode = ABCC_EC_NO_ERROR;
+#if ABCC_CFG_ERR_REPORTING_ENABLED
+   lAddErrorInfo = 0;
+#endif
+
+   if( ABCC_GetMsgDataSize( psWriteMsg ) > link_iMaxMsgSize )
+   {
+      eErrorCode = ABCC_EC_WRMSG_SIZE_ERR;
+      ABCC_ERROR( ABCC_SEV_WARNING, eErrorCode,
+                  iLeTOi( psWriteMsg->sHeader.iDataSize ) );
+      return( eErrorCode );
+   }
+
+   /*
+   ** A message built in a small or medium buffer (ABCC_GetCmdMsgBufferOfSize())
+   ** must not exceed the size of that buffer.
+   */
+   if( ( ABCC_MemGetMaxDataSize( psWriteMsg ) != 0 ) &&
+       ( ABCC_GetMsgDataSize( psWriteMsg ) > ABCC_MemGetMaxDataSize( psWriteMsg ) ) )
+   {
+      eErrorCode = ABCC_EC_WRMSG_SIZE_ERR;
+      ABCC_ERROR( ABCC_SEV_WARNING, eErrorCode,
+                  iLeTOi( psWriteMsg->sHeader.iDataSize ) );
+      return( eErrorCode );
+   }
+
+   /*
+   ** The message may be sent and freed by another context as soon as it is
+   ** queued.
+   */
+   ABCC_MemSetBufferStatus( psWriteMsg, ABCC_MEM_BUFSTAT_SENT );
+
+   if( !ABCC_IsCmdMsg( psWriteMsg ) )
+   {
+      if( link_EnQueue( &link_sRespQueue, psWriteMsg ) )
+      {
+         ABCC_DEBUG_MSG_EVENT( "Response msg queued ", psWriteMsg );
+         ABCC_DEBUG_MSG_GENERAL( "RespQ status: %" PRIu8 "(%" PRIu8 ")\n",
+               link_NumInQueue( &link_sRespQueue ),
+               (UINT8)LINK_MAX_NUM_RESP_IN_Q );
+      }
+      else
+      {
+         ABCC_DEBUG_MSG_EVENT( "Response queue full", psWriteMsg );
+         eErrorCode = ABCC_EC_LINK_RESP_QUEUE_FULL;
+#if ABCC_CFG_ERR_REPORTING_ENABLED
+         lAddErrorInfo = (UINT32)(uintptr_t)psWriteMsg;
+#endif
+      }
+   }
+   else
+   {
+      /*
+      ** The response may be received before link_EnQueue() returns, so the
+      ** counter is incremented in advance.
+      */
+      ABCC_PORT_EnterCritical();
+      link_bNumberOfOutstandingCommands++;
+      ABCC_PORT_ExitCritical();
+
+      if( link_EnQueue( &link_sCmdQueue, psWriteMsg ) )
+      {
+         ABCC_DEBUG_MSG_EVENT( "Command queued", psWriteMsg );
+         ABCC_DEBUG_MSG_GENERAL( "CmdQ status: %" PRIu8 "(%" PRIu8 ")\n",
+               link_NumInQueue( &link_sCmdQueue ),
+               (UINT8)LINK_MAX_NUM_CMDS_IN_Q );
+         ABCC_DEBUG_MSG_GENERAL( "Outstanding commands: %" PRIu8 "\n",
+                                 link_bNumberOfOutstandingCommands );
+      }
+      else
+      {
+         ABCC_PORT_EnterCritical();
+         link_bNumberOfOutstandingCommands--;
+         ABCC_PORT_ExitCritical();
+
+         ABCC_DEBUG_MSG_EVENT( "Command queue full", psWriteMsg );
+         eErrorCode = ABCC_EC_LINK_CMD_QUEUE_FULL;
+      }
+   }
+
+   if( eErrorCode != ABCC_EC_NO_ERROR )
+   {
+      ABCC_LinkFree( &psWriteMsg );
+      ABCC_ERROR( ABCC_SEV_WARNING, eErrorCode, lAddErrorInfo );
+
+      return( eErrorCode );
+   }
+
+   /*
+   ** Send the message now if the driver is ready. Else it will be transmitted
+   ** at the next ABCC write message event.
+   */
+   ABCC_LinkCheckSendMessage();
+
+   return( eErrorCode );
+}
+#else
 ABCC_ErrorCodeType ABCC_LinkWriteMessage( ABP_MsgType* psWriteMsg )
 {
    BOOL fSendMsg;
@@ -346,6 +801,19 @@ ABCC_ErrorCodeType ABCC_LinkWriteMessage( ABP_MsgType* psWriteMsg )
       return( eErrorCode );
    }
 
+   /*
+   ** A message built in a small or medium buffer (ABCC_GetCmdMsgBufferOfSize())
+   ** must not exceed the size of that buffer.
+   */
+   if( ( ABCC_MemGetMaxDataSize( psWriteMsg ) != 0 ) &&
+       ( ABCC_GetMsgDataSize( psWriteMsg ) > ABCC_MemGetMaxDataSize( psWriteMsg ) ) )
+   {
+      eErrorCode = ABCC_EC_WRMSG_SIZE_ERR;
+      ABCC_ERROR( ABCC_SEV_WARNING, eErrorCode,
+                  iLeTOi( psWriteMsg->sHeader.iDataSize ) );
+      return( eErrorCode );
+   }
+
    ABCC_PORT_EnterCritical();
 
    /*
@@ -473,6 +941,7 @@ ABCC_ErrorCodeType ABCC_LinkWriteMessage( ABP_MsgType* psWriteMsg )
 
    return( eErrorCode );
 }
+#endif
 
 ABCC_ErrorCodeType ABCC_LinkWrMsgWithNotification( ABP_MsgType* psWriteMsg,
                                                    ABCC_LinkNotifyIndType pnHandler )
@@ -498,6 +967,93 @@ void ABCC_LinkFree( ABP_MsgType** ppsBuffer )
    ABCC_MemFree( ppsBuffer );
 }
 
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+ABCC_ErrorCodeType ABCC_LinkMapMsgHandler( UINT8 bSrcId, ABCC_MsgHandlerFuncType  pnMSgHandler )
+{
+   ABCC_ErrorCodeType eResult = ABCC_EC_NO_RESOURCES;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   if( ( link_pnMsgHandler[ bSrcId ] == NULL ) &&
+       ( link_iNumMsgHdl < LINK_MAX_NUM_MSG_HDL ) )
+   {
+      /*
+      ** A new command with the source id of a retired one takes over its
+      ** response.
+      */
+      (void)link_RemoveRetiredSrcId( bSrcId );
+      link_pnMsgHandler[ bSrcId ] = pnMSgHandler;
+      link_alSrcIdUsed[ bSrcId >> 5 ] |= (UINT32)1 << ( bSrcId & 31 );
+      link_iNumMsgHdl++;
+      eResult = ABCC_EC_NO_ERROR;
+   }
+   ABCC_PORT_ExitCritical();
+   return( eResult );
+}
+
+/*
+** Get and free the message handler. If not found return NULL. Must be called
+** in a critical section.
+*/
+static ABCC_MsgHandlerFuncType link_UnmapMsgHandler( UINT8 bSrcId )
+{
+   ABCC_MsgHandlerFuncType pnHandler;
+
+   pnHandler = link_pnMsgHandler[ bSrcId ];
+   if( pnHandler != NULL )
+   {
+      link_pnMsgHandler[ bSrcId ] = NULL;
+      link_alSrcIdUsed[ bSrcId >> 5 ] &= ~( (UINT32)1 << ( bSrcId & 31 ) );
+      link_iNumMsgHdl--;
+   }
+   return( pnHandler );
+}
+
+ABCC_MsgHandlerFuncType ABCC_LinkGetMsgHandler( UINT8 bSrcId )
+{
+   ABCC_MsgHandlerFuncType pnHandler;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   pnHandler = link_UnmapMsgHandler( bSrcId );
+   ABCC_PORT_ExitCritical();
+   return( pnHandler );
+}
+
+BOOL ABCC_LinkIsSrcIdUsed( UINT8 bSrcId )
+{
+   return( link_pnMsgHandler[ bSrcId ] != NULL );
+}
+
+UINT8 ABCC_LinkGetFreeSrcId( UINT8 bSrcId )
+{
+   UINT32 lFree;
+   UINT8 bWord;
+   UINT8 bCount;
+
+   /*
+   ** Free source ids at or above bSrcId in its own word, then the following
+   ** words with wrap-around. At most LINK_MAX_NUM_MSG_HDL ids are mapped and
+   ** LINK_MAX_NUM_CMDS_IN_Q retired so a free id is always found.
+   */
+   bWord = bSrcId >> 5;
+   lFree = ~link_alSrcIdUsed[ bWord ] & ( 0xFFFFFFFFUL << ( bSrcId & 31 ) );
+   for( bCount = 0; ( lFree == 0 ) && ( bCount < LINK_NUM_SRC_ID_WORDS ); bCount++ )
+   {
+      bWord = ( bWord + 1 ) % LINK_NUM_SRC_ID_WORDS;
+      lFree = ~link_alSrcIdUsed[ bWord ];
+   }
+
+   bSrcId = bWord << 5;
+   while( ( lFree & 1 ) == 0 )
+   {
+      lFree >>= 1;
+      bSrcId++;
+   }
+
+   return( bSrcId );
+}
+#else
 ABCC_ErrorCodeType ABCC_LinkMapMsgHandler( UINT8 bSrcId, ABCC_MsgHandlerFuncType  pnMSgHandler )
 {
    UINT16 iIndex;
@@ -512,6 +1068,11 @@ ABCC_ErrorCodeType ABCC_LinkMapMsgHandler( UINT8 bSrcId, ABCC_MsgHandlerFuncType
    {
       if( link_pnMsgHandler[ iIndex ] == 0 )
       {
+         /*
+         ** A new command with the source id of a retired one takes over its
+         ** response.
+         */
+         (void)link_RemoveRetiredSrcId( bSrcId );
          link_pnMsgHandler[ iIndex ] = pnMSgHandler;
          link_bMsgSrcId[ iIndex ] = bSrcId;
          eResult = ABCC_EC_NO_ERROR;
@@ -522,16 +1083,15 @@ ABCC_ErrorCodeType ABCC_LinkMapMsgHandler( UINT8 bSrcId, ABCC_MsgHandlerFuncType
    return( eResult );
 }
 
-ABCC_MsgHandlerFuncType ABCC_LinkGetMsgHandler( UINT8 bSrcId )
+/*
+** Find and free the message handler. If not found return NULL. Must be called
+** in a critical section.
+*/
+static ABCC_MsgHandlerFuncType link_UnmapMsgHandler( UINT8 bSrcId )
 {
    UINT16 iIndex;
    ABCC_MsgHandlerFuncType pnHandler = NULL;
-   ABCC_PORT_UseCritical();
 
-   /*
-   ** Find message handler. If not found return NULL.
-   */
-   ABCC_PORT_EnterCritical();
    for( iIndex = 0; iIndex < LINK_MAX_NUM_MSG_HDL; iIndex++ )
    {
       if( ( link_pnMsgHandler[ iIndex ] != NULL ) && ( link_bMsgSrcId[ iIndex ] == bSrcId ) )
@@ -541,6 +1101,16 @@ ABCC_MsgHandlerFuncType ABCC_LinkGetMsgHandler( UINT8 bSrcId )
          break;
       }
    }
+   return( pnHandler );
+}
+
+ABCC_MsgHandlerFuncType ABCC_LinkGetMsgHandler( UINT8 bSrcId )
+{
+   ABCC_MsgHandlerFuncType pnHandler;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   pnHandler = link_UnmapMsgHandler( bSrcId );
    ABCC_PORT_ExitCritical();
    return( pnHandler );
 }
@@ -558,5 +1128,45 @@ BOOL ABCC_LinkIsSrcIdUsed( UINT8 bSrcId )
          break;
       }
    }
+
+   /*
+   ** The source id of a retired command is not reused until its late response
+   ** has been dropped.
+   */
+   for( iIndex = 0; !fFound && ( iIndex < link_bNumRetired ); iIndex++ )
+   {
+      fFound = ( link_abRetiredSrcId[ iIndex ] == bSrcId );
+   }
    return( fFound );
 }
+#endif /* ABCC_CFG_SRC_ID_INDEX_ENABLED */
+
+void ABCC_LinkRetireCmd( UINT8 bSrcId )
+{
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   if( link_UnmapMsgHandler( bSrcId ) != NULL )
+   {
+      if( link_bNumRetired == LINK_MAX_NUM_CMDS_IN_Q )
+      {
+         /*
+         ** The oldest retired command is given up on, its response is not
+         ** expected any longer.
+         */
+         (void)link_RemoveRetiredSrcId( link_abRetiredSrcId[ 0 ] );
+         if( link_bNumberOfOutstandingCommands > 0 )
+         {
+            link_bNumberOfOutstandingCommands--;
+         }
+      }
+      link_abRetiredSrcId[ link_bNumRetired++ ] = bSrcId;
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+      /*
+      ** Keep the source id in use until the late response has been dropped.
+      */
+      link_alSrcIdUsed[ bSrcId >> 5 ] |= (UINT32)1 << ( bSrcId & 31 );
+#endif
+   }
+   ABCC_PORT_ExitCritical();
+}
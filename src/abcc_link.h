@@ -139,6 +139,40 @@ EXTFUNC ABCC_MsgHandlerFuncType ABCC_LinkGetMsgHandler( UINT8 bSrcId );
 */
 EXTFUNC BOOL ABCC_LinkIsSrcIdUsed( UINT8 bSrcId );
 
+/*------------------------------------------------------------------------------
+** Gives up waiting for the response to a command, e.g. at a response timeout.
+** The message handler is freed. The command stays counted as outstanding
+** (see ABCC_LinkGetNumCmdQueueEntries()) since the module still holds it. A
+** late response to the command is dropped and the source id is not reused
+** until then, or until ABCC_CFG_MAX_NUM_APPL_CMDS newer commands have been
+** retired, at which point the command is no longer counted.
+** Must not be called while the response is being handled in another context.
+**------------------------------------------------------------------------------
+** Arguments:
+**          bSrcId:  Source id of the command.
+**
+** Returns:
+**          None.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_LinkRetireCmd( UINT8 bSrcId );
+
+#if ABCC_CFG_SRC_ID_INDEX_ENABLED
+/*------------------------------------------------------------------------------
+** Finds a source id that has no map in the message handler table, searching
+** from bSrcId and upwards with wrap-around. Must be called in a critical
+** section, together with the update of the caller's source id counter.
+**------------------------------------------------------------------------------
+** Arguments:
+**          bSrcId:  First source id to check.
+**
+** Returns:
+**          Free source id.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT8 ABCC_LinkGetFreeSrcId( UINT8 bSrcId );
+#endif
+
 /*------------------------------------------------------------------------------
 ** Receive read message if available
 **------------------------------------------------------------------------------
@@ -22,6 +22,7 @@
 #include "abcc_hardware_abstraction.h"
 #include "abcc_port.h"
 #include "abcc_debug_error.h"
+#include <stddef.h>
 
 /*
 ** Set default value for maximum number of resources
@@ -35,6 +36,34 @@
 */
 #define ABCC_MEM_MAGIC_COOKIE  0x5CC5
 
+/*
+** Free stack head: buffer index in the low 16 bits and a tag in the high 16
+** bits. The tag is incremented by every pop and push so that a compare and
+** exchange based on a stale head fails even if the same buffer is on top again
+** (ABA problem).
+*/
+#define ABCC_MEM_END_OF_STACK         0xFFFF
+#define ABCC_MEM_HEAD_INDEX( lHead )  ( (UINT16)( (lHead) & 0xFFFF ) )
+#define ABCC_MEM_HEAD( lHead, iIndex ) \
+   (UINT32)( ( ( (lHead) + 0x10000UL ) & 0xFFFF0000UL ) | (UINT32)(iIndex) )
+
+/*
+** Number of buffer size classes. The full size class
+** (ABCC_CFG_MAX_MSG_SIZE) always exists, the small and medium classes only if
+** they are given any buffers.
+*/
+#if ( ABCC_CFG_NUM_SMALL_MSG_RESOURCES > 0 )
+#define ABCC_MEM_NUM_SMALL_CLASSES   1
+#else
+#define ABCC_MEM_NUM_SMALL_CLASSES   0
+#endif
+#if ( ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES > 0 )
+#define ABCC_MEM_NUM_MEDIUM_CLASSES  1
+#else
+#define ABCC_MEM_NUM_MEDIUM_CLASSES  0
+#endif
+#define ABCC_MEM_NUM_CLASSES  ( ABCC_MEM_NUM_SMALL_CLASSES + ABCC_MEM_NUM_MEDIUM_CLASSES + 1 )
+
 /*------------------------------------------------------------------------------
 ** Structure for defining size of memory message allocation
 **
@@ -43,77 +72,300 @@
 ** bounds of the message data area.
 **------------------------------------------------------------------------------
 */
+#define ABCC_MEM_ALLOC_TYPE( iDataSize )                                       \
+   struct                                                                      \
+   {                                                                           \
+      ABP_MsgHeaderType16 sHeader;                                             \
+      UINT32   alData[ ( (iDataSize) + 3 ) >> 2 ];                             \
+      UINT16   iMagicCookie;                                                   \
+      UINT16   iBufferStatus;                                                  \
+   }                                                                           \
+   PACKED_STRUCT
+
+typedef ABCC_MEM_ALLOC_TYPE( ABCC_CFG_MAX_MSG_SIZE ) ABCC_MemAllocType;
+#if ( ABCC_CFG_NUM_SMALL_MSG_RESOURCES > 0 )
+typedef ABCC_MEM_ALLOC_TYPE( ABCC_CFG_SMALL_MSG_SIZE ) ABCC_MemAllocSmallType;
+#endif
+#if ( ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES > 0 )
+typedef ABCC_MEM_ALLOC_TYPE( ABCC_CFG_MEDIUM_MSG_SIZE ) ABCC_MemAllocMediumType;
+#endif
+
+/*------------------------------------------------------------------------------
+** The cookie and status fields ending each buffer, regardless of size class.
+**------------------------------------------------------------------------------
+*/
 typedef struct
 {
-   ABP_MsgHeaderType16 sHeader;
-   UINT32   alData[ ( ABCC_CFG_MAX_MSG_SIZE + 3 ) >> 2 ];
    UINT16   iMagicCookie;
    UINT16   iBufferStatus;
 }
-PACKED_STRUCT ABCC_MemAllocType;
+PACKED_STRUCT ABCC_MemTrailerType;
 
 /*------------------------------------------------------------------------------
-** Union used for casting between memory ABCC_MemAllocType and ABP_MsgType.
+** Memory pool structure, one per size class
+**
+** The free buffers of a class form a linked stack (Treiber stack) of buffer
+** indexes. Buffers are popped and pushed with a compare and exchange of the
+** head, so allocating and freeing never disables interrupts.
+**
+** ------------------
+** lFreeHead = 2    |---|
+** ------------------   |
+** Next of Msg 0    |   |   END_OF_STACK
+** ------------------   |
+** Next of Msg 1    |   |   0
+** ------------------   |
+** Next of Msg 2    |<--|   1
+** ------------------
+**
+** pbPool         - First buffer of the class.
+** paiNextFree    - Index of the next free buffer, per buffer.
+** lFreeHead      - Tag and index of the first free buffer.
+** iBufferSize    - Size of one buffer (sizeof).
+** iTrailerOffset - Offset from the start of a buffer to its trailer.
+** iMaxDataSize   - Max message data size of the class in octets.
+** iNumMsg        - Number of buffers of the class.
 **------------------------------------------------------------------------------
 */
-typedef union
+typedef struct
 {
-   ABCC_MemAllocType* psAllocMsg;
-   ABP_MsgType* psMsg;
+   UINT8*            pbPool;
+   volatile UINT16*  paiNextFree;
+   volatile UINT32   lFreeHead;
+   UINT16            iBufferSize;
+   UINT16            iTrailerOffset;
+   UINT16            iMaxDataSize;
+   UINT16            iNumMsg;
 }
-ABCC_MemAllocUnion;
+ABCC_MemClassType;
+
+#if ( ABCC_CFG_NUM_SMALL_MSG_RESOURCES > 0 )
+static volatile UINT16         abcc_aiNextFreeSmallMsg[ ABCC_CFG_NUM_SMALL_MSG_RESOURCES ];
+static ABCC_MemAllocSmallType  abcc_asSmallMsgPool[ ABCC_CFG_NUM_SMALL_MSG_RESOURCES ];
+#endif
+#if ( ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES > 0 )
+static volatile UINT16         abcc_aiNextFreeMediumMsg[ ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES ];
+static ABCC_MemAllocMediumType abcc_asMediumMsgPool[ ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES ];
+#endif
+static volatile UINT16         abcc_aiNextFreeMsg[ ABCC_CFG_MAX_NUM_MSG_RESOURCES ];
+static ABCC_MemAllocType       abcc_asMsgPool[ ABCC_CFG_MAX_NUM_MSG_RESOURCES ];
+
+/*
+** Size classes in ascending size order.
+*/
+static ABCC_MemClassType abcc_asMemClass[ ABCC_MEM_NUM_CLASSES ];
 
 /*------------------------------------------------------------------------------
-** Memory pool structure
+** Replaces the head of a free stack if it has not been changed since it was
+** read.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psClass     - Size class.
+**    plHead      - Head that was read. Updated with the current head if it
+**                  has been changed.
+**    lNewHead    - New head.
 **
-** ------------------
-** iNumFreeMsg = 3  |
-** ------------------
-** Msg 0 pointer    |---|
-** ------------------   |
-** Msg 1 pointer    |---+--|
-** ------------------   |  |
-** Msg 2 pointer    |---+--+--|
-** ------------------   |  |  |
-** Msg 0            |<--|  |  |
-** ------------------      |  |
-** Msg 1            |<-----|  |
-** ------------------         |
-** Msg 2            |<--------|
-** ------------------
+** Returns:
+**    TRUE if the head was replaced.
 **------------------------------------------------------------------------------
 */
-static UINT16 abcc_iNumFreeMsg;
-static ABCC_MemAllocUnion abcc_uFreeMsgStack[ ABCC_CFG_MAX_NUM_MSG_RESOURCES ];
-static ABCC_MemAllocType  abcc_asMsgPool[ ABCC_CFG_MAX_NUM_MSG_RESOURCES ];
+static BOOL ExchangeHead( ABCC_MemClassType* psClass,
+                          UINT32* plHead,
+                          UINT32 lNewHead )
+{
+#ifdef ABCC_PORT_AtomicCompareExchange32
+   return( ABCC_PORT_AtomicCompareExchange32( &psClass->lFreeHead,
+                                              plHead,
+                                              lNewHead ) );
+#else
+   BOOL fExchanged;
+   ABCC_PORT_UseCritical();
 
-void ABCC_MemCreatePool( void )
+   ABCC_PORT_EnterCritical();
+   fExchanged = ( psClass->lFreeHead == *plHead );
+   if( fExchanged )
+   {
+      psClass->lFreeHead = lNewHead;
+   }
+   else
+   {
+      *plHead = psClass->lFreeHead;
+   }
+   ABCC_PORT_ExitCritical();
+
+   return( fExchanged );
+#endif
+}
+
+/*------------------------------------------------------------------------------
+** Initializes a size class and puts all its buffers on the free stack.
+**------------------------------------------------------------------------------
+*/
+static void InitClass( ABCC_MemClassType* psClass,
+                       void* pxPool,
+                       volatile UINT16* paiNextFree,
+                       UINT16 iBufferSize,
+                       UINT16 iTrailerOffset,
+                       UINT16 iMaxDataSize,
+                       UINT16 iNumMsg )
+{
+   ABCC_MemTrailerType* psTrailer;
+   UINT16 i;
+
+   psClass->pbPool = (UINT8*)pxPool;
+   psClass->paiNextFree = paiNextFree;
+   psClass->lFreeHead = ABCC_MEM_HEAD( psClass->lFreeHead, iNumMsg - 1 );
+   psClass->iBufferSize = iBufferSize;
+   psClass->iTrailerOffset = iTrailerOffset;
+   psClass->iMaxDataSize = iMaxDataSize;
+   psClass->iNumMsg = iNumMsg;
+
+   for( i = 0; i < iNumMsg; i++ )
+   {
+      paiNextFree[ i ] = ( i == 0 ) ? ABCC_MEM_END_OF_STACK : (UINT16)( i - 1 );
+      psTrailer = (ABCC_MemTrailerType*)( psClass->pbPool + ( i * iBufferSize ) + iTrailerOffset );
+      psTrailer->iMagicCookie = ABCC_MEM_MAGIC_COOKIE;
+      psTrailer->iBufferStatus = ABCC_MEM_BUFSTAT_FREE;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Finds the size class a buffer belongs to.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psMsg       - Message buffer.
+**
+** Returns:
+**    Pointer to the size class. NULL if the buffer is not a pool buffer.
+**------------------------------------------------------------------------------
+*/
+static ABCC_MemClassType* GetClass( const ABP_MsgType* psMsg )
 {
+   const UINT8* pbMsg = (const UINT8*)psMsg;
+   ABCC_MemClassType* psClass;
    UINT16 i;
 
-   abcc_iNumFreeMsg = ABCC_CFG_MAX_NUM_MSG_RESOURCES;
+   for( i = 0; i < ABCC_MEM_NUM_CLASSES; i++ )
+   {
+      psClass = &abcc_asMemClass[ i ];
+
+      if( ( pbMsg >= psClass->pbPool ) &&
+          ( pbMsg < ( psClass->pbPool + ( (UINT32)psClass->iNumMsg * psClass->iBufferSize ) ) ) &&
+          ( ( ( pbMsg - psClass->pbPool ) % psClass->iBufferSize ) == 0 ) )
+      {
+         return( psClass );
+      }
+   }
+
+   return( NULL );
+}
+
+/*------------------------------------------------------------------------------
+** Returns the cookie/status trailer of a buffer.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psMsg       - Message buffer.
+**
+** Returns:
+**    Pointer to the trailer. NULL if the buffer is not a pool buffer.
+**------------------------------------------------------------------------------
+*/
+static ABCC_MemTrailerType* GetTrailer( const ABP_MsgType* psMsg )
+{
+   const ABCC_MemClassType* psClass;
 
-   for( i = 0; i < ABCC_CFG_MAX_NUM_MSG_RESOURCES; i++ )
+   psClass = GetClass( psMsg );
+
+   if( psClass == NULL )
    {
-      abcc_uFreeMsgStack[ i ].psAllocMsg = &abcc_asMsgPool[ i ];
-      abcc_asMsgPool[ i ].iMagicCookie = ABCC_MEM_MAGIC_COOKIE;
-      abcc_asMsgPool[ i ].iBufferStatus = ABCC_MEM_BUFSTAT_FREE;
+      return( NULL );
    }
+
+   return( (ABCC_MemTrailerType*)( (UINT8*)psMsg + psClass->iTrailerOffset ) );
+}
+
+void ABCC_MemCreatePool( void )
+{
+   UINT16 iClass = 0;
+
+#if ( ABCC_CFG_NUM_SMALL_MSG_RESOURCES > 0 )
+   InitClass( &abcc_asMemClass[ iClass++ ],
+              abcc_asSmallMsgPool,
+              abcc_aiNextFreeSmallMsg,
+              sizeof( ABCC_MemAllocSmallType ),
+              offsetof( ABCC_MemAllocSmallType, iMagicCookie ),
+              ABCC_CFG_SMALL_MSG_SIZE,
+              ABCC_CFG_NUM_SMALL_MSG_RESOURCES );
+#endif
+#if ( ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES > 0 )
+   InitClass( &abcc_asMemClass[ iClass++ ],
+              abcc_asMediumMsgPool,
+              abcc_aiNextFreeMediumMsg,
+              sizeof( ABCC_MemAllocMediumType ),
+              offsetof( ABCC_MemAllocMediumType, iMagicCookie ),
+              ABCC_CFG_MEDIUM_MSG_SIZE,
+              ABCC_CFG_NUM_MEDIUM_MSG_RESOURCES );
+#endif
+   InitClass( &abcc_asMemClass[ iClass ],
+              abcc_asMsgPool,
+              abcc_aiNextFreeMsg,
+              sizeof( ABCC_MemAllocType ),
+              offsetof( ABCC_MemAllocType, iMagicCookie ),
+              ABCC_CFG_MAX_MSG_SIZE,
+              ABCC_CFG_MAX_NUM_MSG_RESOURCES );
 }
 
 ABP_MsgType* ABCC_MemAlloc( void )
 {
-   ABP_MsgType* pxItem = NULL;
-   ABCC_PORT_UseCritical();
-   ABCC_PORT_EnterCritical();
-   if( abcc_iNumFreeMsg > 0 )
+   return( ABCC_MemAllocSize( ABCC_CFG_MAX_MSG_SIZE ) );
+}
+
+ABP_MsgType* ABCC_MemAllocRxMsg( BOOL fCommand, UINT16 iDataSize )
+{
+   if( fCommand || ( iDataSize > ABCC_CFG_MAX_MSG_SIZE ) )
    {
-      abcc_iNumFreeMsg--;
-      pxItem = abcc_uFreeMsgStack[ abcc_iNumFreeMsg ].psMsg;
-      ( (ABCC_MemAllocType*)pxItem )->iBufferStatus = ABCC_MEM_BUFSTAT_ALLOCATED;
+      return( ABCC_MemAlloc() );
    }
 
-   ABCC_PORT_ExitCritical();
+   return( ABCC_MemAllocSize( iDataSize ) );
+}
+
+ABP_MsgType* ABCC_MemAllocSize( UINT16 iMaxDataSize )
+{
+   ABCC_MemClassType* psClass;
+   ABP_MsgType* pxItem = NULL;
+   UINT32 lHead;
+   UINT16 iIndex;
+   UINT16 i;
+
+   /*
+   ** Use the smallest class that fits. If it is empty try the next one up.
+   */
+   for( i = 0; ( i < ABCC_MEM_NUM_CLASSES ) && ( pxItem == NULL ); i++ )
+   {
+      psClass = &abcc_asMemClass[ i ];
+
+      if( psClass->iMaxDataSize < iMaxDataSize )
+      {
+         continue;
+      }
+
+      lHead = psClass->lFreeHead;
+      do
+      {
+         iIndex = ABCC_MEM_HEAD_INDEX( lHead );
+      }
+      while( ( iIndex != ABCC_MEM_END_OF_STACK ) &&
+             !ExchangeHead( psClass,
+                            &lHead,
+                            ABCC_MEM_HEAD( lHead, psClass->paiNextFree[ iIndex ] ) ) );
+
+      if( iIndex != ABCC_MEM_END_OF_STACK )
+      {
+         pxItem = (ABP_MsgType*)( psClass->pbPool + ( (UINT32)iIndex * psClass->iBufferSize ) );
+         ( (ABCC_MemTrailerType*)( (UINT8*)pxItem + psClass->iTrailerOffset ) )->iBufferStatus = ABCC_MEM_BUFSTAT_ALLOCATED;
+      }
+   }
 
    ABCC_DEBUG_MSG_GENERAL( "Mem: Buffer allocated: 0x%p\n", (void*)pxItem );
 
@@ -122,59 +374,93 @@ ABP_MsgType* ABCC_MemAlloc( void )
 
 void ABCC_MemFree( ABP_MsgType** pxItem )
 {
-   ABCC_MemAllocType* const psBuf = (ABCC_MemAllocType*)(*pxItem);
-   ABCC_PORT_UseCritical();
+   ABCC_MemClassType* const psClass = GetClass( *pxItem );
+   ABCC_MemTrailerType* psTrailer;
+   UINT32 lHead;
+   UINT16 iIndex;
 
    ABCC_DEBUG_MSG_GENERAL( "Mem: Buffer returned:  0x%p\n", (void*)*pxItem );
 
-   if( psBuf->iMagicCookie != ABCC_MEM_MAGIC_COOKIE )
+   if( psClass == NULL )
    {
       ABCC_ERROR( ABCC_SEV_FATAL,
                   ABCC_EC_MSG_BUFFER_CORRUPTED,
-                  (UINT32)psBuf );
+                  (UINT32)(uintptr_t)*pxItem );
       return;
    }
 
-   if( psBuf->iBufferStatus == ABCC_MEM_BUFSTAT_FREE )
+   psTrailer = (ABCC_MemTrailerType*)( (UINT8*)*pxItem + psClass->iTrailerOffset );
+
+   if( psTrailer->iMagicCookie != ABCC_MEM_MAGIC_COOKIE )
    {
       ABCC_ERROR( ABCC_SEV_FATAL,
-                  ABCC_EC_MSG_BUFFER_ALREADY_FREED,
-                  (UINT32)psBuf );
+                  ABCC_EC_MSG_BUFFER_CORRUPTED,
+                  (UINT32)(uintptr_t)*pxItem );
       return;
    }
 
-   ABCC_PORT_EnterCritical();
+   if( psTrailer->iBufferStatus == ABCC_MEM_BUFSTAT_FREE )
+   {
+      ABCC_ERROR( ABCC_SEV_FATAL,
+                  ABCC_EC_MSG_BUFFER_ALREADY_FREED,
+                  (UINT32)(uintptr_t)*pxItem );
+      return;
+   }
 
-   abcc_uFreeMsgStack[ abcc_iNumFreeMsg ].psAllocMsg = psBuf;
-   abcc_iNumFreeMsg++;
-   psBuf->iBufferStatus = ABCC_MEM_BUFSTAT_FREE;
+   /*
+   ** The status must be set before the push, the buffer can be allocated
+   ** again as soon as it is on the stack.
+   */
+   iIndex = (UINT16)( ( (UINT8*)*pxItem - psClass->pbPool ) / psClass->iBufferSize );
+   psTrailer->iBufferStatus = ABCC_MEM_BUFSTAT_FREE;
    *pxItem = NULL;
 
-   ABCC_PORT_ExitCritical();
+   lHead = psClass->lFreeHead;
+   do
+   {
+      psClass->paiNextFree[ iIndex ] = ABCC_MEM_HEAD_INDEX( lHead );
+   }
+   while( !ExchangeHead( psClass, &lHead, ABCC_MEM_HEAD( lHead, iIndex ) ) );
+}
+
+UINT16 ABCC_MemGetMaxDataSize( const ABP_MsgType* psMsg )
+{
+   const ABCC_MemClassType* psClass;
+
+   psClass = GetClass( psMsg );
+
+   if( psClass == NULL )
+   {
+      return( 0 );
+   }
+
+   return( psClass->iMaxDataSize );
 }
 
 ABCC_MemBufferStatusType ABCC_MemGetBufferStatus( ABP_MsgType* psMsg )
 {
-   const ABCC_MemAllocType* const psBuf = (ABCC_MemAllocType*)psMsg;
+   const ABCC_MemTrailerType* const psTrailer = GetTrailer( psMsg );
 
-   if( psBuf->iMagicCookie != ABCC_MEM_MAGIC_COOKIE )
+   if( ( psTrailer == NULL ) ||
+       ( psTrailer->iMagicCookie != ABCC_MEM_MAGIC_COOKIE ) )
    {
       ABCC_ERROR( ABCC_SEV_FATAL,
                   ABCC_EC_MSG_BUFFER_CORRUPTED,
-                  (UINT32)psBuf );
+                  (UINT32)(uintptr_t)psMsg );
 
       return( ABCC_MEM_BUFSTAT_UNKNOWN );
    }
 
-   return( (ABCC_MemBufferStatusType)psBuf->iBufferStatus );
+   return( (ABCC_MemBufferStatusType)psTrailer->iBufferStatus );
 }
 
 void ABCC_MemSetBufferStatus( ABP_MsgType* psMsg,
                               ABCC_MemBufferStatusType eStatus )
 {
-   ABCC_MemAllocType* const psBuf = (ABCC_MemAllocType*)psMsg;
+   ABCC_MemTrailerType* const psTrailer = GetTrailer( psMsg );
 
-   if( psBuf->iMagicCookie != ABCC_MEM_MAGIC_COOKIE )
+   if( ( psTrailer == NULL ) ||
+       ( psTrailer->iMagicCookie != ABCC_MEM_MAGIC_COOKIE ) )
    {
       ABCC_ERROR( ABCC_SEV_FATAL,
                   ABCC_EC_MSG_BUFFER_CORRUPTED,
@@ -182,5 +468,5 @@ void ABCC_MemSetBufferStatus( ABP_MsgType* psMsg,
       return;
    }
 
-   psBuf->iBufferStatus = eStatus;
+   psTrailer->iBufferStatus = eStatus;
 }
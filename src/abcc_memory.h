@@ -62,6 +62,47 @@ void ABCC_MemCreatePool( void );
 */
 EXTFUNC ABP_MsgType* ABCC_MemAlloc( void );
 
+/*------------------------------------------------------------------------------
+** Allocates and return pointer to memory from the smallest size class that
+** can hold iMaxDataSize octets of message data. If that class is empty the
+** next larger class is used.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iMaxDataSize - Max message data size the buffer will be used for.
+**
+** Returns:
+**    Pointer to allocated memory. NULL if no class that fits has a free buffer.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC ABP_MsgType* ABCC_MemAllocSize( UINT16 iMaxDataSize );
+
+/*------------------------------------------------------------------------------
+** Allocates memory for a received message once its header is known. A
+** received command gets a full size buffer since the response is normally
+** built in the same buffer. A response gets the smallest buffer that holds its
+** data.
+**------------------------------------------------------------------------------
+** Arguments:
+**    fCommand  - TRUE if the message is a command.
+**    iDataSize - Message data size, rounded up to what the driver reads.
+** Returns:
+**    Pointer to allocated memory. NULL if no class that fits has a free buffer.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC ABP_MsgType* ABCC_MemAllocRxMsg( BOOL fCommand, UINT16 iDataSize );
+
+/*------------------------------------------------------------------------------
+** Get the max message data size of a memory buffer
+**------------------------------------------------------------------------------
+** Arguments:
+**    psMsg - Message buffer to check
+**
+** Returns:
+**    Max message data size in octets. 0 if the buffer is not from the pool.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT16 ABCC_MemGetMaxDataSize( const ABP_MsgType* psMsg );
+
 /*------------------------------------------------------------------------------
 ** Return memory to the pool. Note that it is important that the returned memory
 ** is belonging to the pool from the beginning.
@@ -23,28 +23,49 @@
 #include "abcc_port.h"
 #include "abcc_segmentation.h"
 
-#ifndef ABCC_NUM_SEGMENTATION_SESSIONS
-#define ABCC_NUM_SEGMENTATION_SESSIONS 1
+/*
+** Active sessions are kept in a hash table keyed on the identifiers of the
+** command that started them. Each slot holds a singly linked list of the
+** sessions hashing to it, so a received command is normally matched, or found
+** not to belong to any session, by looking at a single slot.
+*/
+#if ( ABCC_CFG_SEG_HASH_SIZE & ( ABCC_CFG_SEG_HASH_SIZE - 1 ) ) != 0
+#error "ABCC_CFG_SEG_HASH_SIZE must be a power of two"
+#endif
+#if ABCC_CFG_SEG_HASH_SIZE > 256
+#error "ABCC_CFG_SEG_HASH_SIZE must not be larger than 256"
+#endif
+#if ABCC_CFG_NUM_SEG_SESSIONS >= 255
+#error "ABCC_CFG_NUM_SEG_SESSIONS must be less than 255"
 #endif
 
 #define ABCC_MSG_HEADER_TYPE_SIZEOF 12
 
+#define ABCC_SEG_NO_SESSION ( 0xff )
+
+/*------------------------------------------------------------------------------
+** Destination object, command and command extension 0 of a message packed
+** into one session key.
+**------------------------------------------------------------------------------
+*/
+#define SegSessionKey( psMsg )                                                 \
+   ( ( (UINT32)ABCC_GetMsgDestObj( psMsg ) << 24 ) |                           \
+     ( (UINT32)ABCC_GetMsgCmdBits( psMsg ) << 16 ) |                           \
+     ( (UINT32)ABCC_GetMsgCmdExt0( psMsg ) << 8 ) )
+
 /*------------------------------------------------------------------------------
 ** To determine if a command belongs to an existing segmentation session the
 ** the members of this struct must match the command that started the session.
 **------------------------------------------------------------------------------
-**   bDestObj  - Destination object.
+**   lKey      - Destination object, command and command extension 0, see
+**               SegSessionKey().
 **   iInstance - Instance.
-**   bCmd      - Command.
-**   bCmdExt0  - Command extension 0.
 **------------------------------------------------------------------------------
 */
 typedef struct abcc_SegSessionIdentifiers
 {
-   UINT8 bDestObj;
+   UINT32 lKey;
    UINT16 iInstance;
-   UINT8 bCmd;
-   UINT8 bCmdExt0;
 }
 abcc_SegSessionIdentifiersType;
 
@@ -58,7 +79,9 @@ abcc_SegSessionIdentifiersType;
 **   lTotalMsgSize - Size of entire payload to be sent
 **   bRspCmdExt0   - Command extension 0 value to use in response segments.
 **   sIdentifiers  - Used to match commands with existing sessions.
+**   bHashNext     - Next session in the same hash slot.
 **   fInUse        - Indicates if the session is in use.
+**   lTmoDeadlineMs - Uptime when the session times out.
 **------------------------------------------------------------------------------
 */
 typedef struct abcc_SegSession
@@ -71,7 +94,11 @@ typedef struct abcc_SegSession
    UINT32 lDataBlockSize;
    UINT8 bRspCmdExt0;
    abcc_SegSessionIdentifiersType sIdentifiers;
+   UINT8 bHashNext;
    BOOL  fInUse;
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   UINT32 lTmoDeadlineMs;
+#endif
 }
 abcc_SegSessionType;
 
@@ -85,32 +112,93 @@ static UINT8 abcc_bSegNumUsedInst;
 ** Place holder for segmentation sessions
 **------------------------------------------------------------------------------
 */
-static abcc_SegSessionType abcc_sSegSession[ ABCC_NUM_SEGMENTATION_SESSIONS ];
+static abcc_SegSessionType abcc_sSegSession[ ABCC_CFG_NUM_SEG_SESSIONS ];
+
+/*------------------------------------------------------------------------------
+** First session of each hash slot, ABCC_SEG_NO_SESSION if none.
+**------------------------------------------------------------------------------
+*/
+static UINT8 abcc_abSegHash[ ABCC_CFG_SEG_HASH_SIZE ];
+
+/*------------------------------------------------------------------------------
+** Calculates the hash slot of a session.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psIdentifiers - Session identifiers.
+**
+** Returns:
+**    Hash slot.
+**------------------------------------------------------------------------------
+*/
+static UINT8 SegSessionHash( const abcc_SegSessionIdentifiersType* psIdentifiers )
+{
+   UINT32 lHash;
+
+   lHash = (UINT32)( ( psIdentifiers->lKey ^ psIdentifiers->iInstance ) *
+                     2654435769UL );
+
+   return( (UINT8)( ( lHash >> 24 ) & ( ABCC_CFG_SEG_HASH_SIZE - 1 ) ) );
+}
+
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+/*------------------------------------------------------------------------------
+** Restarts the timeout of a session.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psSegSession - Pointer to segmentation instance
+**
+** Returns:
+**    None.
+**------------------------------------------------------------------------------
+*/
+static void RestartSegmentationTmo( abcc_SegSessionType* psSegSession )
+{
+   psSegSession->lTmoDeadlineMs = (UINT32)ABCC_GetUptimeMs() +
+                                  ABCC_CFG_SEG_SESSION_TMO_MS;
+}
+#endif
 
 /*------------------------------------------------------------------------------
-** Allocate segmentations instance
+** Allocate segmentations instance and add it to the hash table.
 **------------------------------------------------------------------------------
 ** Arguments:
-**    None
+**    psReqMsgHeader - Header of the command that starts the session.
 ** Returns:
 **    Pointer to abcc_SegInstanceType. NULL if no free resource is found
 **------------------------------------------------------------------------------
 */
-static abcc_SegSessionType* AllocSegmentationSession( void )
+static abcc_SegSessionType* AllocSegmentationSession( const ABP_MsgHeaderType* psReqMsgHeader )
 {
    UINT8 bSession;
+   UINT8 bSlot;
    abcc_SegSessionType* psSegSession = NULL;
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   UINT32 lTmoDeadlineMs;
+#endif
    ABCC_PORT_UseCritical();
 
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   lTmoDeadlineMs = (UINT32)ABCC_GetUptimeMs() + ABCC_CFG_SEG_SESSION_TMO_MS;
+#endif
+
    ABCC_PORT_EnterCritical();
 
-   for( bSession = 0; bSession < ABCC_NUM_SEGMENTATION_SESSIONS; bSession++ )
+   for( bSession = 0; bSession < ABCC_CFG_NUM_SEG_SESSIONS; bSession++ )
    {
       if( !abcc_sSegSession[ bSession ].fInUse )
       {
          abcc_bSegNumUsedInst++;
          psSegSession = &abcc_sSegSession[ bSession ];
          psSegSession->fInUse = TRUE;
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+         psSegSession->lTmoDeadlineMs = lTmoDeadlineMs;
+#endif
+         psSegSession->sIdentifiers.lKey = SegSessionKey( psReqMsgHeader );
+         psSegSession->sIdentifiers.iInstance = ABCC_GetMsgInstance( psReqMsgHeader );
+
+         bSlot = SegSessionHash( &psSegSession->sIdentifiers );
+         psSegSession->bHashNext = abcc_abSegHash[ bSlot ];
+         abcc_abSegHash[ bSlot ] = bSession;
          break;
       }
    }
@@ -133,28 +221,60 @@ static abcc_SegSessionType* AllocSegmentationSession( void )
 static abcc_SegSessionType* FindSegmentationSession( const ABP_MsgType* psMsg )
 {
    UINT8 bSession;
+   abcc_SegSessionIdentifiersType sIdentifiers;
    abcc_SegSessionType* psSegSession = NULL;
    ABCC_PORT_UseCritical();
 
+   sIdentifiers.lKey = SegSessionKey( psMsg );
+   sIdentifiers.iInstance = ABCC_GetMsgInstance( psMsg );
+
    ABCC_PORT_EnterCritical();
 
-   for( bSession = 0; bSession < ABCC_NUM_SEGMENTATION_SESSIONS; bSession++ )
+   bSession = abcc_abSegHash[ SegSessionHash( &sIdentifiers ) ];
+   while( bSession != ABCC_SEG_NO_SESSION )
    {
-      if( abcc_sSegSession[ bSession ].fInUse &&
-         ( abcc_sSegSession[ bSession ].sIdentifiers.bDestObj == ABCC_GetMsgDestObj( psMsg ) ) &&
-         ( abcc_sSegSession[ bSession ].sIdentifiers.iInstance == ABCC_GetMsgInstance( psMsg ) ) &&
-         ( abcc_sSegSession[ bSession ].sIdentifiers.bCmd == ABCC_GetMsgCmdBits( psMsg ) ) &&
-         ( abcc_sSegSession[ bSession ].sIdentifiers.bCmdExt0 == ABCC_GetMsgCmdExt0( psMsg ) ) )
+      if( ( abcc_sSegSession[ bSession ].sIdentifiers.lKey == sIdentifiers.lKey ) &&
+          ( abcc_sSegSession[ bSession ].sIdentifiers.iInstance == sIdentifiers.iInstance ) )
       {
          psSegSession = &abcc_sSegSession[ bSession ];
          break;
       }
+      bSession = abcc_sSegSession[ bSession ].bHashNext;
    }
    ABCC_PORT_ExitCritical();
 
    return( psSegSession );
 }
 
+/*------------------------------------------------------------------------------
+** Removes a session from the hash table. Must be called in a critical section.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psSegSession - Pointer to segmentation instance
+**
+** Returns:
+**    None.
+**------------------------------------------------------------------------------
+*/
+static void UnlinkSegmentationSession( abcc_SegSessionType* psSegSession )
+{
+   UINT8 bSession;
+   UINT8* pbLink;
+
+   bSession = (UINT8)( psSegSession - abcc_sSegSession );
+   pbLink = &abcc_abSegHash[ SegSessionHash( &psSegSession->sIdentifiers ) ];
+
+   while( *pbLink != ABCC_SEG_NO_SESSION )
+   {
+      if( *pbLink == bSession )
+      {
+         *pbLink = psSegSession->bHashNext;
+         break;
+      }
+      pbLink = &abcc_sSegSession[ *pbLink ].bHashNext;
+   }
+}
+
 /*------------------------------------------------------------------------------
 ** Free segmentation session resource
 **------------------------------------------------------------------------------
@@ -171,8 +291,12 @@ static void FreeSegmentationSession( abcc_SegSessionType* psSegSession )
 
    ABCC_PORT_EnterCritical();
 
-   psSegSession->fInUse = FALSE;
-   abcc_bSegNumUsedInst--;
+   if( psSegSession->fInUse )
+   {
+      UnlinkSegmentationSession( psSegSession );
+      psSegSession->fInUse = FALSE;
+      abcc_bSegNumUsedInst--;
+   }
 
    ABCC_PORT_ExitCritical();
 }
@@ -296,6 +420,10 @@ static void PrepareAndSendSegmentationRespMsg( abcc_SegSessionType* psSegSession
 
    ABCC_SendRespMsg( psMsg );
 
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   RestartSegmentationTmo( psSegSession );
+#endif
+
    /*
    ** Check if last segment has been sent
    */
@@ -312,13 +440,72 @@ static void PrepareAndSendSegmentationRespMsg( abcc_SegSessionType* psSegSession
 void ABCC_SegmentationInit( void )
 {
    UINT8 bSession;
+   UINT16 iSlot;
 
    abcc_bSegNumUsedInst = 0;
-   for( bSession = 0; bSession < ABCC_NUM_SEGMENTATION_SESSIONS; bSession++ )
+   for( bSession = 0; bSession < ABCC_CFG_NUM_SEG_SESSIONS; bSession++ )
    {
       abcc_sSegSession[ bSession ].fInUse = FALSE;
    }
+   for( iSlot = 0; iSlot < ABCC_CFG_SEG_HASH_SIZE; iSlot++ )
+   {
+      abcc_abSegHash[ iSlot ] = ABCC_SEG_NO_SESSION;
+   }
+}
+
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+void ABCC_SegmentationExec( void )
+{
+   UINT8 bSession;
+   UINT32 lNowMs;
+   BOOL fTmo;
+   abcc_SegSessionType* psSegSession;
+   ABCC_PORT_UseCritical();
+
+   if( abcc_bSegNumUsedInst == 0 )
+   {
+      return;
+   }
+
+   lNowMs = (UINT32)ABCC_GetUptimeMs();
+
+   for( bSession = 0; bSession < ABCC_CFG_NUM_SEG_SESSIONS; bSession++ )
+   {
+      psSegSession = &abcc_sSegSession[ bSession ];
+
+      /*
+      ** Unlink a timed out session first so that a late segment request is
+      ** no longer matched with it.
+      */
+      ABCC_PORT_EnterCritical();
+      fTmo = psSegSession->fInUse &&
+             ( (INT32)( lNowMs - psSegSession->lTmoDeadlineMs ) >= 0 );
+      if( fTmo )
+      {
+         UnlinkSegmentationSession( psSegSession );
+         psSegSession->fInUse = FALSE;
+         abcc_bSegNumUsedInst--;
+      }
+      ABCC_PORT_ExitCritical();
+
+      /*
+      ** The module has given up the response, which is nothing the
+      ** application has to recover from.
+      */
+      if( fTmo )
+      {
+         ABCC_ERROR( ABCC_SEV_INFORMATION,
+                     ABCC_EC_SEGMENTATION_TMO,
+                     psSegSession->sIdentifiers.lKey >> 24 );
+
+         if( psSegSession->pnDone )
+         {
+            psSegSession->pnDone( (void*)psSegSession->pxObject );
+         }
+      }
+   }
 }
+#endif
 
 EXTFUNC ABCC_ErrorCodeType ABCC_StartServerRespSegmentationSession( const ABP_MsgHeaderType* psReqMsgHeader,
                                                                     UINT8 bRspCmdExt0,
@@ -336,7 +523,7 @@ EXTFUNC ABCC_ErrorCodeType ABCC_StartServerRespSegmentationSession( const ABP_Ms
       return( ABCC_EC_UNEXPECTED_NULL_PTR );
    }
 
-   psSegSession = AllocSegmentationSession();
+   psSegSession = AllocSegmentationSession( psReqMsgHeader );
 
    if( psSegSession == NULL )
    {
@@ -354,10 +541,6 @@ EXTFUNC ABCC_ErrorCodeType ABCC_StartServerRespSegmentationSession( const ABP_Ms
    psSegSession->pnNext = pnNext;
    psSegSession->pxObject = pxObject;
    psSegSession->bRspCmdExt0 = bRspCmdExt0;
-   psSegSession->sIdentifiers.bDestObj = ABCC_GetMsgDestObj( psReqMsgHeader );
-   psSegSession->sIdentifiers.iInstance = ABCC_GetMsgInstance( psReqMsgHeader );
-   psSegSession->sIdentifiers.bCmd = ABCC_GetMsgCmdBits( psReqMsgHeader );
-   psSegSession->sIdentifiers.bCmdExt0 = ABCC_GetMsgCmdExt0( psReqMsgHeader );
 
    /*
    ** Get message buffer. Will be converted to response later.
@@ -51,4 +51,20 @@ EXTFUNC void ABCC_SegmentationInit( void );
 */
 EXTFUNC BOOL ABCC_HandleSegmentAck( ABP_MsgType* psMsg );
 
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+/*------------------------------------------------------------------------------
+** Cyclic supervision of the segmentation sessions. Sessions that have waited
+** longer than ABCC_CFG_SEG_SESSION_TMO_MS for the next segment request are
+** reclaimed and their done function is called.
+**------------------------------------------------------------------------------
+** Arguments:
+**       None.
+**
+** Returns:
+**       None.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_SegmentationExec( void );
+#endif
+
 #endif  /* inclusion lock */
@@ -23,11 +23,7 @@
 #include "abcc_handler.h"
 #include "abcc_driver_interface.h"
 #include "abcc_debug_error.h"
-
-/*
-** Invalid ADI index.
-*/
-#define AD_INVALID_ADI_INDEX           ( 0xffff )
+#include "abcc_memory.h"
 
 #if !ABCC_CFG_DRV_CMD_SEQ_ENABLED
 typedef enum CmdSetupState
@@ -41,7 +37,7 @@ CmdSetupStateType;
 #endif
 
 #if !ABCC_CFG_DRV_CMD_SEQ_ENABLED
-static void SendSetupCommand( ABP_MsgType* psMsg );
+static BOOL SendSetupCommand( ABP_MsgType* psMsg );
 #endif
 static ABCC_CmdSeqCmdStatusType DataFormatCmd( ABP_MsgType* psMsg, void* pxUserData );
 static ABCC_CmdSeqRespStatusType DataFormatResp( ABP_MsgType* psMsg, void* pxUserData );
@@ -78,16 +74,20 @@ static void SetupDone( const ABCC_CmdSeqResultType eSeqResult, void* pxUserData
 
 /*
 ** Command sequence until user setup.
+** The mapping commands are independent of each other's responses and are
+** therefore sent pipelined. They are never sent again after a response
+** timeout, since the module may already have executed a timed out map
+** command.
 */
 static const ABCC_CmdSeqType SetupSeqBeforeUserInit[] =
 {
-   ABCC_CMD_SEQ( DataFormatCmd,      DataFormatResp ),
-   ABCC_CMD_SEQ( ParamSupportCmd,    ParamSupportResp ),
-   ABCC_CMD_SEQ( ModuleTypeCmd,      ModuleTypeResp ),
-   ABCC_CMD_SEQ( NetworkTypeCmd,     NetworkTypeResp ),
-   ABCC_CMD_SEQ( FirmwareVersionCmd, FirmwareVersionResp ),
-   ABCC_CMD_SEQ( PreparePdMapping,   NULL ),
-   ABCC_CMD_SEQ( ReadWriteMapCmd,    ReadWriteMapResp ),
+   ABCC_CMD_SEQ_SHORT( DataFormatCmd,      DataFormatResp ),
+   ABCC_CMD_SEQ_SHORT( ParamSupportCmd,    ParamSupportResp ),
+   ABCC_CMD_SEQ_SHORT( ModuleTypeCmd,      ModuleTypeResp ),
+   ABCC_CMD_SEQ_SHORT( NetworkTypeCmd,     NetworkTypeResp ),
+   ABCC_CMD_SEQ_SHORT( FirmwareVersionCmd, FirmwareVersionResp ),
+   ABCC_CMD_SEQ( PreparePdMapping,         NULL ),
+   ABCC_CMD_SEQ_PIPELINED_ONCE( ReadWriteMapCmd, ReadWriteMapResp ),
    ABCC_CMD_SEQ_END()
 };
 
@@ -96,9 +96,9 @@ static const ABCC_CmdSeqType SetupSeqBeforeUserInit[] =
 */
 static const ABCC_CmdSeqType SetupSeqAfterUserInit[] =
 {
-   ABCC_CMD_SEQ( RdPdSizeCmd,      RdPdSizeResp ),
-   ABCC_CMD_SEQ( WrPdSizeCmd,      WrPdSizeResp ),
-   ABCC_CMD_SEQ( SetupCompleteCmd, SetupCompleteResp ),
+   ABCC_CMD_SEQ_SHORT( RdPdSizeCmd,      RdPdSizeResp ),
+   ABCC_CMD_SEQ_SHORT( WrPdSizeCmd,      WrPdSizeResp ),
+   ABCC_CMD_SEQ_SHORT( SetupCompleteCmd, SetupCompleteResp ),
    ABCC_CMD_SEQ_END()
 };
 
@@ -194,51 +194,6 @@ static UINT8 bSetupSubState = 0;
 static const ABCC_CmdSeqType* pasSetupSeq;
 #endif
 
-/*------------------------------------------------------------------------------
-** Find ADI entry table index for the specified instance number.
-**------------------------------------------------------------------------------
-** Arguments:
-**    iInstance         -  Instance number.
-**
-** Returns:
-**    AD_INVALID_ADI_INDEX      - Instance was not found.
-**------------------------------------------------------------------------------
-*/
-static UINT16 GetAdiIndex( UINT16 iInstance )
-{
-   UINT16   iLow;
-   UINT16   iMid;
-   UINT16   iHigh;
-
-   if( abcc_iNumAdi == 0 )
-   {
-      return( AD_INVALID_ADI_INDEX );
-   }
-
-   iLow = 0;
-   iHigh = abcc_iNumAdi - 1;
-
-   while( iLow != iHigh )
-   {
-      iMid = iLow + ( ( iHigh - iLow + 1 ) / 2 );
-      if( abcc_psAdiEntry[ iMid ].iInstance > iInstance )
-      {
-         iHigh = iMid - 1;
-      }
-      else
-      {
-         iLow = iMid;
-      }
-   }
-
-   if( abcc_psAdiEntry[ iLow ].iInstance != iInstance )
-   {
-      iLow = AD_INVALID_ADI_INDEX;
-   }
-
-   return( iLow );
-}
-
 static UINT16 abcc_GetAdiMapSizeInBits( const AD_AdiEntryType* psAdiEntry, UINT8 bNumElem, UINT8 bElemStartIndex )
 {
    UINT16 iSize;
@@ -519,6 +474,7 @@ static ABCC_CmdSeqCmdStatusType PreparePdMapping( ABP_MsgType* psMsg, void* pxUs
    (void)psMsg;
    abcc_iNumAdi = ABCC_CbfAdiMappingReq( (const AD_AdiEntryType**)&abcc_psAdiEntry,
                                          (const AD_MapType**)&abcc_psDefaultMap );
+   ABCC_AdiIndexBuild( abcc_psAdiEntry, abcc_iNumAdi );
    /*
    ** No command shall be sent.
    */
@@ -553,9 +509,11 @@ static ABCC_CmdSeqCmdStatusType ReadWriteMapCmd( ABP_MsgType* psMsg, void* pxUse
    {
       if( abcc_psDefaultMap[ abcc_iMappingIndex ].iInstance != AD_MAP_PAD_ADI )
       {
-         iLocalMapIndex = GetAdiIndex( abcc_psDefaultMap[ abcc_iMappingIndex ].iInstance );
+         iLocalMapIndex = ABCC_AdiIndexFind( abcc_psAdiEntry,
+                                             abcc_iNumAdi,
+                                             abcc_psDefaultMap[ abcc_iMappingIndex ].iInstance );
 
-         if( iLocalMapIndex == AD_INVALID_ADI_INDEX )
+         if( iLocalMapIndex == ABCC_ADI_INDEX_NOT_FOUND )
          {
             ABCC_ERROR( ABCC_SEV_WARNING, ABCC_EC_DEFAULT_MAP_ERR,
                         (UINT32)abcc_psDefaultMap[ abcc_iMappingIndex ].iInstance );
@@ -668,6 +626,8 @@ static ABCC_CmdSeqCmdStatusType ReadWriteMapCmd( ABP_MsgType* psMsg, void* pxUse
 **
 ** Part of a command sequence and implements function callback
 ** ABCC_CmdSeqRespHandler type in cmd_seq_if.h
+** When the command sequencer is used the step is pipelined, so the return
+** value only matters if the response indicates an abort.
 **------------------------------------------------------------------------------
 */
 static ABCC_CmdSeqRespStatusType ReadWriteMapResp( ABP_MsgType* psMsg, void* pxUserData )
@@ -862,7 +822,7 @@ static ABCC_CmdSeqRespStatusType SetupCompleteResp( ABP_MsgType* psMsg, void* px
    ABCC_ASSERT_ERR( ABCC_VerifyMessage( psMsg ) == ABCC_EC_NO_ERROR,
                     ABCC_SEV_WARNING, ABCC_EC_RESP_MSG_E_BIT_SET,
                     (UINT32)ABCC_GetErrorCode( psMsg ) );
-   pnABCC_DrvSetPdSize( abcc_iPdReadSize, abcc_iPdWriteSize );
+   ABCC_SetPdSize( abcc_iPdReadSize, abcc_iPdWriteSize );
    DEBUG_EVENT( "RSP MSG_SETUP_COMPLETE\n" );
    return( ABCC_CMDSEQ_RESP_EXEC_NEXT );
 }
@@ -914,11 +874,32 @@ static void SetupDone( const ABCC_CmdSeqResultType eSeqResult, void* pxUserData
 */
 static void HandleSetupRespone( ABP_MsgType* psMsg )
 {
+   ABP_MsgType* psCmdMsg;
+
    if( pasSetupSeq[ bSetupSubState ].pnRespHandler( psMsg ) == ABCC_EXEC_NEXT_COMMAND )
    {
       bSetupSubState++;
    }
-   SendSetupCommand( psMsg );
+
+   if( ABCC_MemGetMaxDataSize( psMsg ) < ABCC_CFG_MAX_MSG_SIZE )
+   {
+      /*
+      ** The response was received in a small or medium buffer that might not
+      ** hold the next command. It is freed by the driver and the next command
+      ** is built in a full size buffer instead.
+      */
+      psCmdMsg = ABCC_GetCmdMsgBuffer();
+      ABCC_ASSERT( psCmdMsg );
+
+      if( !SendSetupCommand( psCmdMsg ) )
+      {
+         ABCC_ReturnMsgBuffer( &psCmdMsg );
+      }
+   }
+   else
+   {
+      SendSetupCommand( psMsg );
+   }
 }
 
 /*------------------------------------------------------------------------------
@@ -937,10 +918,10 @@ static void HandleSetupRespone( ABP_MsgType* psMsg )
 **    psMsg                   - Pointer to response buffer
 **
 ** Returns:
-**    None.
+**    TRUE if a command was sent in psMsg.
 **------------------------------------------------------------------------------
 */
-static void SendSetupCommand( ABP_MsgType* psMsg )
+static BOOL SendSetupCommand( ABP_MsgType* psMsg )
 {
    while( pasSetupSeq[ bSetupSubState ].pnCmdHandler != NULL )
    {
@@ -951,23 +932,22 @@ static void SendSetupCommand( ABP_MsgType* psMsg )
       else
       {
          ABCC_SendCmdMsg( psMsg, HandleSetupRespone );
-         break;
+         return( TRUE );
       }
    }
 
-   if( pasSetupSeq[ bSetupSubState ].pnCmdHandler == NULL )
+   if( eSetupState == SETUP_BEFORE_USER_INIT )
    {
-      if( eSetupState == SETUP_BEFORE_USER_INIT )
-      {
-         eSetupState = SETUP_USER_INIT;
-         TriggerUserInit( ABCC_CMDSEQ_RESULT_COMPLETED, NULL );
-      }
-      else
-      {
-         eSetupState = SETUP_DONE;
-         SetupDone( ABCC_CMDSEQ_RESULT_COMPLETED, NULL );
-      }
+      eSetupState = SETUP_USER_INIT;
+      TriggerUserInit( ABCC_CMDSEQ_RESULT_COMPLETED, NULL );
+   }
+   else
+   {
+      eSetupState = SETUP_DONE;
+      SetupDone( ABCC_CMDSEQ_RESULT_COMPLETED, NULL );
    }
+
+   return( FALSE );
 }
 #endif
 
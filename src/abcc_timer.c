@@ -19,6 +19,29 @@
 #include "abcc_debug_error.h"
 #include "abcc_port.h"
 
+/*
+** The timers are kept in a hashed timing wheel. Each wheel slot holds a doubly
+** linked list of the timers expiring at a tick that maps to that slot, so
+** starting and stopping a timer is O(1) and a tick only visits the timers of
+** the slots it passes. Timers more than one wheel revolution ahead stay in
+** their slot until their expiry tick is reached.
+*/
+#if ( ABCC_CFG_TIMER_WHEEL_SIZE & ( ABCC_CFG_TIMER_WHEEL_SIZE - 1 ) ) != 0
+#error "ABCC_CFG_TIMER_WHEEL_SIZE must be a power of two"
+#endif
+#if ABCC_CFG_MAX_NUM_TIMERS >= ABCC_TIMER_NO_HANDLE
+#error "ABCC_CFG_MAX_NUM_TIMERS must be less than ABCC_TIMER_NO_HANDLE"
+#endif
+
+#define TIMER_WHEEL_MASK ( ABCC_CFG_TIMER_WHEEL_SIZE - 1 )
+
+/*
+** Longest timeout. Expiry is compared with the signed difference of tick
+** counts, so a timer can be at most 2^31 - 1 ticks ahead. Longer timeouts are
+** clamped.
+*/
+#define TIMER_MAX_TICKS          ( 0x7FFFFFFFUL )
+
 /*
 ** Timer resource structure
 */
@@ -26,26 +49,129 @@ typedef struct ABCC_TimerTimeoutType
 {
    BOOL  fActive;
    BOOL  fTmoOccured;
-   INT32 lTimeLeft;
+   UINT32 lExpiryTick;
+   ABCC_TimerHandle xNext;
+   ABCC_TimerHandle xPrev;
    ABCC_TimerTimeoutCallbackType pnHandleTimeout;
 }
 ABCC_TimerTimeoutType;
-#define MAX_NUM_TIMERS 3
-static ABCC_TimerTimeoutType sTimer[ MAX_NUM_TIMERS ];
+static ABCC_TimerTimeoutType sTimer[ ABCC_CFG_MAX_NUM_TIMERS ];
+static ABCC_TimerHandle axWheel[ ABCC_CFG_TIMER_WHEEL_SIZE ];
 static BOOL fTimerEnabled = FALSE;
-static UINT64 llTotalTicks = 0;
+static UINT32 lCurrentTick = 0;
+static UINT32 lResidualUs = 0;
+static UINT64 llTotalUs = 0;
+
+/*------------------------------------------------------------------------------
+** Inserts a timer in the wheel slot of its expiry tick. Must be called in a
+** critical section.
+**------------------------------------------------------------------------------
+*/
+static void LinkTimer( ABCC_TimerHandle xHandle )
+{
+   ABCC_TimerHandle* pxHead;
+
+   pxHead = &axWheel[ sTimer[ xHandle ].lExpiryTick & TIMER_WHEEL_MASK ];
+
+   sTimer[ xHandle ].xPrev = ABCC_TIMER_NO_HANDLE;
+   sTimer[ xHandle ].xNext = *pxHead;
+   if( *pxHead != ABCC_TIMER_NO_HANDLE )
+   {
+      sTimer[ *pxHead ].xPrev = xHandle;
+   }
+   *pxHead = xHandle;
+}
+
+/*------------------------------------------------------------------------------
+** Removes a timer from its wheel slot. Must be called in a critical section.
+**------------------------------------------------------------------------------
+*/
+static void UnlinkTimer( ABCC_TimerHandle xHandle )
+{
+   ABCC_TimerHandle xNext;
+   ABCC_TimerHandle xPrev;
+
+   xNext = sTimer[ xHandle ].xNext;
+   xPrev = sTimer[ xHandle ].xPrev;
+
+   if( xPrev != ABCC_TIMER_NO_HANDLE )
+   {
+      sTimer[ xPrev ].xNext = xNext;
+   }
+   else
+   {
+      axWheel[ sTimer[ xHandle ].lExpiryTick & TIMER_WHEEL_MASK ] = xNext;
+   }
+
+   if( xNext != ABCC_TIMER_NO_HANDLE )
+   {
+      sTimer[ xNext ].xPrev = xPrev;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** (Re)starts a timer. Must not be called in a critical section. The timeout
+** is calculated in 64 bits so that no millisecond timeout overflows.
+**------------------------------------------------------------------------------
+*/
+static BOOL StartTimer( ABCC_TimerHandle xHandle, UINT64 llTimeoutUs )
+{
+   BOOL fTmo;
+   UINT64 llTicks;
+   UINT32 lTicks;
+   ABCC_PORT_TIMER_UseCritical();
+
+   ABCC_ASSERT( sTimer[ xHandle ].pnHandleTimeout );
+
+   /*
+   ** Round up to whole ticks. A zero timeout expires on the next tick.
+   */
+   llTicks = ( llTimeoutUs + ( ABCC_CFG_TIMER_RESOLUTION_US - 1 ) ) /
+             ABCC_CFG_TIMER_RESOLUTION_US;
+   if( llTicks == 0 )
+   {
+      llTicks = 1;
+   }
+   else if( llTicks > TIMER_MAX_TICKS )
+   {
+      llTicks = TIMER_MAX_TICKS;
+   }
+   lTicks = (UINT32)llTicks;
+
+   ABCC_PORT_TIMER_EnterCritical();
+   fTmo = sTimer[ xHandle ].fTmoOccured;
+   if( sTimer[ xHandle ].fActive )
+   {
+      UnlinkTimer( xHandle );
+   }
+   sTimer[ xHandle ].lExpiryTick = lCurrentTick + lTicks;
+   sTimer[ xHandle ].fTmoOccured = FALSE;
+   sTimer[ xHandle ].fActive = TRUE;
+   LinkTimer( xHandle );
+
+   ABCC_PORT_TIMER_ExitCritical();
+   return( fTmo );
+}
 
 void ABCC_TimerInit( void )
 {
    ABCC_TimerHandle xHandle;
+   UINT16 iSlot;
 
-   for( xHandle = 0; xHandle < MAX_NUM_TIMERS; xHandle++ )
+   for( xHandle = 0; xHandle < ABCC_CFG_MAX_NUM_TIMERS; xHandle++ )
    {
       sTimer[ xHandle ].pnHandleTimeout = NULL;
+      sTimer[ xHandle ].fActive = FALSE;
+   }
+   for( iSlot = 0; iSlot < ABCC_CFG_TIMER_WHEEL_SIZE; iSlot++ )
+   {
+      axWheel[ iSlot ] = ABCC_TIMER_NO_HANDLE;
    }
    fTimerEnabled = TRUE;
 
-   llTotalTicks = 0;
+   lCurrentTick = 0;
+   lResidualUs = 0;
+   llTotalUs = 0;
 }
 
 ABCC_TimerHandle ABCC_TimerCreate( ABCC_TimerTimeoutCallbackType pnHandleTimeout )
@@ -55,7 +181,7 @@ ABCC_TimerHandle ABCC_TimerCreate( ABCC_TimerTimeoutCallbackType pnHandleTimeout
 
    ABCC_PORT_TIMER_EnterCritical();
 
-   for( xHandle = 0; xHandle < MAX_NUM_TIMERS; xHandle++ )
+   for( xHandle = 0; xHandle < ABCC_CFG_MAX_NUM_TIMERS; xHandle++ )
    {
       if( sTimer[ xHandle ].pnHandleTimeout == NULL )
       {
@@ -67,7 +193,7 @@ ABCC_TimerHandle ABCC_TimerCreate( ABCC_TimerTimeoutCallbackType pnHandleTimeout
    }
    ABCC_PORT_TIMER_ExitCritical();
 
-   if( xHandle >=  MAX_NUM_TIMERS )
+   if( xHandle >=  ABCC_CFG_MAX_NUM_TIMERS )
    {
       xHandle = ABCC_TIMER_NO_HANDLE;
    }
@@ -77,19 +203,13 @@ ABCC_TimerHandle ABCC_TimerCreate( ABCC_TimerTimeoutCallbackType pnHandleTimeout
 BOOL ABCC_TimerStart( ABCC_TimerHandle xHandle,
                       UINT32 lTimeoutMs )
 {
-   BOOL fTmo;
-   ABCC_PORT_TIMER_UseCritical();
-
-   ABCC_ASSERT( sTimer[ xHandle ].pnHandleTimeout );
-
-   ABCC_PORT_TIMER_EnterCritical();
-   fTmo = sTimer[ xHandle ].fTmoOccured;
-   sTimer[ xHandle ].lTimeLeft = (INT32)lTimeoutMs;
-   sTimer[ xHandle ].fTmoOccured = FALSE;
-   sTimer[ xHandle ].fActive = TRUE;
+   return( StartTimer( xHandle, (UINT64)lTimeoutMs * 1000 ) );
+}
 
-   ABCC_PORT_TIMER_ExitCritical();
-   return( fTmo );
+BOOL ABCC_TimerStartUs( ABCC_TimerHandle xHandle,
+                        UINT32 lTimeoutUs )
+{
+   return( StartTimer( xHandle, lTimeoutUs ) );
 }
 
 BOOL ABCC_TimerStop( ABCC_TimerHandle xHandle )
@@ -100,6 +220,10 @@ BOOL ABCC_TimerStop( ABCC_TimerHandle xHandle )
    ABCC_PORT_TIMER_EnterCritical();
    fTmo = sTimer[ xHandle ].fTmoOccured;
 
+   if( sTimer[ xHandle ].fActive )
+   {
+      UnlinkTimer( xHandle );
+   }
    sTimer[ xHandle ].fActive = FALSE;
    sTimer[ xHandle ].fTmoOccured = FALSE;
 
@@ -109,7 +233,19 @@ BOOL ABCC_TimerStop( ABCC_TimerHandle xHandle )
 
 void ABCC_TimerTick(const INT16 iDeltaTimeMs)
 {
+   ABCC_TimerTickUs( (UINT32)iDeltaTimeMs * 1000UL );
+}
+
+void ABCC_TimerTickUs( const UINT32 lDeltaTimeUs )
+{
+   ABCC_TimerHandle axExpired[ ABCC_CFG_MAX_NUM_TIMERS ];
+   ABCC_TimerTimeoutCallbackType pnHandleTimeout;
    ABCC_TimerHandle xHandle;
+   ABCC_TimerHandle xNext;
+   UINT32 lTicks;
+   UINT32 lSlotTick;
+   UINT8 bNumExpired;
+   UINT8 i;
    ABCC_PORT_TIMER_UseCritical();
 
    if( !fTimerEnabled )
@@ -117,26 +253,68 @@ void ABCC_TimerTick(const INT16 iDeltaTimeMs)
       return;
    }
 
+   bNumExpired = 0;
+
    ABCC_PORT_TIMER_EnterCritical();
 
-   for( xHandle = 0; xHandle < MAX_NUM_TIMERS; xHandle++ )
+   llTotalUs += lDeltaTimeUs;
+   lResidualUs += lDeltaTimeUs;
+   lTicks = lResidualUs / ABCC_CFG_TIMER_RESOLUTION_US;
+   lResidualUs -= lTicks * ABCC_CFG_TIMER_RESOLUTION_US;
+
+   /*
+   ** Visit each slot passed since the last tick, but each slot only once
+   ** even if more than a full revolution has passed.
+   */
+   lSlotTick = lCurrentTick;
+   lCurrentTick += lTicks;
+   if( lTicks > ABCC_CFG_TIMER_WHEEL_SIZE )
    {
-       if( ( sTimer[ xHandle ].pnHandleTimeout != NULL ) &&
-             ( sTimer[ xHandle ].fActive == TRUE ) )
-       {
-          sTimer[ xHandle ].lTimeLeft -= (INT32)iDeltaTimeMs;
-          if( sTimer[ xHandle ].lTimeLeft <= 0 )
-          {
-             sTimer[ xHandle ].fTmoOccured = TRUE;
-             sTimer[ xHandle ].fActive = FALSE;
-             sTimer[ xHandle ].pnHandleTimeout();
-          }
-       }
+      lTicks = ABCC_CFG_TIMER_WHEEL_SIZE;
    }
 
-   llTotalTicks += iDeltaTimeMs;
+   while( lTicks-- > 0 )
+   {
+      lSlotTick++;
+      xHandle = axWheel[ lSlotTick & TIMER_WHEEL_MASK ];
+
+      while( xHandle != ABCC_TIMER_NO_HANDLE )
+      {
+         xNext = sTimer[ xHandle ].xNext;
+
+         if( (INT32)( lCurrentTick - sTimer[ xHandle ].lExpiryTick ) >= 0 )
+         {
+            UnlinkTimer( xHandle );
+            sTimer[ xHandle ].fTmoOccured = TRUE;
+            sTimer[ xHandle ].fActive = FALSE;
+            axExpired[ bNumExpired++ ] = xHandle;
+         }
+
+         xHandle = xNext;
+      }
+   }
 
    ABCC_PORT_TIMER_ExitCritical();
+
+   /*
+   ** Run the timeout callbacks with interrupts enabled. A timer that has been
+   ** restarted or stopped since it expired is skipped.
+   */
+   for( i = 0; i < bNumExpired; i++ )
+   {
+      ABCC_PORT_TIMER_EnterCritical();
+      pnHandleTimeout = NULL;
+      if( sTimer[ axExpired[ i ] ].fTmoOccured )
+      {
+         pnHandleTimeout = sTimer[ axExpired[ i ] ].pnHandleTimeout;
+      }
+      ABCC_PORT_TIMER_ExitCritical();
+
+      if( pnHandleTimeout != NULL )
+      {
+         pnHandleTimeout();
+      }
+   }
 }
 
 void ABCC_TimerDisable( void )
@@ -152,7 +330,7 @@ UINT64 ABCC_TimerGetUptimeMs( void )
 
    ABCC_PORT_TIMER_EnterCritical();
 
-   llUptime = llTotalTicks;
+   llUptime = llTotalUs / 1000;
 
    ABCC_PORT_TIMER_ExitCritical();
 
@@ -66,7 +66,9 @@ EXTFUNC ABCC_TimerHandle ABCC_TimerCreate( ABCC_TimerTimeoutCallbackType pnHandl
 **------------------------------------------------------------------------------
 ** Arguments:
 **    xHandle:     Identifier of timer to be started.
-**    lTimeoutMs:  Timeout in ms.
+**    lTimeoutMs:  Timeout in ms. Timeouts longer than 2^31 - 1 ticks (about
+**                 24 days with 1 ms ticks) are clamped to the longest
+**                 timeout.
 **
 ** Returns:
 **    TRUE if the timer had expired before re-start.
@@ -76,6 +78,23 @@ EXTFUNC ABCC_TimerHandle ABCC_TimerCreate( ABCC_TimerTimeoutCallbackType pnHandl
 EXTFUNC BOOL ABCC_TimerStart( ABCC_TimerHandle xHandle,
                               UINT32 lTimeoutMs );
 
+/*------------------------------------------------------------------------------
+** Start timer with a timeout in microseconds. The timeout is rounded up to a
+** whole number of ABCC_CFG_TIMER_RESOLUTION_US ticks.
+** See ABCC_TimerStart().
+**------------------------------------------------------------------------------
+** Arguments:
+**    xHandle:     Identifier of timer to be started.
+**    lTimeoutUs:  Timeout in us.
+**
+** Returns:
+**    TRUE if the timer had expired before re-start.
+**    FALSE Timer had not expired before re-start.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC BOOL ABCC_TimerStartUs( ABCC_TimerHandle xHandle,
+                                UINT32 lTimeoutUs );
+
 /*------------------------------------------------------------------------------
 ** Stop timer.
 **------------------------------------------------------------------------------
@@ -91,6 +110,8 @@ EXTFUNC BOOL ABCC_TimerStop( ABCC_TimerHandle xHandle );
 /*------------------------------------------------------------------------------
 ** ABCC_TimerTick(). Provides delta time since last timer tick call.
 ** Typically called from timer interrupt.
+** Expired timers are collected in a critical section and their callbacks are
+** invoked after the critical section has been left.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    iDeltaTimeMs: Time in ms since last timerTick call
@@ -100,6 +121,18 @@ EXTFUNC BOOL ABCC_TimerStop( ABCC_TimerHandle xHandle );
 */
 EXTFUNC void ABCC_TimerTick( const INT16 iDeltaTimeMs );
 
+/*------------------------------------------------------------------------------
+** ABCC_TimerTickUs(). Same as ABCC_TimerTick() but with the delta time in
+** microseconds.
+**------------------------------------------------------------------------------
+** Arguments:
+**    lDeltaTimeUs: Time in us since last timerTick call
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_TimerTickUs( const UINT32 lDeltaTimeUs );
+
 /*------------------------------------------------------------------------------
 ** ABCC_TimerDisable(). Disable tick action
 **------------------------------------------------------------------------------
@@ -0,0 +1,175 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Binary trace ring. Records are reserved with an atomic increment of the
+** write counter so that probes in interrupt and application context do not
+** need a critical section. The sequence number of a record is written last,
+** the reader only accepts records whose sequence number matches the expected
+** position.
+********************************************************************************
+*/
+
+#include "abcc_config.h"
+#include "abcc_types.h"
+#include "abcc.h"
+#include "abcc_port.h"
+#include "abcc_trace.h"
+
+#if ABCC_CFG_TRACE_ENABLED
+
+#if( ( ABCC_CFG_TRACE_NUM_RECORDS & ( ABCC_CFG_TRACE_NUM_RECORDS - 1 ) ) != 0 )
+#error "ABCC_CFG_TRACE_NUM_RECORDS must be a power of two"
+#endif
+
+#if( ( ABCC_CFG_TRACE_NUM_RECORDS < 2 ) || ( ABCC_CFG_TRACE_NUM_RECORDS > 32768 ) )
+#error "ABCC_CFG_TRACE_NUM_RECORDS must be in the range 2 - 32768"
+#endif
+
+#define TRACE_INDEX_MASK      ( ABCC_CFG_TRACE_NUM_RECORDS - 1 )
+
+/*
+** Orders the record accesses for a reader on another CPU core. The ring is
+** volatile, so the compiler keeps the order within one core without it.
+*/
+#ifdef ABCC_PORT_MemoryBarrier
+#define TRACE_BARRIER()       ABCC_PORT_MemoryBarrier()
+#else
+#define TRACE_BARRIER()
+#endif
+
+/*
+** Sequence number of a record at iPos that is not completely written. It
+** differs from every position that maps to the same slot since the ring size
+** is even.
+*/
+#define TRACE_SEQ_INCOMPLETE( iPos )  ( (UINT16)( ( iPos ) + 1 ) )
+
+/*
+** The trace ring.
+** trace_iWriteCount - Number of records reserved by producers (wraps).
+** trace_iReadCount  - Number of records consumed by ABCC_TraceRead() (wraps).
+** trace_lLostCount  - Number of records overwritten before they were read.
+*/
+static volatile ABCC_TraceRecordType trace_asRing[ ABCC_CFG_TRACE_NUM_RECORDS ];
+static volatile UINT16        trace_iWriteCount;
+static UINT16                 trace_iReadCount;
+static UINT32                 trace_lLostCount;
+
+void ABCC_TraceInit( void )
+{
+   UINT16 i;
+
+   for( i = 0; i < ABCC_CFG_TRACE_NUM_RECORDS; i++ )
+   {
+      trace_asRing[ i ].iSeq = TRACE_SEQ_INCOMPLETE( i );
+   }
+
+   trace_iWriteCount = 0;
+   trace_iReadCount = 0;
+   trace_lLostCount = 0;
+}
+
+void ABCC_TraceEvent( UINT16 iEvent, UINT16 iArg )
+{
+   volatile ABCC_TraceRecordType* psRecord;
+   UINT16 iPos;
+#ifndef ABCC_PORT_AtomicIncrement16
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   iPos = trace_iWriteCount;
+   trace_iWriteCount = iPos + 1;
+   ABCC_PORT_ExitCritical();
+#else
+   iPos = ABCC_PORT_AtomicIncrement16( &trace_iWriteCount );
+#endif
+
+   psRecord = &trace_asRing[ iPos & TRACE_INDEX_MASK ];
+   psRecord->iSeq = TRACE_SEQ_INCOMPLETE( iPos );
+   TRACE_BARRIER();
+   psRecord->lTimestamp = ABCC_PORT_GetTimestamp();
+   psRecord->iEvent = iEvent;
+   psRecord->iArg = iArg;
+   psRecord->iReserved = 0;
+   TRACE_BARRIER();
+   psRecord->iSeq = iPos;
+}
+
+UINT16 ABCC_TraceRead( ABCC_TraceRecordType* pasRecord, UINT16 iMaxRecords )
+{
+   volatile ABCC_TraceRecordType* psRecord;
+   UINT16 iWriteCount;
+   UINT16 iAvailable;
+   UINT16 iSeq;
+   UINT16 iCopied;
+
+   iCopied = 0;
+
+   while( iCopied < iMaxRecords )
+   {
+      iWriteCount = trace_iWriteCount;
+      iAvailable = iWriteCount - trace_iReadCount;
+
+      if( iAvailable > ABCC_CFG_TRACE_NUM_RECORDS )
+      {
+         /*
+         ** The producers have lapped the reader. Skip to the oldest record
+         ** that is still in the ring.
+         */
+         trace_lLostCount += iAvailable - ABCC_CFG_TRACE_NUM_RECORDS;
+         trace_iReadCount = iWriteCount - ABCC_CFG_TRACE_NUM_RECORDS;
+      }
+      else if( iAvailable == 0 )
+      {
+         break;
+      }
+
+      psRecord = &trace_asRing[ trace_iReadCount & TRACE_INDEX_MASK ];
+
+      iSeq = psRecord->iSeq;
+      TRACE_BARRIER();
+      pasRecord[ iCopied ].lTimestamp = psRecord->lTimestamp;
+      pasRecord[ iCopied ].iEvent = psRecord->iEvent;
+      pasRecord[ iCopied ].iArg = psRecord->iArg;
+      pasRecord[ iCopied ].iSeq = iSeq;
+      pasRecord[ iCopied ].iReserved = 0;
+      TRACE_BARRIER();
+
+      if( ( iSeq != trace_iReadCount ) || ( psRecord->iSeq != iSeq ) )
+      {
+         /*
+         ** The record is being written. If it belongs to a producer that has
+         ** lapped the reader the next turn skips ahead, otherwise it is the
+         ** newest record and is read by the next call.
+         */
+         if( (UINT16)( trace_iWriteCount - trace_iReadCount ) > ABCC_CFG_TRACE_NUM_RECORDS )
+         {
+            continue;
+         }
+
+         break;
+      }
+
+      trace_iReadCount++;
+      iCopied++;
+   }
+
+   return( iCopied );
+}
+
+UINT32 ABCC_TraceGetLostCount( void )
+{
+   return( trace_lLostCount );
+}
+
+#endif
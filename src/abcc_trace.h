@@ -0,0 +1,52 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Interface for the binary trace ring.
+********************************************************************************
+*/
+
+#ifndef ABCC_TRACE_H_
+#define ABCC_TRACE_H_
+
+#include "abcc_config.h"
+#include "abcc_types.h"
+#include "abcc.h"
+
+#if ABCC_CFG_TRACE_ENABLED
+/*------------------------------------------------------------------------------
+** Empties the trace ring and clears the lost record counter.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void ABCC_TraceInit( void );
+
+/*------------------------------------------------------------------------------
+** Trace probe used by the driver. Removed at compile time if
+** ABCC_CFG_TRACE_ENABLED is 0.
+**------------------------------------------------------------------------------
+** Arguments:
+**    eEvent - Event identifier (ABCC_TraceEventType).
+**    iArg   - Event argument.
+**------------------------------------------------------------------------------
+*/
+#define ABCC_TRACE( eEvent, iArg ) ABCC_TraceEvent( (UINT16)( eEvent ), (UINT16)( iArg ) )
+#else
+#define ABCC_TRACE( eEvent, iArg )
+#endif
+
+#endif  /* inclusion lock */
@@ -231,6 +231,84 @@ static volatile BOOL appl_fRdPdReceivedEvent = FALSE;
 static volatile BOOL appl_fTransmitMsgEvent = FALSE;
 static volatile BOOL appl_fAbccStatusEvent = FALSE;
 
+/*------------------------------------------------------------------------------
+** Host objects implemented by the application and their command handlers.
+** With ABCC_CFG_OBJ_REGISTRY_ENABLED they are registered in the driver object
+** registry at init, otherwise ABCC_CbfReceiveMsg() searches the list.
+**------------------------------------------------------------------------------
+*/
+typedef struct appl_ObjHandler
+{
+   UINT8                   bObject;
+   ABCC_MsgHandlerFuncType pnHandler;
+}
+appl_ObjHandlerType;
+
+static const appl_ObjHandlerType appl_asObjHandler[] =
+{
+#if MQTT_OBJ_ENABLE
+   { ABP_OBJ_NUM_MQTT,    MQTT_ProcessCmdMsg },
+#endif
+#if OPCUA_OBJ_ENABLE
+   { ABP_OBJ_NUM_OPCUA,   OPCUA_ProcessCmdMsg },
+#endif
+#if SAFE_OBJ_ENABLE
+   { ABP_OBJ_NUM_SAFE,    SAFE_ProcessCmdMsg },
+#endif
+#if EPL_OBJ_ENABLE
+   { ABP_OBJ_NUM_EPL,     EPL_ProcessCmdMsg },
+#endif
+#if EIP_OBJ_ENABLE
+   { ABP_OBJ_NUM_EIP,     EIP_ProcessCmdMsg },
+#endif
+#if PRT_OBJ_ENABLE
+   { ABP_OBJ_NUM_PNIO,    PRT_ProcessCmdMsg },
+#endif
+#if DPV1_OBJ_ENABLE
+   { ABP_OBJ_NUM_DPV1,    DPV1_ProcessCmdMsg },
+#endif
+#if DEV_OBJ_ENABLE
+   { ABP_OBJ_NUM_DEV,     DEV_ProcessCmdMsg },
+#endif
+#if MOD_OBJ_ENABLE
+   { ABP_OBJ_NUM_MOD,     MOD_ProcessCmdMsg },
+#endif
+#if COP_OBJ_ENABLE
+   { ABP_OBJ_NUM_COP,     COP_ProcessCmdMsg },
+#endif
+#if ETN_OBJ_ENABLE
+   { ABP_OBJ_NUM_ETN,     ETN_ProcessCmdMsg },
+#endif
+#if ECT_OBJ_ENABLE
+   { ABP_OBJ_NUM_ECT,     ECT_ProcessCmdMsg },
+#endif
+   { ABP_OBJ_NUM_APPD,    AD_ProcObjectRequest },
+#if APP_OBJ_ENABLE
+   { ABP_OBJ_NUM_APP,     APP_ProcessCmdMsg },
+#endif
+#if SYNC_OBJ_ENABLE
+   { ABP_OBJ_NUM_SYNC,    SYNC_ProcessCmdMsg },
+#endif
+#if CCL_OBJ_ENABLE
+   { ABP_OBJ_NUM_CCL,     CCL_ProcessCmdMsg },
+#endif
+#if CFN_OBJ_ENABLE
+   { ABP_OBJ_NUM_CFN,     CFN_ProcessCmdMsg },
+#endif
+#if CIET_OBJ_ENABLE
+   { ABP_OBJ_NUM_CIET,    CIET_ProcessCmdMsg },
+#endif
+#if ASM_OBJ_ENABLE
+   { ABP_OBJ_NUM_ASM,     ASM_ProcessCmdMsg },
+#endif
+#if BAC_OBJ_ENABLE
+   { ABP_OBJ_NUM_BAC,     BAC_ProcessCmdMsg },
+#endif
+};
+
+#define APPL_NUM_OBJ_HANDLERS \
+   ( (UINT8)( sizeof( appl_asObjHandler ) / sizeof( appl_asObjHandler[ 0 ] ) ) )
+
 /*------------------------------------------------------------------------------
 ** Forward declarations
 **------------------------------------------------------------------------------
@@ -258,14 +336,14 @@ static void UpdateCommSettingsDone( const ABCC_CmdSeqResultType eSeqResult, void
 */
 static const ABCC_CmdSeqType appl_asUserInitCmdSeq[] =
 {
-   ABCC_CMD_SEQ( UpdateIpAddress, NULL ),
-   ABCC_CMD_SEQ( UpdateNetmask, NULL ),
-   ABCC_CMD_SEQ( UpdateGateway, NULL ),
-   ABCC_CMD_SEQ( UpdateDhcp, NULL ),
-   ABCC_CMD_SEQ( UpdateNodeAddress, NULL ),
-   ABCC_CMD_SEQ( UpdateBaudRate, NULL ),
-   ABCC_CMD_SEQ( UpdateCommSetting1, NULL ),
-   ABCC_CMD_SEQ( UpdateCommSetting2, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateIpAddress, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateNetmask, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateGateway, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateDhcp, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateNodeAddress, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateBaudRate, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateCommSetting1, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateCommSetting2, NULL ),
    ABCC_CMD_SEQ_END()
 };
 
@@ -277,8 +355,8 @@ static const ABCC_CmdSeqType appl_asUserInitCmdSeq[] =
 */
 static const ABCC_CmdSeqType appl_asAddressChangedCmdSeq[] =
 {
-   ABCC_CMD_SEQ( UpdateIpAddress, NULL ),
-   ABCC_CMD_SEQ( UpdateNodeAddress, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateIpAddress, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateNodeAddress, NULL ),
    ABCC_CMD_SEQ_END()
 };
 
@@ -290,7 +368,7 @@ static const ABCC_CmdSeqType appl_asAddressChangedCmdSeq[] =
 */
 static const ABCC_CmdSeqType appl_asBaudRateChangedCmdSeq[] =
 {
-   ABCC_CMD_SEQ( UpdateBaudRate, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateBaudRate, NULL ),
    ABCC_CMD_SEQ_END()
 };
 
@@ -302,8 +380,8 @@ static const ABCC_CmdSeqType appl_asBaudRateChangedCmdSeq[] =
 */
 static const ABCC_CmdSeqType appl_asCommSettingsChangedCmdSeq[] =
 {
-   ABCC_CMD_SEQ( UpdateCommSetting1, NULL ),
-   ABCC_CMD_SEQ( UpdateCommSetting2, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateCommSetting1, NULL ),
+   ABCC_CMD_SEQ_SHORT( UpdateCommSetting2, NULL ),
    ABCC_CMD_SEQ_END()
 };
 
@@ -315,8 +393,8 @@ static const ABCC_CmdSeqType appl_asCommSettingsChangedCmdSeq[] =
 */
 static const ABCC_CmdSeqType appl_asReadExeptionCmdSeq[] =
 {
-   ABCC_CMD_SEQ( ReadExeption,     HandleExceptionResp ),
-   ABCC_CMD_SEQ( ReadExeptionInfo, HandleExceptionInfoResp ),
+   ABCC_CMD_SEQ_SHORT( ReadExeption,     HandleExceptionResp ),
+   ABCC_CMD_SEQ_SHORT( ReadExeptionInfo, HandleExceptionInfoResp ),
    ABCC_CMD_SEQ_END()
 };
 
@@ -767,6 +845,9 @@ APPL_AbccHandlerStatusType APPL_HandleAbcc( void )
    static APPL_AbccHandlerStatusType eModuleStatus = APPL_MODULE_NO_ERROR;
    UINT32 lStartupTimeMs;
    ABCC_CommunicationStateType eAbccComState;
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+   UINT8 bIndex;
+#endif
 
    switch( appl_eAbccHandlerState )
    {
@@ -786,6 +867,17 @@ APPL_AbccHandlerStatusType APPL_HandleAbcc( void )
 
       if( eModuleStatus == APPL_MODULE_NO_ERROR )
       {
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+         /*
+         ** Register the host objects in the driver object registry
+         */
+         for( bIndex = 0; bIndex < APPL_NUM_OBJ_HANDLERS; bIndex++ )
+         {
+            (void)ABCC_RegisterObject( appl_asObjHandler[ bIndex ].bObject,
+                                       appl_asObjHandler[ bIndex ].pnHandler );
+         }
+#endif
+
          /*
          ** Init application data object
          */
@@ -803,6 +895,18 @@ APPL_AbccHandlerStatusType APPL_HandleAbcc( void )
 #endif
 #if ANB_FSI_OBJ_ENABLE
          ANB_FSI_Init();
+#endif
+#if BAC_OBJ_ENABLE
+         /*
+         ** Init BACnet object (Advanced Mapping lookup index)
+         */
+         BAC_Init();
+#endif
+#if ECT_OBJ_ENABLE
+         /*
+         ** Init EtherCAT object (serialized attribute values)
+         */
+         ECT_Init();
 #endif
       }
 
@@ -1180,136 +1284,24 @@ void ABCC_CbfDriverError( ABCC_SeverityType eSeverity, ABCC_ErrorCodeType iError
 
 void ABCC_CbfReceiveMsg( ABP_MsgType* psReceivedMsg )
 {
-   switch(  ABCC_GetMsgDestObj( psReceivedMsg ) )
-   {
-#if MQTT_OBJ_ENABLE
-   case ABP_OBJ_NUM_MQTT:
-
-      MQTT_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if OPCUA_OBJ_ENABLE
-   case ABP_OBJ_NUM_OPCUA:
-
-      OPCUA_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if SAFE_OBJ_ENABLE
-   case ABP_OBJ_NUM_SAFE:
-
-      SAFE_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if EPL_OBJ_ENABLE
-   case ABP_OBJ_NUM_EPL:
-
-      EPL_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if EIP_OBJ_ENABLE
-   case ABP_OBJ_NUM_EIP:
-
-      EIP_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if PRT_OBJ_ENABLE
-   case ABP_OBJ_NUM_PNIO:
-
-      PRT_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if DPV1_OBJ_ENABLE
-   case ABP_OBJ_NUM_DPV1:
-
-      DPV1_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if DEV_OBJ_ENABLE
-   case ABP_OBJ_NUM_DEV:
-
-      DEV_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if MOD_OBJ_ENABLE
-   case ABP_OBJ_NUM_MOD:
-
-      MOD_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if COP_OBJ_ENABLE
-   case ABP_OBJ_NUM_COP:
-
-      COP_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if ETN_OBJ_ENABLE
-   case ABP_OBJ_NUM_ETN:
-
-      ETN_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if ECT_OBJ_ENABLE
-   case ABP_OBJ_NUM_ECT:
-
-      ECT_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-   case ABP_OBJ_NUM_APPD:
-
-      AD_ProcObjectRequest( psReceivedMsg );
-      break;
+#if !ABCC_CFG_OBJ_REGISTRY_ENABLED
+   UINT8 bIndex;
 
-#if APP_OBJ_ENABLE
-   case ABP_OBJ_NUM_APP:
-
-      APP_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if SYNC_OBJ_ENABLE
-   case ABP_OBJ_NUM_SYNC:
-
-      SYNC_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if CCL_OBJ_ENABLE
-   case ABP_OBJ_NUM_CCL:
-
-      CCL_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if CFN_OBJ_ENABLE
-   case ABP_OBJ_NUM_CFN:
-
-      CFN_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if CIET_OBJ_ENABLE
-   case ABP_OBJ_NUM_CIET:
-
-      CIET_ProcessCmdMsg(psReceivedMsg);
-      break;
-#endif
-#if ASM_OBJ_ENABLE
-   case ABP_OBJ_NUM_ASM:
-
-      ASM_ProcessCmdMsg( psReceivedMsg );
-      break;
-#endif
-#if BAC_OBJ_ENABLE
-   case ABP_OBJ_NUM_BAC:
-
-      BAC_ProcessCmdMsg( psReceivedMsg );
-      break;
+   for( bIndex = 0; bIndex < APPL_NUM_OBJ_HANDLERS; bIndex++ )
+   {
+      if( appl_asObjHandler[ bIndex ].bObject == ABCC_GetMsgDestObj( psReceivedMsg ) )
+      {
+         appl_asObjHandler[ bIndex ].pnHandler( psReceivedMsg );
+         return;
+      }
+   }
 #endif
-   default:
 
-      /*
-      ** We have received a command to an unsupported object.
-      */
-      ABP_SetMsgErrorResponse( psReceivedMsg, 1, ABP_ERR_UNSUP_OBJ );
-      ABCC_SendRespMsg( psReceivedMsg );
-      break;
-   }
+   /*
+   ** We have received a command to an unsupported object.
+   */
+   ABP_SetMsgErrorResponse( psReceivedMsg, 1, ABP_ERR_UNSUP_OBJ );
+   ABCC_SendRespMsg( psReceivedMsg );
 }
 
 void ABCC_CbfWdTimeout( void )
@@ -0,0 +1,191 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Table driven Get_Attribute/Set_Attribute handling for host objects.
+********************************************************************************
+*/
+
+#include "abcc_types.h"
+#include "abcc.h"
+#include "abp.h"
+#include "abcc_host_attribute.h"
+
+/*------------------------------------------------------------------------------
+** Copies an attribute value to the response.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**    psAttr            - Attribute descriptor.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetAttr( ABP_MsgType* psNewMessage, const ABCC_HostAttrType* psAttr )
+{
+   UINT16 i;
+   UINT16 iSize;
+
+   iSize = psAttr->iSize;
+
+   switch( psAttr->bKind )
+   {
+   case ABCC_HOST_ATTR_KIND_UINT8:
+
+      ABCC_SetMsgData8( psNewMessage, (UINT8)psAttr->lValue, 0 );
+      break;
+
+   case ABCC_HOST_ATTR_KIND_UINT16:
+
+      ABCC_SetMsgData16( psNewMessage, (UINT16)psAttr->lValue, 0 );
+      break;
+
+   case ABCC_HOST_ATTR_KIND_UINT32:
+
+      ABCC_SetMsgData32( psNewMessage, psAttr->lValue, 0 );
+      break;
+
+   case ABCC_HOST_ATTR_KIND_OCTETS:
+
+      for( i = 0; i < psAttr->iSize; i++ )
+      {
+         ABCC_SetMsgData8( psNewMessage,
+                           ( (const UINT8*)psAttr->pxData )[ i ], i );
+      }
+      break;
+
+   case ABCC_HOST_ATTR_KIND_STRING:
+
+      ABCC_SetMsgString( psNewMessage, (const char*)psAttr->pxData,
+                         psAttr->iSize, 0 );
+      break;
+
+   case ABCC_HOST_ATTR_KIND_CSTRING:
+
+      iSize = 0;
+      while( ( iSize < psAttr->iSize ) &&
+             ( ( (const char*)psAttr->pxData )[ iSize ] != '\0' ) )
+      {
+         iSize++;
+      }
+      ABCC_SetMsgString( psNewMessage, (const char*)psAttr->pxData, iSize, 0 );
+      break;
+
+   default:
+
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_GENERAL_ERROR );
+      return;
+   }
+
+   ABP_SetMsgResponse( psNewMessage, iSize );
+}
+
+const ABCC_HostAttrType* ABCC_HostAttrFind( const ABCC_HostAttrType* pasAttr,
+                                            UINT8 bNumAttr,
+                                            UINT8 bAttr )
+{
+   UINT8 bLow;
+   UINT8 bHigh;
+   UINT8 bMid;
+
+   if( ( bNumAttr == 0 ) || ( bAttr < pasAttr[ 0 ].bAttr ) )
+   {
+      return( NULL );
+   }
+
+   /*
+   ** Most tables have consecutive attribute numbers, try the direct index
+   ** first.
+   */
+   bMid = bAttr - pasAttr[ 0 ].bAttr;
+   if( ( bMid < bNumAttr ) && ( pasAttr[ bMid ].bAttr == bAttr ) )
+   {
+      return( &pasAttr[ bMid ] );
+   }
+
+   bLow = 0;
+   bHigh = bNumAttr;
+   while( bLow < bHigh )
+   {
+      bMid = bLow + ( ( bHigh - bLow ) >> 1 );
+      if( pasAttr[ bMid ].bAttr < bAttr )
+      {
+         bLow = bMid + 1;
+      }
+      else
+      {
+         bHigh = bMid;
+      }
+   }
+
+   if( ( bLow < bNumAttr ) && ( pasAttr[ bLow ].bAttr == bAttr ) )
+   {
+      return( &pasAttr[ bLow ] );
+   }
+
+   return( NULL );
+}
+
+void ABCC_HostAttrCommand( ABP_MsgType* psNewMessage,
+                           const ABCC_HostAttrType* pasAttr,
+                           UINT8 bNumAttr )
+{
+   const ABCC_HostAttrType* psAttr;
+   UINT8 bCmd;
+
+   bCmd = ABCC_GetMsgCmdBits( psNewMessage );
+
+   if( ( bCmd != ABP_CMD_GET_ATTR ) && ( bCmd != ABP_CMD_SET_ATTR ) )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_CMD );
+      return;
+   }
+
+   psAttr = ABCC_HostAttrFind( pasAttr, bNumAttr,
+                               ABCC_GetMsgCmdExt0( psNewMessage ) );
+
+   if( psAttr == NULL )
+   {
+      /*
+      ** Unsupported attribute.
+      */
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
+   }
+   else if( bCmd == ABP_CMD_GET_ATTR )
+   {
+      if( psAttr->bKind != ABCC_HOST_ATTR_KIND_FUNC )
+      {
+         GetAttr( psNewMessage, psAttr );
+      }
+      else if( psAttr->pnGet != NULL )
+      {
+         psAttr->pnGet( psNewMessage );
+      }
+      else
+      {
+         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_GETABLE );
+      }
+   }
+   else
+   {
+      if( ( psAttr->bKind == ABCC_HOST_ATTR_KIND_FUNC ) &&
+          ( psAttr->pnSet != NULL ) )
+      {
+         psAttr->pnSet( psNewMessage );
+      }
+      else
+      {
+         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
+      }
+   }
+}
@@ -43,13 +43,20 @@
 /*
 ** Invalid ADI index.
 */
-#define AD_INVALID_ADI_INDEX                 ( 0xffff )
+#define AD_INVALID_ADI_INDEX                 ( ABCC_ADI_INDEX_NOT_FOUND )
 
 /*
 ** All ADI indexes.
 */
 #define AD_ALL_ADI_INDEX                     ( 0xffff )
 
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+/*
+** Size of the write map change bit fields (one bit per write map entry).
+*/
+#define AD_WRPD_DIRTY_MAP_SIZE               ( ( AD_MAX_NUM_WRITE_MAP_ENTRIES + 7 ) / 8 )
+#endif
+
 /*------------------------------------------------------------------------------
 ** Union for all different property types.
 **------------------------------------------------------------------------------
@@ -131,6 +138,135 @@ typedef struct ad_MapInfo
 }
 ad_MapInfoType;
 
+#if( AD_PD_COPY_PLAN_ENABLE )
+/*------------------------------------------------------------------------------
+** Operation codes of a precompiled process data copy plan.
+**------------------------------------------------------------------------------
+** AD_COPY_OP_OCTETS  - Plain octet copy. iNumElem is the number of octets.
+** AD_COPY_OP_SWAP16  - 16 bit values copied with endian swap.
+** AD_COPY_OP_SWAP32  - 32 bit values copied with endian swap.
+** AD_COPY_OP_SWAP64  - 64 bit values copied with endian swap.
+** AD_COPY_OP_BITS    - BITx/BOOL1 elements of type bDataType.
+** AD_COPY_OP_GET_CBF - Call pnGetAdiValue of psAdiEntry (write direction).
+** AD_COPY_OP_SET_CBF - Call pnSetAdiValue of psAdiEntry (read direction).
+**------------------------------------------------------------------------------
+*/
+typedef enum ad_CopyOpCode
+{
+   AD_COPY_OP_OCTETS = 0,
+   AD_COPY_OP_SWAP16,
+   AD_COPY_OP_SWAP32,
+   AD_COPY_OP_SWAP64,
+   AD_COPY_OP_BITS,
+   AD_COPY_OP_GET_CBF,
+   AD_COPY_OP_SET_CBF
+}
+ad_CopyOpCodeType;
+
+/*------------------------------------------------------------------------------
+** A single pre-resolved copy operation.
+**------------------------------------------------------------------------------
+** pxAdiData      - Base pointer to the ADI value (or struct element).
+** iAdiBitOffset  - Bit offset relative pxAdiData.
+** iPdBitOffset   - Bit offset relative the process data buffer.
+** iNumElem       - Number of elements (octets for AD_COPY_OP_OCTETS).
+** bOpCode        - ad_CopyOpCodeType.
+** bDataType      - ABP data type (only used by AD_COPY_OP_BITS).
+** psAdiEntry     - ADI entry (only used by the callback operations).
+** bNumElements   - Number of mapped elements (callback operations).
+** bStartIndex    - First mapped element (callback operations).
+** iFirstMapIndex - First map entry covered by the operation (write direction
+**                  change tracking).
+** iLastMapIndex  - Last map entry covered by the operation. Always the first
+**                  one in the write plan, see AddOctetCopyOp().
+**------------------------------------------------------------------------------
+*/
+typedef struct ad_CopyOp
+{
+   void*    pxAdiData;
+   UINT16   iAdiBitOffset;
+   UINT16   iPdBitOffset;
+   UINT16   iNumElem;
+   UINT8    bOpCode;
+   UINT8    bDataType;
+#if( ABCC_CFG_ADI_GET_SET_CALLBACK_ENABLED )
+   const AD_AdiEntryType* psAdiEntry;
+   UINT8    bNumElements;
+   UINT8    bStartIndex;
+#endif
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   UINT16   iFirstMapIndex;
+   UINT16   iLastMapIndex;
+#endif
+}
+ad_CopyOpType;
+
+/*------------------------------------------------------------------------------
+** Precompiled copy plan for one process data direction.
+**------------------------------------------------------------------------------
+** pasOps      - Pointer to the list of operations.
+** iNumOps     - Number of operations in the plan.
+** iMaxNumOps  - Maximum number of operations.
+** fValid      - TRUE if the plan reflects the present map. If FALSE the map
+**               walk is used.
+** fInUse      - TRUE while the plan is executed by a process data update or
+**               being compiled.
+** fRebuild    - Set if the map changed while the plan was in use. The
+**               context using it then rebuilds it when done.
+** fCompileOk  - Used while compiling. FALSE once the map cannot be held by
+**               the plan.
+** iMapIndex   - Map entry being compiled.
+**------------------------------------------------------------------------------
+*/
+typedef struct ad_CopyPlan
+{
+   ad_CopyOpType* pasOps;
+   UINT16         iNumOps;
+   UINT16         iMaxNumOps;
+   BOOL           fValid;
+   BOOL           fInUse;
+   BOOL           fRebuild;
+   BOOL           fCompileOk;
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   UINT16         iMapIndex;
+#endif
+}
+ad_CopyPlanType;
+#endif
+
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+/*------------------------------------------------------------------------------
+** Kind of write process data update to make.
+**------------------------------------------------------------------------------
+** AD_WRPD_UPDATE_NONE    - Nothing has changed since the last update.
+** AD_WRPD_UPDATE_PARTIAL - Only the changed map entries are copied.
+** AD_WRPD_UPDATE_FULL    - All map entries are copied.
+**------------------------------------------------------------------------------
+*/
+typedef enum ad_WrPdUpdate
+{
+   AD_WRPD_UPDATE_NONE = 0,
+   AD_WRPD_UPDATE_PARTIAL,
+   AD_WRPD_UPDATE_FULL
+}
+ad_WrPdUpdateType;
+#endif
+
+/*------------------------------------------------------------------------------
+** ADI lists of the Get_Instance_Numbers command, in the order of
+** ad_abListDescrMask[].
+**------------------------------------------------------------------------------
+*/
+typedef enum ad_List
+{
+   AD_LIST_ALL = 0,
+   AD_LIST_RD_PD_MAPPABLE,
+   AD_LIST_WR_PD_MAPPABLE,
+   AD_LIST_NVS_PARAMS,
+   AD_NUM_LISTS
+}
+ad_ListType;
+
 static BOOL ad_fDoNetworkEndianSwap = FALSE;
 static const AD_MapType* ad_asDefaultMap = NULL;
 static const AD_AdiEntryType* ad_asADIEntryList = NULL;
@@ -140,6 +276,103 @@ static ad_MapType ad_PdReadMapping[ AD_MAX_NUM_READ_MAP_ENTRIES ];
 static ad_MapType ad_PdWriteMapping[ AD_MAX_NUM_WRITE_MAP_ENTRIES ];
 static ad_MapInfoType ad_ReadMapInfo;
 static ad_MapInfoType ad_WriteMapInfo;
+#if( AD_PD_COPY_PLAN_ENABLE )
+static ad_CopyOpType ad_asReadCopyOps[ AD_MAX_NUM_READ_COPY_OPS ];
+static ad_CopyOpType ad_asWriteCopyOps[ AD_MAX_NUM_WRITE_COPY_OPS ];
+static ad_CopyPlanType ad_sReadCopyPlan;
+static ad_CopyPlanType ad_sWriteCopyPlan;
+#endif
+
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+/*
+** Write process data change tracking.
+**
+** ad_abWrPdDirty       - Write map entries changed since the last update.
+** ad_abWrPdAlwaysDirty - Write map entries copied in every update (ADIs with
+**                        a get callback).
+** ad_fWrPdDirty        - TRUE if any bit in ad_abWrPdDirty is set.
+** ad_fWrPdAlwaysDirty  - TRUE if any bit in ad_abWrPdAlwaysDirty is set.
+** ad_fWrPdFullUpdate   - TRUE if the next update must copy all entries.
+** ad_pxLastWrPdBuf     - Buffer used in the last update.
+*/
+static UINT8 ad_abWrPdDirty[ AD_WRPD_DIRTY_MAP_SIZE ];
+static UINT8 ad_abWrPdAlwaysDirty[ AD_WRPD_DIRTY_MAP_SIZE ];
+static BOOL ad_fWrPdDirty = FALSE;
+static BOOL ad_fWrPdAlwaysDirty = FALSE;
+static BOOL ad_fWrPdFullUpdate = TRUE;
+static void* ad_pxLastWrPdBuf = NULL;
+#endif
+
+/*
+** Descriptor bits that an ADI must have to be in each list, 0 for all ADIs.
+*/
+static const UINT8 ad_abListDescrMask[ AD_NUM_LISTS ] =
+{
+   0,
+   ABP_APPD_DESCR_MAPPABLE_READ_PD,
+   ABP_APPD_DESCR_MAPPABLE_WRITE_PD,
+   ABP_APPD_DESCR_NVS_PARAMETER
+};
+
+/*
+** Number of ADIs in each list.
+*/
+static UINT16 ad_aiNumInList[ AD_NUM_LISTS ];
+
+#if( AD_ORDINAL_LIST_SIZE > 0 )
+/*
+** Instance numbers of the ADIs in each list, in list order and little endian.
+** The lists are stored one after the other, starting at
+** ad_aiOrdinalListStart[]. Only valid if all lists fit.
+*/
+static UINT16 ad_aiOrdinalList[ AD_ORDINAL_LIST_SIZE ];
+static UINT16 ad_aiOrdinalListStart[ AD_NUM_LISTS ];
+static BOOL ad_fOrdinalListValid = FALSE;
+#endif
+
+#if( AD_SEG_VALUE_ENABLE )
+/*
+** Segmented Get_Attribute of an ADI value. psAdiEntry is NULL when no
+** segmented response is being sent. bNextElem is the first element of the
+** next block.
+*/
+typedef struct ad_SegGetType
+{
+   const AD_AdiEntryType* psAdiEntry;
+   UINT8 bNextElem;
+}
+ad_SegGetType;
+
+static ad_SegGetType ad_sSegGet;
+
+/*
+** Values that cannot be sent straight from the ADI storage are converted into
+** this buffer one block of elements at a time.
+*/
+static UINT32 ad_alSegGetBlock[ ( AD_SEG_GET_BLOCK_SIZE + 3 ) / 4 ];
+
+#if( AD_SEG_SET_BUFFER_SIZE > 0 )
+/*
+** Segmented Set_Attribute of an ADI value. The segments are collected in
+** ad_alSegSetBuffer, iSize octets so far. psAdiEntry is NULL when no
+** segmented request is being received. A request not completed within
+** ABCC_CFG_SEG_SESSION_TMO_MS of its last segment is abandoned
+** (lTmoDeadlineMs).
+*/
+typedef struct ad_SegSetType
+{
+   const AD_AdiEntryType* psAdiEntry;
+   UINT16 iSize;
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   UINT32 lTmoDeadlineMs;
+#endif
+}
+ad_SegSetType;
+
+static ad_SegSetType ad_sSegSet;
+static UINT32 ad_alSegSetBuffer[ ( AD_SEG_SET_BUFFER_SIZE + 3 ) / 4 ];
+#endif
+#endif
 
 /*------------------------------------------------------------------------------
 ** Converts number of octet offset to byte offset.
@@ -178,6 +411,7 @@ do                                        \
    (bits) %= 16;                          \
 }                                         \
 while( 0 )
+#define AD_BITS_PER_CHAR  16
 #else
 #define AddBitsToOctetSize( octet, bits ) \
 do                                        \
@@ -186,8 +420,16 @@ do                                        \
    (bits) %= 8;                           \
 }                                         \
 while( 0 )
+#define AD_BITS_PER_CHAR  8
 #endif
 
+/*------------------------------------------------------------------------------
+** Largest bit field CopyBitsInWord() can handle for any bit offset below
+** AD_BITS_PER_CHAR.
+**------------------------------------------------------------------------------
+*/
+#define AD_MAX_BIT_CHUNK  ( 32 - AD_BITS_PER_CHAR )
+
 /*------------------------------------------------------------------------------
 ** Calculates the bit offset to the startindex element in the ADI.
 **------------------------------------------------------------------------------
@@ -207,102 +449,6 @@ while( 0 )
 */
 #define BitToOctetOffset( bitOffset ) ( (bitOffset) >> 3 )
 
-/*------------------------------------------------------------------------------
-** Copies a 16 bit values from a source to a destination. Each value will be
-** endian swapped. The function support octet alignment.
-**------------------------------------------------------------------------------
-** Arguments:
-**    pxDest            - Base pointer to the destination.
-**    iDestOctetOffset  - Octet offset to the destination where the copy will
-**                        begin.
-**    pxSrc             - Bsse pointer to source data.
-**    iSrcOctetOffset   - Octet offset to the source where the copy will begin.
-**    iNumElem          - Number of 16 bit values to copy.
-**
-** Returns:
-**    None
-**------------------------------------------------------------------------------
-*/
-static void Copy16WithEndianSwap( void* pxDest, UINT16 iDestOctetOffset,
-                                  const void* pxSrc, UINT16 iSrcOctetOffset,
-                                  UINT16 iNumElem )
-{
-   UINT16 i;
-   UINT16 iConv;
-
-   for( i = 0; i < iNumElem; i++ )
-   {
-      ABCC_PORT_Copy16( &iConv, 0, pxSrc, iSrcOctetOffset + ( i << 1 ) );
-      iConv = ABCC_iEndianSwap( iConv );
-      ABCC_PORT_Copy16( pxDest, iDestOctetOffset + ( i << 1 ), &iConv, 0 );
-   }
-}
-
-/*------------------------------------------------------------------------------
-** Copies a 32 bit values from a source to a destination. Each value will be
-** endian swapped. The function support octet alignment.
-**------------------------------------------------------------------------------
-** Arguments:
-**    pxDest            - Base pointer to the destination.
-**    iDestOctetOffset  - Octet offset to the destination where the copy will
-**                        begin.
-**    pxSrc             - Bsse pointer to source data.
-**    iSrcOctetOffset   - Octet offset to the source where the copy will begin.
-**    iNumElem          - Number of 32 bit values to copy.
-**
-** Returns:
-**    None
-**------------------------------------------------------------------------------
-*/
-static void Copy32WithEndianSwap( void* pxDest, UINT16 iDestOctetOffset,
-                                  const void* pxSrc, UINT16 iSrcOctetOffset,
-                                  UINT16 iNumElem )
-{
-   UINT16 i;
-   UINT32 lConv;
-
-   for( i = 0; i < iNumElem; i++ )
-   {
-      ABCC_PORT_Copy32( &lConv, 0, pxSrc, iSrcOctetOffset + ( i << 2 ) );
-      lConv = ABCC_lEndianSwap( lConv );
-      ABCC_PORT_Copy32( pxDest, iDestOctetOffset + ( i << 2 ), &lConv, 0 );
-   }
-}
-
-
-/*------------------------------------------------------------------------------
-** Copies a 64 bit values from a source to a destination. Each value will be
-** endian swapped. The function support octet alignment.
-**------------------------------------------------------------------------------
-** Arguments:
-**    pxDest            - Base pointer to the destination.
-**    iDestOctetOffset  - Octet offset to the destination where the copy will
-**                        begin.
-**    pxSrc             - Bsse pointer to source data.
-**    iSrcOctetOffset   - Octet offset to the source where the copy will begin.
-**    iNumElem          - Number of 64 bit values to copy.
-**
-** Returns:
-**    None
-**------------------------------------------------------------------------------
-*/
-#if( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
-static void Copy64WithEndianSwap( void* pxDest, UINT16 iDestOctetOffset,
-                                  const void* pxSrc, UINT16 iSrcOctetOffset,
-                                  UINT16 iNumElem )
-{
-   UINT16 i;
-   UINT64 lConv;
-
-   for( i = 0; i < iNumElem; i++ )
-   {
-      ABCC_PORT_Copy64( &lConv, 0, pxSrc, iSrcOctetOffset + ( i << 3 ) );
-      lConv = ABCC_l64EndianSwap( lConv );
-      ABCC_PORT_Copy64( pxDest, iDestOctetOffset + ( i << 3 ), &lConv, 0 );
-   }
-}
-#endif
-
 /*------------------------------------------------------------------------------
 ** Calculates the size of a part of or a complete ADI, in bits.
 **------------------------------------------------------------------------------
@@ -424,45 +570,201 @@ static void UpdateMapSize( ad_MapInfoType* psMap )
 */
 static UINT16 GetAdiIndex( UINT16 iInstance )
 {
-   UINT16   iLow;
-   UINT16   iMid;
-   UINT16   iHigh;
-
    if( iInstance == 0 )
    {
       return( AD_MAP_PAD_INDEX );
    }
 
-   if( ad_iNumOfADIs == 0 )
-   {
-      return( AD_INVALID_ADI_INDEX );
-   }
+   return( ABCC_AdiIndexFind( ad_asADIEntryList, ad_iNumOfADIs, iInstance ) );
+}
 
-   iLow = 0;
-   iHigh = ad_iNumOfADIs - 1;
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+/*------------------------------------------------------------------------------
+** Marks all write map entries referring to an ADI as changed.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iAdiIndex         -  Index in ADI entry table.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void MarkWrPdDirty( UINT16 iAdiIndex )
+{
+   UINT16 iMapIndex;
+   ABCC_PORT_UseCritical();
 
-   while( iLow != iHigh )
+   for( iMapIndex = 0; iMapIndex < ad_WriteMapInfo.iNumMappedAdi; iMapIndex++ )
    {
-      iMid = iLow + ( ( iHigh - iLow + 1 ) / 2 );
-      if( ad_asADIEntryList[ iMid ].iInstance > iInstance )
+      if( ad_WriteMapInfo.paiMappedAdiList[ iMapIndex ].iAdiIndex == iAdiIndex )
       {
-         iHigh = iMid - 1;
+         ABCC_PORT_EnterCritical();
+         ad_abWrPdDirty[ iMapIndex >> 3 ] |= (UINT8)( 1 << ( iMapIndex & 7 ) );
+         ad_fWrPdDirty = TRUE;
+         ABCC_PORT_ExitCritical();
       }
-      else
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Restarts the write process data change tracking after the write map has
+** been changed. The next update copies all map entries.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void ResetWrPdDirty( void )
+{
+   UINT16 iIndex;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+
+   for( iIndex = 0; iIndex < AD_WRPD_DIRTY_MAP_SIZE; iIndex++ )
+   {
+      ad_abWrPdDirty[ iIndex ] = 0;
+      ad_abWrPdAlwaysDirty[ iIndex ] = 0;
+   }
+
+   ad_fWrPdDirty = FALSE;
+   ad_fWrPdAlwaysDirty = FALSE;
+   ad_fWrPdFullUpdate = TRUE;
+
+#if( ABCC_CFG_ADI_GET_SET_CALLBACK_ENABLED )
+   /*
+   ** The value of an ADI with a get callback is only known to the
+   ** application, so it is copied in every update.
+   */
+   for( iIndex = 0; iIndex < ad_WriteMapInfo.iNumMappedAdi; iIndex++ )
+   {
+      UINT16 iAdiIndex = ad_WriteMapInfo.paiMappedAdiList[ iIndex ].iAdiIndex;
+
+      if( ( iAdiIndex < ad_iNumOfADIs ) &&
+          ( ad_asADIEntryList[ iAdiIndex ].pnGetAdiValue != NULL ) )
       {
-         iLow = iMid;
+         ad_abWrPdAlwaysDirty[ iIndex >> 3 ] |= (UINT8)( 1 << ( iIndex & 7 ) );
+         ad_fWrPdAlwaysDirty = TRUE;
       }
    }
+#endif
+
+   ABCC_PORT_ExitCritical();
+}
+
+/*------------------------------------------------------------------------------
+** Fetches and clears the set of write map entries changed since the last
+** update.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pxPdDataBuf       -  Write process data buffer about to be updated. A
+**                         full update is required if it differs from the
+**                         buffer used in the last update.
+**    pabDirty          -  Destination of the changed entries (one bit per
+**                         write map entry). Only valid for
+**                         AD_WRPD_UPDATE_PARTIAL.
+**
+** Returns:
+**    Kind of update to make.
+**------------------------------------------------------------------------------
+*/
+static ad_WrPdUpdateType TakeWrPdDirty( void* pxPdDataBuf, UINT8* pabDirty )
+{
+   ad_WrPdUpdateType eUpdate;
+   UINT16 iIndex;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+
+   if( ad_fWrPdFullUpdate || ( pxPdDataBuf != ad_pxLastWrPdBuf ) )
+   {
+      eUpdate = AD_WRPD_UPDATE_FULL;
+   }
+   else if( ad_fWrPdDirty || ad_fWrPdAlwaysDirty )
+   {
+      eUpdate = AD_WRPD_UPDATE_PARTIAL;
+   }
+   else
+   {
+      eUpdate = AD_WRPD_UPDATE_NONE;
+   }
+
+   for( iIndex = 0; iIndex < AD_WRPD_DIRTY_MAP_SIZE; iIndex++ )
+   {
+      pabDirty[ iIndex ] = ad_abWrPdDirty[ iIndex ] | ad_abWrPdAlwaysDirty[ iIndex ];
+      ad_abWrPdDirty[ iIndex ] = 0;
+   }
+
+   ad_fWrPdDirty = FALSE;
+   ad_fWrPdFullUpdate = FALSE;
+   ad_pxLastWrPdBuf = pxPdDataBuf;
+
+   ABCC_PORT_ExitCritical();
+
+   return( eUpdate );
+}
+
+/*------------------------------------------------------------------------------
+** Checks if any write map entry in a range is marked as changed.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pabDirty          -  Changed entries, see TakeWrPdDirty().
+**    iFirstMapIndex    -  First map entry in the range.
+**    iLastMapIndex     -  Last map entry in the range.
+**
+** Returns:
+**    TRUE if any entry in the range is changed.
+**------------------------------------------------------------------------------
+*/
+static BOOL IsWrPdDirty( const UINT8* pabDirty,
+                         UINT16 iFirstMapIndex,
+                         UINT16 iLastMapIndex )
+{
+   UINT16 iMapIndex;
 
-   if( ad_asADIEntryList[ iLow ].iInstance != iInstance )
+   for( iMapIndex = iFirstMapIndex; iMapIndex <= iLastMapIndex; iMapIndex++ )
    {
-      iLow = AD_INVALID_ADI_INDEX;
+      if( pabDirty[ iMapIndex >> 3 ] & ( 1 << ( iMapIndex & 7 ) ) )
+      {
+         return( TRUE );
+      }
    }
 
-   return( iLow );
+   return( FALSE );
 }
+#endif
 
 #if( ABCC_CFG_REMAP_SUPPORT_ENABLED )
+#if( AD_PD_COPY_PLAN_ENABLE )
+/*------------------------------------------------------------------------------
+** Invalidates a copy plan while its map is changed. A plan in use is rebuilt
+** when released, so a compilation in progress is not made valid with the
+** operations of the old map.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan         - Pointer to the copy plan.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void InvalidateCopyPlan( ad_CopyPlanType* psPlan )
+{
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   psPlan->fValid = FALSE;
+   if( psPlan->fInUse )
+   {
+      psPlan->fRebuild = TRUE;
+   }
+   ABCC_PORT_ExitCritical();
+}
+#endif
+
 /*------------------------------------------------------------------------------
 ** Check if the targeted ADI/element descriptor says that it is PD mappable in
 ** the requested PD direction.
@@ -731,6 +1033,18 @@ static void RemapProcessDataCommand( ABP_MsgType* psMsg,
 
       UpdateMapSize( psCurrMap );
 
+#if( AD_PD_COPY_PLAN_ENABLE )
+      /*
+      ** The copy plans are rebuilt when the remap is done. Until then the
+      ** maps are walked.
+      */
+      InvalidateCopyPlan( &ad_sReadCopyPlan );
+      InvalidateCopyPlan( &ad_sWriteCopyPlan );
+#endif
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+      ResetWrPdDirty();
+#endif
+
       ABCC_SetMsgData16(psMsg, psCurrMap->iPdSize, 0);
       ABP_SetMsgResponse( psMsg, 2 );
       ABCC_SendRemapRespMsg( psMsg, ad_ReadMapInfo.iPdSize,
@@ -746,133 +1060,267 @@ static void RemapProcessDataCommand( ABP_MsgType* psMsg,
 
 
 /*------------------------------------------------------------------------------
-** Copy bit data. Any alignment is allowed.
+** Copy a bit field that fits within a 32 bit window in both source and
+** destination. Only the octets covered by the field are read and written.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    pxDest            - Destination base pointer.
-**    iDestBitOffset    - Bit offset relative destination pointer.
+**    iDestOctetOffset  - Octet offset relative destination pointer.
+**    iDestBitOffset    - Bit offset relative destination octet offset.
 **    pxSrc             - Source base pointer.
-**    iSrcBitOffset     - Bit offset relative source pointer.
-**    bDataType         - Data type according to ABP_<X> types in abp.h
-**    iNumElem          - Number of elements to copy.
+**    iSrcOctetOffset   - Octet offset relative source pointer.
+**    iSrcBitOffset     - Bit offset relative source octet offset.
+**    iNumBits          - Number of bits to copy (1 - AD_MAX_BIT_CHUNK).
 **
 ** Returns:
-**    Size of copied data in bits.
+**    None
 **------------------------------------------------------------------------------
 */
-static UINT16 CopyBitData( void* pxDest,
-                           UINT16 iDestBitOffset,
-                           const void* pxSrc,
-                           UINT16 iSrcBitOffset,
-                           UINT8 bDataType,
-                           UINT16 iNumElem )
+static void CopyBitsInWord( void* pxDest,
+                            UINT16 iDestOctetOffset,
+                            UINT16 iDestBitOffset,
+                            const void* pxSrc,
+                            UINT16 iSrcOctetOffset,
+                            UINT16 iSrcBitOffset,
+                            UINT16 iNumBits )
 {
-   UINT8  bCopySize;
-   UINT16 i;
-   UINT16 iSetBitSize = 0;
+   UINT8  bDestCopySize;
    UINT32 lBitMask;
    UINT32 lSrc;
    UINT32 lDest;
-   UINT16 iSrcOctetOffset;
-   UINT16 iDestOctetOffset;
 
-   iSrcOctetOffset = 0;
-   iDestOctetOffset = 0;
+   /*
+   ** Calculate the number of octets that has to be copied to include both
+   ** bit offset and bit size.
+   */
+   bDestCopySize = (UINT8)( ( iNumBits + iDestBitOffset + 7 ) / 8 );
 
-   if( ABP_Is_PADx( bDataType ) )
+   /*
+   ** Copy parts to be manipulated into local 32 bit variables to guarantee
+   ** correct alignment.
+   */
+   lSrc = 0;
+   lDest = 0;
+   ABCC_PORT_CopyOctets( &lSrc, 0, pxSrc, iSrcOctetOffset,
+                         ( iNumBits + iSrcBitOffset + 7 ) / 8 );
+   ABCC_PORT_CopyOctets( &lDest, 0, pxDest, iDestOctetOffset, bDestCopySize );
+
+   /*
+   ** Bit data types crossing octet boundaries are always little endian.
+   */
+   lSrc = lLeTOl( lSrc );
+   lDest = lLeTOl( lDest );
+
+   /*
+   ** Calculate bit mask and align it with destination bit offset.
+   */
+   lBitMask = ( (UINT32)1 << iNumBits ) - 1;
+   lBitMask <<= iDestBitOffset;
+
+   /*
+   ** Align source bits with destination bits
+   */
+   if( iSrcBitOffset < iDestBitOffset )
    {
-      /*
-      ** This is only a pad. No copy is done.
-      */
-      iSetBitSize += bDataType - ABP_PAD0;
+      lSrc <<= iDestBitOffset - iSrcBitOffset;
    }
    else
    {
-      /*
-      ** Separate offsets into octets and bits.
-      */
+      lSrc >>= iSrcBitOffset - iDestBitOffset;
+   }
+
+   /*
+   ** Clear destinations bits and mask source bits an insert source bits
+   ** into destination bit position.
+   */
+   lDest &= ~lBitMask;
+   lSrc &= lBitMask;
+   lDest |= lSrc;
+
+   /*
+   ** Restore endian and copy local updated data into final destination.
+   */
+   lDest = lTOlLe( lDest );
+   ABCC_PORT_CopyOctets( pxDest, iDestOctetOffset, &lDest, 0, bDestCopySize );
+}
+
+/*------------------------------------------------------------------------------
+** Copy an arbitrary range of bits. Any alignment is allowed.
+**
+** If source and destination share the same bit alignment the range is copied
+** as whole octets. Otherwise the destination is first brought to an octet
+** boundary and the bulk of the range is then moved 32 bits at a time by
+** funnel shifting two consecutive source words. Remaining bits are copied
+** with CopyBitsInWord().
+**------------------------------------------------------------------------------
+** Arguments:
+**    pxDest            - Destination base pointer.
+**    iDestBitOffset    - Bit offset relative destination pointer.
+**    pxSrc             - Source base pointer.
+**    iSrcBitOffset     - Bit offset relative source pointer.
+**    iNumBits          - Number of bits to copy.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void CopyBitRange( void* pxDest,
+                          UINT16 iDestBitOffset,
+                          const void* pxSrc,
+                          UINT16 iSrcBitOffset,
+                          UINT16 iNumBits )
+{
+   UINT16 iSrcOctetOffset;
+   UINT16 iDestOctetOffset;
+   UINT16 iChunk;
+   UINT32 lLow;
+   UINT32 lHigh;
+   UINT32 lData;
+
+   /*
+   ** Separate offsets into octets and bits.
+   */
+   iSrcOctetOffset = 0;
+   iDestOctetOffset = 0;
+   AddBitsToOctetSize( iSrcOctetOffset, iSrcBitOffset );
+   AddBitsToOctetSize( iDestOctetOffset, iDestBitOffset );
+
+   /*
+   ** Bring the destination to a char boundary.
+   */
+   if( ( iDestBitOffset != 0 ) && ( iNumBits > 0 ) )
+   {
+      iChunk = AD_BITS_PER_CHAR - iDestBitOffset;
+      if( iChunk > iNumBits )
+      {
+         iChunk = iNumBits;
+      }
+
+      CopyBitsInWord( pxDest, iDestOctetOffset, iDestBitOffset,
+                      pxSrc, iSrcOctetOffset, iSrcBitOffset, iChunk );
+
+      iNumBits -= iChunk;
+      iSrcBitOffset += iChunk;
       AddBitsToOctetSize( iSrcOctetOffset, iSrcBitOffset );
+      iDestBitOffset += iChunk;
       AddBitsToOctetSize( iDestOctetOffset, iDestBitOffset );
+   }
 
+   if( iSrcBitOffset == 0 )
+   {
       /*
-      ** Calculate number of bits to be set.
+      ** Same alignment. Copy whole octets.
       */
-      if( bDataType == ABP_BOOL1 )
-      {
-         iSetBitSize += 1;
-      }
-      else
-      {
-         iSetBitSize += ( ( bDataType - ABP_BIT1 ) + 1 );
-      }
+      ABCC_PORT_CopyOctets( pxDest, iDestOctetOffset,
+                            pxSrc, iSrcOctetOffset,
+                            iNumBits >> 3 );
+      iSrcOctetOffset += iNumBits >> 3;
+      iDestOctetOffset += iNumBits >> 3;
+      iNumBits &= 7;
+   }
+   else if( ( iSrcBitOffset + iNumBits ) >= 64 )
+   {
+      /*
+      ** Funnel shift 32 bits at a time. The next source word is only read
+      ** while all of its octets are part of the range.
+      */
+      ABCC_PORT_CopyOctets( &lLow, 0, pxSrc, iSrcOctetOffset,
+                            ABP_UINT32_SIZEOF );
+      lLow = lLeTOl( lLow );
 
-      for( i = 0; i < iNumElem; i++ )
+      while( ( iSrcBitOffset + iNumBits ) >= 64 )
       {
-         /*
-         ** Calculate the number of octets that has to be copied
-         ** to include both destination bit offset and bit size.
-         */
-         bCopySize = (UINT8)( ( iSetBitSize + iDestBitOffset + 7 ) / 8 );
-
-         /*
-         ** Copy parts to be manipulated into local 32 bit variables to
-         ** guarantee correct alignment.
-         */
-         ABCC_PORT_CopyOctets( &lSrc, 0, pxSrc, iSrcOctetOffset,
+         ABCC_PORT_CopyOctets( &lHigh, 0, pxSrc,
+                               iSrcOctetOffset + ABP_UINT32_SIZEOF,
                                ABP_UINT32_SIZEOF );
-         ABCC_PORT_CopyOctets( &lDest, 0, pxDest, iDestOctetOffset, bCopySize );
+         lHigh = lLeTOl( lHigh );
 
-         /*
-         ** Bit data types crossing octet boundaries are always little endian.
-         */
-         lSrc = lLeTOl( lSrc );
-         lDest = lLeTOl( lDest );
+         lData = ( lLow >> iSrcBitOffset ) | ( lHigh << ( 32 - iSrcBitOffset ) );
+         lData = lTOlLe( lData );
+         ABCC_PORT_CopyOctets( pxDest, iDestOctetOffset, &lData, 0,
+                               ABP_UINT32_SIZEOF );
 
-         /*
-         ** Calculate bit mask and align it with destination bit offset.
-         */
-         lBitMask = ( (UINT32)1 << iSetBitSize ) - 1;
-         lBitMask <<= iDestBitOffset;
+         lLow = lHigh;
+         iSrcOctetOffset += ABP_UINT32_SIZEOF;
+         iDestOctetOffset += ABP_UINT32_SIZEOF;
+         iNumBits -= 32;
+      }
+   }
 
-         /*
-         ** Align source bits with destination bits
-         */
-         if( iSrcBitOffset <  iDestBitOffset )
-         {
-            lSrc <<= iDestBitOffset - iSrcBitOffset;
-         }
-         else
-         {
-            lSrc >>= iSrcBitOffset - iDestBitOffset;
-         }
+   /*
+   ** Remaining bits.
+   */
+   while( iNumBits > 0 )
+   {
+      iChunk = AD_MAX_BIT_CHUNK;
+      if( iChunk > iNumBits )
+      {
+         iChunk = iNumBits;
+      }
 
-         /*
-         ** Clear destinations bits and mask source bits an insert source bits
-         ** into destination bit position.
-         */
-         lDest &=  ~lBitMask;
-         lSrc &=  lBitMask;
-         lDest |= lSrc;
+      CopyBitsInWord( pxDest, iDestOctetOffset, iDestBitOffset,
+                      pxSrc, iSrcOctetOffset, iSrcBitOffset, iChunk );
 
-         /*
-         ** Restore endian.
-         */
-         lDest = lTOlLe( lDest );
+      iNumBits -= iChunk;
+      iSrcBitOffset += iChunk;
+      AddBitsToOctetSize( iSrcOctetOffset, iSrcBitOffset );
+      iDestBitOffset += iChunk;
+      AddBitsToOctetSize( iDestOctetOffset, iDestBitOffset );
+   }
+}
 
-         /*
-         ** Copy local updated data into final destination.
-         */
-         ABCC_PORT_CopyOctets( pxDest, iDestOctetOffset, &lDest, 0, bCopySize );
+/*------------------------------------------------------------------------------
+** Copy bit data. Any alignment is allowed.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pxDest            - Destination base pointer.
+**    iDestBitOffset    - Bit offset relative destination pointer.
+**    pxSrc             - Source base pointer.
+**    iSrcBitOffset     - Bit offset relative source pointer.
+**    bDataType         - Data type according to ABP_<X> types in abp.h
+**    iNumElem          - Number of elements to copy.
+**
+** Returns:
+**    Size of copied data in bits.
+**------------------------------------------------------------------------------
+*/
+static UINT16 CopyBitData( void* pxDest,
+                           UINT16 iDestBitOffset,
+                           const void* pxSrc,
+                           UINT16 iSrcBitOffset,
+                           UINT8 bDataType,
+                           UINT16 iNumElem )
+{
+   UINT16 iSetBitSize;
 
-         /*
-         ** Update bit offsets to next bit field.
-         */
-         iSrcBitOffset += iSetBitSize;
-         AddBitsToOctetSize( iSrcOctetOffset, iSrcBitOffset );
-         iDestBitOffset += iSetBitSize;
-         AddBitsToOctetSize( iDestOctetOffset, iDestBitOffset );
+   if( ABP_Is_PADx( bDataType ) )
+   {
+      /*
+      ** This is only a pad. No copy is done.
+      */
+      iSetBitSize = bDataType - ABP_PAD0;
+   }
+   else
+   {
+      /*
+      ** Calculate number of bits to be set.
+      */
+      if( bDataType == ABP_BOOL1 )
+      {
+         iSetBitSize = 1;
+      }
+      else
+      {
+         iSetBitSize = ( bDataType - ABP_BIT1 ) + 1;
       }
+
+      /*
+      ** Bit elements are packed without gaps so the whole array is one
+      ** contiguous bit range.
+      */
       iSetBitSize *= iNumElem;
+      CopyBitRange( pxDest, iDestBitOffset, pxSrc, iSrcBitOffset,
+                    iSetBitSize );
    }
    return( iSetBitSize );
 }
@@ -930,22 +1378,25 @@ static UINT16 CopyValue( void* pxDst,
             break;
 
          case 2:
-            Copy16WithEndianSwap( pxDst, BitToOctetOffset( iDestBitOffset ),
-                                  pxSrc, BitToOctetOffset( iSrcBitOffset ),
-                                  iNumElem );
+            ABCC_PORT_Copy16WithEndianSwap(
+               pxDst, BitToOctetOffset( iDestBitOffset ),
+               pxSrc, BitToOctetOffset( iSrcBitOffset ),
+               iNumElem );
             break;
 
          case 4:
-            Copy32WithEndianSwap( pxDst, BitToOctetOffset( iDestBitOffset ),
-                                  pxSrc, BitToOctetOffset( iSrcBitOffset ),
-                                  iNumElem );
+            ABCC_PORT_Copy32WithEndianSwap(
+               pxDst, BitToOctetOffset( iDestBitOffset ),
+               pxSrc, BitToOctetOffset( iSrcBitOffset ),
+               iNumElem );
             break;
 
 #if( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
          case 8:
-            Copy64WithEndianSwap( pxDst, BitToOctetOffset( iDestBitOffset ),
-                                  pxSrc, BitToOctetOffset( iSrcBitOffset ),
-                                  iNumElem );
+            ABCC_PORT_Copy64WithEndianSwap(
+               pxDst, BitToOctetOffset( iDestBitOffset ),
+               pxSrc, BitToOctetOffset( iSrcBitOffset ),
+               iNumElem );
             break;
 #endif
          default:
@@ -1576,6 +2027,16 @@ static void SetAdiValue( const AD_AdiEntryType* psAdiEntry,
 {
    UINT16 iDestBitOffset;
 
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   if( fExplicit )
+   {
+      /*
+      ** The ADI may also be mapped as write process data.
+      */
+      MarkWrPdDirty( (UINT16)( psAdiEntry - ad_asADIEntryList ) );
+   }
+#endif
+
 #if( ABCC_CFG_STRUCT_DATA_TYPE_ENABLED )
    if( psAdiEntry->psStruct != NULL )
    {
@@ -1629,112 +2090,1219 @@ static void SetAdiValue( const AD_AdiEntryType* psAdiEntry,
                                  bNumElements,
                                  bStartIndex );
    }
-#endif
+#endif
+}
+
+/*------------------------------------------------------------------------------
+** Write to a buffer using data from a PD map.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pxDstPdDataBuf - Destination data buffer.
+**    piPdBitOffset  - Pointer to bit offset relative pxPdDataBuf.
+**                     This offset will be incremented according to the size
+**                     written to the buffer.
+**    pasPdMap       - Pointer to PD map.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void WriteBufferFromPdMap( void* pxDstPdDataBuf,
+                                  UINT16* piPdBitOffset,
+                                  ad_MapInfoType* pasPdMap )
+{
+   UINT16 iIndex;
+   const ad_MapType* paiPdMap = pasPdMap->paiMappedAdiList;
+
+   if( paiPdMap )
+   {
+      for( iIndex = 0; iIndex < pasPdMap->iNumMappedAdi; iIndex++ )
+      {
+         if( paiPdMap->iAdiIndex != AD_MAP_PAD_INDEX )
+         {
+            if( paiPdMap->iAdiIndex >= ad_iNumOfADIs )
+            {
+               /*
+               ** Pull the plug! The data in these tables should already have
+               ** been checked and should be OK!
+               */
+               ABCC_ERROR( ABCC_SEV_FATAL, ABCC_EC_ERROR_IN_WRITE_MAP_CONFIG, (UINT32)(paiPdMap->iAdiIndex) );
+            }
+            AD_GetAdiValue( &ad_asADIEntryList[ paiPdMap->iAdiIndex ],
+                            pxDstPdDataBuf,
+                            paiPdMap->bNumElements,
+                            paiPdMap->bStartIndex,
+                            piPdBitOffset,
+                            FALSE );
+         }
+         else
+         {
+            *piPdBitOffset += paiPdMap->bNumElements;
+         }
+
+         paiPdMap++;
+      }
+   }
+}
+
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+/*------------------------------------------------------------------------------
+** Write to the write process data buffer using data from the changed entries
+** of the write PD map. The remaining parts of the buffer are left untouched.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pxDstPdDataBuf - Destination data buffer.
+**    pabDirty       - Changed entries, see TakeWrPdDirty().
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void WriteBufferFromDirtyPdMap( void* pxDstPdDataBuf,
+                                       const UINT8* pabDirty )
+{
+   UINT16 iIndex;
+   UINT16 iPdBitOffset = 0;
+   const ad_MapType* paiPdMap = ad_WriteMapInfo.paiMappedAdiList;
+
+   for( iIndex = 0; iIndex < ad_WriteMapInfo.iNumMappedAdi; iIndex++ )
+   {
+      if( paiPdMap->iAdiIndex == AD_MAP_PAD_INDEX )
+      {
+         iPdBitOffset += paiPdMap->bNumElements;
+      }
+      else
+      {
+         if( paiPdMap->iAdiIndex >= ad_iNumOfADIs )
+         {
+            /*
+            ** Pull the plug! The data in these tables should already have
+            ** been checked and should be OK!
+            */
+            ABCC_ERROR( ABCC_SEV_FATAL, ABCC_EC_ERROR_IN_WRITE_MAP_CONFIG, (UINT32)(paiPdMap->iAdiIndex) );
+         }
+
+         if( IsWrPdDirty( pabDirty, iIndex, iIndex ) )
+         {
+            AD_GetAdiValue( &ad_asADIEntryList[ paiPdMap->iAdiIndex ],
+                            pxDstPdDataBuf,
+                            paiPdMap->bNumElements,
+                            paiPdMap->bStartIndex,
+                            &iPdBitOffset,
+                            FALSE );
+         }
+         else
+         {
+            iPdBitOffset += GetAdiSizeInBits( &ad_asADIEntryList[ paiPdMap->iAdiIndex ],
+                                              paiPdMap->bNumElements,
+                                              paiPdMap->bStartIndex );
+         }
+      }
+
+      paiPdMap++;
+   }
+}
+#endif
+
+/*------------------------------------------------------------------------------
+** Write to a PD map using data from a buffer.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pasPdMap       - Pointer to PD map.
+**    pxSrcPdDataBuf - Source data buffer.
+**    piPdBitOffset  - Pointer to bit offset relative pxPdDataBuf.
+**                     This offset will be incremented according to the size
+**                     read from the buffer.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void WritePdMapFromBuffer( const ad_MapInfoType* pasPdMap,
+                                  void* pxSrcPdDataBuf,
+                                  UINT16* piPdBitOffset )
+{
+   UINT16 iIndex;
+   const ad_MapType* paiPdMap = pasPdMap->paiMappedAdiList;
+
+   if( paiPdMap )
+   {
+      for( iIndex = 0; iIndex < pasPdMap->iNumMappedAdi; iIndex++ )
+      {
+         if( paiPdMap->iAdiIndex != AD_MAP_PAD_INDEX )
+         {
+            if( paiPdMap->iAdiIndex >= ad_iNumOfADIs )
+            {
+               /*
+               ** Pull the plug! The data in these tables should already have
+               ** been checked and should be OK!
+               */
+               ABCC_ERROR( ABCC_SEV_FATAL, ABCC_EC_ERROR_IN_READ_MAP_CONFIG, (UINT32)(paiPdMap->iAdiIndex) );
+            }
+            SetAdiValue( &ad_asADIEntryList[ paiPdMap->iAdiIndex ],
+                         pxSrcPdDataBuf,
+                         paiPdMap->bNumElements,
+                         paiPdMap->bStartIndex,
+                         piPdBitOffset,
+                         FALSE );
+         }
+         else
+         {
+            *piPdBitOffset += paiPdMap->bNumElements;
+         }
+
+         paiPdMap++;
+      }
+   }
+}
+
+#if( AD_PD_COPY_PLAN_ENABLE )
+/*------------------------------------------------------------------------------
+** Allocates the next operation in a copy plan being compiled. If the plan is
+** full the compilation fails and the map walk will be used for that
+** direction.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan            - Pointer to the copy plan.
+**
+** Returns:
+**    Pointer to the allocated operation, NULL if the plan is full or invalid.
+**------------------------------------------------------------------------------
+*/
+static ad_CopyOpType* AllocCopyOp( ad_CopyPlanType* psPlan )
+{
+   if( !psPlan->fCompileOk )
+   {
+      return( NULL );
+   }
+
+   if( psPlan->iNumOps >= psPlan->iMaxNumOps )
+   {
+      psPlan->fCompileOk = FALSE;
+      return( NULL );
+   }
+
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   psPlan->pasOps[ psPlan->iNumOps ].iFirstMapIndex = psPlan->iMapIndex;
+   psPlan->pasOps[ psPlan->iNumOps ].iLastMapIndex = psPlan->iMapIndex;
+#endif
+
+   return( &psPlan->pasOps[ psPlan->iNumOps++ ] );
+}
+
+/*------------------------------------------------------------------------------
+** Returns the size in octets of one element handled by an octet/swap copy
+** operation.
+**------------------------------------------------------------------------------
+*/
+static UINT8 GetCopyOpElemSize( UINT8 bOpCode )
+{
+   switch( bOpCode )
+   {
+   case AD_COPY_OP_SWAP16:
+      return( 2 );
+
+   case AD_COPY_OP_SWAP32:
+      return( 4 );
+
+   case AD_COPY_OP_SWAP64:
+      return( 8 );
+
+   default:
+      return( 1 );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Adds an octet or endian swap copy operation to a copy plan. If the data is
+** adjacent to the previous operation, both in the process data and in the
+** ADI memory, the previous operation is extended instead. With write process
+** data change tracking, write operations are only extended within the same
+** map entry, so that a partial update leaves unchanged entries untouched.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan            - Pointer to the copy plan.
+**    bOpCode           - AD_COPY_OP_OCTETS or AD_COPY_OP_SWAPxx.
+**    pxAdiData         - Base pointer to ADI data.
+**    iAdiBitOffset     - Bit offset relative pxAdiData.
+**    iPdBitOffset      - Bit offset relative the process data buffer.
+**    iNumElem          - Number of elements.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void AddOctetCopyOp( ad_CopyPlanType* psPlan,
+                            UINT8 bOpCode,
+                            void* pxAdiData,
+                            UINT16 iAdiBitOffset,
+                            UINT16 iPdBitOffset,
+                            UINT16 iNumElem )
+{
+   ad_CopyOpType* psOp;
+   UINT16 iNumOctets;
+   BOOL fAdjacent;
+
+   if( ( !psPlan->fCompileOk ) || ( iNumElem == 0 ) )
+   {
+      return;
+   }
+
+   if( psPlan->iNumOps > 0 )
+   {
+      psOp = &psPlan->pasOps[ psPlan->iNumOps - 1 ];
+
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+      if( ( psOp->bOpCode == bOpCode ) &&
+          ( ( psPlan != &ad_sWriteCopyPlan ) ||
+            ( psOp->iFirstMapIndex == psPlan->iMapIndex ) ) )
+#else
+      if( psOp->bOpCode == bOpCode )
+#endif
+      {
+         iNumOctets = psOp->iNumElem * GetCopyOpElemSize( bOpCode );
+
+#ifdef ABCC_SYS_16_BIT_CHAR
+         fAdjacent = ( psOp->pxAdiData == pxAdiData ) &&
+                     ( ( psOp->iAdiBitOffset + ( iNumOctets << 3 ) ) == iAdiBitOffset );
+#else
+         fAdjacent = ( ( (UINT8*)psOp->pxAdiData +
+                         BitToOctetOffset( psOp->iAdiBitOffset ) + iNumOctets ) ==
+                       ( (UINT8*)pxAdiData + BitToOctetOffset( iAdiBitOffset ) ) );
+#endif
+         if( fAdjacent &&
+             ( ( psOp->iPdBitOffset + ( iNumOctets << 3 ) ) == iPdBitOffset ) )
+         {
+            psOp->iNumElem += iNumElem;
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+            psOp->iLastMapIndex = psPlan->iMapIndex;
+#endif
+            return;
+         }
+      }
+   }
+
+   psOp = AllocCopyOp( psPlan );
+
+   if( psOp != NULL )
+   {
+      psOp->bOpCode = bOpCode;
+      psOp->bDataType = 0;
+      psOp->pxAdiData = pxAdiData;
+      psOp->iAdiBitOffset = iAdiBitOffset;
+      psOp->iPdBitOffset = iPdBitOffset;
+      psOp->iNumElem = iNumElem;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Adds the copy operation for a value (single element or parts of an array)
+** to a copy plan. The data type and endian swap is resolved here instead of
+** in each process data cycle, see CopyValue().
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan            - Pointer to the copy plan.
+**    pxAdiData         - Base pointer to ADI data.
+**    iAdiBitOffset     - Bit offset relative pxAdiData.
+**    iPdBitOffset      - Bit offset relative the process data buffer.
+**    bDataType         - Data type according to ABP_<X> types in abp.h
+**    iNumElem          - Number of elements.
+**
+** Returns:
+**    Size of the value in the process data in bits.
+**------------------------------------------------------------------------------
+*/
+static UINT16 AddValueCopyOp( ad_CopyPlanType* psPlan,
+                              void* pxAdiData,
+                              UINT16 iAdiBitOffset,
+                              UINT16 iPdBitOffset,
+                              UINT8 bDataType,
+                              UINT16 iNumElem )
+{
+   ad_CopyOpType* psOp;
+   UINT8 bDataTypeSizeInOctets;
+   UINT8 bOpCode;
+   UINT16 iNumCopyElem;
+
+   if( ABP_Is_PADx( bDataType ) )
+   {
+      /*
+      ** This is only a pad. No copy is done.
+      */
+      return( bDataType - ABP_PAD0 );
+   }
+
+   if( ABP_Is_BITx( bDataType ) || ( bDataType == ABP_BOOL1 ) )
+   {
+      if( iNumElem > 0 )
+      {
+         psOp = AllocCopyOp( psPlan );
+
+         if( psOp != NULL )
+         {
+            psOp->bOpCode = AD_COPY_OP_BITS;
+            psOp->bDataType = bDataType;
+            psOp->pxAdiData = pxAdiData;
+            psOp->iAdiBitOffset = iAdiBitOffset;
+            psOp->iPdBitOffset = iPdBitOffset;
+            psOp->iNumElem = iNumElem;
+         }
+      }
+
+      return( ABCC_GetDataTypeSizeInBits( bDataType ) * iNumElem );
+   }
+
+   bDataTypeSizeInOctets = ABCC_GetDataTypeSize( bDataType );
+   bOpCode = AD_COPY_OP_OCTETS;
+   iNumCopyElem = bDataTypeSizeInOctets * iNumElem;
+
+   if( ad_fDoNetworkEndianSwap )
+   {
+      switch( bDataTypeSizeInOctets )
+      {
+      case 1:
+         break;
+
+      case 2:
+         bOpCode = AD_COPY_OP_SWAP16;
+         iNumCopyElem = iNumElem;
+         break;
+
+      case 4:
+         bOpCode = AD_COPY_OP_SWAP32;
+         iNumCopyElem = iNumElem;
+         break;
+
+#if( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
+      case 8:
+         bOpCode = AD_COPY_OP_SWAP64;
+         iNumCopyElem = iNumElem;
+         break;
+#endif
+
+      default:
+         iNumCopyElem = 0;
+         break;
+      }
+   }
+
+   AddOctetCopyOp( psPlan, bOpCode, pxAdiData, iAdiBitOffset, iPdBitOffset,
+                   iNumCopyElem );
+
+   return( ( iNumElem * bDataTypeSizeInOctets ) << 3 );
+}
+
+#if( ABCC_CFG_ADI_GET_SET_CALLBACK_ENABLED )
+/*------------------------------------------------------------------------------
+** Adds a get/set callback notification to a copy plan.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan            - Pointer to the copy plan.
+**    bOpCode           - AD_COPY_OP_GET_CBF or AD_COPY_OP_SET_CBF.
+**    psAdiEntry        - Pointer to ADI entry.
+**    bNumElements      - Number of mapped elements.
+**    bStartIndex       - Index to first mapped element.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void AddCallbackOp( ad_CopyPlanType* psPlan,
+                           UINT8 bOpCode,
+                           const AD_AdiEntryType* psAdiEntry,
+                           UINT8 bNumElements,
+                           UINT8 bStartIndex )
+{
+   ad_CopyOpType* psOp;
+
+   psOp = AllocCopyOp( psPlan );
+
+   if( psOp != NULL )
+   {
+      psOp->bOpCode = bOpCode;
+      psOp->psAdiEntry = psAdiEntry;
+      psOp->bNumElements = bNumElements;
+      psOp->bStartIndex = bStartIndex;
+   }
+}
+#endif
+
+/*------------------------------------------------------------------------------
+** Writes the operations of a PD map into a copy plan. The result is equivalent
+** to what WriteBufferFromPdMap() (write direction) or WritePdMapFromBuffer()
+** (read direction) does with the same map. The plan must be in use by the
+** caller, see CompileCopyPlan().
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan         - Pointer to the copy plan to build.
+**    psMap          - Pointer to PD map.
+**    fWriteDir      - TRUE for the write process data direction.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void FillCopyPlan( ad_CopyPlanType* psPlan,
+                          const ad_MapInfoType* psMap,
+                          BOOL fWriteDir )
+{
+   const ad_MapType* psMapEntry;
+   const AD_AdiEntryType* psAdiEntry;
+   UINT16 iIndex;
+   UINT16 iPdBitOffset;
+
+   psPlan->iNumOps = 0;
+   psPlan->fCompileOk = ( psMap->paiMappedAdiList != NULL );
+   iPdBitOffset = 0;
+
+   for( iIndex = 0; ( iIndex < psMap->iNumMappedAdi ) && psPlan->fCompileOk; iIndex++ )
+   {
+      psMapEntry = &psMap->paiMappedAdiList[ iIndex ];
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+      psPlan->iMapIndex = iIndex;
+#endif
+
+      if( psMapEntry->iAdiIndex == AD_MAP_PAD_INDEX )
+      {
+         iPdBitOffset += psMapEntry->bNumElements;
+         continue;
+      }
+
+      if( psMapEntry->iAdiIndex >= ad_iNumOfADIs )
+      {
+         /*
+         ** Leave the error reporting to the map walk.
+         */
+         psPlan->fCompileOk = FALSE;
+         break;
+      }
+
+      psAdiEntry = &ad_asADIEntryList[ psMapEntry->iAdiIndex ];
+
+#if( ABCC_CFG_ADI_GET_SET_CALLBACK_ENABLED )
+      if( fWriteDir && ( psAdiEntry->pnGetAdiValue != NULL ) )
+      {
+         AddCallbackOp( psPlan, AD_COPY_OP_GET_CBF, psAdiEntry,
+                        psMapEntry->bNumElements, psMapEntry->bStartIndex );
+      }
+#else
+      (void)fWriteDir;
+#endif
+
+#if( ABCC_CFG_STRUCT_DATA_TYPE_ENABLED )
+      if( psAdiEntry->psStruct != NULL )
+      {
+         UINT16 i;
+
+         for( i = psMapEntry->bStartIndex;
+              i < ( psMapEntry->bNumElements + psMapEntry->bStartIndex );
+              i++ )
+         {
+            iPdBitOffset += AddValueCopyOp( psPlan,
+                                            psAdiEntry->psStruct[ i ].uData.sVOID.pxValuePtr,
+                                            psAdiEntry->psStruct[ i ].bBitOffset,
+                                            iPdBitOffset,
+                                            psAdiEntry->psStruct[ i ].bDataType,
+                                            psAdiEntry->psStruct[ i ].iNumSubElem );
+         }
+      }
+      else
+#endif
+      {
+         iPdBitOffset += AddValueCopyOp( psPlan,
+                                         psAdiEntry->uData.sVOID.pxValuePtr,
+                                         CalcStartIndexBitOffset( psAdiEntry->bDataType,
+                                                                  psMapEntry->bStartIndex ),
+                                         iPdBitOffset,
+                                         psAdiEntry->bDataType,
+                                         psMapEntry->bNumElements );
+      }
+
+#if( ABCC_CFG_ADI_GET_SET_CALLBACK_ENABLED )
+      if( ( !fWriteDir ) && ( psAdiEntry->pnSetAdiValue != NULL ) )
+      {
+         AddCallbackOp( psPlan, AD_COPY_OP_SET_CBF, psAdiEntry,
+                        psMapEntry->bNumElements, psMapEntry->bStartIndex );
+      }
+#endif
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Fills a copy plan the caller has marked in use, refilling it as long as a
+** rebuild is requested meanwhile. The plan is then made valid (if the map
+** could be held) and released.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan         - Pointer to the copy plan to build.
+**    psMap          - Pointer to PD map.
+**    fWriteDir      - TRUE for the write process data direction.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void RebuildCopyPlan( ad_CopyPlanType* psPlan,
+                             const ad_MapInfoType* psMap,
+                             BOOL fWriteDir )
+{
+   BOOL fRebuild;
+   ABCC_PORT_UseCritical();
+
+   do
+   {
+      FillCopyPlan( psPlan, psMap, fWriteDir );
+
+      ABCC_PORT_EnterCritical();
+      fRebuild = psPlan->fRebuild;
+      psPlan->fRebuild = FALSE;
+      if( !fRebuild )
+      {
+         psPlan->fValid = psPlan->fCompileOk;
+         psPlan->fInUse = FALSE;
+      }
+      ABCC_PORT_ExitCritical();
+   }
+   while( fRebuild );
+}
+
+/*------------------------------------------------------------------------------
+** Compiles a PD map into a copy plan.
+** The plan is invalid while it is compiled and only becomes valid once the
+** last operation is written, a process data update in another context uses
+** the map walk meanwhile. A plan that is in use by a process data update or
+** compilation that this call has interrupted is not touched. The rebuild is
+** then made by that context when it is done with the plan.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan         - Pointer to the copy plan to build.
+**    psMap          - Pointer to PD map.
+**    fWriteDir      - TRUE for the write process data direction.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void CompileCopyPlan( ad_CopyPlanType* psPlan,
+                             const ad_MapInfoType* psMap,
+                             BOOL fWriteDir )
+{
+   BOOL fInUse;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   psPlan->fValid = FALSE;
+   fInUse = psPlan->fInUse;
+   if( fInUse )
+   {
+      psPlan->fRebuild = TRUE;
+   }
+   else
+   {
+      psPlan->fInUse = TRUE;
+   }
+   ABCC_PORT_ExitCritical();
+
+   if( !fInUse )
+   {
+      RebuildCopyPlan( psPlan, psMap, fWriteDir );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Takes a copy plan for execution if it is valid. The validity check and
+** marking the plan in use are atomic with respect to CompileCopyPlan(), which
+** then leaves the plan alone until ReleaseCopyPlan() is called.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan         - Pointer to the copy plan.
+**
+** Returns:
+**    TRUE if the plan is valid and may be executed. If FALSE the map walk
+**    shall be used.
+**------------------------------------------------------------------------------
+*/
+static BOOL AcquireCopyPlan( ad_CopyPlanType* psPlan )
+{
+   BOOL fValid;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   fValid = psPlan->fValid;
+   if( fValid )
+   {
+      psPlan->fInUse = TRUE;
+   }
+   ABCC_PORT_ExitCritical();
+
+   return( fValid );
+}
+
+/*------------------------------------------------------------------------------
+** Releases a copy plan taken with AcquireCopyPlan() and makes a rebuild that
+** was requested meanwhile.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan         - Pointer to the copy plan.
+**    psMap          - Pointer to the PD map of the plan.
+**    fWriteDir      - TRUE for the write process data direction.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void ReleaseCopyPlan( ad_CopyPlanType* psPlan,
+                             const ad_MapInfoType* psMap,
+                             BOOL fWriteDir )
+{
+   BOOL fRebuild;
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   fRebuild = psPlan->fRebuild;
+   psPlan->fRebuild = FALSE;
+   if( !fRebuild )
+   {
+      psPlan->fInUse = FALSE;
+   }
+   ABCC_PORT_ExitCritical();
+
+   if( fRebuild )
+   {
+      /*
+      ** Still in use, RebuildCopyPlan() releases it.
+      */
+      RebuildCopyPlan( psPlan, psMap, fWriteDir );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Executes a copy plan.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psPlan         - Pointer to the copy plan.
+**    pxPdDataBuf    - Process data buffer.
+**    fWriteDir      - TRUE to copy from the ADIs to pxPdDataBuf (write
+**                     process data), FALSE to copy from pxPdDataBuf to the
+**                     ADIs (read process data).
+**    pabDirty       - Changed write map entries, see TakeWrPdDirty(). Only
+**                     operations covering a changed entry are executed. NULL
+**                     executes all operations.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void ExecCopyPlan( const ad_CopyPlanType* psPlan,
+                          void* pxPdDataBuf,
+                          BOOL fWriteDir,
+                          const UINT8* pabDirty )
+{
+   const ad_CopyOpType* psOp;
+   const ad_CopyOpType* psEndOp;
+   void* pxDest;
+   const void* pxSrc;
+   UINT16 iDestBitOffset;
+   UINT16 iSrcBitOffset;
+
+   psOp = psPlan->pasOps;
+   psEndOp = &psPlan->pasOps[ psPlan->iNumOps ];
+
+   for( ; psOp < psEndOp; psOp++ )
+   {
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+      if( ( pabDirty != NULL ) &&
+          !IsWrPdDirty( pabDirty, psOp->iFirstMapIndex, psOp->iLastMapIndex ) )
+      {
+         continue;
+      }
+#else
+      (void)pabDirty;
+#endif
+
+      if( fWriteDir )
+      {
+         pxDest = pxPdDataBuf;
+         iDestBitOffset = psOp->iPdBitOffset;
+         pxSrc = psOp->pxAdiData;
+         iSrcBitOffset = psOp->iAdiBitOffset;
+      }
+      else
+      {
+         pxDest = psOp->pxAdiData;
+         iDestBitOffset = psOp->iAdiBitOffset;
+         pxSrc = pxPdDataBuf;
+         iSrcBitOffset = psOp->iPdBitOffset;
+      }
+
+      switch( psOp->bOpCode )
+      {
+      case AD_COPY_OP_OCTETS:
+         ABCC_PORT_CopyOctets( pxDest, BitToOctetOffset( iDestBitOffset ),
+                               pxSrc, BitToOctetOffset( iSrcBitOffset ),
+                               psOp->iNumElem );
+         break;
+
+      case AD_COPY_OP_SWAP16:
+         ABCC_PORT_Copy16WithEndianSwap(
+            pxDest, BitToOctetOffset( iDestBitOffset ),
+            pxSrc, BitToOctetOffset( iSrcBitOffset ),
+            psOp->iNumElem );
+         break;
+
+      case AD_COPY_OP_SWAP32:
+         ABCC_PORT_Copy32WithEndianSwap(
+            pxDest, BitToOctetOffset( iDestBitOffset ),
+            pxSrc, BitToOctetOffset( iSrcBitOffset ),
+            psOp->iNumElem );
+         break;
+
+#if( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
+      case AD_COPY_OP_SWAP64:
+         ABCC_PORT_Copy64WithEndianSwap(
+            pxDest, BitToOctetOffset( iDestBitOffset ),
+            pxSrc, BitToOctetOffset( iSrcBitOffset ),
+            psOp->iNumElem );
+         break;
+#endif
+
+      case AD_COPY_OP_BITS:
+         (void)CopyBitData( pxDest, iDestBitOffset,
+                            pxSrc, iSrcBitOffset,
+                            psOp->bDataType, psOp->iNumElem );
+         break;
+
+#if( ABCC_CFG_ADI_GET_SET_CALLBACK_ENABLED )
+      case AD_COPY_OP_GET_CBF:
+         psOp->psAdiEntry->pnGetAdiValue( psOp->psAdiEntry,
+                                          psOp->bNumElements,
+                                          psOp->bStartIndex );
+         break;
+
+      case AD_COPY_OP_SET_CBF:
+         psOp->psAdiEntry->pnSetAdiValue( psOp->psAdiEntry,
+                                          psOp->bNumElements,
+                                          psOp->bStartIndex );
+         break;
+#endif
+
+      default:
+         break;
+      }
+   }
+}
+
+/*------------------------------------------------------------------------------
+** (Re)builds the read and write copy plans from the present PD maps.
+**------------------------------------------------------------------------------
+*/
+static void BuildCopyPlans( void )
+{
+   CompileCopyPlan( &ad_sReadCopyPlan, &ad_ReadMapInfo, FALSE );
+   CompileCopyPlan( &ad_sWriteCopyPlan, &ad_WriteMapInfo, TRUE );
+}
+#endif
+
+/*------------------------------------------------------------------------------
+** Counts the ADIs of each Get_Instance_Numbers list and, if enabled and there
+** is room, builds the ordinal lists.
+**------------------------------------------------------------------------------
+*/
+static void BuildOrdinalLists( void )
+{
+   UINT16 iAdiIndex;
+   UINT8  bList;
+   UINT8  bDesc;
+#if( AD_ORDINAL_LIST_SIZE > 0 )
+   UINT32 lTotal;
+   UINT16 aiPos[ AD_NUM_LISTS ];
+#endif
+
+   for( bList = 0; bList < AD_NUM_LISTS; bList++ )
+   {
+      ad_aiNumInList[ bList ] = 0;
+   }
+
+   for( iAdiIndex = 0; iAdiIndex < ad_iNumOfADIs; iAdiIndex++ )
+   {
+      bDesc = ad_asADIEntryList[ iAdiIndex ].bDesc;
+      for( bList = 0; bList < AD_NUM_LISTS; bList++ )
+      {
+         if( ( ad_abListDescrMask[ bList ] == 0 ) ||
+             ( bDesc & ad_abListDescrMask[ bList ] ) )
+         {
+            ad_aiNumInList[ bList ]++;
+         }
+      }
+   }
+
+#if( AD_ORDINAL_LIST_SIZE > 0 )
+   lTotal = 0;
+   for( bList = 0; bList < AD_NUM_LISTS; bList++ )
+   {
+      ad_aiOrdinalListStart[ bList ] = (UINT16)lTotal;
+      aiPos[ bList ] = (UINT16)lTotal;
+      lTotal += ad_aiNumInList[ bList ];
+   }
+
+   ad_fOrdinalListValid = ( lTotal <= AD_ORDINAL_LIST_SIZE );
+   if( !ad_fOrdinalListValid )
+   {
+      return;
+   }
+
+   for( iAdiIndex = 0; iAdiIndex < ad_iNumOfADIs; iAdiIndex++ )
+   {
+      bDesc = ad_asADIEntryList[ iAdiIndex ].bDesc;
+      for( bList = 0; bList < AD_NUM_LISTS; bList++ )
+      {
+         if( ( ad_abListDescrMask[ bList ] == 0 ) ||
+             ( bDesc & ad_abListDescrMask[ bList ] ) )
+         {
+            ad_aiOrdinalList[ aiPos[ bList ]++ ] =
+               iTOiLe( ad_asADIEntryList[ iAdiIndex ].iInstance );
+         }
+      }
+   }
+#endif
+}
+
+#if( AD_SEG_VALUE_ENABLE )
+/*------------------------------------------------------------------------------
+** Checks if the value of an ADI can be sent straight from the ADI storage,
+** i.e. it is not a structure or a bit type and needs no endian swap.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psAdiEntry        - Pointer to ADI entry.
+**
+** Returns:
+**    TRUE if the ADI storage can be sent as is.
+**------------------------------------------------------------------------------
+*/
+static BOOL IsSegGetDirect( const AD_AdiEntryType* psAdiEntry )
+{
+#if( ABCC_CFG_STRUCT_DATA_TYPE_ENABLED )
+   if( psAdiEntry->psStruct != NULL )
+   {
+      return( FALSE );
+   }
+#endif
+
+   if( Is_BITx_Or_PADx( psAdiEntry->bDataType ) ||
+       ( psAdiEntry->bDataType == ABP_BOOL1 ) )
+   {
+      return( FALSE );
+   }
+
+   return( !ad_fDoNetworkEndianSwap ||
+           ( ABCC_GetDataTypeSize( psAdiEntry->bDataType ) == 1 ) );
+}
+
+/*------------------------------------------------------------------------------
+** Calculates how many elements, starting at bStartIndex, fit in one
+** ad_alSegGetBlock block. A block must end on an octet boundary unless it
+** ends with the last element of the ADI.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psAdiEntry        - Pointer to ADI entry.
+**    bStartIndex       - First element of the block.
+**
+** Returns:
+**    Number of elements. 0 if no block boundary can be found.
+**------------------------------------------------------------------------------
+*/
+static UINT8 GetSegGetBlockNumElem( const AD_AdiEntryType* psAdiEntry,
+                                    UINT8 bStartIndex )
+{
+   UINT32 lBits;
+   UINT8 bNumElem;
+   UINT8 bBlockNumElem;
+
+   lBits = 0;
+   bNumElem = 0;
+   bBlockNumElem = 0;
+
+   while( ( bStartIndex + bNumElem ) < psAdiEntry->bNumOfElements )
+   {
+      lBits += GetAdiSizeInBits( psAdiEntry, 1, (UINT8)( bStartIndex + bNumElem ) );
+      if( lBits > ( (UINT32)AD_SEG_GET_BLOCK_SIZE * 8 ) )
+      {
+         break;
+      }
+
+      bNumElem++;
+      if( ( ( lBits & 7 ) == 0 ) ||
+          ( ( bStartIndex + bNumElem ) == psAdiEntry->bNumOfElements ) )
+      {
+         bBlockNumElem = bNumElem;
+      }
+   }
+
+   return( bBlockNumElem );
+}
+
+/*------------------------------------------------------------------------------
+** Segmentation callback providing the next block of a segmented ADI value.
+** See ABCC_SegMsgHandlerNextBlockFuncType.
+**------------------------------------------------------------------------------
+*/
+static UINT8* GetNextSegGetBlock( void* pxObject, UINT32* plSize )
+{
+   ad_SegGetType* psSegGet;
+   const AD_AdiEntryType* psAdiEntry;
+   UINT16 iBitOffset;
+   UINT16 iSize;
+   UINT8 bNumElem;
+   UINT8 bZero;
+
+   psSegGet = (ad_SegGetType*)pxObject;
+   psAdiEntry = psSegGet->psAdiEntry;
+
+   if( psSegGet->bNextElem >= psAdiEntry->bNumOfElements )
+   {
+      return( NULL );
+   }
+
+   if( IsSegGetDirect( psAdiEntry ) )
+   {
+#if( ABCC_CFG_ADI_GET_SET_CALLBACK_ENABLED )
+      if( psAdiEntry->pnGetAdiValue != NULL )
+      {
+         psAdiEntry->pnGetAdiValue( psAdiEntry,
+                                    psAdiEntry->bNumOfElements,
+                                    0 );
+      }
+#endif
+      psSegGet->bNextElem = psAdiEntry->bNumOfElements;
+      *plSize = GetAdiSizeInOctets( psAdiEntry );
+
+      return( (UINT8*)psAdiEntry->uData.sVOID.pxValuePtr );
+   }
+
+   bNumElem = GetSegGetBlockNumElem( psAdiEntry, psSegGet->bNextElem );
+
+   /*
+   ** Bit types only update their own bits, clear the last octet of the block.
+   */
+   iSize = SizeInOctets( 0, GetAdiSizeInBits( psAdiEntry, bNumElem,
+                                              psSegGet->bNextElem ) );
+   bZero = 0;
+   ABCC_PORT_CopyOctets( ad_alSegGetBlock, iSize - 1, &bZero, 0, 1 );
+
+   iBitOffset = 0;
+   AD_GetAdiValue( psAdiEntry, ad_alSegGetBlock, bNumElem,
+                   psSegGet->bNextElem, &iBitOffset, TRUE );
+
+   psSegGet->bNextElem += bNumElem;
+   *plSize = iSize;
+
+   return( (UINT8*)ad_alSegGetBlock );
+}
+
+/*------------------------------------------------------------------------------
+** Segmentation callback called when a segmented ADI value has been sent.
+** See ABCC_SegMsgHandlerDoneFuncType.
+**------------------------------------------------------------------------------
+*/
+static void SegGetDone( void* pxObject )
+{
+   ( (ad_SegGetType*)pxObject )->psAdiEntry = NULL;
+}
+
+/*------------------------------------------------------------------------------
+** Starts a segmented Get_Attribute response of an ADI value. On success the
+** first segment is sent in a new message buffer and the request is not to be
+** responded to.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psAdiEntry        - Pointer to ADI entry.
+**    psMsgBuffer       - Pointer to the Get_Attribute request.
+**
+** Returns:
+**    ABP_ERR_NO_ERROR if the response was started, otherwise the error code to
+**    respond with.
+**------------------------------------------------------------------------------
+*/
+static UINT8 StartSegGet( const AD_AdiEntryType* psAdiEntry,
+                          ABP_MsgType* psMsgBuffer )
+{
+   UINT8 bElem;
+   UINT8 bNumElem;
+
+   if( ad_sSegGet.psAdiEntry != NULL )
+   {
+      return( ABP_ERR_NO_RESOURCES );
+   }
+
+   if( !IsSegGetDirect( psAdiEntry ) )
+   {
+      /*
+      ** Make sure the value can be split into blocks before anything is sent.
+      */
+      bElem = 0;
+      while( bElem < psAdiEntry->bNumOfElements )
+      {
+         bNumElem = GetSegGetBlockNumElem( psAdiEntry, bElem );
+         if( bNumElem == 0 )
+         {
+            return( ABP_ERR_MSG_CHANNEL_TOO_SMALL );
+         }
+         bElem += bNumElem;
+      }
+   }
+
+   ad_sSegGet.psAdiEntry = psAdiEntry;
+   ad_sSegGet.bNextElem = 0;
+
+   if( ABCC_StartServerRespSegmentationSession( &psMsgBuffer->sHeader,
+                                                ABCC_GetMsgCmdExt0( psMsgBuffer ),
+                                                NULL,
+                                                0,
+                                                GetNextSegGetBlock,
+                                                SegGetDone,
+                                                &ad_sSegGet ) != ABCC_EC_NO_ERROR )
+   {
+      ad_sSegGet.psAdiEntry = NULL;
+
+      return( ABP_ERR_NO_RESOURCES );
+   }
+
+   return( ABP_ERR_NO_ERROR );
 }
 
+#if( AD_SEG_SET_BUFFER_SIZE > 0 )
 /*------------------------------------------------------------------------------
-** Write to a buffer using data from a PD map.
+** Adds a segment of a segmented Set_Attribute request of an ADI value to
+** ad_alSegSetBuffer. An abort discards the collected segments.
 **------------------------------------------------------------------------------
 ** Arguments:
-**    pxDstPdDataBuf - Destination data buffer.
-**    piPdBitOffset  - Pointer to bit offset relative pxPdDataBuf.
-**                     This offset will be incremented according to the size
-**                     written to the buffer.
-**    pasPdMap       - Pointer to PD map.
+**    psAdiEntry        - Pointer to ADI entry.
+**    psMsgBuffer       - Pointer to the Set_Attribute segment.
+**    pfLast            - Set to TRUE when the last segment has been added and
+**                        the complete value is in ad_alSegSetBuffer.
 **
 ** Returns:
-**    None
+**    ABP_ERR_NO_ERROR or the error code to respond with.
 **------------------------------------------------------------------------------
 */
-static void WriteBufferFromPdMap( void* pxDstPdDataBuf,
-                                  UINT16* piPdBitOffset,
-                                  ad_MapInfoType* pasPdMap )
+static UINT8 AddSegSetSegment( const AD_AdiEntryType* psAdiEntry,
+                               ABP_MsgType* psMsgBuffer,
+                               BOOL* pfLast )
 {
-   UINT16 iIndex;
-   const ad_MapType* paiPdMap = pasPdMap->paiMappedAdiList;
+   UINT8 bCmdExt1;
+   UINT16 iSize;
 
-   if( paiPdMap )
+   bCmdExt1 = ABCC_GetMsgCmdExt1( psMsgBuffer );
+   iSize = iLeTOi( psMsgBuffer->sHeader.iDataSize );
+   *pfLast = FALSE;
+
+   if( bCmdExt1 & ABP_MSG_CMDEXT1_SEG_ABORT )
    {
-      for( iIndex = 0; iIndex < pasPdMap->iNumMappedAdi; iIndex++ )
+      ad_sSegSet.psAdiEntry = NULL;
+
+      return( ABP_ERR_NO_ERROR );
+   }
+
+   if( bCmdExt1 & ABP_MSG_CMDEXT1_SEG_FIRST )
+   {
+      if( GetAdiSizeInOctets( psAdiEntry ) > AD_SEG_SET_BUFFER_SIZE )
       {
-         if( paiPdMap->iAdiIndex != AD_MAP_PAD_INDEX )
-         {
-            if( paiPdMap->iAdiIndex >= ad_iNumOfADIs )
-            {
-               /*
-               ** Pull the plug! The data in these tables should already have
-               ** been checked and should be OK!
-               */
-               ABCC_ERROR( ABCC_SEV_FATAL, ABCC_EC_ERROR_IN_WRITE_MAP_CONFIG, (UINT32)(paiPdMap->iAdiIndex) );
-            }
-            AD_GetAdiValue( &ad_asADIEntryList[ paiPdMap->iAdiIndex ],
-                            pxDstPdDataBuf,
-                            paiPdMap->bNumElements,
-                            paiPdMap->bStartIndex,
-                            piPdBitOffset,
-                            FALSE );
-         }
-         else
-         {
-            *piPdBitOffset += paiPdMap->bNumElements;
-         }
+         ad_sSegSet.psAdiEntry = NULL;
 
-         paiPdMap++;
+         return( ABP_ERR_NO_RESOURCES );
       }
+
+      ad_sSegSet.psAdiEntry = psAdiEntry;
+      ad_sSegSet.iSize = 0;
+   }
+   else if( ad_sSegSet.psAdiEntry != psAdiEntry )
+   {
+      return( ABP_ERR_INV_STATE );
+   }
+
+   if( ( (UINT32)ad_sSegSet.iSize + iSize ) > GetAdiSizeInOctets( psAdiEntry ) )
+   {
+      ad_sSegSet.psAdiEntry = NULL;
+
+      return( ABP_ERR_TOO_MUCH_DATA );
+   }
+
+   ABCC_PORT_CopyOctets( ad_alSegSetBuffer, ad_sSegSet.iSize,
+                         ABCC_GetMsgDataPtr( psMsgBuffer ), 0, iSize );
+   ad_sSegSet.iSize += iSize;
+
+   if( bCmdExt1 & ABP_MSG_CMDEXT1_SEG_LAST )
+   {
+      ad_sSegSet.psAdiEntry = NULL;
+      *pfLast = TRUE;
+   }
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   else
+   {
+      ad_sSegSet.lTmoDeadlineMs = (UINT32)ABCC_GetUptimeMs() +
+                                  ABCC_CFG_SEG_SESSION_TMO_MS;
    }
+#endif
+
+   return( ABP_ERR_NO_ERROR );
 }
 
 /*------------------------------------------------------------------------------
-** Write to a PD map using data from a buffer.
+** Checks if a Set_Attribute request of an ADI value is a segment of a
+** segmented request. Segments in the middle of a segmented request have no
+** segmentation bits set, just like an unsegmented request. A request without
+** segmentation bits is therefore only taken as a segment while a segmented
+** request of the same ADI is in progress. A request in progress is abandoned
+** if it has timed out, or if the data would not fit in the ADI as a segment,
+** since the module then no longer continues it.
 **------------------------------------------------------------------------------
 ** Arguments:
-**    pasPdMap       - Pointer to PD map.
-**    pxSrcPdDataBuf - Source data buffer.
-**    piPdBitOffset  - Pointer to bit offset relative pxPdDataBuf.
-**                     This offset will be incremented according to the size
-**                     read from the buffer.
+**    psAdiEntry        - Pointer to ADI entry.
+**    psMsgBuffer       - Pointer to the Set_Attribute request.
 **
 ** Returns:
-**    None
+**    TRUE if the request is a segment.
 **------------------------------------------------------------------------------
 */
-static void WritePdMapFromBuffer( const ad_MapInfoType* pasPdMap,
-                                  void* pxSrcPdDataBuf,
-                                  UINT16* piPdBitOffset )
+static BOOL IsSegSetSegment( const AD_AdiEntryType* psAdiEntry,
+                             ABP_MsgType* psMsgBuffer )
 {
-   UINT16 iIndex;
-   const ad_MapType* paiPdMap = pasPdMap->paiMappedAdiList;
+   if( ABCC_GetMsgCmdExt1( psMsgBuffer ) &
+       ( ABP_MSG_CMDEXT1_SEG_FIRST |
+         ABP_MSG_CMDEXT1_SEG_LAST |
+         ABP_MSG_CMDEXT1_SEG_ABORT ) )
+   {
+      return( TRUE );
+   }
 
-   if( paiPdMap )
+   if( ad_sSegSet.psAdiEntry != psAdiEntry )
    {
-      for( iIndex = 0; iIndex < pasPdMap->iNumMappedAdi; iIndex++ )
-      {
-         if( paiPdMap->iAdiIndex != AD_MAP_PAD_INDEX )
-         {
-            if( paiPdMap->iAdiIndex >= ad_iNumOfADIs )
-            {
-               /*
-               ** Pull the plug! The data in these tables should already have
-               ** been checked and should be OK!
-               */
-               ABCC_ERROR( ABCC_SEV_FATAL, ABCC_EC_ERROR_IN_READ_MAP_CONFIG, (UINT32)(paiPdMap->iAdiIndex) );
-            }
-            SetAdiValue( &ad_asADIEntryList[ paiPdMap->iAdiIndex ],
-                         pxSrcPdDataBuf,
-                         paiPdMap->bNumElements,
-                         paiPdMap->bStartIndex,
-                         piPdBitOffset,
-                         FALSE );
-         }
-         else
-         {
-            *piPdBitOffset += paiPdMap->bNumElements;
-         }
+      return( FALSE );
+   }
 
-         paiPdMap++;
-      }
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   if( (INT32)( (UINT32)ABCC_GetUptimeMs() - ad_sSegSet.lTmoDeadlineMs ) >= 0 )
+   {
+      ad_sSegSet.psAdiEntry = NULL;
+
+      return( FALSE );
+   }
+#endif
+
+   if( ( ad_sSegSet.iSize > 0 ) &&
+       ( ( (UINT32)ad_sSegSet.iSize + iLeTOi( psMsgBuffer->sHeader.iDataSize ) ) >
+         GetAdiSizeInOctets( psAdiEntry ) ) )
+   {
+      ad_sSegSet.psAdiEntry = NULL;
+
+      return( FALSE );
    }
+
+   return( TRUE );
 }
+#endif
+#endif
+
 EXTFUNC APPL_ErrCodeType AD_Init( const AD_AdiEntryType* psAdiEntry,
                                   UINT16 iNumAdi,
                                   const AD_MapType* psDefaultMap )
@@ -1753,8 +3321,35 @@ EXTFUNC APPL_ErrCodeType AD_Init( const AD_AdiEntryType* psAdiEntry,
    ad_iNumOfADIs =  iNumAdi;
    ad_iHighestInstanceNumber = 0;
 
+#if( AD_SEG_VALUE_ENABLE )
+   ad_sSegGet.psAdiEntry = NULL;
+#if( AD_SEG_SET_BUFFER_SIZE > 0 )
+   ad_sSegSet.psAdiEntry = NULL;
+#endif
+#endif
+
+   ABCC_AdiIndexBuild( ad_asADIEntryList, ad_iNumOfADIs );
+
    ad_ReadMapInfo.paiMappedAdiList = ad_PdReadMapping;
    ad_ReadMapInfo.iPdSize = 0;
+
+#if( AD_PD_COPY_PLAN_ENABLE )
+   ad_sReadCopyPlan.pasOps = ad_asReadCopyOps;
+   ad_sReadCopyPlan.iMaxNumOps = AD_MAX_NUM_READ_COPY_OPS;
+   ad_sReadCopyPlan.iNumOps = 0;
+   ad_sReadCopyPlan.fValid = FALSE;
+   ad_sReadCopyPlan.fInUse = FALSE;
+   ad_sReadCopyPlan.fRebuild = FALSE;
+   ad_sReadCopyPlan.fCompileOk = FALSE;
+
+   ad_sWriteCopyPlan.pasOps = ad_asWriteCopyOps;
+   ad_sWriteCopyPlan.iMaxNumOps = AD_MAX_NUM_WRITE_COPY_OPS;
+   ad_sWriteCopyPlan.iNumOps = 0;
+   ad_sWriteCopyPlan.fValid = FALSE;
+   ad_sWriteCopyPlan.fInUse = FALSE;
+   ad_sWriteCopyPlan.fRebuild = FALSE;
+   ad_sWriteCopyPlan.fCompileOk = FALSE;
+#endif
    ad_ReadMapInfo.iNumMappedAdi = 0;
    ad_ReadMapInfo.iMaxNumMappedAdi = AD_MAX_NUM_READ_MAP_ENTRIES;
 
@@ -1855,6 +3450,14 @@ EXTFUNC APPL_ErrCodeType AD_Init( const AD_AdiEntryType* psAdiEntry,
       }
    }
 
+#if( AD_PD_COPY_PLAN_ENABLE )
+   BuildCopyPlans();
+#endif
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   ResetWrPdDirty();
+#endif
+   BuildOrdinalLists();
+
    return( APPL_NO_ERROR );
 }
 
@@ -1953,6 +3556,11 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
    UINT16 iTemp;
    UINT16 iDataSize;
    UINT8  bErrCode;
+#if( AD_SEG_VALUE_ENABLE && ( AD_SEG_SET_BUFFER_SIZE > 0 ) )
+   BOOL   fLastSeg;
+#endif
+   void*  pxSetData;
+   UINT16 iSetSize;
 
    iMsgBitOffset = 0;
    iDataSize = 0;
@@ -1989,54 +3597,18 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
             break;
 
          case ABP_APPD_OA_NR_READ_PD_MAPPABLE_INSTANCES:
-            {
-               UINT16 iIndex;
-               UINT16 iCnt = 0;
-
-               for( iIndex = 0; iIndex < ad_iNumOfADIs; iIndex++ )
-               {
-                  if( ad_asADIEntryList[iIndex ].bDesc & ABP_APPD_DESCR_MAPPABLE_READ_PD )
-                  {
-                     iCnt++;
-                  }
-               }
-               ABCC_SetMsgData16( psMsgBuffer, iCnt, 0 );
-               iDataSize = ABP_UINT16_SIZEOF;
-            }
+            ABCC_SetMsgData16( psMsgBuffer, ad_aiNumInList[ AD_LIST_RD_PD_MAPPABLE ], 0 );
+            iDataSize = ABP_UINT16_SIZEOF;
             break;
 
          case ABP_APPD_OA_NR_WRITE_PD_MAPPABLE_INSTANCES:
-            {
-               UINT16 iIndex;
-               UINT16 iCnt = 0;
-
-               for( iIndex = 0; iIndex < ad_iNumOfADIs; iIndex++ )
-               {
-                  if( ad_asADIEntryList[ iIndex ].bDesc & ABP_APPD_DESCR_MAPPABLE_WRITE_PD )
-                  {
-                     iCnt++;
-                  }
-               }
-               ABCC_SetMsgData16( psMsgBuffer, iCnt, 0 );
-               iDataSize = ABP_UINT16_SIZEOF;
-            }
+            ABCC_SetMsgData16( psMsgBuffer, ad_aiNumInList[ AD_LIST_WR_PD_MAPPABLE ], 0 );
+            iDataSize = ABP_UINT16_SIZEOF;
             break;
 
          case ABP_APPD_OA_NR_NV_INSTANCES:
-            {
-               UINT16 iIndex;
-               UINT16 iCnt = 0;
-
-               for( iIndex = 0; iIndex < ad_iNumOfADIs; iIndex++ )
-               {
-                  if( ad_asADIEntryList[ iIndex ].bDesc & ABP_APPD_DESCR_NVS_PARAMETER )
-                  {
-                     iCnt++;
-                  }
-               }
-               ABCC_SetMsgData16( psMsgBuffer, iCnt, 0 );
-               iDataSize = ABP_UINT16_SIZEOF;
-            }
+            ABCC_SetMsgData16( psMsgBuffer, ad_aiNumInList[ AD_LIST_NVS_PARAMS ], 0 );
+            iDataSize = ABP_UINT16_SIZEOF;
             break;
 
          default:
@@ -2083,9 +3655,10 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
       {
          UINT16 iStartingOrder;
          UINT16 iReqInstances;
+         UINT16 iNumInstances;
          UINT16 iAdiIndex;
          UINT16 iLocalOrder;
-         UINT8  bDescrMask = 0;
+         UINT8  bList = AD_LIST_ALL;
 
          if( ABCC_GetMsgCmdExt0( psMsgBuffer ) != 0 )
          {
@@ -2099,15 +3672,15 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
             break;
 
          case ABP_APPD_LIST_TYPE_RD_PD_MAPPABLE:
-            bDescrMask = ABP_APPD_DESCR_MAPPABLE_READ_PD;
+            bList = AD_LIST_RD_PD_MAPPABLE;
             break;
 
          case ABP_APPD_LIST_TYPE_WR_PD_MAPPABLE:
-            bDescrMask = ABP_APPD_DESCR_MAPPABLE_WRITE_PD;
+            bList = AD_LIST_WR_PD_MAPPABLE;
             break;
 
          case ABP_APPD_LIST_TYPE_NVS_PARAMS:
-            bDescrMask = ABP_APPD_DESCR_NVS_PARAMETER;
+            bList = AD_LIST_NVS_PARAMS;
             break;
 
          default:
@@ -2134,23 +3707,51 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
          }
 
          iDataSize = 0;
+         if( iStartingOrder > ad_aiNumInList[ bList ] )
+         {
+            break;
+         }
+
+         /*
+         ** Number of instances in the response. All of them must fit.
+         */
+         iNumInstances = ad_aiNumInList[ bList ] - iStartingOrder + 1;
+         if( iReqInstances < iNumInstances )
+         {
+            iNumInstances = iReqInstances;
+         }
+         if( ( (UINT32)iNumInstances * ABP_UINT16_SIZEOF ) > ABCC_GetMaxMessageSize() )
+         {
+            bErrCode = ABP_ERR_OUT_OF_RANGE;
+            break;
+         }
+
+#if( AD_ORDINAL_LIST_SIZE > 0 )
+         if( ad_fOrdinalListValid )
+         {
+            ABCC_PORT_CopyOctets( ABCC_GetMsgDataPtr( psMsgBuffer ), 0,
+                                  ad_aiOrdinalList,
+                                  ( ad_aiOrdinalListStart[ bList ] + iStartingOrder - 1 ) *
+                                  ABP_UINT16_SIZEOF,
+                                  iNumInstances * ABP_UINT16_SIZEOF );
+            iDataSize = iNumInstances * ABP_UINT16_SIZEOF;
+            break;
+         }
+#endif
+
          iLocalOrder = 0;
          for( iAdiIndex = 0; iAdiIndex < ad_iNumOfADIs; iAdiIndex++ )
          {
-            if( ( bDescrMask == 0 ) || ( ad_asADIEntryList[ iAdiIndex ].bDesc & bDescrMask ) )
+            if( ( ad_abListDescrMask[ bList ] == 0 ) ||
+                ( ad_asADIEntryList[ iAdiIndex ].bDesc & ad_abListDescrMask[ bList ] ) )
             {
                iLocalOrder++;
                if( iLocalOrder >= iStartingOrder )
                {
-                  if( ( iDataSize + ABP_UINT16_SIZEOF ) > ABCC_GetMaxMessageSize() )
-                  {
-                     bErrCode = ABP_ERR_OUT_OF_RANGE;
-                     break;
-                  }
                   ABCC_SetMsgData16( psMsgBuffer, ad_asADIEntryList[ iAdiIndex ].iInstance, iDataSize );
                   iDataSize += ABP_UINT16_SIZEOF;
-                  iReqInstances--;
-                  if( iReqInstances == 0 )
+                  iNumInstances--;
+                  if( iNumInstances == 0 )
                   {
                      break;
                   }
@@ -2253,6 +3854,23 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
                break;
             }
 #endif
+            if( GetAdiSizeInOctets( psAdiEntry ) > ABCC_GetMaxMessageSize() )
+            {
+#if( AD_SEG_VALUE_ENABLE )
+               bErrCode = StartSegGet( psAdiEntry, psMsgBuffer );
+               if( bErrCode == ABP_ERR_NO_ERROR )
+               {
+                  /*
+                  ** The response is sent by the segmentation session.
+                  */
+                  psMsgBuffer = NULL;
+               }
+#else
+               bErrCode = ABP_ERR_MSG_CHANNEL_TOO_SMALL;
+#endif
+               break;
+            }
+
             ABCC_GetMsgDataPtr( psMsgBuffer )[ 0 ] = 0;
 
             AD_GetAdiValue( psAdiEntry, ABCC_GetMsgDataPtr( psMsgBuffer ),
@@ -2377,23 +3995,39 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
                break;
             }
 
+            pxSetData = ABCC_GetMsgDataPtr( psMsgBuffer );
+            iSetSize = iLeTOi( psMsgBuffer->sHeader.iDataSize );
+
+#if( AD_SEG_VALUE_ENABLE && ( AD_SEG_SET_BUFFER_SIZE > 0 ) )
+            if( IsSegSetSegment( psAdiEntry, psMsgBuffer ) )
+            {
+               bErrCode = AddSegSetSegment( psAdiEntry, psMsgBuffer, &fLastSeg );
+               if( ( bErrCode != ABP_ERR_NO_ERROR ) || !fLastSeg )
+               {
+                  break;
+               }
+
+               pxSetData = ad_alSegSetBuffer;
+               iSetSize = ad_sSegSet.iSize;
+            }
+#endif
+
             /*
             ** Check the length of each array.
             */
             iItemSize = GetAdiSizeInOctets( psAdiEntry );
-            if( iLeTOi( psMsgBuffer->sHeader.iDataSize ) > iItemSize )
+            if( iSetSize > iItemSize )
             {
                bErrCode = ABP_ERR_TOO_MUCH_DATA;
                break;
             }
-            else if( iLeTOi( psMsgBuffer->sHeader.iDataSize ) < iItemSize )
+            else if( iSetSize < iItemSize )
             {
                bErrCode = ABP_ERR_NOT_ENOUGH_DATA;
                break;
             }
 #if( AD_IA_MIN_MAX_DEFAULT_ENABLE )
-            bErrCode = VerifyRange( psAdiEntry, ABCC_GetMsgDataPtr( psMsgBuffer ),
-                                    AD_ALL_ADI_INDEX );
+            bErrCode = VerifyRange( psAdiEntry, pxSetData, AD_ALL_ADI_INDEX );
 #endif
 
             if( bErrCode == ABP_ERR_NO_ERROR )
@@ -2404,13 +4038,13 @@ void AD_ProcObjectRequest( ABP_MsgType* psMsgBuffer )
                   bErrCode = psAdiEntry->pnSetAdiValueTransparent( psAdiEntry,
                                                                    psAdiEntry->bNumOfElements,
                                                                    0,
-                                                                   iLeTOi( psMsgBuffer->sHeader.iDataSize ),
-                                                                   ABCC_GetMsgDataPtr( psMsgBuffer ) );
+                                                                   iSetSize,
+                                                                   pxSetData );
                }
                else
 #endif
                {
-                  SetAdiValue( psAdiEntry, ABCC_GetMsgDataPtr( psMsgBuffer ),
+                  SetAdiValue( psAdiEntry, pxSetData,
                                psAdiEntry->bNumOfElements, 0,
                                &iMsgBitOffset, TRUE );
                   /*
@@ -2657,23 +4291,77 @@ void AD_UpdatePdReadData( void* pxPdDataBuf )
 {
    if( ad_ReadMapInfo.paiMappedAdiList )
    {
-      UINT16 iBitOffset = 0;
+#if( AD_PD_COPY_PLAN_ENABLE )
+      if( AcquireCopyPlan( &ad_sReadCopyPlan ) )
+      {
+         ExecCopyPlan( &ad_sReadCopyPlan, pxPdDataBuf, FALSE, NULL );
+         ReleaseCopyPlan( &ad_sReadCopyPlan, &ad_ReadMapInfo, FALSE );
+      }
+      else
+#endif
+      {
+         UINT16 iBitOffset = 0;
 
-      WritePdMapFromBuffer( &ad_ReadMapInfo,
-                            pxPdDataBuf,
-                            &iBitOffset );
+         WritePdMapFromBuffer( &ad_ReadMapInfo,
+                               pxPdDataBuf,
+                               &iBitOffset );
+      }
    }
 }
 
 BOOL AD_UpdatePdWriteData( void* pxPdDataBuf )
 {
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   UINT8 abDirty[ AD_WRPD_DIRTY_MAP_SIZE ];
+   ad_WrPdUpdateType eUpdate;
+#endif
+
    if( ad_WriteMapInfo.paiMappedAdiList )
    {
-      UINT16 iBitOffset = 0;
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+      eUpdate = TakeWrPdDirty( pxPdDataBuf, abDirty );
+
+      if( eUpdate == AD_WRPD_UPDATE_NONE )
+      {
+         /*
+         ** Nothing has changed. The buffer already holds the right content.
+         */
+         return( FALSE );
+      }
+
+      if( eUpdate == AD_WRPD_UPDATE_PARTIAL )
+      {
+#if( AD_PD_COPY_PLAN_ENABLE )
+         if( AcquireCopyPlan( &ad_sWriteCopyPlan ) )
+         {
+            ExecCopyPlan( &ad_sWriteCopyPlan, pxPdDataBuf, TRUE, abDirty );
+            ReleaseCopyPlan( &ad_sWriteCopyPlan, &ad_WriteMapInfo, TRUE );
+         }
+         else
+#endif
+         {
+            WriteBufferFromDirtyPdMap( pxPdDataBuf, abDirty );
+         }
+
+         return( TRUE );
+      }
+#endif
+
+#if( AD_PD_COPY_PLAN_ENABLE )
+      if( AcquireCopyPlan( &ad_sWriteCopyPlan ) )
+      {
+         ExecCopyPlan( &ad_sWriteCopyPlan, pxPdDataBuf, TRUE, NULL );
+         ReleaseCopyPlan( &ad_sWriteCopyPlan, &ad_WriteMapInfo, TRUE );
+      }
+      else
+#endif
+      {
+         UINT16 iBitOffset = 0;
 
-      WriteBufferFromPdMap( pxPdDataBuf,
-                            &iBitOffset,
-                            &ad_WriteMapInfo );
+         WriteBufferFromPdMap( pxPdDataBuf,
+                               &iBitOffset,
+                               &ad_WriteMapInfo );
+      }
    }
    else
    {
@@ -2683,6 +4371,29 @@ BOOL AD_UpdatePdWriteData( void* pxPdDataBuf )
    return( TRUE );
 }
 
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+void AD_MarkAdiDirty( UINT16 iInstance )
+{
+   UINT16 iAdiIndex;
+
+   iAdiIndex = GetAdiIndex( iInstance );
+
+   if( iAdiIndex < ad_iNumOfADIs )
+   {
+      MarkWrPdDirty( iAdiIndex );
+   }
+}
+
+void AD_MarkAllAdisDirty( void )
+{
+   ABCC_PORT_UseCritical();
+
+   ABCC_PORT_EnterCritical();
+   ad_fWrPdFullUpdate = TRUE;
+   ABCC_PORT_ExitCritical();
+}
+#endif
+
 void AD_WriteBufferFromPdMap( void* pxDstPdDataBuf,
                               UINT16* piOctetOffset,
                               const AD_MapType* pasMap )
@@ -2808,6 +4519,20 @@ UINT16 AD_AdiMappingReq( const AD_AdiEntryType** ppsAdiEntry,
    ad_fDoNetworkEndianSwap = ( eNetFormat == NET_LITTLEENDIAN ) ? FALSE : TRUE;
 #endif
 
+#if( AD_PD_COPY_PLAN_ENABLE )
+   /*
+   ** The endian swap decision is part of the copy plans.
+   */
+   BuildCopyPlans();
+#endif
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   /*
+   ** Called at each driver start. The write process data buffer does not
+   ** hold any valid data yet.
+   */
+   ResetWrPdDirty();
+#endif
+
    *ppsAdiEntry = ad_asADIEntryList;
    *ppsDefaultMap = ad_asDefaultMap;
 
@@ -2820,6 +4545,12 @@ void AD_RemapDone( void )
    ** This Write Process Data update is to ensure that the write process data
    ** is updated with the right content.
    */
+#if( AD_PD_COPY_PLAN_ENABLE )
+   BuildCopyPlans();
+#endif
+#if( AD_WRPD_DIRTY_TRACKING_ENABLE )
+   ResetWrPdDirty();
+#endif
    ABCC_TriggerWrPdUpdate();
 }
 
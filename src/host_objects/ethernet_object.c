@@ -24,6 +24,7 @@
 #include "string.h"
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_host_attribute.h"
 
 #if ETN_OBJ_ENABLE
 
@@ -36,20 +37,6 @@
 #define ETN_OA_NUM_INST_VALUE                      1
 #define ETN_OA_HIGHEST_INST_VALUE                  1
 
-/*------------------------------------------------------------------------------
-** etn_ObjectType.
-** Structure describing an Ethernet Object.
-**------------------------------------------------------------------------------
-*/
-typedef struct etn_ObjectType
-{
-    const  char* pcName;
-    UINT8  bRevision;
-    UINT16 iNumberOfInstances;
-    UINT16 iHighestInstanceNo;
-}
-etn_ObjectType;
-
 /*------------------------------------------------------------------------------
 ** Forward declarations
 **------------------------------------------------------------------------------
@@ -63,63 +50,82 @@ static UINT16 etn_iNetworkStatus;
 #if ETN_IA_IP_CONFIGURATION_ENABLE
 static ETN_IpConfigType etn_sIpConfig;
 #endif
-static const etn_ObjectType etn_sObject =
+
+#if ETN_IA_NETWORK_STATUS_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Network status (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetNetworkStatus( ABP_MsgType* psNewMessage )
 {
-   ETN_OA_NAME_VALUE,                           /* Name.                                              */
-   ETN_OA_REV_VALUE,                            /* Revision.                                          */
-   ETN_OA_NUM_INST_VALUE,                       /* Number of instances.                               */
-   ETN_OA_HIGHEST_INST_VALUE                    /* Highest instance number.                           */
-};
+   ABCC_SetMsgData16( psNewMessage, etn_iNetworkStatus, 0 );
+   ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_NETWORK_STATUS_DS );
+}
 
-void ETN_ProcessCmdMsg( ABP_MsgType* psNewMessage )
+/*------------------------------------------------------------------------------
+** Sets the Network status (Instance 1) from the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void SetNetworkStatus( ABP_MsgType* psNewMessage )
 {
-   /*
-   ** This function processes commands to the Ethernet Object and it's Instance.
-   */
-   if( ABCC_GetMsgInstance( psNewMessage ) == ABP_INST_OBJ )
+   if( ABCC_GetMsgDataSize( psNewMessage ) > ABP_ETN_IA_NETWORK_STATUS_DS )
    {
-      /*
-      ** Ethernet object Command
-      */
-      ObjectCommand( psNewMessage );
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
+      return;
    }
-   else
+   else if( ABCC_GetMsgDataSize( psNewMessage ) < ABP_ETN_IA_NETWORK_STATUS_DS )
    {
-      /*
-      ** Ethernet instance Command
-      */
-      InstanceCommand( psNewMessage );
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
+      return;
    }
 
-   ABCC_SendRespMsg( psNewMessage );
+   ABCC_GetMsgData16( psNewMessage, &etn_iNetworkStatus, 0 );
+#if ETN_OBJ_USE_SET_ATTR_SUCCESS_CALLBACK
+   ETN_SetAttrSuccessCallback( ABCC_GetMsgInstance( psNewMessage ),
+                               ABP_ETN_IA_NETWORK_STATUS );
+#endif
+   ABP_SetMsgResponse( psNewMessage, 0 );
 }
+#endif
 
 #if ETN_IA_IP_CONFIGURATION_ENABLE
-void ETN_GetIpConfig( ETN_IpConfigType* psIpConfig )
+/*------------------------------------------------------------------------------
+** Copies the IP configuration (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetIpConfiguration( ABP_MsgType* psNewMessage )
 {
-   ABCC_PORT_UseCritical();
+   UINT16 i;
 
-   ABCC_PORT_EnterCritical();
+   i = 0;
+   while( i < ABP_ETN_IA_IP_CONFIGURATION_DS )
    {
-      *psIpConfig = etn_sIpConfig;
+      ABCC_SetMsgData32( psNewMessage, etn_sIpConfig.alIpConfig[ ( i / ABP_UINT32_SIZEOF ) ], i );
+      i += ABP_UINT32_SIZEOF;
    }
-   ABCC_PORT_ExitCritical();
+   ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_IP_CONFIGURATION_DS );
 }
-#endif /* #if ETN_IA_IP_CONFIGURATION_ENABLE */
-
-#if ETN_IA_NETWORK_STATUS_ENABLE
-void ETN_GetNwStatus( UINT16* piNwStatus )
-{
-   ABCC_PORT_UseCritical();
-
-   ABCC_PORT_EnterCritical();
-   *piNwStatus = etn_iNetworkStatus;
-   ABCC_PORT_ExitCritical();
-}
-#endif /* #if ETN_IA_NETWORK_STATUS_ENABLE */
 
 /*------------------------------------------------------------------------------
-** Processes commands to ETN Instances
+** Sets the IP configuration (Instance 1) from the message.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    psNewMessage      - Pointer to a ABP_MsgType message.
@@ -128,542 +134,227 @@ void ETN_GetNwStatus( UINT16* piNwStatus )
 **    None
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage )
+static void SetIpConfiguration( ABP_MsgType* psNewMessage )
 {
-   UINT16 iInstance;
-   UINT8 bAttribute;
-
-   iInstance = ABCC_GetMsgInstance( psNewMessage );
-   bAttribute = ABCC_GetMsgCmdExt0( psNewMessage );
+   UINT16 i;
 
-#if ETN_IA_SNMP_READ_ONLY_ENABLE   ||       \
-    ETN_IA_SNMP_READ_WRITE_ENABLE
-   char*  pcStr;
-   UINT16 iStrLength;
-#endif
-
-   /*
-   ** This function processes commands to the Ethernet Instance.
-   */
-   if( iInstance != 1 )
+   if( ABCC_GetMsgDataSize( psNewMessage ) > ABP_ETN_IA_IP_CONFIGURATION_DS )
    {
-      /*
-      ** The Instance does not exist.
-      */
-      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
+      return;
+   }
+   else if( ABCC_GetMsgDataSize( psNewMessage ) < ABP_ETN_IA_IP_CONFIGURATION_DS )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
       return;
    }
 
-   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   i = 0;
+   while( i < ABP_ETN_IA_IP_CONFIGURATION_DS )
    {
-   case ABP_CMD_GET_ATTR:
+      ABCC_GetMsgData32( psNewMessage, &etn_sIpConfig.alIpConfig[ ( i / ABP_UINT32_SIZEOF ) ], i );
+      i += ABP_UINT32_SIZEOF;
+   }
+#if ETN_OBJ_USE_SET_ATTR_SUCCESS_CALLBACK
+   ETN_SetAttrSuccessCallback( ABCC_GetMsgInstance( psNewMessage ),
+                               ABP_ETN_IA_IP_CONFIGURATION );
+#endif
+   ABP_SetMsgResponse( psNewMessage, 0 );
+}
+#endif
+
+/*------------------------------------------------------------------------------
+** Object attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType etn_asObjAttr[] =
+{
+   ABCC_HOST_ATTR_OBJECT( ETN_OA_NAME_VALUE,
+                          ETN_OA_REV_VALUE,
+                          ETN_OA_NUM_INST_VALUE,
+                          ETN_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
-      switch( bAttribute )
-      {
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType etn_asInstAttr[] =
+{
 #if ETN_IA_MAC_ADDRESS_ENABLE
-      case ABP_ETN_IA_MAC_ADDRESS:
-      {
-         UINT16 i;
-         UINT8  abMac[ 6 ];
-
-         /*
-         ** Copy the 1st Instance 1 attribute (MAC Address) to the message.
-         */
-
-         ABCC_PORT_MemCpy( abMac, ETN_IA_MAC_ADDRESS_VALUE, ABP_ETN_IA_MAC_ADDRESS_DS );
-
-         for( i = 0; i < ABP_ETN_IA_MAC_ADDRESS_DS; i++ )
-         {
-            ABCC_SetMsgData8( psNewMessage, abMac[ i ], i );
-         }
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_MAC_ADDRESS_DS );
-         break;
-      }
+   ABCC_HOST_ATTR_OCT( ABP_ETN_IA_MAC_ADDRESS, ETN_IA_MAC_ADDRESS_VALUE,
+                       ABP_ETN_IA_MAC_ADDRESS_DS ),
 #endif
 #if ETN_IA_ENABLE_HICP_ENABLE
-      case ABP_ETN_IA_ENABLE_HICP:
-
-         /*
-         ** Copy the 2nd Instance 1 attribute (Enable HICP) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_HICP_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_HICP_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_HICP, ETN_IA_ENABLE_HICP_VALUE ),
 #endif
 #if ETN_IA_ENABLE_WEB_ENABLE
-      case ABP_ETN_IA_ENABLE_WEB:
-
-         /*
-         ** Copy the 3rd Instance 1 attribute (Enable WEB) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_WEB_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_WEB_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_WEB, ETN_IA_ENABLE_WEB_VALUE ),
 #endif
 #if ETN_IA_ENABLE_WEB_ADI_ACCESS_ENABLE
-      case ABP_ETN_IA_ENABLE_WEB_ADI_ACCESS:
-
-         /*
-         ** Copy the 5th Instance 1 attribute (Enable WEB ADI access) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_WEB_ADI_ACCESS_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_WEB_ADI_ACCESS_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_WEB_ADI_ACCESS,
+                      ETN_IA_ENABLE_WEB_ADI_ACCESS_VALUE ),
 #endif
 #if ETN_IA_ENABLE_FTP_ENABLE
-      case ABP_ETN_IA_ENABLE_FTP:
-
-         /*
-         ** Copy the 6th Instance 1 attribute (Enable FTP) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_FTP_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_FTP_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_FTP, ETN_IA_ENABLE_FTP_VALUE ),
 #endif
 #if ETN_IA_ENABLE_ADMIN_MODE_ENABLE
-      case ABP_ETN_IA_ENABLE_ADMIN_MODE:
-
-         /*
-         ** Copy the 7th Instance 1 attribute (Enable admin mode) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_ADMIN_MODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_ADMIN_MODE_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_ADMIN_MODE,
+                      ETN_IA_ENABLE_ADMIN_MODE_VALUE ),
 #endif
 #if ETN_IA_NETWORK_STATUS_ENABLE
-      case ABP_ETN_IA_NETWORK_STATUS:
-
-         /*
-         ** Copy the 8th Instance 1 attribute (Network Status) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, etn_iNetworkStatus, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_NETWORK_STATUS_DS );
-         break;
+   ABCC_HOST_ATTR_FUNC( ABP_ETN_IA_NETWORK_STATUS,
+                        GetNetworkStatus, SetNetworkStatus ),
 #endif
 #if ETN_IA_PORT1_MAC_ADDRESS_ENABLE
-      case ABP_ETN_IA_PORT1_MAC_ADDRESS:
-      {
-         UINT16 i;
-         UINT8  abMac[ 6 ];
-
-         /*
-         ** Copy the 9th Instance 1 attribute (Port 1 MAC Address) to the message.
-         */
-
-         ABCC_PORT_MemCpy( abMac, ETN_IA_PORT1_MAC_ADDRESS_VALUE, ABP_ETN_IA_PORT1_MAC_ADDRESS_DS );
-
-         for( i = 0; i < ABP_ETN_IA_PORT1_MAC_ADDRESS_DS; i++ )
-         {
-            ABCC_SetMsgData8( psNewMessage, abMac[ i ], i );
-         }
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_PORT1_MAC_ADDRESS_DS );
-         break;
-      }
+   ABCC_HOST_ATTR_OCT( ABP_ETN_IA_PORT1_MAC_ADDRESS,
+                       ETN_IA_PORT1_MAC_ADDRESS_VALUE,
+                       ABP_ETN_IA_PORT1_MAC_ADDRESS_DS ),
 #endif
 #if ETN_IA_PORT2_MAC_ADDRESS_ENABLE
-      case ABP_ETN_IA_PORT2_MAC_ADDRESS:
-      {
-         UINT16 i;
-         UINT8  abMac[ 6 ];
-
-         /*
-         ** Copy the 10th Instance 1 attribute (Port 2 MAC Address) to the message.
-         */
-
-         ABCC_PORT_MemCpy( abMac, ETN_IA_PORT2_MAC_ADDRESS_VALUE, ABP_ETN_IA_PORT2_MAC_ADDRESS_DS );
-
-         for( i = 0; i < ABP_ETN_IA_PORT2_MAC_ADDRESS_DS; i++ )
-         {
-            ABCC_SetMsgData8( psNewMessage, abMac[ i ], i );
-         }
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_PORT2_MAC_ADDRESS_DS );
-         break;
-      }
+   ABCC_HOST_ATTR_OCT( ABP_ETN_IA_PORT2_MAC_ADDRESS,
+                       ETN_IA_PORT2_MAC_ADDRESS_VALUE,
+                       ABP_ETN_IA_PORT2_MAC_ADDRESS_DS ),
 #endif
 #if ETN_IA_ENABLE_ACD_ENABLE
-      case ABP_ETN_IA_ENABLE_ACD:
-
-         /*
-         ** Copy the 11th Instance 1 attribute (Enable ACD) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_ACD_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_ACD_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_ACD, ETN_IA_ENABLE_ACD_VALUE ),
 #endif
 #if ETN_IA_PORT1_STATE_ENABLE
-      case ABP_ETN_IA_PORT1_STATE:
-
-         /*
-         ** Copy the 12th Instance 1 attribute (Port 1 state) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_PORT1_STATE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_PORT1_STATE_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_PORT1_STATE, ETN_IA_PORT1_STATE_VALUE ),
 #endif
 #if ETN_IA_PORT2_STATE_ENABLE
-      case ABP_ETN_IA_PORT2_STATE:
-
-         /*
-         ** Copy the 13th Instance 1 attribute (Port 2 state) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_PORT2_STATE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_PORT2_STATE_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_PORT2_STATE, ETN_IA_PORT2_STATE_VALUE ),
 #endif
 #if ETN_IA_ENABLE_WEB_UPDATE_ENABLE
-      case ABP_ETN_IA_ENABLE_WEB_UPDATE:
-
-         /*
-         ** Copy the 14th Instance 1 attribute (Enable web update) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_WEB_UPDATE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_WEB_UPDATE_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_WEB_UPDATE,
+                      ETN_IA_ENABLE_WEB_UPDATE_VALUE ),
 #endif
 #if ETN_IA_ENABLE_HICP_RESET_ENABLE
-      case ABP_ETN_IA_ENABLE_HICP_RESET:
-
-         /*
-         ** Copy the 15th Instance 1 attribute (Enable HICP reset) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_HICP_RESET_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_HICP_RESET_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_HICP_RESET,
+                      ETN_IA_ENABLE_HICP_RESET_VALUE ),
 #endif
 #if ETN_IA_IP_CONFIGURATION_ENABLE
-      case ABP_ETN_IA_IP_CONFIGURATION:
-      {
-         UINT16 i;
-
-         /*
-         ** Copy the 16th Instance 1 attribute (IP configuration) to the message.
-         */
-
-         i = 0;
-         while( i < ABP_ETN_IA_IP_CONFIGURATION_DS )
-         {
-            ABCC_SetMsgData32( psNewMessage, etn_sIpConfig.alIpConfig[ ( i / ABP_UINT32_SIZEOF ) ], i );
-            i += ABP_UINT32_SIZEOF;
-         }
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_IP_CONFIGURATION_DS );
-         break;
-      }
+   ABCC_HOST_ATTR_FUNC( ABP_ETN_IA_IP_CONFIGURATION,
+                        GetIpConfiguration, SetIpConfiguration ),
 #endif
 #if ETN_IA_IP_ADDRESS_BYTE_0_2_ENABLE
-      case ABP_ETN_IA_IP_ADDRESS_BYTE_0_2:
-      {
-         UINT16 i;
-         UINT8  abIp[ 3 ];
-
-         /*
-         ** Copy the 17th Instance 1 attribute (IP address byte 0 to 2) to the message.
-         */
-
-         ABCC_PORT_MemCpy( abIp, ETN_IA_IP_ADDRESS_BYTE_0_2_VALUE, ABP_ETN_IA_IP_ADDRESS_BYTE_0_2_DS );
-
-         for( i = 0; i < ABP_ETN_IA_IP_ADDRESS_BYTE_0_2_DS; i++ )
-         {
-            ABCC_SetMsgData8( psNewMessage, abIp[ i ], i );
-         }
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_IP_ADDRESS_BYTE_0_2_DS );
-         break;
-      }
+   ABCC_HOST_ATTR_OCT( ABP_ETN_IA_IP_ADDRESS_BYTE_0_2,
+                       ETN_IA_IP_ADDRESS_BYTE_0_2_VALUE,
+                       ABP_ETN_IA_IP_ADDRESS_BYTE_0_2_DS ),
 #endif
 #if ETN_IA_ETH_PHY_CONFIG_ENABLE
-      case ABP_ETN_IA_ETH_PHY_CONFIG:
-      {
-         /*
-         ** Copy the 18th Instance 1 attribute (Ethernet PHY Configuration) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, ETN_IA_ETH_PHY_CONFIG_PORT1_VALUE, 0 );
-         ABCC_SetMsgData16( psNewMessage, ETN_IA_ETH_PHY_CONFIG_PORT2_VALUE, 2 );
-         ABP_SetMsgResponse( psNewMessage, 4 );
-         break;
-      }
+   ABCC_HOST_ATTR_U16X2( ABP_ETN_IA_ETH_PHY_CONFIG,
+                         ETN_IA_ETH_PHY_CONFIG_PORT1_VALUE,
+                         ETN_IA_ETH_PHY_CONFIG_PORT2_VALUE ),
 #endif
 #if ETN_IA_SNMP_READ_ONLY_ENABLE
-      case ABP_ETN_IA_SNMP_READ_ONLY:
-      {
-         /*
-         ** Copy the 20th Instance 1 attribute (SNMP read-only community string) to the message.
-         */
-         pcStr = ETN_IA_SNMP_READ_ONLY_VALUE;
-         iStrLength = (UINT16)strnlen( pcStr, ABP_ETN_IA_SNMP_READ_ONLY_DS );
-
-         ABCC_SetMsgString( psNewMessage, pcStr, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-      }
+   ABCC_HOST_ATTR_STR_MAX( ABP_ETN_IA_SNMP_READ_ONLY,
+                           ETN_IA_SNMP_READ_ONLY_VALUE,
+                           ABP_ETN_IA_SNMP_READ_ONLY_DS ),
 #endif
 #if ETN_IA_SNMP_READ_WRITE_ENABLE
-      case ABP_ETN_IA_SNMP_READ_WRITE:
-      {
-         /*
-         ** Copy the 21st Instance 1 attribute (SNMP read-write community string) to the message.
-         */
-         pcStr = ETN_IA_SNMP_READ_WRITE_VALUE;
-         iStrLength = (UINT16)strnlen( pcStr, ABP_ETN_IA_SNMP_READ_WRITE_DS );
-
-         ABCC_SetMsgString( psNewMessage, pcStr, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-      }
+   ABCC_HOST_ATTR_STR_MAX( ABP_ETN_IA_SNMP_READ_WRITE,
+                           ETN_IA_SNMP_READ_WRITE_VALUE,
+                           ABP_ETN_IA_SNMP_READ_WRITE_DS ),
 #endif
 #if ETN_IA_DHCP_OPTION_61_SOURCE_ENABLE
-      case ABP_ETN_IA_DHCP_OPTION_61_SOURCE:
-      {
-         /*
-         ** Copy the 22nd Instance 1 attribute (DHCP Option 61 source) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_DHCP_OPTION_61_SOURCE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_DHCP_OPTION_61_SOURCE_DS );
-         break;
-      }
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_DHCP_OPTION_61_SOURCE,
+                      ETN_IA_DHCP_OPTION_61_SOURCE_VALUE ),
 #endif
 #if ETN_IA_DHCP_OPTION_61_GENERIC_STR_ENABLE
-      case ABP_ETN_IA_DHCP_OPTION_61_GENERIC_STR:
-      {
-         UINT16  iIndex;
-         /*
-         ** Copy the 23rd Instance 1 attribute (DHCP Option 61 generic string) to the message.
-         */
-         for( iIndex = 0; iIndex < ETN_IA_DHCP_OPTION_61_GENERIC_STR_ARRAY_SIZE; iIndex++ )
-         {
-            ABCC_SetMsgData8( psNewMessage, ETN_IA_DHCP_OPTION_61_GENERIC_STR_VALUE[ iIndex ], iIndex );
-         }
-         ABP_SetMsgResponse( psNewMessage, ETN_IA_DHCP_OPTION_61_GENERIC_STR_ARRAY_SIZE );
-         break;
-      }
+   ABCC_HOST_ATTR_OCT( ABP_ETN_IA_DHCP_OPTION_61_GENERIC_STR,
+                       ETN_IA_DHCP_OPTION_61_GENERIC_STR_VALUE,
+                       ETN_IA_DHCP_OPTION_61_GENERIC_STR_ARRAY_SIZE ),
 #endif
 #if ETN_IA_ENABLE_DHCP_CLIENT_ENABLE
-      case ABP_ETN_IA_ENABLE_DHCP_CLIENT:
-      {
-         /*
-         ** Copy the 24th Instance 1 attribute (Enable DHCP client) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_DHCP_CLIENT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_DHCP_CLIENT_DS );
-         break;
-      }
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_DHCP_CLIENT,
+                      ETN_IA_ENABLE_DHCP_CLIENT_VALUE ),
 #endif
 #if ETN_IA_ENABLE_WEBDAV_ENABLE
-      case ABP_ETN_IA_ENABLE_WEBDAV:
-      {
-         /*
-         ** Copy the 25th Instance 1 attribute (Enable WebDAV Server) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ETN_IA_ENABLE_WEBDAV_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ETN_IA_ENABLE_WEBDAV_DS );
-         break;
-      }
-#endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
-      break;
-
-   case ABP_CMD_SET_ATTR:
-
-      switch( bAttribute )
-      {
-#if ETN_IA_MAC_ADDRESS_ENABLE
-      case ABP_ETN_IA_MAC_ADDRESS:
-
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_ETN_IA_ENABLE_WEBDAV, ETN_IA_ENABLE_WEBDAV_VALUE ),
 #endif
-#if ETN_IA_ENABLE_HICP_ENABLE
-      case ABP_ETN_IA_ENABLE_HICP:
+   ABCC_HOST_ATTR_END
+};
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ENABLE_WEB_ENABLE
-      case ABP_ETN_IA_ENABLE_WEB:
+void ETN_ProcessCmdMsg( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** This function processes commands to the Ethernet Object and it's Instance.
+   */
+   if( ABCC_GetMsgInstance( psNewMessage ) == ABP_INST_OBJ )
+   {
+      /*
+      ** Ethernet object Command
+      */
+      ObjectCommand( psNewMessage );
+   }
+   else
+   {
+      /*
+      ** Ethernet instance Command
+      */
+      InstanceCommand( psNewMessage );
+   }
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ENABLE_WEB_ADI_ACCESS_ENABLE
-      case ABP_ETN_IA_ENABLE_WEB_ADI_ACCESS:
+   ABCC_SendRespMsg( psNewMessage );
+}
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ENABLE_FTP_ENABLE
-      case ABP_ETN_IA_ENABLE_FTP:
+#if ETN_IA_IP_CONFIGURATION_ENABLE
+void ETN_GetIpConfig( ETN_IpConfigType* psIpConfig )
+{
+   ABCC_PORT_UseCritical();
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ENABLE_ADMIN_MODE_ENABLE
-      case ABP_ETN_IA_ENABLE_ADMIN_MODE:
+   ABCC_PORT_EnterCritical();
+   {
+      *psIpConfig = etn_sIpConfig;
+   }
+   ABCC_PORT_ExitCritical();
+}
+#endif /* #if ETN_IA_IP_CONFIGURATION_ENABLE */
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
 #if ETN_IA_NETWORK_STATUS_ENABLE
-      case ABP_ETN_IA_NETWORK_STATUS:
-      {
-         /*
-         ** Set the 8th Instance 1 attribute (Network Status) to the message.
-         */
-
-         if( ABCC_GetMsgDataSize( psNewMessage ) > ABP_ETN_IA_NETWORK_STATUS_DS )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
-            break;
-         }
-         else if( ABCC_GetMsgDataSize( psNewMessage ) < ABP_ETN_IA_NETWORK_STATUS_DS )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
-            break;
-         }
-
-         ABCC_GetMsgData16( psNewMessage, &etn_iNetworkStatus, 0 );
-#if ETN_OBJ_USE_SET_ATTR_SUCCESS_CALLBACK
-         ETN_SetAttrSuccessCallback( iInstance, bAttribute );
-#endif
-         ABP_SetMsgResponse( psNewMessage, 0 );
-         break;
-      }
-#endif
-#if ETN_IA_PORT1_MAC_ADDRESS_ENABLE
-      case ABP_ETN_IA_PORT1_MAC_ADDRESS:
-
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_PORT2_MAC_ADDRESS_ENABLE
-      case ABP_ETN_IA_PORT2_MAC_ADDRESS:
-
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ENABLE_ACD_ENABLE
-      case ABP_ETN_IA_ENABLE_ACD:
-
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_PORT1_STATE_ENABLE
-      case ABP_ETN_IA_PORT1_STATE:
-
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_PORT2_STATE_ENABLE
-      case ABP_ETN_IA_PORT2_STATE:
+void ETN_GetNwStatus( UINT16* piNwStatus )
+{
+   ABCC_PORT_UseCritical();
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ENABLE_WEB_UPDATE_ENABLE
-      case ABP_ETN_IA_ENABLE_WEB_UPDATE:
+   ABCC_PORT_EnterCritical();
+   *piNwStatus = etn_iNetworkStatus;
+   ABCC_PORT_ExitCritical();
+}
+#endif /* #if ETN_IA_NETWORK_STATUS_ENABLE */
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ENABLE_HICP_RESET_ENABLE
-      case ABP_ETN_IA_ENABLE_HICP_RESET:
+/*------------------------------------------------------------------------------
+** Processes commands to ETN Instances
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void InstanceCommand( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** This function processes commands to the Ethernet Instance.
+   */
+   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
+   {
+      /*
+      ** The Instance does not exist.
+      */
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
+      return;
+   }
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_IP_CONFIGURATION_ENABLE
-      case ABP_ETN_IA_IP_CONFIGURATION:
-      {
-         UINT16 i;
-
-         /*
-         ** Set the 16th Instance 1 attribute (IP configuration) to the message.
-         */
-
-         if( ABCC_GetMsgDataSize( psNewMessage ) > ABP_ETN_IA_IP_CONFIGURATION_DS )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
-            break;
-         }
-         else if( ABCC_GetMsgDataSize( psNewMessage ) < ABP_ETN_IA_IP_CONFIGURATION_DS )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
-            break;
-         }
-
-         i = 0;
-         while( i < ABP_ETN_IA_IP_CONFIGURATION_DS )
-         {
-            ABCC_GetMsgData32( psNewMessage, &etn_sIpConfig.alIpConfig[ ( i / ABP_UINT32_SIZEOF ) ], i );
-            i += ABP_UINT32_SIZEOF;
-         }
-#if ETN_OBJ_USE_SET_ATTR_SUCCESS_CALLBACK
-         ETN_SetAttrSuccessCallback( iInstance, bAttribute );
-#endif
-         ABP_SetMsgResponse( psNewMessage, 0 );
-         break;
-      }
-#endif
-#if ETN_IA_IP_ADDRESS_BYTE_0_2_ENABLE
-      case ABP_ETN_IA_IP_ADDRESS_BYTE_0_2:
+   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   {
+   case ABP_CMD_GET_ATTR:
+   case ABP_CMD_SET_ATTR:
 
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-#endif
-#if ETN_IA_ETH_PHY_CONFIG_ENABLE
-      case ABP_ETN_IA_ETH_PHY_CONFIG:
-      {
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-      }
-#endif
-#if ETN_IA_SNMP_READ_ONLY_ENABLE
-      case ABP_ETN_IA_SNMP_READ_ONLY:
-      {
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-      }
-#endif
-#if ETN_IA_SNMP_READ_WRITE_ENABLE
-      case ABP_ETN_IA_SNMP_READ_WRITE:
-      {
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-      }
-#endif
-#if ETN_IA_DHCP_OPTION_61_SOURCE_ENABLE
-      case ABP_ETN_IA_DHCP_OPTION_61_SOURCE:
-      {
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-      }
-#endif
-#if ETN_IA_DHCP_OPTION_61_GENERIC_STR_ENABLE
-      case ABP_ETN_IA_DHCP_OPTION_61_GENERIC_STR:
-      {
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-      }
-#endif
-#if ETN_IA_ENABLE_DHCP_CLIENT_ENABLE
-      case ABP_ETN_IA_ENABLE_DHCP_CLIENT:
-      {
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-      }
-#endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, etn_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( etn_asInstAttr ) );
       break;
 
    default:
@@ -694,59 +385,10 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         iStrLength = (UINT16)strlen( etn_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, etn_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData8( psNewMessage, etn_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, etn_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, etn_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+
+      ABCC_HostAttrCommand( psNewMessage, etn_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( etn_asObjAttr ) );
       break;
-   }
 
    default:
 
@@ -21,6 +21,7 @@
 #include "abcc_port.h"
 #include "abp_mqtt.h"
 #include "mqtt_object.h"
+#include "abcc_host_attribute.h"
 
 #if MQTT_OBJ_ENABLE
 
@@ -39,25 +40,77 @@
 */
 #define MQTT_TOPIC_STR_BUFFER_SIZE                40
 
+#if MQTT_IA_LAST_WILL_ENABLE
 /*------------------------------------------------------------------------------
-** Structure describing an MQTT object.
+** Copies the Last will configuration (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
 **------------------------------------------------------------------------------
 */
-typedef struct mqtt_Object
+static void GetLastWill( ABP_MsgType* psNewMessage )
 {
-   const char* pcName;
-   UINT8  bRevision;
-   UINT16 iNumberOfInstances;
-   UINT16 iHighestInstanceNo;
+   char*  pcStr;
+   UINT16 iTopicStrLength;
+   UINT16 iMessageStrLength;
+   UINT16 iMsgRespSize;
+
+   /*
+   ** Last will QoS and retain
+   */
+   ABCC_SetMsgData8( psNewMessage, MQTT_IA_LAST_WILL_QOS, ABP_MQTT_LASTWILL_QOS_OFFSET );
+   ABCC_SetMsgData8( psNewMessage, MQTT_IA_LAST_WILL_RETAIN, ABP_MQTT_LASTWILL_RETAIN_OFFSET );
+
+   /*
+   ** Last will topic
+   */
+   pcStr = MQTT_IA_LAST_WILL_TOPIC_STR;
+   iTopicStrLength = (UINT16)strnlen( pcStr, 128 );
+   ABCC_SetMsgData16( psNewMessage, iTopicStrLength, ABP_MQTT_LASTWILL_TOPIC_LENGTH_OFFSET );
+   ABCC_SetMsgString( psNewMessage, pcStr, iTopicStrLength, ABP_MQTT_LASTWILL_TOPIC_STR_OFFSET );
+
+   /*
+   ** Last will message
+   */
+   pcStr = MQTT_IA_LAST_WILL_MESSAGE_STR;
+   iMessageStrLength = (UINT16)strnlen( pcStr, 256 );
+   ABCC_SetMsgData16( psNewMessage, iMessageStrLength, ABP_MQTT_LASTWILL_MESSAGE_LENGTH_BASE_OFFSET + iTopicStrLength );
+   ABCC_SetMsgString( psNewMessage, pcStr, iMessageStrLength, ABP_MQTT_LASTWILL_MESSSAGE_STR_BASE_OFFSET + iTopicStrLength );
+
+   iMsgRespSize = ABP_UINT8_SIZEOF + ABP_BOOL_SIZEOF + ABP_UINT16_SIZEOF + iTopicStrLength + ABP_UINT16_SIZEOF + iMessageStrLength;
+   ABP_SetMsgResponse( psNewMessage, iMsgRespSize );
 }
-mqtt_ObjectType;
+#endif
+
+/*------------------------------------------------------------------------------
+** Object attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType mqtt_asObjAttr[] =
+{
+   ABCC_HOST_ATTR_OBJECT( MQTT_OA_NAME_VALUE,
+                          MQTT_OA_REV_VALUE,
+                          MQTT_OA_NUM_INST_VALUE,
+                          MQTT_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
-static const mqtt_ObjectType mqtt_sObject =
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType mqtt_asInstAttr[] =
 {
-   MQTT_OA_NAME_VALUE,                            /* Name.                                      */
-   MQTT_OA_REV_VALUE,                             /* Revision.                                  */
-   MQTT_OA_NUM_INST_VALUE,                        /* Number of instances.                       */
-   MQTT_OA_HIGHEST_INST_VALUE                     /* Highest instance number.                   */
+#if MQTT_IA_MODE_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_MQTT_IA_MODE, MQTT_IA_MODE_VALUE ),
+#endif
+#if MQTT_IA_LAST_WILL_ENABLE
+   ABCC_HOST_ATTR_FUNC( APB_MQTT_IA_LAST_WILL, GetLastWill, NULL ),
+#endif
+   ABCC_HOST_ATTR_END
 };
 
 /*------------------------------------------------------------------------------
@@ -72,13 +125,6 @@ static const mqtt_ObjectType mqtt_sObject =
 */
 static void InstanceCommand( ABP_MsgType* psNewMessage )
 {
-#if MQTT_IA_LAST_WILL_ENABLE
-   char*  pcStr;
-   UINT16 iTopicStrLength;
-   UINT16 iMessageStrLength;
-   UINT16 iMsgRespSize;
-#endif
-
    if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
    {
       /*
@@ -93,65 +139,10 @@ static void InstanceCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if MQTT_IA_MODE_ENABLE
-      case ABP_MQTT_IA_MODE:
-
-         /*
-         ** The 'MQTT mode' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, MQTT_IA_MODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_MQTT_IA_MODE_DS );
-         break;
-#endif
-
-#if MQTT_IA_LAST_WILL_ENABLE
-      case APB_MQTT_IA_LAST_WILL:
 
-         /*
-         ** The 'MQTT last will' attribute is requested.
-         ** Copy the attribute to a response message
-         */
-
-         /*
-         ** Last will QoS and retain
-         */
-         ABCC_SetMsgData8( psNewMessage, MQTT_IA_LAST_WILL_QOS, ABP_MQTT_LASTWILL_QOS_OFFSET );
-         ABCC_SetMsgData8( psNewMessage, MQTT_IA_LAST_WILL_RETAIN, ABP_MQTT_LASTWILL_RETAIN_OFFSET );
-
-         /*
-         ** Last will topic
-         */
-         pcStr = MQTT_IA_LAST_WILL_TOPIC_STR;
-         iTopicStrLength = (UINT16)strnlen( pcStr, 128 );
-         ABCC_SetMsgData16( psNewMessage, iTopicStrLength, ABP_MQTT_LASTWILL_TOPIC_LENGTH_OFFSET );
-         ABCC_SetMsgString( psNewMessage, pcStr, iTopicStrLength, ABP_MQTT_LASTWILL_TOPIC_STR_OFFSET );
-
-         /*
-         ** Last will message
-         */
-         pcStr = MQTT_IA_LAST_WILL_MESSAGE_STR;
-         iMessageStrLength = (UINT16)strnlen( pcStr, 256 );
-         ABCC_SetMsgData16( psNewMessage, iMessageStrLength, ABP_MQTT_LASTWILL_MESSAGE_LENGTH_BASE_OFFSET + iTopicStrLength );
-         ABCC_SetMsgString( psNewMessage, pcStr, iMessageStrLength, ABP_MQTT_LASTWILL_MESSSAGE_STR_BASE_OFFSET + iTopicStrLength );
-
-         iMsgRespSize = ABP_UINT8_SIZEOF + ABP_BOOL_SIZEOF + ABP_UINT16_SIZEOF + iTopicStrLength + ABP_UINT16_SIZEOF + iMessageStrLength;
-         ABP_SetMsgResponse( psNewMessage, iMsgRespSize );
-         break;
-#endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, mqtt_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( mqtt_asInstAttr ) );
       break;
-   }
 
    default:
 
@@ -175,7 +166,6 @@ static void InstanceCommand( ABP_MsgType* psNewMessage )
 */
 static void ObjectCommand( ABP_MsgType* psNewMessage )
 {
-   UINT16 iStrLength;
 #if MQTT_CMD_PUBLISH_CFG_ENABLE
    UINT16 iDatasetIdentifier;
    BOOL   fRetainBit;
@@ -187,60 +177,11 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-
-         /*
-         ** The 'name' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         iStrLength = (UINT16)strlen( mqtt_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, mqtt_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-
-      case ABP_OA_REV:
-
-         /*
-         ** The 'revision' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, mqtt_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** The 'Number of Instances' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData16( psNewMessage, mqtt_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
 
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** The 'Highest Instance Number' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData16( psNewMessage, mqtt_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, mqtt_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( mqtt_asObjAttr ) );
       break;
-   }
+
 #if MQTT_CMD_PUBLISH_CFG_ENABLE
    case ABP_MQTT_CMD_GET_PUBLISH_CONFIGURATION:
    {
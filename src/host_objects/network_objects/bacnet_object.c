@@ -21,6 +21,7 @@
 #include "bacnet_object.h"
 #include "abp.h"
 #include "abp_bac.h"
+#include "abcc_host_attribute.h"
 #include "application_data_instance_config.h"
 
 #include "string.h"
@@ -122,6 +123,87 @@
 static void bac_InstanceCommand( ABP_MsgType* psNewMessage );
 static void bac_ObjectCommand( ABP_MsgType* psNewMessage );
 
+#if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE
+/*------------------------------------------------------------------------------
+** Advanced Mapping lookup index, see BAC_ADV_MAPPING_INDEX_SIZE and
+** BAC_ADV_MAPPING_BITMAP_TYPES. Built by BAC_Init(). Lookups fall back to a
+** scan of the object list when a table is not built.
+**------------------------------------------------------------------------------
+*/
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 )
+
+#if( ( BAC_ADV_MAPPING_INDEX_SIZE & ( BAC_ADV_MAPPING_INDEX_SIZE - 1 ) ) != 0 )
+#error "BAC_ADV_MAPPING_INDEX_SIZE must be a power of two"
+#endif
+
+/*
+** Multiplier used when hashing keys (Fibonacci hashing, 2^32/phi).
+*/
+#define BAC_HASH_MULTIPLIER                        ( 2654435769UL )
+
+/*
+** FNV-1a parameters used when hashing object names.
+*/
+#define BAC_NAME_HASH_INIT                         ( 2166136261UL )
+#define BAC_NAME_HASH_PRIME                        ( 16777619UL )
+
+/*------------------------------------------------------------------------------
+** Open addressing hash table with linear probing.
+**------------------------------------------------------------------------------
+** iNumSlots      - Number of slots in use, 0 if the table is not built.
+** bHashShift     - Right shift applied to the hash product.
+** aiSlot         - Object list index per slot, ABCC_ADI_INDEX_NOT_FOUND if the
+**                  slot is empty.
+**------------------------------------------------------------------------------
+*/
+typedef struct bac_HashIndexType
+{
+   UINT16   iNumSlots;
+   UINT8    bHashShift;
+   UINT16   aiSlot[ BAC_ADV_MAPPING_INDEX_SIZE ];
+}
+bac_HashIndexType;
+
+/*
+** Object type and instance to object list index.
+*/
+static bac_HashIndexType bac_sObjInstIndex;
+
+/*
+** ADI name to ADI list index.
+*/
+static bac_HashIndexType bac_sNameIndex;
+
+#endif /* BAC_ADV_MAPPING_INDEX_SIZE > 0 */
+
+#if( BAC_ADV_MAPPING_BITMAP_TYPES > 0 )
+
+/*------------------------------------------------------------------------------
+** Get_All_BACnet_Object_Instances response of one object type.
+**------------------------------------------------------------------------------
+** iObjType       - BACnet object type.
+** aiBitmap       - One bit per object instance, in message octet order.
+**------------------------------------------------------------------------------
+*/
+typedef struct bac_TypeBitmapType
+{
+   UINT16   iObjType;
+   UINT16   aiBitmap[ ( BAC_CMD_GET_ALL_OBJ_INST_LENGTH + 1 ) / 2 ];
+}
+bac_TypeBitmapType;
+
+static bac_TypeBitmapType bac_asTypeBitmap[ BAC_ADV_MAPPING_BITMAP_TYPES ];
+static UINT8 bac_bNumTypeBitmaps = 0;
+
+/*
+** TRUE if all object types in the object list have a bitmap.
+*/
+static BOOL bac_fTypeBitmapsComplete = FALSE;
+
+#endif /* BAC_ADV_MAPPING_BITMAP_TYPES > 0 */
+
+#endif /* BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE */
+
 #if BAC_IA_OBJECT_NAME_ENABLE && BAC_IA_OBJECT_NAME_SET
 /*
 ** PORTING ALERT!
@@ -161,8 +243,9 @@ void BAC_ProcessCmdMsg( ABP_MsgType* psNewMessage )
    ABCC_SendRespMsg( psNewMessage );
 }
 
+#if BAC_IA_OBJECT_NAME_ENABLE && BAC_IA_OBJECT_NAME_SET
 /*------------------------------------------------------------------------------
-** Processes commands to BACnet host object Instances
+** Get/set of the Object Name attribute (RAM buffer).
 **------------------------------------------------------------------------------
 ** Arguments:
 **    psNewMessage      - Pointer to a ABP_MsgType message.
@@ -171,280 +254,213 @@ void BAC_ProcessCmdMsg( ABP_MsgType* psNewMessage )
 **    None
 **------------------------------------------------------------------------------
 */
-static void bac_InstanceCommand( ABP_MsgType* psNewMessage )
+static void bac_GetObjectName( ABP_MsgType* psNewMessage )
 {
    /*
-   ** This function processes commands to the BACnet Instance 1.
+   ** PORTING ALERT!
+   **
+   ** If the Object Name attribute only supports GET its value can come
+   ** from a hard-coded string, but if it also supports SET its value
+   ** will normally come from local NVS.
+   **
+   ** In this example a hard-coded value is used when only GET is
+   ** supported, a RAM buffer is used if SET is supported.
    */
-   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
-   {
-      /*
-      ** The Instance does not exist.
-      */
-      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
-      return;
-   }
-
-   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
-   {
-   case ABP_CMD_GET_ATTR:
+   UINT16 iStrLength;
 
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if BAC_IA_OBJECT_NAME_ENABLE
-      case ABP_BAC_IA_OBJECT_NAME:
-      {
-         /*
-         ** PORTING ALERT!
-         **
-         ** If the Object Name attribute only supports GET its value can come
-         ** from a hard-coded string, but if it also supports SET its value
-         ** will normally come from local NVS.
-         **
-         ** In this example a hard-coded value is used when only GET is
-         ** supported, a RAM buffer is used if SET is supported.
-         */
-         UINT16 iStrLength;
-
-#if BAC_IA_OBJECT_NAME_SET
-         iStrLength = (UINT16)strnlen( bac_abObjectNameValue, ABP_BAC_IA_OBJECT_NAME_MAX_DS );
-         ABCC_SetMsgString( psNewMessage, bac_abObjectNameValue, iStrLength, 0 );
-#else
-         iStrLength = (UINT16)strnlen( BAC_IA_OBJECT_NAME_VALUE, ABP_BAC_IA_OBJECT_NAME_MAX_DS );
-         ABCC_SetMsgString( psNewMessage, BAC_IA_OBJECT_NAME_VALUE, iStrLength, 0 );
-#endif
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-
-         break;
-      }
-#endif
-#if BAC_IA_VENDOR_NAME_ENABLE
-      case ABP_BAC_IA_VENDOR_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strnlen( BAC_IA_VENDOR_NAME_VALUE, ABP_BAC_IA_VENDOR_NAME_MAX_DS );
-         ABCC_SetMsgString( psNewMessage, BAC_IA_VENDOR_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-
-         break;
-      }
-#endif
-#if BAC_IA_VENDOR_IDENTIFIER_ENABLE
-      case ABP_BAC_IA_VENDOR_IDENTIFIER:
-         ABCC_SetMsgData16( psNewMessage, BAC_IA_VENDOR_IDENTIFIER_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_BAC_IA_VENDOR_IDENTIFIER_DS );
-
-         break;
-#endif
-#if BAC_IA_MODEL_NAME_ENABLE
-      case ABP_BAC_IA_MODEL_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strnlen( BAC_IA_MODEL_NAME_VALUE, ABP_BAC_IA_MODEL_NAME_MAX_DS );
-         ABCC_SetMsgString( psNewMessage, BAC_IA_MODEL_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-
-         break;
-      }
-#endif
-#if BAC_IA_FIRMWARE_REVISION_ENABLE
-      case ABP_BAC_IA_FIRMWARE_REVISION:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strnlen( BAC_IA_FIRMWARE_REVISION_VALUE, ABP_BAC_IA_FIRMWARE_REVISION_MAX_DS );
-         ABCC_SetMsgString( psNewMessage, BAC_IA_FIRMWARE_REVISION_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-
-         break;
-      }
-#endif
-#if BAC_IA_APP_SOFTWARE_VERSION_ENABLE
-      case ABP_BAC_IA_APP_SOFTWARE_VERSION:
-      {
-         UINT16 iStrLength;
+   iStrLength = (UINT16)strnlen( bac_abObjectNameValue, ABP_BAC_IA_OBJECT_NAME_MAX_DS );
+   ABCC_SetMsgString( psNewMessage, bac_abObjectNameValue, iStrLength, 0 );
+   ABP_SetMsgResponse( psNewMessage, iStrLength );
+}
 
-         iStrLength = (UINT16)strnlen( BAC_IA_APP_SOFTWARE_VERSION_VALUE, ABP_BAC_IA_APP_SOFTWARE_VERSION_MAX_DS );
-         ABCC_SetMsgString( psNewMessage, BAC_IA_APP_SOFTWARE_VERSION_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
+static void bac_SetObjectName( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** PORTING ALERT!
+   **
+   ** If the Object Name attribute supports SET the new value should be
+   ** saved in local NVS.
+   **
+   ** In this example a local buffer is used to hold the value, it is
+   ** not saved to NVS.
+   */
+   UINT16 iStrLength;
 
-         break;
-      }
+   iStrLength = ABCC_GetMsgDataSize( psNewMessage );
+   if( iStrLength > ABP_BAC_IA_OBJECT_NAME_MAX_DS )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
+   }
+   else if( iStrLength < 1 )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
+   }
+   else
+   {
+      ABCC_GetMsgString( psNewMessage, bac_abObjectNameValue, iStrLength, 0 );
+      bac_abObjectNameValue[ iStrLength ] = 0;
+      ABP_SetMsgResponse( psNewMessage, 0 );
+   }
+}
 #endif
-#if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE
-      case ABP_BAC_IA_SUPPORT_ADV_MAPPING:
-         ABCC_SetMsgData8( psNewMessage, BAC_IA_SUPPORT_ADV_MAPPING_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_BAC_IA_SUPPORT_ADV_MAPPING_DS );
 
-         break;
-#endif
 #if BAC_IA_CURR_DATE_AND_TIME_ENABLE
-      case ABP_BAC_IA_CURRENT_DATE_AND_TIME:
-      {
-         ABCC_TIME_DateAndTimeType sTime;
-         memset( &sTime, 0, sizeof( sTime ) );
+/*------------------------------------------------------------------------------
+** Get/set of the Current Date And Time attribute.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void bac_GetCurrentDateAndTime( ABP_MsgType* psNewMessage )
+{
+   ABCC_TIME_DateAndTimeType sTime;
+   memset( &sTime, 0, sizeof( sTime ) );
 
-         if( !ABCC_TIME_GetDateAndTime( &sTime ) )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_GETABLE );
-            break;
-         }
+   if( !ABCC_TIME_GetDateAndTime( &sTime ) )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_GETABLE );
+      return;
+   }
 
-         ABCC_SetMsgData16( psNewMessage, sTime.iYear, 0 );
-         ABCC_SetMsgData8( psNewMessage, sTime.bMonth, 2 );
-         ABCC_SetMsgData8( psNewMessage, sTime.bDay, 3 );
-         ABCC_SetMsgData8( psNewMessage, sTime.bHour, 4 );
-         ABCC_SetMsgData8( psNewMessage, sTime.bMinute, 5 );
-         ABCC_SetMsgData8( psNewMessage, sTime.bSecond, 6 );
+   ABCC_SetMsgData16( psNewMessage, sTime.iYear, 0 );
+   ABCC_SetMsgData8( psNewMessage, sTime.bMonth, 2 );
+   ABCC_SetMsgData8( psNewMessage, sTime.bDay, 3 );
+   ABCC_SetMsgData8( psNewMessage, sTime.bHour, 4 );
+   ABCC_SetMsgData8( psNewMessage, sTime.bMinute, 5 );
+   ABCC_SetMsgData8( psNewMessage, sTime.bSecond, 6 );
 
-         ABP_SetMsgResponse( psNewMessage, ABP_BAC_IA_CURRENT_DATE_AND_TIME_DS );
+   ABP_SetMsgResponse( psNewMessage, ABP_BAC_IA_CURRENT_DATE_AND_TIME_DS );
+}
 
-         break;
-      }
-#endif
-#if BAC_IA_PASSWORD_ENABLE
-      case ABP_BAC_IA_PASSWORD:
-      {
-         UINT16 iStrLength;
+#if BAC_IA_CURR_DATE_AND_TIME_SET
+static void bac_SetCurrentDateAndTime( ABP_MsgType* psNewMessage )
+{
+   ABCC_TIME_DateAndTimeType sTime;
+   memset( &sTime, 0, sizeof( sTime ) );
 
-         iStrLength = (UINT16)strnlen( BAC_IA_PASSWORD_VALUE, ABP_BAC_IA_PASSWORD_MAX_DS );
-         ABCC_SetMsgString( psNewMessage, BAC_IA_PASSWORD_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
+   ABCC_GetMsgData16( psNewMessage, &sTime.iYear, 0 );
+   ABCC_GetMsgData8( psNewMessage, &sTime.bMonth, 2 );
+   ABCC_GetMsgData8( psNewMessage, &sTime.bDay, 3 );
+   ABCC_GetMsgData8( psNewMessage, &sTime.bHour, 4 );
+   ABCC_GetMsgData8( psNewMessage, &sTime.bMinute, 5 );
+   ABCC_GetMsgData8( psNewMessage, &sTime.bSecond, 6 );
 
-         break;
-      }
+   if( ABCC_TIME_SetDateAndTime( &sTime ) )
+   {
+      ABP_SetMsgResponse( psNewMessage, 0 );
+   }
+   else
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
+   }
+}
+#endif
 #endif
 
-      default:
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-
-         break;
-
-      } /* End of switch( attribute number )" */
-
-      break; /* End of ABP_CMD_GET_ATTR */
-
-   case ABP_CMD_SET_ATTR:
+/*------------------------------------------------------------------------------
+** Object (instance 0) and instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType bac_asObjAttr[] =
+{
+   ABCC_HOST_ATTR_OBJECT( BAC_OA_NAME_VALUE, BAC_OA_REV_VALUE,
+                          BAC_OA_NUM_INST_VALUE, BAC_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
+static const ABCC_HostAttrType bac_asInstAttr[] =
+{
 #if BAC_IA_OBJECT_NAME_ENABLE
-      case ABP_BAC_IA_OBJECT_NAME:
-      {
-         /*
-         ** PORTING ALERT!
-         **
-         ** If the Object Name attribute supports SET the new value should be
-         ** saved in local NVS.
-         **
-         ** In this example a local buffer is used to hold the value, it is
-         ** not saved to NVS.
-         */
 #if BAC_IA_OBJECT_NAME_SET
-         UINT16 iStrLength;
-
-         iStrLength = ABCC_GetMsgDataSize( psNewMessage );
-         if( iStrLength > ABP_BAC_IA_OBJECT_NAME_MAX_DS )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
-         }
-         else if( iStrLength < 1 )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
-         }
-         else
-         {
-            ABCC_GetMsgString( psNewMessage, bac_abObjectNameValue, iStrLength, 0 );
-            bac_abObjectNameValue[ iStrLength ] = 0;
-            ABP_SetMsgResponse( psNewMessage, 0 );
-         }
+   ABCC_HOST_ATTR_FUNC( ABP_BAC_IA_OBJECT_NAME,
+                        bac_GetObjectName, bac_SetObjectName ),
 #else
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
+   ABCC_HOST_ATTR_STR_MAX( ABP_BAC_IA_OBJECT_NAME,
+                           BAC_IA_OBJECT_NAME_VALUE,
+                           ABP_BAC_IA_OBJECT_NAME_MAX_DS ),
 #endif
-         break;
-      }
-#endif
-#if BAC_IA_CURR_DATE_AND_TIME_ENABLE
-      case ABP_BAC_IA_CURRENT_DATE_AND_TIME:
-      {
-
-#if BAC_IA_CURR_DATE_AND_TIME_SET
-         ABCC_TIME_DateAndTimeType sTime;
-         memset( &sTime, 0, sizeof( sTime ) );
-
-         ABCC_GetMsgData16( psNewMessage, &sTime.iYear, 0 );
-         ABCC_GetMsgData8( psNewMessage, &sTime.bMonth, 2 );
-         ABCC_GetMsgData8( psNewMessage, &sTime.bDay, 3 );
-         ABCC_GetMsgData8( psNewMessage, &sTime.bHour, 4 );
-         ABCC_GetMsgData8( psNewMessage, &sTime.bMinute, 5 );
-         ABCC_GetMsgData8( psNewMessage, &sTime.bSecond, 6 );
-
-         if( ABCC_TIME_SetDateAndTime( &sTime ) )
-         {
-            ABP_SetMsgResponse( psNewMessage, 0 );
-         }
-         else
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         }
-#else
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-#endif
-         break;
-      }
 #endif
 #if BAC_IA_VENDOR_NAME_ENABLE
-      case ABP_BAC_IA_VENDOR_NAME:
+   ABCC_HOST_ATTR_STR_MAX( ABP_BAC_IA_VENDOR_NAME,
+                           BAC_IA_VENDOR_NAME_VALUE,
+                           ABP_BAC_IA_VENDOR_NAME_MAX_DS ),
 #endif
 #if BAC_IA_VENDOR_IDENTIFIER_ENABLE
-      case ABP_BAC_IA_VENDOR_IDENTIFIER:
+   ABCC_HOST_ATTR_U16( ABP_BAC_IA_VENDOR_IDENTIFIER,
+                       BAC_IA_VENDOR_IDENTIFIER_VALUE ),
 #endif
 #if BAC_IA_MODEL_NAME_ENABLE
-      case ABP_BAC_IA_MODEL_NAME:
+   ABCC_HOST_ATTR_STR_MAX( ABP_BAC_IA_MODEL_NAME,
+                           BAC_IA_MODEL_NAME_VALUE,
+                           ABP_BAC_IA_MODEL_NAME_MAX_DS ),
 #endif
 #if BAC_IA_FIRMWARE_REVISION_ENABLE
-      case ABP_BAC_IA_FIRMWARE_REVISION:
+   ABCC_HOST_ATTR_STR_MAX( ABP_BAC_IA_FIRMWARE_REVISION,
+                           BAC_IA_FIRMWARE_REVISION_VALUE,
+                           ABP_BAC_IA_FIRMWARE_REVISION_MAX_DS ),
 #endif
 #if BAC_IA_APP_SOFTWARE_VERSION_ENABLE
-      case ABP_BAC_IA_APP_SOFTWARE_VERSION:
+   ABCC_HOST_ATTR_STR_MAX( ABP_BAC_IA_APP_SOFTWARE_VERSION,
+                           BAC_IA_APP_SOFTWARE_VERSION_VALUE,
+                           ABP_BAC_IA_APP_SOFTWARE_VERSION_MAX_DS ),
 #endif
 #if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE
-      case ABP_BAC_IA_SUPPORT_ADV_MAPPING:
+   ABCC_HOST_ATTR_U8( ABP_BAC_IA_SUPPORT_ADV_MAPPING,
+                      BAC_IA_SUPPORT_ADV_MAPPING_VALUE ),
 #endif
-#if BAC_IA_PASSWORD_ENABLE
-      case ABP_BAC_IA_PASSWORD:
+#if BAC_IA_CURR_DATE_AND_TIME_ENABLE
+#if BAC_IA_CURR_DATE_AND_TIME_SET
+   ABCC_HOST_ATTR_FUNC( ABP_BAC_IA_CURRENT_DATE_AND_TIME,
+                        bac_GetCurrentDateAndTime, bac_SetCurrentDateAndTime ),
+#else
+   ABCC_HOST_ATTR_FUNC( ABP_BAC_IA_CURRENT_DATE_AND_TIME,
+                        bac_GetCurrentDateAndTime, NULL ),
 #endif
-#if ( BAC_IA_VENDOR_NAME_ENABLE ) ||            \
-    ( BAC_IA_VENDOR_IDENTIFIER_ENABLE ) ||      \
-    ( BAC_IA_MODEL_NAME_ENABLE ) ||             \
-    ( BAC_IA_FIRMWARE_REVISION_ENABLE ) ||      \
-    ( BAC_IA_APP_SOFTWARE_VERSION_ENABLE ) ||   \
-    ( BAC_IA_SUPPORT_ADV_MAPPING_ENABLE ) ||    \
-    ( BAC_IA_PASSWORD_ENABLE )
-         /*
-         ** ABP_ERR_ATTR_NOT_SETABLE response for all GET-only attributes.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-
-         break;
 #endif
+#if BAC_IA_PASSWORD_ENABLE
+   ABCC_HOST_ATTR_STR_MAX( ABP_BAC_IA_PASSWORD,
+                           BAC_IA_PASSWORD_VALUE,
+                           ABP_BAC_IA_PASSWORD_MAX_DS ),
+#endif
+   ABCC_HOST_ATTR_END
+};
 
-      default:
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-
-         break;
+/*------------------------------------------------------------------------------
+** Processes commands to BACnet host object Instances
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void bac_InstanceCommand( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** This function processes commands to the BACnet Instance 1.
+   */
+   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
+   {
+      /*
+      ** The Instance does not exist.
+      */
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
+      return;
+   }
 
-      } /* End of switch( attribute number )" */
+   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   {
+   case ABP_CMD_GET_ATTR:
+   case ABP_CMD_SET_ATTR:
 
-      break; /* End of ABP_CMD_SET_ATTR */
+      ABCC_HostAttrCommand( psNewMessage, bac_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( bac_asInstAttr ) );
+      break;
 
    default:
       /*
@@ -457,79 +473,293 @@ static void bac_InstanceCommand( ABP_MsgType* psNewMessage )
    } /* End of switch( command number ) */
 }
 
-static void bac_ObjectCommandGetAttr( ABP_MsgType* psNewMessage )
+#if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE
+
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 )
+/*------------------------------------------------------------------------------
+** Calculates the home slot of a key in a hash table.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psIndex           - Hash table.
+**    lKey              - Key (object type and instance, or name hash).
+**
+** Returns:
+**    Slot number.
+**------------------------------------------------------------------------------
+*/
+static UINT16 bac_HashSlot( const bac_HashIndexType* psIndex, UINT32 lKey )
+{
+   return( (UINT16)( ( ( lKey * BAC_HASH_MULTIPLIER ) & 0xffffffffUL ) >>
+                     psIndex->bHashShift ) );
+}
+
+/*------------------------------------------------------------------------------
+** Calculates the hash table key of a BACnet object type and instance.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iObjType          - BACnet object type.
+**    lInstance         - BACnet object instance.
+**
+** Returns:
+**    Key.
+**------------------------------------------------------------------------------
+*/
+static UINT32 bac_ObjInstKey( UINT16 iObjType, UINT32 lInstance )
+{
+   return( ( (UINT32)iObjType << 16 ) ^ lInstance );
+}
+
+/*------------------------------------------------------------------------------
+** Adds one character to a name hash (FNV-1a).
+**------------------------------------------------------------------------------
+** Arguments:
+**    lHash             - Hash so far, BAC_NAME_HASH_INIT for the first one.
+**    bChar             - Character.
+**
+** Returns:
+**    Updated hash.
+**------------------------------------------------------------------------------
+*/
+static UINT32 bac_NameHashAdd( UINT32 lHash, UINT8 bChar )
+{
+   return( ( ( lHash ^ bChar ) * BAC_NAME_HASH_PRIME ) & 0xffffffffUL );
+}
+
+/*------------------------------------------------------------------------------
+** Sizes and clears a hash table for a number of keys. The smallest power of
+** two number of slots that keeps the load factor at or below 3/4 is used,
+** never more than BAC_ADV_MAPPING_INDEX_SIZE.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psIndex           - Hash table.
+**    iNumKeys          - Number of keys that will be inserted.
+**
+** Returns:
+**    TRUE if the keys fit, FALSE if the table is left unused.
+**------------------------------------------------------------------------------
+*/
+static BOOL bac_HashIndexInit( bac_HashIndexType* psIndex, UINT16 iNumKeys )
 {
-   switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
+   UINT16 i;
+
+   psIndex->iNumSlots = 0;
+
+   if( ( iNumKeys == 0 ) ||
+       ( ( (UINT32)iNumKeys * 4 ) > ( (UINT32)BAC_ADV_MAPPING_INDEX_SIZE * 3 ) ) )
    {
-   case ABP_OA_NAME:
+      return( FALSE );
+   }
+
+   psIndex->iNumSlots = 1;
+   psIndex->bHashShift = 32;
+   while( ( ( (UINT32)psIndex->iNumSlots * 3 ) < ( (UINT32)iNumKeys * 4 ) ) &&
+          ( ( psIndex->iNumSlots << 1 ) <= BAC_ADV_MAPPING_INDEX_SIZE ) )
    {
-      UINT16   iStrLength;
+      psIndex->iNumSlots <<= 1;
+      psIndex->bHashShift--;
+   }
 
-      iStrLength = (UINT16)strlen( BAC_OA_NAME_VALUE );
-      ABCC_SetMsgString( psNewMessage, BAC_OA_NAME_VALUE, iStrLength, 0 );
-      ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
+   if( ( (UINT32)psIndex->iNumSlots * 3 ) < ( (UINT32)iNumKeys * 4 ) )
+   {
+      psIndex->iNumSlots = 0;
+      return( FALSE );
+   }
 
-      break;
+   for( i = 0; i < psIndex->iNumSlots; i++ )
+   {
+      psIndex->aiSlot[ i ] = ABCC_ADI_INDEX_NOT_FOUND;
    }
 
-   case ABP_OA_REV:
-      ABCC_SetMsgData8( psNewMessage, BAC_OA_REV_VALUE, 0 );
-      ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
+   return( TRUE );
+}
 
-      break;
+/*------------------------------------------------------------------------------
+** Inserts an object list index in a hash table. Entries with equal keys are
+** found in insertion order, so the first matching object list entry is
+** returned just like a linear scan would.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psIndex           - Hash table.
+**    lKey              - Key.
+**    iIndex            - Object list (and ADI list) index.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void bac_HashIndexInsert( bac_HashIndexType* psIndex, UINT32 lKey, UINT16 iIndex )
+{
+   UINT16 iSlot;
 
-   case ABP_OA_NUM_INST:
-      ABCC_SetMsgData16( psNewMessage, BAC_OA_NUM_INST_VALUE, 0 );
-      ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
+   iSlot = bac_HashSlot( psIndex, lKey );
+   while( psIndex->aiSlot[ iSlot ] != ABCC_ADI_INDEX_NOT_FOUND )
+   {
+      iSlot = ( iSlot + 1 ) & ( psIndex->iNumSlots - 1 );
+   }
+   psIndex->aiSlot[ iSlot ] = iIndex;
+}
+#endif /* BAC_ADV_MAPPING_INDEX_SIZE > 0 */
 
-      break;
+/*------------------------------------------------------------------------------
+** Compares an ADI name with the object name in a request.
+**
+** Manual strcmp() on the message data. Using the standard library strcmp()
+** would require copying the message data to a local temporary buffer, but a
+** BACnet object name can be up to 252 bytes, which might be a bit too much to
+** allocate from the stack in an embedded system.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**    iStrLen           - Length of the name in the message.
+**    pacName           - ADI name.
+**
+** Returns:
+**    TRUE if the names are equal.
+**------------------------------------------------------------------------------
+*/
+static BOOL bac_NameMatch( ABP_MsgType* psNewMessage,
+                           UINT16 iStrLen,
+                           const char* pacName )
+{
+   UINT8    bTmpChar;
+   UINT16   j;
 
-   case ABP_OA_HIGHEST_INST:
-      ABCC_SetMsgData16( psNewMessage, BAC_OA_HIGHEST_INST_VALUE, 0 );
-      ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
+   if( pacName == NULL )
+   {
+      return( FALSE );
+   }
 
-      break;
+   for( j = 0; j < iStrLen; j++ )
+   {
+      ABCC_GetMsgData8( psNewMessage, &bTmpChar, j );
+      if( ( pacName[ j ] == 0 ) || ( (UINT8)pacName[ j ] != bTmpChar ) )
+      {
+         return( FALSE );
+      }
+   }
 
-   default:
-      /*
-      ** Unsupported attribute.
-      */
-      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
+   return( pacName[ j ] == 0 );
+}
 
-      break;
+/*------------------------------------------------------------------------------
+** Finds the object list entry of a BACnet object type and instance.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iObjType          - BACnet object type.
+**    lInstance         - BACnet object instance, less than
+**                        BAC_MAX_OBJECT_INSTANCE_NUMBERS.
+**
+** Returns:
+**    Object list (and ADI list) index, or ABCC_ADI_INDEX_NOT_FOUND.
+**------------------------------------------------------------------------------
+*/
+static UINT16 bac_FindObjInst( UINT16 iObjType, UINT32 lInstance )
+{
+   UINT16   iNumOfAdis;
+   UINT16   i;
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 )
+   UINT16   iSlot;
+
+   if( bac_sObjInstIndex.iNumSlots != 0 )
+   {
+      iSlot = bac_HashSlot( &bac_sObjInstIndex,
+                            bac_ObjInstKey( iObjType, lInstance ) );
+      while( ( i = bac_sObjInstIndex.aiSlot[ iSlot ] ) != ABCC_ADI_INDEX_NOT_FOUND )
+      {
+         if( ( BAC_asObjectList[ i ].iObjType == iObjType ) &&
+             ( BAC_asObjectList[ i ].lInstance == lInstance ) )
+         {
+            return( i );
+         }
+         iSlot = ( iSlot + 1 ) & ( bac_sObjInstIndex.iNumSlots - 1 );
+      }
+      return( ABCC_ADI_INDEX_NOT_FOUND );
+   }
+#endif
+
+   iNumOfAdis = APPL_GetNumAdi();
+   for( i = 0; i < iNumOfAdis; i++ )
+   {
+      if( ( BAC_asObjectList[ i ].iObjType == iObjType ) &&
+          ( BAC_asObjectList[ i ].lInstance == lInstance ) )
+      {
+         return( i );
+      }
+   }
 
-   } /* End of switch( attribute number ) */
+   return( ABCC_ADI_INDEX_NOT_FOUND );
 }
 
-#if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE
+/*------------------------------------------------------------------------------
+** Finds the ADI list entry with the object name given in a request.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**    iStrLen           - Length of the name in the message.
+**
+** Returns:
+**    ADI list (and object list) index, or ABCC_ADI_INDEX_NOT_FOUND.
+**------------------------------------------------------------------------------
+*/
+static UINT16 bac_FindObjInstName( ABP_MsgType* psNewMessage, UINT16 iStrLen )
+{
+   UINT16   iNumOfAdis;
+   UINT16   i;
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 )
+   UINT16   iSlot;
+   UINT32   lHash;
+   UINT8    bTmpChar;
+
+   if( bac_sNameIndex.iNumSlots != 0 )
+   {
+      lHash = BAC_NAME_HASH_INIT;
+      for( i = 0; i < iStrLen; i++ )
+      {
+         ABCC_GetMsgData8( psNewMessage, &bTmpChar, i );
+         lHash = bac_NameHashAdd( lHash, bTmpChar );
+      }
+
+      iSlot = bac_HashSlot( &bac_sNameIndex, lHash );
+      while( ( i = bac_sNameIndex.aiSlot[ iSlot ] ) != ABCC_ADI_INDEX_NOT_FOUND )
+      {
+         if( bac_NameMatch( psNewMessage, iStrLen, APPL_asAdiEntryList[ i ].pacName ) )
+         {
+            return( i );
+         }
+         iSlot = ( iSlot + 1 ) & ( bac_sNameIndex.iNumSlots - 1 );
+      }
+      return( ABCC_ADI_INDEX_NOT_FOUND );
+   }
+#endif
+
+   iNumOfAdis = APPL_GetNumAdi();
+   for( i = 0; i < iNumOfAdis; i++ )
+   {
+      if( bac_NameMatch( psNewMessage, iStrLen, APPL_asAdiEntryList[ i ].pacName ) )
+      {
+         return( i );
+      }
+   }
+
+   return( ABCC_ADI_INDEX_NOT_FOUND );
+}
 
 static void bac_ObjectCommandGetAdiByBacnetObjInst( ABP_MsgType* psNewMessage )
 {
    UINT16   iReqObjType;
    UINT32   lReqInstance;
-   BOOL     fMatch;
-   UINT16   iNumOfAdis;
    UINT16   i;
 
    ABCC_GetMsgData16( psNewMessage, &iReqObjType, 0 );
    ABCC_GetMsgData32( psNewMessage, &lReqInstance, 2 );
 
-   fMatch = FALSE;
+   i = ABCC_ADI_INDEX_NOT_FOUND;
    if( lReqInstance < BAC_MAX_OBJECT_INSTANCE_NUMBERS )
    {
-      iNumOfAdis = APPL_GetNumAdi();
-      for( i = 0; i < iNumOfAdis; i++ )
-      {
-         if( ( BAC_asObjectList[ i ].iObjType == iReqObjType ) &&
-             ( BAC_asObjectList[ i ].lInstance == lReqInstance ) )
-         {
-            fMatch = TRUE;
-            break;
-         }
-      }
+      i = bac_FindObjInst( iReqObjType, lReqInstance );
    }
 
-   if( fMatch )
+   if( i != ABCC_ADI_INDEX_NOT_FOUND )
    {
       ABCC_SetMsgData16( psNewMessage, APPL_asAdiEntryList[ i ].iInstance, 0 );
       ABP_SetMsgResponse( psNewMessage, ABP_UINT16_SIZEOF );
@@ -543,12 +773,9 @@ static void bac_ObjectCommandGetAdiByBacnetObjInst( ABP_MsgType* psNewMessage )
 static void bac_ObjectCommandGetAdiByBacnetObjInstName( ABP_MsgType* psNewMessage )
 {
    UINT8    bErrCode;
-   BOOL     fMatch;
-   UINT16   iNumOfAdis;
    UINT8    bTmpChar;
    UINT16   iStrLen;
    UINT16   i;
-   UINT16   j;
 
    bErrCode = ABP_ERR_NO_ERROR;
 
@@ -572,47 +799,9 @@ static void bac_ObjectCommandGetAdiByBacnetObjInstName( ABP_MsgType* psNewMessag
 
    if( bErrCode == ABP_ERR_NO_ERROR )
    {
-      fMatch = FALSE;
-      iNumOfAdis = APPL_GetNumAdi();
-      for( i = 0; i < iNumOfAdis; i++ )
-      {
-         if( APPL_asAdiEntryList[ i ].pacName != NULL )
-         {
-            if( APPL_asAdiEntryList[ i ].pacName[ 0 ] != 0 )
-            {
-               /*
-               ** Manual strcmp() on the message data. Using the standard
-               ** library strcmp() would require copying the message data
-               ** to a local temporary buffer, but a BACnet object name can
-               ** be up to 252 bytes, which might be a bit too much to
-               ** allocate from the stack in an embedded system.
-               */
-               fMatch = TRUE;
-               for( j = 0; j < iStrLen; j++ )
-               {
-                  ABCC_GetMsgData8( psNewMessage, &bTmpChar, j );
-                  if( APPL_asAdiEntryList[ i ].pacName[ j ] != bTmpChar )
-                  {
-                     fMatch = FALSE;
-                     break;
-                  }
-               }
-               if( fMatch )
-               {
-                  if( APPL_asAdiEntryList[ i ].pacName[ j ] != 0 )
-                  {
-                     fMatch = FALSE;
-                  }
-               }
-            }
-         }
-         if( fMatch )
-         {
-            break;
-         }
-      }
+      i = bac_FindObjInstName( psNewMessage, iStrLen );
 
-      if( fMatch )
+      if( i != ABCC_ADI_INDEX_NOT_FOUND )
       {
          ABCC_SetMsgData16( psNewMessage, APPL_asAdiEntryList[ i ].iInstance, 0 );
          ABCC_SetMsgData16( psNewMessage, BAC_asObjectList[ i ].iObjType, 2 );
@@ -641,6 +830,23 @@ static void bac_ObjectCommandGetAllBacnetObjInstances( ABP_MsgType* psNewMessage
 
    ABCC_GetMsgData16( psNewMessage, &iReqObjType, 0 );
 
+#if( BAC_ADV_MAPPING_BITMAP_TYPES > 0 )
+   /*
+   ** Use the bitmap built by BAC_Init() if there is one for this type.
+   */
+   for( i = 0; i < bac_bNumTypeBitmaps; i++ )
+   {
+      if( bac_asTypeBitmap[ i ].iObjType == iReqObjType )
+      {
+         ABCC_PORT_CopyOctets( ABCC_GetMsgDataPtr( psNewMessage ), 0,
+                               bac_asTypeBitmap[ i ].aiBitmap, 0,
+                               BAC_CMD_GET_ALL_OBJ_INST_LENGTH );
+         ABP_SetMsgResponse( psNewMessage, BAC_CMD_GET_ALL_OBJ_INST_LENGTH );
+         return;
+      }
+   }
+#endif
+
    /*
    ** The response contains BAC_CMD_GET_ALL_OBJ_INST_LENGTH bytes of bitmap,
    ** clear this so that we only need to set the correct bits in the next loop.
@@ -651,6 +857,17 @@ static void bac_ObjectCommandGetAllBacnetObjInstances( ABP_MsgType* psNewMessage
    }
    ABP_SetMsgResponse( psNewMessage, BAC_CMD_GET_ALL_OBJ_INST_LENGTH );
 
+#if( BAC_ADV_MAPPING_BITMAP_TYPES > 0 )
+   if( bac_fTypeBitmapsComplete )
+   {
+      /*
+      ** All types in the object list have a bitmap, so there are no objects
+      ** of this type.
+      */
+      return;
+   }
+#endif
+
    /*
    ** Each bit represents one BACnet object, step through the object list
    ** and set the corresponding bit in the message data field for objects
@@ -676,26 +893,22 @@ static void bac_ObjectCommandGetBacnetObjInstByAdi( ABP_MsgType* psNewMessage )
 {
    UINT16   iReqAdi;
    UINT16   iNumOfAdis;
-   BOOL     fMatch;
    UINT16   i;
 
    ABCC_GetMsgData16( psNewMessage, &iReqAdi, 0 );
 
-   fMatch = FALSE;
+   i = ABCC_ADI_INDEX_NOT_FOUND;
    iNumOfAdis = APPL_GetNumAdi();
    if( iReqAdi < iNumOfAdis )
    {
-      for( i = 0; i < iNumOfAdis; i++ )
-      {
-         if( APPL_asAdiEntryList[ i ].iInstance == iReqAdi )
-         {
-            fMatch = TRUE;
-            break;
-         }
-      }
+      /*
+      ** The ADI list and the object list match 1:1, so the ADI list index is
+      ** also the object list index.
+      */
+      i = ABCC_AdiIndexFind( APPL_asAdiEntryList, iNumOfAdis, iReqAdi );
    }
 
-   if( fMatch )
+   if( i != ABCC_ADI_INDEX_NOT_FOUND )
    {
       ABCC_SetMsgData16( psNewMessage, BAC_asObjectList[ i ].iObjType, 0 );
       ABCC_SetMsgData32( psNewMessage, BAC_asObjectList[ i ].lInstance, 2 );
@@ -708,6 +921,130 @@ static void bac_ObjectCommandGetBacnetObjInstByAdi( ABP_MsgType* psNewMessage )
 }
 #endif /* BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE */
 
+void BAC_Init( void )
+{
+#if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 ) || ( BAC_ADV_MAPPING_BITMAP_TYPES > 0 )
+   UINT16   iNumOfAdis;
+   UINT16   i;
+#endif
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 )
+   UINT16   iNumObjInst;
+   UINT16   iNumNames;
+   UINT32   lHash;
+   UINT16   j;
+#endif
+#if( BAC_ADV_MAPPING_BITMAP_TYPES > 0 )
+   UINT8    bType;
+   UINT16   iByteOffset;
+   UINT8    bValue;
+#endif
+
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 ) || ( BAC_ADV_MAPPING_BITMAP_TYPES > 0 )
+   iNumOfAdis = APPL_GetNumAdi();
+#endif
+
+#if( BAC_ADV_MAPPING_INDEX_SIZE > 0 )
+   /*
+   ** Objects with instance numbers out of range, e.g. BAC_OBJ_TYPE_IGNORE,
+   ** can never be requested and ADIs without a name can never match, so
+   ** those are left out of the hash tables.
+   */
+   iNumObjInst = 0;
+   iNumNames = 0;
+   for( i = 0; i < iNumOfAdis; i++ )
+   {
+      if( BAC_asObjectList[ i ].lInstance < BAC_MAX_OBJECT_INSTANCE_NUMBERS )
+      {
+         iNumObjInst++;
+      }
+      if( ( APPL_asAdiEntryList[ i ].pacName != NULL ) &&
+          ( APPL_asAdiEntryList[ i ].pacName[ 0 ] != 0 ) )
+      {
+         iNumNames++;
+      }
+   }
+
+   if( bac_HashIndexInit( &bac_sObjInstIndex, iNumObjInst ) )
+   {
+      for( i = 0; i < iNumOfAdis; i++ )
+      {
+         if( BAC_asObjectList[ i ].lInstance < BAC_MAX_OBJECT_INSTANCE_NUMBERS )
+         {
+            bac_HashIndexInsert( &bac_sObjInstIndex,
+                                 bac_ObjInstKey( BAC_asObjectList[ i ].iObjType,
+                                                 BAC_asObjectList[ i ].lInstance ),
+                                 i );
+         }
+      }
+   }
+
+   if( bac_HashIndexInit( &bac_sNameIndex, iNumNames ) )
+   {
+      for( i = 0; i < iNumOfAdis; i++ )
+      {
+         if( ( APPL_asAdiEntryList[ i ].pacName != NULL ) &&
+             ( APPL_asAdiEntryList[ i ].pacName[ 0 ] != 0 ) )
+         {
+            lHash = BAC_NAME_HASH_INIT;
+            for( j = 0; APPL_asAdiEntryList[ i ].pacName[ j ] != 0; j++ )
+            {
+               lHash = bac_NameHashAdd( lHash,
+                                        (UINT8)APPL_asAdiEntryList[ i ].pacName[ j ] );
+            }
+            bac_HashIndexInsert( &bac_sNameIndex, lHash, i );
+         }
+      }
+   }
+#endif
+
+#if( BAC_ADV_MAPPING_BITMAP_TYPES > 0 )
+   /*
+   ** Build the Get_All_BACnet_Object_Instances bitmap of the first
+   ** BAC_ADV_MAPPING_BITMAP_TYPES object types found in the object list.
+   */
+   bac_bNumTypeBitmaps = 0;
+   bac_fTypeBitmapsComplete = TRUE;
+   for( i = 0; i < iNumOfAdis; i++ )
+   {
+      if( BAC_asObjectList[ i ].lInstance >= BAC_MAX_OBJECT_INSTANCE_NUMBERS )
+      {
+         continue;
+      }
+
+      for( bType = 0; bType < bac_bNumTypeBitmaps; bType++ )
+      {
+         if( bac_asTypeBitmap[ bType ].iObjType == BAC_asObjectList[ i ].iObjType )
+         {
+            break;
+         }
+      }
+
+      if( bType == bac_bNumTypeBitmaps )
+      {
+         if( bac_bNumTypeBitmaps == BAC_ADV_MAPPING_BITMAP_TYPES )
+         {
+            bac_fTypeBitmapsComplete = FALSE;
+            continue;
+         }
+
+         bac_asTypeBitmap[ bType ].iObjType = BAC_asObjectList[ i ].iObjType;
+         for( iByteOffset = 0; iByteOffset < BAC_CMD_GET_ALL_OBJ_INST_LENGTH; iByteOffset++ )
+         {
+            ABCC_SetData8( bac_asTypeBitmap[ bType ].aiBitmap, 0, iByteOffset );
+         }
+         bac_bNumTypeBitmaps++;
+      }
+
+      iByteOffset = (UINT16)( BAC_asObjectList[ i ].lInstance >> 3 );
+      ABCC_GetData8( bac_asTypeBitmap[ bType ].aiBitmap, &bValue, iByteOffset );
+      bValue = bValue | 1 << ( BAC_asObjectList[ i ].lInstance & 7 );
+      ABCC_SetData8( bac_asTypeBitmap[ bType ].aiBitmap, bValue, iByteOffset );
+   }
+#endif
+#endif /* BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE */
+}
+
 /*------------------------------------------------------------------------------
 ** Processes commands to the BACnet host object (Instance 0)
 **------------------------------------------------------------------------------
@@ -726,7 +1063,8 @@ static void bac_ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-      bac_ObjectCommandGetAttr( psNewMessage );
+      ABCC_HostAttrCommand( psNewMessage, bac_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( bac_asObjAttr ) );
       break;
 
 #if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE
@@ -24,6 +24,7 @@
 #include "string.h"
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_host_attribute.h"
 
 #if CFN_OBJ_ENABLE
 
@@ -37,31 +38,50 @@
 #define CFN_OA_HIGHEST_INST_VALUE                  1
 
 /*------------------------------------------------------------------------------
-** Structure describing an CC-Link IE Field Object.
+** Forward declarations
 **------------------------------------------------------------------------------
 */
-typedef struct cfn_Object
-{
-   const  char* pcName;
-   UINT8  bRevision;
-   UINT16 iNumberOfInstances;
-   UINT16 iHighestInstanceNo;
-}
-cfn_ObjectType;
+static void InstanceCommand( ABP_MsgType* psNewMessage );
+static void ObjectCommand( ABP_MsgType* psNewMessage );
 
 /*------------------------------------------------------------------------------
-** Forward declarations
+** Object attributes.
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage );
-static void ObjectCommand( ABP_MsgType* psNewMessage );
+static const ABCC_HostAttrType cfn_asObjAttr[] =
+{
+   ABCC_HOST_ATTR_OBJECT( CFN_OA_NAME_VALUE,
+                          CFN_OA_REV_VALUE,
+                          CFN_OA_NUM_INST_VALUE,
+                          CFN_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
-static const cfn_ObjectType cfn_sObject =
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType cfn_asInstAttr[] =
 {
-   CFN_OA_NAME_VALUE,                           /* Name.                                              */
-   CFN_OA_REV_VALUE,                            /* Revision.                                          */
-   CFN_OA_NUM_INST_VALUE,                       /* Number of instances.                               */
-   CFN_OA_HIGHEST_INST_VALUE                    /* Highest instance number.                           */
+#if CFN_IA_VENDOR_CODE_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_CFN_IA_VENDOR_CODE, CFN_IA_VENDOR_CODE_VALUE ),
+#endif
+#if CFN_IA_VENDOR_NAME_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_CFN_IA_VENDOR_NAME, CFN_IA_VENDOR_NAME_VALUE ),
+#endif
+#if CFN_IA_MODEL_TYPE_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_CFN_IA_MODEL_TYPE, CFN_IA_MODEL_TYPE_VALUE ),
+#endif
+#if CFN_IA_MODEL_NAME_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_CFN_IA_MODEL_NAME, CFN_IA_MODEL_NAME_VALUE ),
+#endif
+#if CFN_IA_MODEL_CODE_ENABLE
+   ABCC_HOST_ATTR_U32( ABP_CFN_IA_MODEL_CODE, CFN_IA_MODEL_CODE_VALUE ),
+#endif
+#if CFN_IA_SW_VERSION_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_CFN_IA_SW_VERSION, CFN_IA_SW_VERSION_VALUE ),
+#endif
+   ABCC_HOST_ATTR_END
 };
 
 void CFN_ProcessCmdMsg( ABP_MsgType* psNewMessage )
@@ -114,87 +134,11 @@ static void InstanceCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if CFN_IA_VENDOR_CODE_ENABLE
-      case ABP_CFN_IA_VENDOR_CODE:
-
-         /*
-         ** Copy the 1st Instance 1 attribute (Vendor Code) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, CFN_IA_VENDOR_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CFN_IA_VENDOR_CODE_DS );
-         break;
-#endif
-#if CFN_IA_VENDOR_NAME_ENABLE
-      case ABP_CFN_IA_VENDOR_NAME:
-      {
-         UINT16 iStrLength;
 
-         /*
-         ** Copy the 2nd Instance 1 attribute (Vendor Name) to the message.
-         */
-         iStrLength = (UINT16)strlen( CFN_IA_VENDOR_NAME_VALUE );
-         ABCC_SetMsgString( psNewMessage, CFN_IA_VENDOR_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-#endif
-#if CFN_IA_MODEL_TYPE_ENABLE
-      case ABP_CFN_IA_MODEL_TYPE:
-
-         /*
-         ** Copy the 3rd Instance 1 attribute (Model Type) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, CFN_IA_MODEL_TYPE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CFN_IA_MODEL_TYPE_DS );
-         break;
-#endif
-#if CFN_IA_MODEL_NAME_ENABLE
-      case ABP_CFN_IA_MODEL_NAME:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the 4th Instance 1 attribute (Model Name) to the message.
-         */
-         iStrLength = (UINT16)strlen( CFN_IA_MODEL_NAME_VALUE );
-         ABCC_SetMsgString( psNewMessage, CFN_IA_MODEL_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-#endif
-#if CFN_IA_MODEL_CODE_ENABLE
-      case ABP_CFN_IA_MODEL_CODE:
-
-         /*
-         ** Copy the 5th Instance 1 attribute (Model code) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, CFN_IA_MODEL_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CFN_IA_MODEL_CODE_DS );
-         break;
-#endif
-#if CFN_IA_SW_VERSION_ENABLE
-      case ABP_CFN_IA_SW_VERSION:
-
-         /*
-         ** Copy the 6th Instance 1 attribute (Version) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, CFN_IA_SW_VERSION_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CFN_IA_SW_VERSION_DS );
-         break;
-#endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, cfn_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( cfn_asInstAttr ) );
       break;
-   }
+
    default:
 
       /*
@@ -224,61 +168,11 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         iStrLength = (UINT16)strlen( cfn_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, cfn_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData8( psNewMessage, cfn_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, cfn_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, cfn_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-
-      } /* End of switch( Attribute number ) */
 
+      ABCC_HostAttrCommand( psNewMessage, cfn_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( cfn_asObjAttr ) );
       break;
-   }
+
    case ABP_CFN_CMD_BUF_SIZE_NOTIF:
 
       /*
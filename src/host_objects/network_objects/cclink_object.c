@@ -24,6 +24,7 @@
 #include "string.h"
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_host_attribute.h"
 
 #if CCL_OBJ_ENABLE
 
@@ -37,31 +38,60 @@
 #define CCL_OA_HIGHEST_INST_VALUE                  1
 
 /*------------------------------------------------------------------------------
-** Structure describing an CC-Link Object.
+** Forward declarations
+**------------------------------------------------------------------------------
+*/
+static void InstanceCommand( ABP_MsgType* psNewMessage );
+static void ObjectCommand( ABP_MsgType* psNewMessage );
+
+/*------------------------------------------------------------------------------
+** Object attributes.
 **------------------------------------------------------------------------------
 */
-typedef struct ccl_Object
+static const ABCC_HostAttrType ccl_asObjAttr[] =
 {
-   const  char* pcName;
-   UINT8  bRevision;
-   UINT16 iNumberOfInstances;
-   UINT16 iHighestInstanceNo;
-}
-ccl_ObjectType;
+   ABCC_HOST_ATTR_OBJECT( CCL_OA_NAME_VALUE,
+                          CCL_OA_REV_VALUE,
+                          CCL_OA_NUM_INST_VALUE,
+                          CCL_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
 /*------------------------------------------------------------------------------
-** Forward declarations
+** Instance 1 attributes.
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage );
-static void ObjectCommand( ABP_MsgType* psNewMessage );
+#if CCL_IA_NETWORK_SETTING_ENABLE
+static const UINT8 ccl_abNetworkSettings[ ABP_CCL_IA_NETWORK_SETTINGS_DS ] =
+{
+   CCL_IA_CCLINK_VERSION_VALUE,
+   CCL_IA_NUM_OF_OCCUPIED_STATION_VALUE,
+   CCL_IA_NUM_OF_EXTENSION_CYCLES_VALUE
+};
+#endif
 
-static const ccl_ObjectType ccl_sObject =
+static const ABCC_HostAttrType ccl_asInstAttr[] =
 {
-   CCL_OA_NAME_VALUE,                           /* Name.                                              */
-   CCL_OA_REV_VALUE,                            /* Revision.                                          */
-   CCL_OA_NUM_INST_VALUE,                       /* Number of instances.                               */
-   CCL_OA_HIGHEST_INST_VALUE                    /* Highest instance number.                           */
+#if CCL_IA_VENDOR_CODE_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_CCL_IA_VENDOR_CODE, CCL_IA_VENDOR_CODE_VALUE ),
+#endif
+#if CCL_IA_SOFTWARE_VERSION_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_CCL_IA_SOFTWARE_VERSION, CCL_IA_SOFTWARE_VERSION_VALUE ),
+#endif
+#if CCL_IA_MODEL_CODE_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_CCL_IA_MODEL_CODE, CCL_IA_MODEL_CODE_VALUE ),
+#endif
+#if CCL_IA_NETWORK_SETTING_ENABLE
+   ABCC_HOST_ATTR_OCT( ABP_CCL_IA_NETWORK_SETTINGS, ccl_abNetworkSettings,
+                       ABP_CCL_IA_NETWORK_SETTINGS_DS ),
+#endif
+#if CCL_IA_SYSTEM_AREA_HANDLER_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_CCL_IA_SYS_AREA_HANDLER, CCL_IA_SYSTEM_AREA_HANDLER_VALUE ),
+#endif
+#if CCL_IA_OUTPUT_HOLD_CLEAR_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_CCL_IA_HOLD_CLEAR_SETTING, CCL_IA_OUTPUT_HOLD_CLEAR_VALUE ),
+#endif
+   ABCC_HOST_ATTR_END
 };
 
 void CCL_ProcessCmdMsg( ABP_MsgType* psNewMessage )
@@ -114,82 +144,11 @@ static void InstanceCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if CCL_IA_VENDOR_CODE_ENABLE
-      case ABP_CCL_IA_VENDOR_CODE:
 
-         /*
-         ** Copy the 1st Instance 1 attribute (Vendor Code) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, CCL_IA_VENDOR_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CCL_IA_VENDOR_CODE_DS );
-         break;
-#endif
-#if CCL_IA_SOFTWARE_VERSION_ENABLE
-      case ABP_CCL_IA_SOFTWARE_VERSION:
-
-         /*
-         ** Copy the 2nd Instance 1 attribute (Software Version) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, CCL_IA_SOFTWARE_VERSION_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CCL_IA_SOFTWARE_VERSION_DS );
-         break;
-#endif
-#if CCL_IA_MODEL_CODE_ENABLE
-      case ABP_CCL_IA_MODEL_CODE:
-
-         /*
-         ** Copy the 3rd Instance 1 attribute (Model Code) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, CCL_IA_MODEL_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CCL_IA_MODEL_CODE_DS );
-         break;
-#endif
-#if CCL_IA_NETWORK_SETTING_ENABLE
-      case ABP_CCL_IA_NETWORK_SETTINGS:
-
-         /*
-         ** Copy the 4th Instance 1 attribute (Network Setting) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, CCL_IA_CCLINK_VERSION_VALUE, 0 );
-         ABCC_SetMsgData8( psNewMessage, CCL_IA_NUM_OF_OCCUPIED_STATION_VALUE, 1 );
-         ABCC_SetMsgData8( psNewMessage, CCL_IA_NUM_OF_EXTENSION_CYCLES_VALUE, 2 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CCL_IA_NETWORK_SETTINGS_DS );
-         break;
-#endif
-#if CCL_IA_SYSTEM_AREA_HANDLER_ENABLE
-      case ABP_CCL_IA_SYS_AREA_HANDLER:
-
-         /*
-         ** Copy the 5th Instance 1 attribute (System Area Handler) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, CCL_IA_SYSTEM_AREA_HANDLER_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CCL_IA_SYS_AREA_HANDLER_DS );
-         break;
-#endif
-#if CCL_IA_OUTPUT_HOLD_CLEAR_ENABLE
-      case ABP_CCL_IA_HOLD_CLEAR_SETTING:
-
-         /*
-         ** Copy the 6th Instance 1 attribute (Output Hold/Clear) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, CCL_IA_OUTPUT_HOLD_CLEAR_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_CCL_IA_HOLD_CLEAR_SETTING_DS );
-         break;
-#endif
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, ccl_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( ccl_asInstAttr ) );
       break;
-   }
+
    default:
 
       /*
@@ -219,61 +178,11 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         iStrLength = (UINT16)strlen( ccl_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, ccl_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ccl_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, ccl_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, ccl_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-
-      } /* End of switch( Attribute number ) */
 
+      ABCC_HostAttrCommand( psNewMessage, ccl_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( ccl_asObjAttr ) );
       break;
-   }
+
    case ABP_CCL_CMD_INITIAL_DATA_SETTING_NOTIFICATION:
 
       /*
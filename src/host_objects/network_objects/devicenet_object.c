@@ -24,6 +24,7 @@
 #include "string.h"
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_host_attribute.h"
 
 #if DEV_OBJ_ENABLE
 
@@ -37,31 +38,100 @@
 #define DEV_OA_HIGHEST_INST_VALUE                  1
 
 /*------------------------------------------------------------------------------
-** Structure describing the DeviceNet Object.
+** Forward declarations
 **------------------------------------------------------------------------------
 */
-typedef struct dev_Object
-{
-   const  char* pcName;
-   UINT8  bRevision;
-   UINT16 iNumberOfInstances;
-   UINT16 iHighestInstanceNo;
-}
-dev_ObjectType;
+static void InstanceCommand( ABP_MsgType* psNewMessage );
+static void ObjectCommand( ABP_MsgType* psNewMessage );
+#if DEV_IA_SERIAL_NUMBER_ENABLE
+static void GetSerialNumber( ABP_MsgType* psNewMessage );
+#endif
+#if ASM_OBJ_ENABLE
+static void GetProdInstanceList( ABP_MsgType* psNewMessage );
+static void GetConsInstanceList( ABP_MsgType* psNewMessage );
+#endif
 
 /*------------------------------------------------------------------------------
-** Forward declarations
+** Object attributes.
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage );
-static void ObjectCommand( ABP_MsgType* psNewMessage );
+static const ABCC_HostAttrType dev_asObjAttr[] =
+{
+   ABCC_HOST_ATTR_OBJECT( DEV_OA_NAME_VALUE,
+                          DEV_OA_REV_VALUE,
+                          DEV_OA_NUM_INST_VALUE,
+                          DEV_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
-static const dev_ObjectType dev_sObject =
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType dev_asInstAttr[] =
 {
-   DEV_OA_NAME_VALUE,                           /* Name.                                              */
-   DEV_OA_REV_VALUE,                            /* Revision.                                          */
-   DEV_OA_NUM_INST_VALUE,                       /* Number of instances.                               */
-   DEV_OA_HIGHEST_INST_VALUE                    /* Highest instance number.                           */
+#if DEV_IA_VENDOR_ID_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_VENDOR_ID, DEV_IA_VENDOR_ID_VALUE ),
+#endif
+#if DEV_IA_DEVICE_TYPE_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_DEVICE_TYPE, DEV_IA_DEVICE_TYPE_VALUE ),
+#endif
+#if DEV_IA_PRODUCT_CODE_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_PRODUCT_CODE, DEV_IA_PRODUCT_CODE_VALUE ),
+#endif
+#if DEV_IA_REVISION_ENABLE
+   ABCC_HOST_ATTR_U8X2( ABP_DEV_IA_REVISION, DEV_IA_REVISION_MAJOR_VALUE,
+                        DEV_IA_REVISION_MINOR_VALUE ),
+#endif
+#if DEV_IA_SERIAL_NUMBER_ENABLE
+   ABCC_HOST_ATTR_FUNC( ABP_DEV_IA_SERIAL_NUMBER, GetSerialNumber, NULL ),
+#endif
+#if DEV_IA_PRODUCT_NAME_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_DEV_IA_PRODUCT_NAME, DEV_IA_PRODUCT_NAME_VALUE ),
+#endif
+#if DEV_IA_PROD_INSTANCE_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_PROD_INSTANCE, DEV_IA_PROD_INSTANCE_VALUE ),
+#endif
+#if DEV_IA_CONS_INSTANCE_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_CONS_INSTANCE, DEV_IA_CONS_INSTANCE_VALUE ),
+#endif
+#if DEV_IA_ADDRESS_FROM_NET_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_DEV_IA_ADDRESS_FROM_NET,
+                      DEV_IA_ADDRESS_FROM_NET_VALUE ),
+#endif
+#if DEV_IA_BAUD_RATE_FROM_NET_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_DEV_IA_BAUD_RATE_FROM_NET,
+                      DEV_IA_BAUD_RATE_FROM_NET_VALUE ),
+#endif
+#if DEV_IA_ENABLE_APP_CIP_OBJECTS_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_DEV_IA_ENABLE_APP_CIP_OBJECTS,
+                      DEV_IA_ENABLE_APP_CIP_OBJECTS_VALUE ),
+#endif
+#if DEV_IA_ENABLE_PARAM_OBJECT_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_DEV_IA_ENABLE_PARAM_OBJECT,
+                      DEV_IA_ENABLE_PARAM_OBJECT_VALUE ),
+#endif
+#if DEV_IA_ENABLE_QUICK_CONNECT_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_DEV_IA_ENABLE_QUICK_CONNECT,
+                      DEV_IA_ENABLE_QUICK_CONNECT_VALUE ),
+#endif
+#if DEV_IA_PREPEND_PRODUCING_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_PREPEND_PRODUCING,
+                       DEV_IA_PREPEND_PRODUCING_VALUE ),
+#endif
+#if DEV_IA_PREPEND_CONSUMING_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_PREPEND_CONSUMING,
+                       DEV_IA_PREPEND_CONSUMING_VALUE ),
+#endif
+#if DEV_IA_ABCC_ADI_OBJECT_ENABLE
+   ABCC_HOST_ATTR_U16( ABP_DEV_IA_ABCC_ADI_OBJECT,
+                       DEV_IA_ABCC_ADI_OBJECT_VALUE ),
+#endif
+#if ASM_OBJ_ENABLE
+   ABCC_HOST_ATTR_FUNC( ABP_DEV_IA_PROD_INSTANCE_LIST, GetProdInstanceList, NULL ),
+   ABCC_HOST_ATTR_FUNC( ABP_DEV_IA_CONS_INSTANCE_LIST, GetConsInstanceList, NULL ),
+#endif
+   ABCC_HOST_ATTR_END
 };
 
 void DEV_ProcessCmdMsg( ABP_MsgType* psNewMessage )
@@ -87,6 +157,69 @@ void DEV_ProcessCmdMsg( ABP_MsgType* psNewMessage )
    ABCC_SendRespMsg( psNewMessage );
 }
 
+#if DEV_IA_SERIAL_NUMBER_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Serial number (Instance 1) to the message. The value may be a
+** function call or a variable, see abcc_identification.h.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetSerialNumber( ABP_MsgType* psNewMessage )
+{
+   ABCC_SetMsgData32( psNewMessage, DEV_IA_SERIAL_NUMBER_VALUE, 0 );
+   ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_SERIAL_NUMBER_DS );
+}
+#endif
+
+#if ASM_OBJ_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Producing Instance Number list (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetProdInstanceList( ABP_MsgType* psNewMessage )
+{
+   UINT16 iIndex;
+
+   for( iIndex = 0; iIndex < DEV_iProdInstNumListSize; ++iIndex )
+   {
+      ABCC_SetMsgData16( psNewMessage, DEV_aiProdInstNumList[ iIndex ], ABP_UINT16_SIZEOF * iIndex );
+   }
+   ABP_SetMsgResponse( psNewMessage, DEV_iProdInstNumListSize * ABP_UINT16_SIZEOF );
+}
+
+/*------------------------------------------------------------------------------
+** Copies the Consuming Instance Number list (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetConsInstanceList( ABP_MsgType* psNewMessage )
+{
+   UINT16 iIndex;
+
+   for( iIndex = 0; iIndex < DEV_iConsInstNumListSize; ++iIndex )
+   {
+      ABCC_SetMsgData16( psNewMessage, DEV_aiConsInstNumList[ iIndex ], ABP_UINT16_SIZEOF * iIndex );
+   }
+   ABP_SetMsgResponse( psNewMessage, DEV_iConsInstNumListSize * ABP_UINT16_SIZEOF );
+}
+#endif
+
 /*------------------------------------------------------------------------------
 ** Processes commands to DEV Instances
 **------------------------------------------------------------------------------
@@ -114,215 +247,11 @@ static void InstanceCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if DEV_IA_VENDOR_ID_ENABLE
-      case ABP_DEV_IA_VENDOR_ID:
-
-         /*
-         ** Copy the 1st Instance 1 attribute (Vendor ID) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_VENDOR_ID_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_VENDOR_ID_DS );
-         break;
-#endif
-#if DEV_IA_DEVICE_TYPE_ENABLE
-      case ABP_DEV_IA_DEVICE_TYPE:
-
-         /*
-         ** Copy the 2nd Instance 1 attribute (Device type) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_DEVICE_TYPE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_DEVICE_TYPE_DS );
-         break;
-#endif
-#if DEV_IA_PRODUCT_CODE_ENABLE
-      case ABP_DEV_IA_PRODUCT_CODE:
-
-         /*
-         ** Copy the 3rd Instance 1 attribute (Product code) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_PRODUCT_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_PRODUCT_CODE_DS );
-         break;
-#endif
-#if DEV_IA_REVISION_ENABLE
-      case ABP_DEV_IA_REVISION:
-
-         /*
-         ** Copy the 4th Instance 1 attribute (Revision) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, DEV_IA_REVISION_MAJOR_VALUE, 0 );
-         ABCC_SetMsgData8( psNewMessage, DEV_IA_REVISION_MINOR_VALUE, 1 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_REVISION_DS );
-         break;
-#endif
-#if DEV_IA_SERIAL_NUMBER_ENABLE
-      case ABP_DEV_IA_SERIAL_NUMBER:
-
-         /*
-         ** Copy the 5th Instance 1 attribute (Serial number) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, DEV_IA_SERIAL_NUMBER_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_SERIAL_NUMBER_DS );
-         break;
-#endif
-#if DEV_IA_PRODUCT_NAME_ENABLE
-      case ABP_DEV_IA_PRODUCT_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( DEV_IA_PRODUCT_NAME_VALUE );
 
-         /*
-         ** Copy the 6th Instance 1 attribute (Product name) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, DEV_IA_PRODUCT_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-#endif
-#if DEV_IA_PROD_INSTANCE_ENABLE
-      case ABP_DEV_IA_PROD_INSTANCE:
-
-         /*
-         ** Copy the 7th Instance 1 attribute (Producing instance number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_PROD_INSTANCE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_PROD_INSTANCE_DS );
-         break;
-#endif
-#if DEV_IA_CONS_INSTANCE_ENABLE
-      case ABP_DEV_IA_CONS_INSTANCE:
-
-         /*
-         ** Copy the 8th Instance 1 attribute (Consuming instance number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_CONS_INSTANCE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_CONS_INSTANCE_DS );
-         break;
-#endif
-#if DEV_IA_ADDRESS_FROM_NET_ENABLE
-      case ABP_DEV_IA_ADDRESS_FROM_NET:
-
-         /*
-         ** Copy the 9th Instance 1 attribute (Enable address from net) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, DEV_IA_ADDRESS_FROM_NET_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_ADDRESS_FROM_NET_DS );
-         break;
-#endif
-#if DEV_IA_BAUD_RATE_FROM_NET_ENABLE
-      case ABP_DEV_IA_BAUD_RATE_FROM_NET:
-
-         /*
-         ** Copy the 10th Instance 1 attribute (Enable baud rate from net) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, DEV_IA_BAUD_RATE_FROM_NET_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_BAUD_RATE_FROM_NET_DS );
-         break;
-#endif
-#if DEV_IA_ENABLE_APP_CIP_OBJECTS_ENABLE
-      case ABP_DEV_IA_ENABLE_APP_CIP_OBJECTS:
-
-         /*
-         ** Copy the 11th Instance 1 attribute (Enable CIP request forwarding) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, DEV_IA_ENABLE_APP_CIP_OBJECTS_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_ENABLE_APP_CIP_OBJECTS_DS );
-         break;
-#endif
-#if DEV_IA_ENABLE_PARAM_OBJECT_ENABLE
-      case ABP_DEV_IA_ENABLE_PARAM_OBJECT:
-
-         /*
-         ** Copy the 12th Instance 1 attribute (Enable Parameter object) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, DEV_IA_ENABLE_PARAM_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_ENABLE_PARAM_OBJECT_DS );
-         break;
-#endif
-#if DEV_IA_ENABLE_QUICK_CONNECT_ENABLE
-      case ABP_DEV_IA_ENABLE_QUICK_CONNECT:
-
-         /*
-         ** Copy the 13th Instance 1 attribute (Enable Quick Connect) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, DEV_IA_ENABLE_QUICK_CONNECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_ENABLE_PARAM_OBJECT_DS );
-         break;
-#endif
-#if DEV_IA_PREPEND_PRODUCING_ENABLE
-      case ABP_DEV_IA_PREPEND_PRODUCING:
-
-         /*
-         ** Copy the 18th Instance 1 attribute (Prepend producing profile instance) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_PREPEND_PRODUCING_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_PREPEND_PRODUCING_DS );
-         break;
-#endif
-#if DEV_IA_PREPEND_CONSUMING_ENABLE
-      case ABP_DEV_IA_PREPEND_CONSUMING:
-
-         /*
-         ** Copy the 19th Instance 1 attribute (Prepend consuming profile instance) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_PREPEND_CONSUMING_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_PREPEND_CONSUMING_DS );
-         break;
-#endif
-#if DEV_IA_ABCC_ADI_OBJECT_ENABLE
-      case ABP_DEV_IA_ABCC_ADI_OBJECT:
-
-         /*
-         ** Copy the 20th Instance 1 attribute (ABCC ADI Object Number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, DEV_IA_ABCC_ADI_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_DEV_IA_ABCC_ADI_OBJECT_DS );
-         break;
-#endif
-#if ASM_OBJ_ENABLE
-      case ABP_DEV_IA_PROD_INSTANCE_LIST:
-      {
-         UINT16 iIndex;
-
-         /*
-         ** Copy the 21st Instance 1 attribute (Producing Instance Number list) to the message.
-         */
-         for( iIndex = 0; iIndex < DEV_iProdInstNumListSize; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage, DEV_aiProdInstNumList[ iIndex ], ABP_UINT16_SIZEOF * iIndex );
-         }
-         ABP_SetMsgResponse( psNewMessage, DEV_iProdInstNumListSize * ABP_UINT16_SIZEOF );
-         break;
-      }
-      case ABP_DEV_IA_CONS_INSTANCE_LIST:
-      {
-         UINT16  iIndex;
-
-         /*
-         ** Copy the 22nd Instance 1 attribute (Consuming Instance Number list) to the message.
-         */
-         for( iIndex = 0; iIndex < DEV_iConsInstNumListSize; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage, DEV_aiConsInstNumList[ iIndex ], ABP_UINT16_SIZEOF * iIndex );
-         }
-         ABP_SetMsgResponse( psNewMessage, DEV_iConsInstNumListSize * ABP_UINT16_SIZEOF );
-         break;
-      }
-#endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, dev_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( dev_asInstAttr ) );
       break;
-   }
+
    default:
 
       /*
@@ -352,61 +281,11 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         iStrLength = (UINT16)strlen( dev_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, dev_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData8( psNewMessage, dev_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, dev_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, dev_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-
-      } /* End of switch( Attribute number ) */
 
+      ABCC_HostAttrCommand( psNewMessage, dev_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( dev_asObjAttr ) );
       break;
-   }
+
    case ABP_DEV_CMD_PROCESS_CIP_OBJ_REQUEST:
 
       /*
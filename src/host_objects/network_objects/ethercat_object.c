@@ -26,6 +26,7 @@
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
 #include "application_data_instance_config.h"
+#include "abcc_host_attribute.h"
 
 #if ECT_OBJ_ENABLE
 
@@ -38,6 +39,36 @@
 #define ECT_OA_NUM_INST_VALUE                      1
 #define ECT_OA_HIGHEST_INST_VALUE                  1
 
+/*------------------------------------------------------------------------------
+** Size of one ADI translation and object subindex translation entry in the
+** message.
+**------------------------------------------------------------------------------
+*/
+#define ECT_ADI_TRANS_ENTRY_SIZE     ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF )
+#define ECT_OBJ_SUB_TRANS_ENTRY_SIZE ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF + \
+                                       ABP_UINT8_SIZEOF )
+
+/*------------------------------------------------------------------------------
+** Size in octets of the blocks of a segmented ENUM ADI list (attribute 9).
+**------------------------------------------------------------------------------
+*/
+#define ECT_ENUM_ADIS_BLOCK_SIZE     ( 32 )
+
+/*------------------------------------------------------------------------------
+** Segmented response of the ENUM ADI list (attribute 9), read from the ADI
+** list one block at a time. fActive is TRUE while the response is being sent
+** and iNextAdiIndex is the index in the ADI list where the next block starts.
+**------------------------------------------------------------------------------
+*/
+#if ECT_IA_ENUM_ADIS_ENABLE
+typedef struct ect_EnumAdiSeg
+{
+   BOOL   fActive;
+   UINT16 iNextAdiIndex;
+}
+ect_EnumAdiSegType;
+#endif
+
 /*------------------------------------------------------------------------------
 ** Structure describing the EtherCAT Instance 1 attribute 13 ADI Translation
 **------------------------------------------------------------------------------
@@ -74,12 +105,7 @@ ect_Instance1ObjSubTrans;
      ECT_IA_RD_PD_ASSY_INST_TRANS_ENABLE || \
      ECT_IA_ADI_TRANS_ENABLE ||             \
      ECT_IA_OBJ_SUB_TRANS_ENABLE ||         \
-     ECT_IA_ENABLE_FOE_ENABLE ||            \
-     ECT_IA_ENABLE_EOE_ENABLE ||            \
-     ECT_IA_SET_DEV_ID_AS_CSA_ENABLE ||     \
      ECT_IA_STATE_TIMEOUTS_ENABLE ||        \
-     ECT_IA_COMP_IDENT_LISTS_ENABLE ||      \
-     ECT_IA_CLEAR_IDENT_AL_STS_ENABLE ||    \
      ECT_IA_DEF_TXPDO_ASSIGN_ENABLE ||      \
      ECT_IA_DEF_RXPDO_ASSIGN_ENABLE )
 typedef struct ect_Instance
@@ -96,24 +122,9 @@ typedef struct ect_Instance
 #if ECT_IA_OBJ_SUB_TRANS_ENABLE
    ect_Instance1ObjSubTrans asObjSubTrans[ ECT_IA_OBJ_SUB_TRANS_SIZE ];
 #endif
-#if ECT_IA_ENABLE_FOE_ENABLE
-   BOOL fEnableFoE;
-#endif
-#if ECT_IA_ENABLE_EOE_ENABLE
-   BOOL fEnableEoE;
-#endif
-#if ECT_IA_SET_DEV_ID_AS_CSA_ENABLE
-   BOOL fSetDevIDAsCSA;
-#endif
 #if ECT_IA_STATE_TIMEOUTS_ENABLE
    UINT32 alStateTransTimeouts[ 4 ];
 #endif
-#if ECT_IA_COMP_IDENT_LISTS_ENABLE
-   BOOL fCompIDLists;
-#endif
-#if ECT_IA_CLEAR_IDENT_AL_STS_ENABLE
-   BOOL fClearIdAlSts;
-#endif
 #if ECT_IA_DEF_TXPDO_ASSIGN_ENABLE
    UINT16 aiTxPdoAssignments[ ECT_IA_DEF_TXPDO_ASSIGN_SIZE ];
 #endif
@@ -220,52 +231,90 @@ ect_GetObjectDescType;
 #endif
 
 
+#if ECT_IA_ETHERCAT_STATE_ENABLE
+   static UINT8 ect_bEtherCATState;
+#endif
+
+#if ECT_IA_FSOE_STATUS_IND_ENABLE
+   static UINT8 ect_eFSoEStatusIndicator;
+#endif
+
+/*------------------------------------------------------------------------------
+** Attribute values serialized to message format by BuildMsgData().
+**------------------------------------------------------------------------------
+** ect_aiEnumAdiList       - Instance numbers of the ENUM ADIs (attribute 9).
+** ect_iNumEnumAdis        - Number of entries in ect_aiEnumAdiList.
+** ect_fEnumAdiListValid   - FALSE if there are more ENUM ADIs than
+**                           ECT_IA_ENUM_ADIS_LIST_SIZE.
+** ect_aiAdiTransMsg       - ADI translation (attribute 13).
+** ect_aiObjSubTransMsg    - Object subindex translation (attribute 15).
+** ect_fMsgDataBuilt       - TRUE when the above are built.
+**------------------------------------------------------------------------------
+*/
+#if ECT_IA_ENUM_ADIS_ENABLE && ( ECT_IA_ENUM_ADIS_LIST_SIZE > 0 )
+   static UINT16 ect_aiEnumAdiList[ ECT_IA_ENUM_ADIS_LIST_SIZE ];
+   static UINT16 ect_iNumEnumAdis;
+   static BOOL   ect_fEnumAdiListValid;
+#endif
+
 /*------------------------------------------------------------------------------
-** Structure describing an EtherCAT Object.
+** ENUM ADI list that does not fit in one message, see ect_EnumAdiSegType.
+** The blocks are built in ect_aiEnumAdiBlock.
 **------------------------------------------------------------------------------
 */
-typedef struct ect_Object
-{
-    const char*           pcName;
-    UINT8                 bRevision;
-    UINT16                iNumberOfInstances;
-    UINT16                iHighestInstanceNo;
-#if ECT_OBJ_CMD_GET_OBJ_DESC_ENABLE
-    ect_GetObjectDescType asObjectDescriptions[ ECT_GET_OBJ_DESC_NUM_OBJ ];
+#if ECT_IA_ENUM_ADIS_ENABLE
+   static ect_EnumAdiSegType ect_sEnumAdiSeg;
+   static UINT16 ect_aiEnumAdiBlock[ ECT_ENUM_ADIS_BLOCK_SIZE / ABP_UINT16_SIZEOF ];
 #endif
-}
-ect_ObjectType;
 
-#if ECT_IA_ETHERCAT_STATE_ENABLE
-   static UINT8 ect_bEtherCATState;
+#if ECT_IA_ADI_TRANS_ENABLE
+   static UINT16 ect_aiAdiTransMsg[ ( ( ECT_IA_ADI_TRANS_SIZE * ECT_ADI_TRANS_ENTRY_SIZE ) + 1 ) / 2 ];
 #endif
 
-#if ECT_IA_FSOE_STATUS_IND_ENABLE
-   static UINT8 ect_eFSoEStatusIndicator;
+#if ECT_IA_OBJ_SUB_TRANS_ENABLE
+   static UINT16 ect_aiObjSubTransMsg[ ( ( ECT_IA_OBJ_SUB_TRANS_SIZE * ECT_OBJ_SUB_TRANS_ENTRY_SIZE ) + 1 ) / 2 ];
+#endif
+
+#if ( ( ECT_IA_ENUM_ADIS_ENABLE && ( ECT_IA_ENUM_ADIS_LIST_SIZE > 0 ) ) || \
+     ECT_IA_ADI_TRANS_ENABLE ||                                          \
+     ECT_IA_OBJ_SUB_TRANS_ENABLE )
+   static BOOL ect_fMsgDataBuilt = FALSE;
 #endif
 
-static const ect_ObjectType ect_sObject =
+/*------------------------------------------------------------------------------
+** TRUE if the response to the current request is sent by a segmentation
+** session instead of by ECT_ProcessCmdMsg().
+**------------------------------------------------------------------------------
+*/
+static BOOL ect_fRespSegmented = FALSE;
+
+/*------------------------------------------------------------------------------
+** Object attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType ect_asObjAttr[] =
 {
-   ECT_OA_NAME_VALUE,               /* Name.                                                  */
-   ECT_OA_REV_VALUE,                /* Revision.                                              */
-   ECT_OA_NUM_INST_VALUE,           /* Number of instances.                                   */
-   ECT_OA_HIGHEST_INST_VALUE        /* Highest instance number.                               */
+   ABCC_HOST_ATTR_OBJECT( ECT_OA_NAME_VALUE,
+                          ECT_OA_REV_VALUE,
+                          ECT_OA_NUM_INST_VALUE,
+                          ECT_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
+
 #if ECT_OBJ_CMD_GET_OBJ_DESC_ENABLE
-   ,
-   ECT_GET_OBJ_DESC_CONTENT         /* Object descriptions for Get_Object_Description command */
+/*------------------------------------------------------------------------------
+** Object descriptions for the Get_Object_Description command.
+**------------------------------------------------------------------------------
+*/
+static const ect_GetObjectDescType ect_asObjectDescriptions[ ECT_GET_OBJ_DESC_NUM_OBJ ] =
+   ECT_GET_OBJ_DESC_CONTENT;
 #endif
-};
 
 #if( ECT_IA_WR_PD_ASSY_INST_TRANS_ENABLE || \
      ECT_IA_RD_PD_ASSY_INST_TRANS_ENABLE || \
      ECT_IA_ADI_TRANS_ENABLE ||             \
      ECT_IA_OBJ_SUB_TRANS_ENABLE ||         \
-     ECT_IA_ENABLE_FOE_ENABLE ||            \
-     ECT_IA_ENABLE_EOE_ENABLE ||            \
-     ECT_IA_SET_DEV_ID_AS_CSA_ENABLE ||     \
      ECT_IA_STATE_TIMEOUTS_ENABLE ||        \
-     ECT_IA_COMP_IDENT_LISTS_ENABLE ||      \
-     ECT_IA_CLEAR_IDENT_AL_STS_ENABLE ||    \
      ECT_IA_DEF_TXPDO_ASSIGN_ENABLE ||      \
      ECT_IA_DEF_RXPDO_ASSIGN_ENABLE )
 static const ect_InstanceType ect_sInstance =
@@ -282,24 +331,9 @@ static const ect_InstanceType ect_sInstance =
 #if ECT_IA_OBJ_SUB_TRANS_ENABLE
    ECT_IA_OBJ_SUB_TRANS_VALUE,
 #endif
-#if ECT_IA_ENABLE_FOE_ENABLE
-   ECT_IA_ENABLE_FOE_VALUE,
-#endif
-#if ECT_IA_ENABLE_EOE_ENABLE
-   ECT_IA_ENABLE_EOE_VALUE,
-#endif
-#if ECT_IA_SET_DEV_ID_AS_CSA_ENABLE
-   ECT_IA_SET_DEV_ID_AS_CSA_VALUE,
-#endif
 #if ECT_IA_STATE_TIMEOUTS_ENABLE
    ECT_IA_STATE_TIMEOUTS_VALUE,
 #endif
-#if ECT_IA_COMP_IDENT_LISTS_ENABLE
-   ECT_IA_COMP_IDENT_LISTS_VALUE,
-#endif
-#if ECT_IA_CLEAR_IDENT_AL_STS_ENABLE
-   ECT_IA_CLEAR_IDENT_AL_STS_VALUE,
-#endif
 #if ECT_IA_DEF_TXPDO_ASSIGN_ENABLE
    ECT_IA_DEF_TXPDO_ASSIGN_VALUE,
 #endif
@@ -311,6 +345,231 @@ static const ect_InstanceType ect_sInstance =
 #endif /* #if( ECT_IA_WR_PD_ASSY_INST_TRANS_ENABLE... */
 
 #if ECT_IA_ENUM_ADIS_ENABLE
+/*------------------------------------------------------------------------------
+** Checks if an ADI belongs in the ENUM ADI list.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iAdiIndex         - Index in the ADI list.
+**
+** Returns:
+**    TRUE if the ADI is an ABP_ENUM ADI.
+**------------------------------------------------------------------------------
+*/
+static BOOL IsEnumAdi( UINT16 iAdiIndex )
+{
+#if( ABCC_CFG_STRUCT_DATA_TYPE_ENABLED )
+   /*
+   ** Ignore struct ADIs, ABP_ENUMs are not allowed in them.
+   */
+   return( ( APPL_asAdiEntryList[ iAdiIndex ].psStruct == NULL ) &&
+           ( APPL_asAdiEntryList[ iAdiIndex ].bDataType == ABP_ENUM ) );
+#else
+   return( APPL_asAdiEntryList[ iAdiIndex ].bDataType == ABP_ENUM );
+#endif
+}
+#endif /* ECT_IA_ENUM_ADIS_ENABLE */
+
+#if ( ( ECT_IA_ENUM_ADIS_ENABLE && ( ECT_IA_ENUM_ADIS_LIST_SIZE > 0 ) ) || \
+     ECT_IA_ADI_TRANS_ENABLE ||                                          \
+     ECT_IA_OBJ_SUB_TRANS_ENABLE )
+/*------------------------------------------------------------------------------
+** Serializes the ENUM ADI list and the translation tables to message format,
+** so that Get_Attribute requests are answered with one copy.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void BuildMsgData( void )
+{
+   UINT16   iIndex;
+#if ECT_IA_ENUM_ADIS_ENABLE && ( ECT_IA_ENUM_ADIS_LIST_SIZE > 0 )
+   UINT16   iNumOfAdis;
+
+   iNumOfAdis = APPL_GetNumAdi();
+   ect_iNumEnumAdis = 0;
+   ect_fEnumAdiListValid = TRUE;
+
+   for( iIndex = 0; iIndex < iNumOfAdis; iIndex++ )
+   {
+      if( IsEnumAdi( iIndex ) )
+      {
+         if( ect_iNumEnumAdis == ECT_IA_ENUM_ADIS_LIST_SIZE )
+         {
+            ect_fEnumAdiListValid = FALSE;
+            break;
+         }
+         ABCC_SetData16( ect_aiEnumAdiList,
+                         APPL_asAdiEntryList[ iIndex ].iInstance,
+                         ect_iNumEnumAdis * ABP_UINT16_SIZEOF );
+         ect_iNumEnumAdis++;
+      }
+   }
+#endif
+
+#if ECT_IA_ADI_TRANS_ENABLE
+   for( iIndex = 0; iIndex < ECT_IA_ADI_TRANS_SIZE; ++iIndex )
+   {
+      ABCC_SetData16( ect_aiAdiTransMsg,
+                      ect_sInstance.asADITrans[ iIndex ].iADIInstanceNumber,
+                      ( ECT_ADI_TRANS_ENTRY_SIZE * iIndex ) );
+      ABCC_SetData16( ect_aiAdiTransMsg,
+                      ect_sInstance.asADITrans[ iIndex ].iADIObjectIndex,
+                      ( ECT_ADI_TRANS_ENTRY_SIZE * iIndex ) + ABP_UINT16_SIZEOF );
+   }
+#endif
+
+#if ECT_IA_OBJ_SUB_TRANS_ENABLE
+   for( iIndex = 0; iIndex < ECT_IA_OBJ_SUB_TRANS_SIZE; ++iIndex )
+   {
+      ABCC_SetData16( ect_aiObjSubTransMsg,
+                      ect_sInstance.asObjSubTrans[ iIndex ].iADIInstanceNumber,
+                      ( ECT_OBJ_SUB_TRANS_ENTRY_SIZE * iIndex ) );
+      ABCC_SetData16( ect_aiObjSubTransMsg,
+                      ect_sInstance.asObjSubTrans[ iIndex ].iADIObjectIndex,
+                      ( ECT_OBJ_SUB_TRANS_ENTRY_SIZE * iIndex ) + ABP_UINT16_SIZEOF );
+      ABCC_SetData8( ect_aiObjSubTransMsg,
+                     ect_sInstance.asObjSubTrans[ iIndex ].bADIObjectIndexSubindex,
+                     ( ECT_OBJ_SUB_TRANS_ENTRY_SIZE * iIndex ) + ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF );
+   }
+#endif
+
+   ect_fMsgDataBuilt = TRUE;
+}
+
+/*------------------------------------------------------------------------------
+** Sends an attribute value in message format as the response. Values that do
+** not fit in one message are sent as a segmented response, the data must then
+** remain valid until the segmentation session is done.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**    pxData            - Attribute value in message format.
+**    lSize             - Size of the attribute value in octets.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void SetMsgOctets( ABP_MsgType* psNewMessage,
+                          const void* pxData,
+                          UINT32 lSize )
+{
+   if( lSize <= ABCC_GetMaxMessageSize() )
+   {
+      ABCC_PORT_CopyOctets( ABCC_GetMsgDataPtr( psNewMessage ), 0,
+                            pxData, 0, (UINT16)lSize );
+      ABP_SetMsgResponse( psNewMessage, (UINT16)lSize );
+   }
+   else if( ABCC_StartServerRespSegmentationSession( &psNewMessage->sHeader,
+                                                     ABCC_GetMsgCmdExt0( psNewMessage ),
+                                                     pxData,
+                                                     lSize,
+                                                     NULL,
+                                                     NULL,
+                                                     NULL ) == ABCC_EC_NO_ERROR )
+   {
+      ect_fRespSegmented = TRUE;
+   }
+   else
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NO_RESOURCES );
+   }
+}
+#endif
+
+#if ECT_IA_ENUM_ADIS_ENABLE
+/*------------------------------------------------------------------------------
+** Segmentation callback providing the next block of the ENUM ADI list.
+** See ABCC_SegMsgHandlerNextBlockFuncType.
+**------------------------------------------------------------------------------
+*/
+static UINT8* GetNextEnumAdiBlock( void* pxObject, UINT32* plSize )
+{
+   ect_EnumAdiSegType* psEnumAdiSeg;
+   UINT16 iNumOfAdis;
+   UINT16 iBlockOffset;
+
+   psEnumAdiSeg = (ect_EnumAdiSegType*)pxObject;
+   iNumOfAdis = APPL_GetNumAdi();
+   iBlockOffset = 0;
+
+   while( ( psEnumAdiSeg->iNextAdiIndex < iNumOfAdis ) &&
+          ( iBlockOffset < ECT_ENUM_ADIS_BLOCK_SIZE ) )
+   {
+      if( IsEnumAdi( psEnumAdiSeg->iNextAdiIndex ) )
+      {
+         ABCC_SetData16( ect_aiEnumAdiBlock,
+                         APPL_asAdiEntryList[ psEnumAdiSeg->iNextAdiIndex ].iInstance,
+                         iBlockOffset );
+         iBlockOffset += ABP_UINT16_SIZEOF;
+      }
+      psEnumAdiSeg->iNextAdiIndex++;
+   }
+
+   if( iBlockOffset == 0 )
+   {
+      return( NULL );
+   }
+
+   *plSize = iBlockOffset;
+
+   return( (UINT8*)ect_aiEnumAdiBlock );
+}
+
+/*------------------------------------------------------------------------------
+** Segmentation callback called when the ENUM ADI list has been sent.
+** See ABCC_SegMsgHandlerDoneFuncType.
+**------------------------------------------------------------------------------
+*/
+static void EnumAdiSegDone( void* pxObject )
+{
+   ( (ect_EnumAdiSegType*)pxObject )->fActive = FALSE;
+}
+
+/*------------------------------------------------------------------------------
+** Sends the ENUM ADI list as a segmented response, read from the ADI list one
+** block at a time as the segments are sent.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to the Get_Attribute request.
+**
+** Returns:
+**    None              - The psNewMessage is set to an error response if the
+**                        segmented response could not be started.
+**------------------------------------------------------------------------------
+*/
+static void StartEnumAdiSeg( ABP_MsgType* psNewMessage )
+{
+   if( ect_sEnumAdiSeg.fActive )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NO_RESOURCES );
+      return;
+   }
+
+   ect_sEnumAdiSeg.fActive = TRUE;
+   ect_sEnumAdiSeg.iNextAdiIndex = 0;
+
+   if( ABCC_StartServerRespSegmentationSession( &psNewMessage->sHeader,
+                                                ABCC_GetMsgCmdExt0( psNewMessage ),
+                                                NULL,
+                                                0,
+                                                GetNextEnumAdiBlock,
+                                                EnumAdiSegDone,
+                                                &ect_sEnumAdiSeg ) == ABCC_EC_NO_ERROR )
+   {
+      ect_fRespSegmented = TRUE;
+   }
+   else
+   {
+      ect_sEnumAdiSeg.fActive = FALSE;
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NO_RESOURCES );
+   }
+}
+
 /*------------------------------------------------------------------------------
 ** Generates the ADI list that instance attribute 9 represents, i.e. the list
 ** of all ABP_ENUM ADIs.
@@ -328,11 +587,24 @@ static void GenerateEnumAdiList( ABP_MsgType* psNewMessage )
    UINT16   iAdiIndex;
    UINT16   iMsgOffset;
    UINT16   iNumOfAdis;
-   UINT8    bErrCode;
+
+#if( ECT_IA_ENUM_ADIS_LIST_SIZE > 0 )
+   if( !ect_fMsgDataBuilt )
+   {
+      BuildMsgData();
+   }
+
+   if( ect_fEnumAdiListValid )
+   {
+      SetMsgOctets( psNewMessage,
+                    ect_aiEnumAdiList,
+                    (UINT32)ect_iNumEnumAdis * ABP_UINT16_SIZEOF );
+      return;
+   }
+#endif
 
    iMsgOffset = 0;
    iNumOfAdis = APPL_GetNumAdi();
-   bErrCode = ABP_ERR_NO_ERROR;
 
    /*
    ** Search the ADI list for ABP_ENUM ADIs and copy their instance number(s)
@@ -340,30 +612,16 @@ static void GenerateEnumAdiList( ABP_MsgType* psNewMessage )
    */
    for( iAdiIndex = 0; iAdiIndex < iNumOfAdis; iAdiIndex++ )
    {
-#if( ABCC_CFG_STRUCT_DATA_TYPE_ENABLED )
-      /*
-      ** Ignore struct ADIs, ABP_ENUMs are not allowed in them.
-      */
-      if( ( APPL_asAdiEntryList[ iAdiIndex ].psStruct == NULL ) &&
-          ( APPL_asAdiEntryList[ iAdiIndex ].bDataType == ABP_ENUM ) )
-#else
-      if( APPL_asAdiEntryList[ iAdiIndex ].bDataType == ABP_ENUM )
-#endif
+      if( IsEnumAdi( iAdiIndex ) )
       {
          if( iMsgOffset >= ( ABCC_GetMaxMessageSize() - 1 ) )
          {
             /*
             ** There are more ABP_ENUM ADIs than what we can fit into the
-            ** message data field. Notify the user and send an error response
-            ** to prevent an 'Only half of the ABP_ENUM ADIs shows up as ENUM!'
-            ** situation.
+            ** message data field, send the whole list segmented instead.
             */
-            ABCC_ERROR( ABCC_SEV_WARNING,
-                        ABCC_EC_NO_RESOURCES,
-                        (UINT32)APPL_asAdiEntryList[ iAdiIndex ].iInstance );
-            bErrCode = ABP_ERR_NO_RESOURCES;
-
-            break; /* Break for( ... ) */
+            StartEnumAdiSeg( psNewMessage );
+            return;
          }
          ABCC_SetMsgData16( psNewMessage,
                               APPL_asAdiEntryList[ iAdiIndex ].iInstance,
@@ -372,527 +630,376 @@ static void GenerateEnumAdiList( ABP_MsgType* psNewMessage )
       }
    }
 
-   if( bErrCode == ABP_ERR_NO_ERROR )
-   {
-      ABP_SetMsgResponse( psNewMessage, iMsgOffset );
-   }
-   else
-   {
-      ABP_SetMsgErrorResponse( psNewMessage, 1, bErrCode );
-   }
+   ABP_SetMsgResponse( psNewMessage, iMsgOffset );
 }
 #endif /* ECT_IA_ENUM_ADIS_ENABLE */
 
+#if( ECT_IA_WR_PD_ASSY_INST_TRANS_ENABLE || \
+     ECT_IA_RD_PD_ASSY_INST_TRANS_ENABLE || \
+     ECT_IA_DEF_TXPDO_ASSIGN_ENABLE ||      \
+     ECT_IA_DEF_RXPDO_ASSIGN_ENABLE )
 /*------------------------------------------------------------------------------
-** Processes commands to ECT Instances
+** Copies an array of UINT16 attribute values to the message.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    psNewMessage      - Pointer to a ABP_MsgType message.
+**    paiData           - Attribute values.
+**    iNumElements      - Number of elements in paiData.
 **
 ** Returns:
 **    None
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage )
+static void SetMsgUint16Array( ABP_MsgType* psNewMessage,
+                               const UINT16* paiData,
+                               UINT16 iNumElements )
 {
-   /*
-   ** This function processes commands to the EtherCAT Instance.
-   */
-   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
-   {
-      /*
-      ** The Instance does not exist.
-      */
-      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
+   UINT16  iIndex;
 
-      return;
-   }
-
-   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   for( iIndex = 0; iIndex < iNumElements; ++iIndex )
    {
-   case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if ECT_IA_VENDOR_ID_ENABLE
-      case ABP_ECT_IA_VENDOR_ID:
-
-         /*
-         ** Copy the 1st Instance 1 attribute (Vendor ID) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, ECT_IA_VENDOR_ID_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_VENDOR_ID_DS );
-         break;
-#endif
-#if ECT_IA_PRODUCT_CODE_ENABLE
-      case ABP_ECT_IA_PRODUCT_CODE:
-
-         /*
-         ** Copy the 2nd Instance 1 attribute (Product code) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, ECT_IA_PRODUCT_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_PRODUCT_CODE_DS );
-         break;
-#endif
-#if ECT_IA_MAJOR_REV_ENABLE
-      case ABP_ECT_IA_MAJOR_REV:
+      ABCC_SetMsgData16( psNewMessage,
+                         paiData[ iIndex ],
+                         ( ABP_UINT16_SIZEOF * iIndex ) );
+   }
 
-         /*
-         ** Copy the 3rd Instance 1 attribute (Revision high word) to the
-         ** message.
-         */
-         ABCC_SetMsgData16( psNewMessage, ECT_IA_REVISION_HW_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_MAJOR_REV_DS );
-         break;
+   ABP_SetMsgResponse( psNewMessage, ( iNumElements * ABP_UINT16_SIZEOF ) );
+}
 #endif
-#if ECT_IA_MINOR_REV_ENABLE
-      case ABP_ECT_IA_MINOR_REV:
 
-         /*
-         ** Copy the 4th Instance 1 attribute (Revision low word) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, ECT_IA_REVISION_LW_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_MINOR_REV_DS );
-         break;
+#if ECT_IA_WR_PD_ASSY_INST_TRANS_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Write PD assembly instance translation (Instance 1) to the
+** message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetWrPdAssyInstTrans( ABP_MsgType* psNewMessage )
+{
+   SetMsgUint16Array( psNewMessage,
+                      ect_sInstance.aiWrPdAssyInstTrans,
+                      ECT_IA_WR_PD_ASSY_INST_TRANS_SIZE );
+}
 #endif
-#if ECT_IA_SERIAL_NUMBER_ENABLE
-      case ABP_ECT_IA_SERIAL_NUMBER:
 
-         /*
-         ** Copy the 5th Instance 1 attribute (Serial number) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, ECT_IA_SERIAL_NUMBER_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_SERIAL_NUMBER_DS );
-         break;
-#endif
-#if ECT_IA_MANF_DEVICE_NAME_ENABLE
-      case ABP_ECT_IA_MANF_DEV_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( ECT_IA_MANF_DEVICE_NAME_VALUE );
-
-         /*
-         ** Copy the 6th Instance 1 attribute (Manufacturer device name) to the
-         ** message.
-         */
-         ABCC_SetMsgString( psNewMessage, ECT_IA_MANF_DEVICE_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-#endif
-#if ECT_IA_MANF_HW_VERSION_ENABLE
-      case ABP_ECT_IA_MANF_HW_VER:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( ECT_IA_MANF_HW_VERSION_VALUE );
-
-         /*
-         ** Copy the 7th Instance 1 attribute (Manufacturer hardware version) to
-         ** the message.
-         */
-         ABCC_SetMsgString( psNewMessage, ECT_IA_MANF_HW_VERSION_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-      }
-      break;
-#endif
-#if ECT_IA_MANF_SW_VERSION_ENABLE
-      case ABP_ECT_IA_MANF_SW_VER:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( ECT_IA_MANF_SW_VERSION_VALUE );
-
-         /*
-         ** Copy the 8th Instance 1 attribute (Manufacturer software version) to
-         ** the message.
-         */
-         ABCC_SetMsgString( psNewMessage, ECT_IA_MANF_SW_VERSION_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-      }
-      break;
-#endif
-#if ECT_IA_ENUM_ADIS_ENABLE
-      case ABP_ECT_IA_ENUM_ADIS:
-      {
-         GenerateEnumAdiList( psNewMessage );
-         break;
-      }
-#endif
-#if ECT_IA_DEVICE_TYPE_ENABLE
-      case ABP_ECT_IA_DEVICE_TYPE:
-
-         /*
-         ** Copy the 10th Instance 1 attribute (Device type) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, ECT_IA_DEVICE_TYPE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_DEVICE_TYPE_DS );
-         break;
-#endif
-#if ECT_IA_WR_PD_ASSY_INST_TRANS_ENABLE
-      case ABP_ECT_IA_WR_PD_ASSY_INST_TRANS:
-      {
-         UINT16  iIndex;
-
-         /*
-         ** Copy the 11th Instance 1 attribute (Write PD assembly instance
-         ** translation) to the message.
-         */
-         for( iIndex = 0; iIndex < ECT_IA_WR_PD_ASSY_INST_TRANS_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.aiWrPdAssyInstTrans[ iIndex ],
-                               ( ABP_UINT16_SIZEOF * iIndex ) );
-         }
-
-         ABP_SetMsgResponse( psNewMessage, ( ECT_IA_WR_PD_ASSY_INST_TRANS_SIZE * ABP_UINT16_SIZEOF ) );
-         break;
-      }
-#endif
 #if ECT_IA_RD_PD_ASSY_INST_TRANS_ENABLE
-      case ABP_ECT_IA_RD_PD_ASSY_INST_TRANS:
-      {
-         UINT16  iIndex;
-
-         /*
-         ** Copy the 12th Instance 1 attribute (Read PD assembly instance
-         ** translation) to the message.
-         */
-         for( iIndex = 0; iIndex < ECT_IA_RD_PD_ASSY_INST_TRANS_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.aiRdPdAssyInstTrans[ iIndex ],
-                               ( ABP_UINT16_SIZEOF * iIndex ) );
-         }
-
-         ABP_SetMsgResponse( psNewMessage, ( ECT_IA_RD_PD_ASSY_INST_TRANS_SIZE * ABP_UINT16_SIZEOF ) );
-         break;
-      }
+/*------------------------------------------------------------------------------
+** Copies the Read PD assembly instance translation (Instance 1) to the
+** message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetRdPdAssyInstTrans( ABP_MsgType* psNewMessage )
+{
+   SetMsgUint16Array( psNewMessage,
+                      ect_sInstance.aiRdPdAssyInstTrans,
+                      ECT_IA_RD_PD_ASSY_INST_TRANS_SIZE );
+}
 #endif
-#if ECT_IA_ADI_TRANS_ENABLE
-      case ABP_ECT_IA_ADI_TRANS:
-      {
-         UINT16  iIndex;
 
-         /*
-         ** Copy the 13th Instance 1 attribute (ADI translation) to the message.
-         */
-         for( iIndex = 0; iIndex < ECT_IA_ADI_TRANS_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.asADITrans[ iIndex ].iADIInstanceNumber,
-                               ( ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF ) * iIndex ) );
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.asADITrans[ iIndex ].iADIObjectIndex,
-                               ( ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF ) * iIndex ) + ABP_UINT16_SIZEOF );
-         }
+#if ECT_IA_ADI_TRANS_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the ADI translation (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetAdiTrans( ABP_MsgType* psNewMessage )
+{
+   if( !ect_fMsgDataBuilt )
+   {
+      BuildMsgData();
+   }
 
-         ABP_SetMsgResponse( psNewMessage, ( ECT_IA_ADI_TRANS_SIZE * ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF ) ) );
-         break;
-      }
+   SetMsgOctets( psNewMessage,
+                 ect_aiAdiTransMsg,
+                 (UINT32)ECT_IA_ADI_TRANS_SIZE * ECT_ADI_TRANS_ENTRY_SIZE );
+}
 #endif
-#if ECT_IA_OBJ_SUB_TRANS_ENABLE
-      case ABP_ECT_IA_OBJ_SUB_TRANS:
-      {
-         UINT16  iIndex;
 
-         /*
-         ** Copy the 13th Instance 1 attribute (ADI translation) to the message.
-         */
-         for( iIndex = 0; iIndex < ECT_IA_OBJ_SUB_TRANS_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.asObjSubTrans[ iIndex ].iADIInstanceNumber,
-                               ( ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF + ABP_UINT8_SIZEOF ) * iIndex ) );
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.asObjSubTrans[ iIndex ].iADIObjectIndex,
-                               ( ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF + ABP_UINT8_SIZEOF ) * iIndex ) + ABP_UINT16_SIZEOF );
-            ABCC_SetMsgData8( psNewMessage,
-                               ect_sInstance.asObjSubTrans[ iIndex ].bADIObjectIndexSubindex,
-                               ( ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF + ABP_UINT8_SIZEOF ) * iIndex ) + ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF );
-         }
+#if ECT_IA_OBJ_SUB_TRANS_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Object subindex translation (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetObjSubTrans( ABP_MsgType* psNewMessage )
+{
+   if( !ect_fMsgDataBuilt )
+   {
+      BuildMsgData();
+   }
 
-         ABP_SetMsgResponse( psNewMessage, ( ECT_IA_OBJ_SUB_TRANS_SIZE * ( ABP_UINT16_SIZEOF + ABP_UINT16_SIZEOF + ABP_UINT8_SIZEOF ) ) );
-         break;
-      }
-#endif
-#if ECT_IA_ENABLE_FOE_ENABLE
-      case ABP_ECT_IA_ENABLE_FOE:
-      {
-         /*
-         ** The 'FoE enable' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ect_sInstance.fEnableFoE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_ENABLE_FOE_DS );
-         break;
-      }
-#endif
-#if ECT_IA_ENABLE_EOE_ENABLE
-      case ABP_ECT_IA_ENABLE_EOE:
-      {
-         /*
-         ** The 'EoE' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ect_sInstance.fEnableEoE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_ENABLE_EOE_DS );
-         break;
-      }
-#endif
-#if ECT_IA_SET_DEV_ID_AS_CSA_ENABLE
-      case ABP_ECT_IA_SET_DEV_ID_AS_CSA:
-      {
-         /*
-         ** The 'Set Device ID as Configured State Alias' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ect_sInstance.fSetDevIDAsCSA, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_SET_DEV_ID_AS_CSA_DS );
-         break;
-      }
+   SetMsgOctets( psNewMessage,
+                 ect_aiObjSubTransMsg,
+                 (UINT32)ECT_IA_OBJ_SUB_TRANS_SIZE * ECT_OBJ_SUB_TRANS_ENTRY_SIZE );
+}
 #endif
+
 #if ECT_IA_ETHERCAT_STATE_ENABLE
-      case ABP_ECT_IA_ETHERCAT_STATE:
-      {
-         /*
-         ** The 'EtherCAT state' attribute is requested.
-         ** Attribute is 'Set only'. Return error code 'Attribute not gettable'.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_GETABLE );
-         break;
-      }
+/*------------------------------------------------------------------------------
+** Sets the EtherCAT state (Instance 1) from the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void SetEtherCatState( ABP_MsgType* psNewMessage )
+{
+   ABCC_GetMsgData8( psNewMessage, &ect_bEtherCATState, 0 );
+   ABP_SetMsgResponse( psNewMessage, 0 );
+}
 #endif
+
 #if ECT_IA_STATE_TIMEOUTS_ENABLE
-      case ABP_ECT_IA_STATE_TIMEOUTS:
-      {
-         /*
-         ** The 'State Transitions Timeout' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 0 ], 0 );
-         ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 1 ], 4 );
-         ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 2 ], 8 );
-         ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 3 ], 12 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_STATE_TIMEOUTS_DS );
-         break;
-      }
-#endif
-#if ECT_IA_COMP_IDENT_LISTS_ENABLE
-      case ABP_ECT_IA_COMP_IDENT_LISTS:
-      {
-         /*
-         ** The 'Compare Identity Lists' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ect_sInstance.fCompIDLists, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_COMP_IDENT_LISTS_DS );
-         break;
-      }
-#endif
-#if ECT_IA_FSOE_STATUS_IND_ENABLE
-      case ABP_ECT_IA_FSOE_STATUS_IND:
-      {
-         /*
-         ** The 'FsOE status indicator' attribute is requested.
-         ** Attribute is 'Set only'. Return error code 'Attribute not gettable'.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_GETABLE );
-         break;
-      }
-#endif
-#if ECT_IA_CLEAR_IDENT_AL_STS_ENABLE
-      case ABP_ECT_IA_CLEAR_IDENT_AL_STS:
-      {
-         /*
-         ** The 'Clear IdentALSts' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, ect_sInstance.fClearIdAlSts, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_CLEAR_IDENT_AL_STS_DS );
-         break;
-      }
+/*------------------------------------------------------------------------------
+** Copies the State transition timeouts (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetStateTimeouts( ABP_MsgType* psNewMessage )
+{
+   ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 0 ], 0 );
+   ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 1 ], 4 );
+   ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 2 ], 8 );
+   ABCC_SetMsgData32( psNewMessage, ect_sInstance.alStateTransTimeouts[ 3 ], 12 );
+   ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_STATE_TIMEOUTS_DS );
+}
 #endif
-#if ECT_IA_SII_ORDER_NUM_ENABLE
-      case ABP_ECT_IA_SII_ORDER_NUM:
-      {
-         UINT16 iStrLength = (UINT16)strlen( ECT_IA_SII_ORDER_NUM_VALUE );
-
-         if( iStrLength > ABP_ECT_IA_SII_ORDER_NUM_MAX_DS )
-         {
-            iStrLength = ABP_ECT_IA_SII_ORDER_NUM_MAX_DS;
-         }
 
-         ABCC_SetMsgString( psNewMessage, ECT_IA_SII_ORDER_NUM_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-
-         break;
-      }
+#if ECT_IA_FSOE_STATUS_IND_ENABLE
+/*------------------------------------------------------------------------------
+** Sets the FSoE status indicator (Instance 1) from the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void SetFSoEStatusInd( ABP_MsgType* psNewMessage )
+{
+   ABCC_GetMsgData8( psNewMessage, &ect_eFSoEStatusIndicator, 0 );
+   ABP_SetMsgResponse( psNewMessage, 0 );
+}
 #endif
-#if ECT_IA_SII_DEV_NAME_ENABLE
-      case ABP_ECT_IA_SII_DEV_NAME:
-      {
-         UINT16 iStrLength = (UINT16)strlen( ECT_IA_SII_DEV_NAME_VALUE );
-
-         if( iStrLength > ABP_ECT_IA_SII_DEV_NAME_MAX_DS )
-         {
-            iStrLength = ABP_ECT_IA_SII_DEV_NAME_MAX_DS;
-         }
 
-         ABCC_SetMsgString( psNewMessage, ECT_IA_SII_DEV_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-
-         break;
-      }
-#endif
 #if ECT_IA_DEF_TXPDO_ASSIGN_ENABLE
-      case ABP_ECT_IA_DEF_TXPDO_ASSIGN:
-      {
-         UINT16 iIndex;
-
-         for( iIndex = 0; iIndex < ECT_IA_DEF_TXPDO_ASSIGN_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.aiTxPdoAssignments[ iIndex ],
-                               ( ABP_UINT16_SIZEOF * iIndex ) );
-         }
-
-         ABP_SetMsgResponse( psNewMessage, ( ECT_IA_DEF_TXPDO_ASSIGN_SIZE * ABP_UINT16_SIZEOF ) );
-
-         break;
-      }
+/*------------------------------------------------------------------------------
+** Copies the Default TxPDO assignments (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetDefTxPdoAssign( ABP_MsgType* psNewMessage )
+{
+   SetMsgUint16Array( psNewMessage,
+                      ect_sInstance.aiTxPdoAssignments,
+                      ECT_IA_DEF_TXPDO_ASSIGN_SIZE );
+}
 #endif
-#if ECT_IA_DEF_RXPDO_ASSIGN_ENABLE
-      case ABP_ECT_IA_DEF_RXPDO_ASSIGN:
-      {
-         UINT16 iIndex;
 
-         for( iIndex = 0; iIndex < ECT_IA_DEF_RXPDO_ASSIGN_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage,
-                               ect_sInstance.aiRxPdoAssignments[ iIndex ],
-                               ( ABP_UINT16_SIZEOF * iIndex ) );
-         }
-
-         ABP_SetMsgResponse( psNewMessage, ( ECT_IA_DEF_RXPDO_ASSIGN_SIZE * ABP_UINT16_SIZEOF ) );
-
-         break;
-      }
+#if ECT_IA_DEF_RXPDO_ASSIGN_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Default RxPDO assignments (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetDefRxPdoAssign( ABP_MsgType* psNewMessage )
+{
+   SetMsgUint16Array( psNewMessage,
+                      ect_sInstance.aiRxPdoAssignments,
+                      ECT_IA_DEF_RXPDO_ASSIGN_SIZE );
+}
 #endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
 
-      break;
-   }
-   case ABP_CMD_SET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if ECT_IA_ETHERCAT_STATE_ENABLE
-      case ABP_ECT_IA_ETHERCAT_STATE:
-      {
-         /*
-         ** Save the new state in the local variable.
-         */
-         ABCC_GetMsgData8( psNewMessage, &ect_bEtherCATState, 0 );
-         ABP_SetMsgResponse( psNewMessage, 0 );
-         break;
-      }
-#endif
-#if ECT_IA_FSOE_STATUS_IND_ENABLE
-      case ABP_ECT_IA_FSOE_STATUS_IND:
-      {
-         /*
-         ** Save the new state of the FsOE status indicator.
-         */
-         ABCC_GetMsgData8( psNewMessage, &ect_eFSoEStatusIndicator, 0 );
-         ABP_SetMsgResponse( psNewMessage, 0 );
-         break;
-      }
+#if ECT_IA_SERIAL_NUMBER_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Serial number (Instance 1) to the message. The value may be a
+** function call or a variable, see abcc_identification.h.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetSerialNumber( ABP_MsgType* psNewMessage )
+{
+   ABCC_SetMsgData32( psNewMessage, ECT_IA_SERIAL_NUMBER_VALUE, 0 );
+   ABP_SetMsgResponse( psNewMessage, ABP_ECT_IA_SERIAL_NUMBER_DS );
+}
 #endif
-#if( ECT_IA_VENDOR_ID_ENABLE || ECT_IA_PRODUCT_CODE_ENABLE || ECT_IA_MAJOR_REV_ENABLE || ECT_IA_MINOR_REV_ENABLE || ECT_IA_SERIAL_NUMBER_ENABLE || ECT_IA_MANF_DEVICE_NAME_ENABLE || ECT_IA_MANF_HW_VERSION_ENABLE || ECT_IA_MANF_SW_VERSION_ENABLE || ECT_IA_ENUM_ADIS_ENABLE || ECT_IA_DEVICE_TYPE_ENABLE || ECT_IA_WR_PD_ASSY_INST_TRANS_ENABLE || ECT_IA_RD_PD_ASSY_INST_TRANS_ENABLE || ECT_IA_ADI_TRANS_ENABLE || ECT_IA_OBJ_SUB_TRANS_ENABLE || ECT_IA_ENABLE_FOE_ENABLE || ECT_IA_ENABLE_EOE_ENABLE || ECT_IA_SET_DEV_ID_AS_CSA_ENABLE || ECT_IA_STATE_TIMEOUTS_ENABLE || ECT_IA_COMP_IDENT_LISTS_ENABLE || ECT_IA_CLEAR_IDENT_AL_STS_ENABLE )
+
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType ect_asInstAttr[] =
+{
 #if ECT_IA_VENDOR_ID_ENABLE
-      case ABP_ECT_IA_VENDOR_ID:
+   ABCC_HOST_ATTR_U32( ABP_ECT_IA_VENDOR_ID, ECT_IA_VENDOR_ID_VALUE ),
 #endif
 #if ECT_IA_PRODUCT_CODE_ENABLE
-      case ABP_ECT_IA_PRODUCT_CODE:
+   ABCC_HOST_ATTR_U32( ABP_ECT_IA_PRODUCT_CODE, ECT_IA_PRODUCT_CODE_VALUE ),
 #endif
 #if ECT_IA_MAJOR_REV_ENABLE
-      case ABP_ECT_IA_MAJOR_REV:
+   ABCC_HOST_ATTR_U16( ABP_ECT_IA_MAJOR_REV, ECT_IA_REVISION_HW_VALUE ),
 #endif
 #if ECT_IA_MINOR_REV_ENABLE
-      case ABP_ECT_IA_MINOR_REV:
+   ABCC_HOST_ATTR_U16( ABP_ECT_IA_MINOR_REV, ECT_IA_REVISION_LW_VALUE ),
 #endif
 #if ECT_IA_SERIAL_NUMBER_ENABLE
-      case ABP_ECT_IA_SERIAL_NUMBER:
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_SERIAL_NUMBER, GetSerialNumber, NULL ),
 #endif
 #if ECT_IA_MANF_DEVICE_NAME_ENABLE
-      case ABP_ECT_IA_MANF_DEV_NAME:
+   ABCC_HOST_ATTR_STR( ABP_ECT_IA_MANF_DEV_NAME,
+                       ECT_IA_MANF_DEVICE_NAME_VALUE ),
 #endif
 #if ECT_IA_MANF_HW_VERSION_ENABLE
-      case ABP_ECT_IA_MANF_HW_VER:
+   ABCC_HOST_ATTR_STR( ABP_ECT_IA_MANF_HW_VER, ECT_IA_MANF_HW_VERSION_VALUE ),
 #endif
 #if ECT_IA_MANF_SW_VERSION_ENABLE
-      case ABP_ECT_IA_MANF_SW_VER:
+   ABCC_HOST_ATTR_STR( ABP_ECT_IA_MANF_SW_VER, ECT_IA_MANF_SW_VERSION_VALUE ),
 #endif
 #if ECT_IA_ENUM_ADIS_ENABLE
-      case ABP_ECT_IA_ENUM_ADIS:
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_ENUM_ADIS, GenerateEnumAdiList, NULL ),
 #endif
 #if ECT_IA_DEVICE_TYPE_ENABLE
-      case ABP_ECT_IA_DEVICE_TYPE:
+   ABCC_HOST_ATTR_U32( ABP_ECT_IA_DEVICE_TYPE, ECT_IA_DEVICE_TYPE_VALUE ),
 #endif
 #if ECT_IA_WR_PD_ASSY_INST_TRANS_ENABLE
-      case ABP_ECT_IA_WR_PD_ASSY_INST_TRANS:
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_WR_PD_ASSY_INST_TRANS,
+                        GetWrPdAssyInstTrans,
+                        NULL ),
 #endif
 #if ECT_IA_RD_PD_ASSY_INST_TRANS_ENABLE
-      case ABP_ECT_IA_RD_PD_ASSY_INST_TRANS:
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_RD_PD_ASSY_INST_TRANS,
+                        GetRdPdAssyInstTrans,
+                        NULL ),
 #endif
 #if ECT_IA_ADI_TRANS_ENABLE
-      case ABP_ECT_IA_ADI_TRANS:
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_ADI_TRANS, GetAdiTrans, NULL ),
 #endif
 #if ECT_IA_OBJ_SUB_TRANS_ENABLE
-      case ABP_ECT_IA_OBJ_SUB_TRANS:
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_OBJ_SUB_TRANS, GetObjSubTrans, NULL ),
 #endif
 #if ECT_IA_ENABLE_FOE_ENABLE
-      case ABP_ECT_IA_ENABLE_FOE:
+   ABCC_HOST_ATTR_U8( ABP_ECT_IA_ENABLE_FOE, ECT_IA_ENABLE_FOE_VALUE ),
 #endif
 #if ECT_IA_ENABLE_EOE_ENABLE
-      case ABP_ECT_IA_ENABLE_EOE:
+   ABCC_HOST_ATTR_U8( ABP_ECT_IA_ENABLE_EOE, ECT_IA_ENABLE_EOE_VALUE ),
 #endif
 #if ECT_IA_SET_DEV_ID_AS_CSA_ENABLE
-      case ABP_ECT_IA_SET_DEV_ID_AS_CSA:
+   ABCC_HOST_ATTR_U8( ABP_ECT_IA_SET_DEV_ID_AS_CSA,
+                      ECT_IA_SET_DEV_ID_AS_CSA_VALUE ),
+#endif
+#if ECT_IA_ETHERCAT_STATE_ENABLE
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_ETHERCAT_STATE, NULL, SetEtherCatState ),
 #endif
 #if ECT_IA_STATE_TIMEOUTS_ENABLE
-      case ABP_ECT_IA_STATE_TIMEOUTS:
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_STATE_TIMEOUTS, GetStateTimeouts, NULL ),
 #endif
 #if ECT_IA_COMP_IDENT_LISTS_ENABLE
-      case ABP_ECT_IA_COMP_IDENT_LISTS:
+   ABCC_HOST_ATTR_U8( ABP_ECT_IA_COMP_IDENT_LISTS,
+                      ECT_IA_COMP_IDENT_LISTS_VALUE ),
+#endif
+#if ECT_IA_FSOE_STATUS_IND_ENABLE
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_FSOE_STATUS_IND, NULL, SetFSoEStatusInd ),
 #endif
 #if ECT_IA_CLEAR_IDENT_AL_STS_ENABLE
-      case ABP_ECT_IA_CLEAR_IDENT_AL_STS:
+   ABCC_HOST_ATTR_U8( ABP_ECT_IA_CLEAR_IDENT_AL_STS,
+                      ECT_IA_CLEAR_IDENT_AL_STS_VALUE ),
 #endif
-      {
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_ATTR_NOT_SETABLE );
-         break;
-      }
+#if ECT_IA_SII_ORDER_NUM_ENABLE
+   ABCC_HOST_ATTR_STR_MAX( ABP_ECT_IA_SII_ORDER_NUM, ECT_IA_SII_ORDER_NUM_VALUE,
+                           ABP_ECT_IA_SII_ORDER_NUM_MAX_DS ),
 #endif
-      default:
+#if ECT_IA_SII_DEV_NAME_ENABLE
+   ABCC_HOST_ATTR_STR_MAX( ABP_ECT_IA_SII_DEV_NAME, ECT_IA_SII_DEV_NAME_VALUE,
+                           ABP_ECT_IA_SII_DEV_NAME_MAX_DS ),
+#endif
+#if ECT_IA_DEF_TXPDO_ASSIGN_ENABLE
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_DEF_TXPDO_ASSIGN, GetDefTxPdoAssign, NULL ),
+#endif
+#if ECT_IA_DEF_RXPDO_ASSIGN_ENABLE
+   ABCC_HOST_ATTR_FUNC( ABP_ECT_IA_DEF_RXPDO_ASSIGN, GetDefRxPdoAssign, NULL ),
+#endif
+   ABCC_HOST_ATTR_END
+};
 
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
-      break;
+/*------------------------------------------------------------------------------
+** Processes commands to ECT Instances
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void InstanceCommand( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** This function processes commands to the EtherCAT Instance.
+   */
+   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
+   {
+      /*
+      ** The Instance does not exist.
+      */
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
+
+      return;
    }
+
+   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   {
+   case ABP_CMD_GET_ATTR:
+   case ABP_CMD_SET_ATTR:
+
+      ABCC_HostAttrCommand( psNewMessage, ect_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( ect_asInstAttr ) );
+      break;
+
    default:
 
       /*
@@ -923,59 +1030,8 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    {
    case ABP_CMD_GET_ATTR:
 
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( ECT_OA_NAME_VALUE );
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgString( psNewMessage, ECT_OA_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-
-         ABCC_SetMsgData8( psNewMessage, ect_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_UINT8_SIZEOF );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, ect_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_UINT16_SIZEOF );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, ect_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_UINT16_SIZEOF );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-
-      } /* End of switch( Attribute number ) */
-
+      ABCC_HostAttrCommand( psNewMessage, ect_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( ect_asObjAttr ) );
       break;
 
 #if ECT_OBJ_CMD_GET_OBJ_DESC_ENABLE
@@ -989,14 +1045,14 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
 
          for( iArrayIndex = 0; iArrayIndex < ECT_GET_OBJ_DESC_NUM_OBJ; iArrayIndex++ )
          {
-            if( ect_sObject.asObjectDescriptions[ iArrayIndex ].iObjectIndex == iRequestedObjIndex )
+            if( ect_asObjectDescriptions[ iArrayIndex ].iObjectIndex == iRequestedObjIndex )
             {
                ABCC_SetMsgData16( psNewMessage,
-                                  ect_sObject.asObjectDescriptions[ iArrayIndex ].eEctDataType,
+                                  ect_asObjectDescriptions[ iArrayIndex ].eEctDataType,
                                   0 );
 
                ABCC_SetMsgData8( psNewMessage,
-                                 ect_sObject.asObjectDescriptions[ iArrayIndex ].eObjectCode,
+                                 ect_asObjectDescriptions[ iArrayIndex ].eObjectCode,
                                  ABP_UINT16_SIZEOF );
 
                ABP_SetMsgResponse( psNewMessage, ( ABP_UINT16_SIZEOF + ABP_UINT8_SIZEOF ) );
@@ -1020,8 +1076,23 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    } /* End of switch( Command number ) */
 }
 
+void ECT_Init( void )
+{
+#if ECT_IA_ENUM_ADIS_ENABLE
+   ect_sEnumAdiSeg.fActive = FALSE;
+#endif
+
+#if ( ( ECT_IA_ENUM_ADIS_ENABLE && ( ECT_IA_ENUM_ADIS_LIST_SIZE > 0 ) ) || \
+     ECT_IA_ADI_TRANS_ENABLE ||                                          \
+     ECT_IA_OBJ_SUB_TRANS_ENABLE )
+   BuildMsgData();
+#endif
+}
+
 void ECT_ProcessCmdMsg( ABP_MsgType* psNewMessage )
 {
+   ect_fRespSegmented = FALSE;
+
    /*
    ** This function processes commands to the EtherCAT Object and its Instance.
    */
@@ -1040,7 +1111,14 @@ void ECT_ProcessCmdMsg( ABP_MsgType* psNewMessage )
       InstanceCommand( psNewMessage );
    }
 
-   ABCC_SendRespMsg( psNewMessage );
+   /*
+   ** A segmented response is sent by the segmentation session, the request
+   ** buffer is then returned by the driver.
+   */
+   if( !ect_fRespSegmented )
+   {
+      ABCC_SendRespMsg( psNewMessage );
+   }
 }
 
 #if ECT_IA_ETHERCAT_STATE_ENABLE
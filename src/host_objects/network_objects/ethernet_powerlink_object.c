@@ -25,6 +25,7 @@
 #include "string.h"
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_host_attribute.h"
 
 #if EPL_OBJ_ENABLE
 
@@ -38,28 +39,22 @@
 #define EPL_OA_HIGHEST_INST_VALUE                  1
 
 /*------------------------------------------------------------------------------
-** Structure describing a Powerlink Object.
+** Object attributes.
 **------------------------------------------------------------------------------
 */
-typedef struct epl_Object
+static const ABCC_HostAttrType epl_asObjAttr[] =
 {
-    const  char* pcName;
-    UINT8  bRevision;
-    UINT16 iNumberOfInstances;
-    UINT16 iHighestInstanceNo;
-}
-epl_ObjectType;
-
-static const epl_ObjectType epl_sObject =
-{
-   EPL_OA_NAME_VALUE,                           /* Name.                                              */
-   EPL_OA_REV_VALUE,                            /* Revision.                                          */
-   EPL_OA_NUM_INST_VALUE,                       /* Number of instances.                               */
-   EPL_OA_HIGHEST_INST_VALUE                    /* Highest instance number.                           */
+   ABCC_HOST_ATTR_OBJECT( EPL_OA_NAME_VALUE,
+                          EPL_OA_REV_VALUE,
+                          EPL_OA_NUM_INST_VALUE,
+                          EPL_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
 };
 
+#if EPL_IA_SERIAL_NUMBER_ENABLE
 /*------------------------------------------------------------------------------
-** Processes commands to EPL Instances
+** Copies the Serial number (Instance 1) to the message. The value may be a
+** function call or a variable, see abcc_identification.h.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    psNewMessage      - Pointer to a ABP_MsgType message.
@@ -68,164 +63,86 @@ static const epl_ObjectType epl_sObject =
 **    None
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage )
+static void GetSerialNumber( ABP_MsgType* psNewMessage )
 {
-   /*
-   ** This function processes commands to the Ethernet POWERLINK Instance.
-   */
-   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
-   {
-      /*
-      ** The Instance does not exist.
-      */
-      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
-
-      return;
-   }
+   ABCC_SetMsgData32( psNewMessage, EPL_IA_SERIAL_NUMBER_VALUE, 0 );
+   ABP_SetMsgResponse( psNewMessage, ABP_EPL_IA_SERIAL_NUMBER_DS );
+}
+#endif
 
-   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
-   {
-   case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType epl_asInstAttr[] =
+{
 #if EPL_IA_VENDOR_ID_ENABLE
-      case ABP_EPL_IA_VENDOR_ID:
-
-         /*
-         ** Copy the 1st Instance 1 attribute (Vendor ID) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, EPL_IA_VENDOR_ID_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EPL_IA_VENDOR_ID_DS );
-         break;
+   ABCC_HOST_ATTR_U32( ABP_EPL_IA_VENDOR_ID, EPL_IA_VENDOR_ID_VALUE ),
 #endif
 #if EPL_IA_PRODUCT_CODE_ENABLE
-      case ABP_EPL_IA_PRODUCT_CODE:
-
-         /*
-         ** Copy the 2nd Instance 1 attribute (Product code) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, EPL_IA_PRODUCT_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EPL_IA_PRODUCT_CODE_DS );
-         break;
+   ABCC_HOST_ATTR_U32( ABP_EPL_IA_PRODUCT_CODE, EPL_IA_PRODUCT_CODE_VALUE ),
 #endif
 #if EPL_IA_REVISION_HW_ENABLE
-      case ABP_EPL_IA_MAJOR_REV:
-
-         /*
-         ** Copy the 3rd Instance 1 attribute (Revision high word) to the
-         ** message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EPL_IA_REVISION_HW_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EPL_IA_MAJOR_REV_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EPL_IA_MAJOR_REV, EPL_IA_REVISION_HW_VALUE ),
 #endif
 #if EPL_IA_REVISION_LW_ENABLE
-      case ABP_EPL_IA_MINOR_REV:
-
-         /*
-         ** Copy the 4th Instance 1 attribute (Revision low word) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EPL_IA_REVISION_LW_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EPL_IA_MINOR_REV_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EPL_IA_MINOR_REV, EPL_IA_REVISION_LW_VALUE ),
 #endif
 #if EPL_IA_SERIAL_NUMBER_ENABLE
-      case ABP_EPL_IA_SERIAL_NUMBER:
-
-         /*
-         ** Copy the 5th Instance 1 attribute (Serial number) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, EPL_IA_SERIAL_NUMBER_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EPL_IA_SERIAL_NUMBER_DS );
-         break;
+   ABCC_HOST_ATTR_FUNC( ABP_EPL_IA_SERIAL_NUMBER, GetSerialNumber, NULL ),
 #endif
 #if EPL_IA_MANF_DEVICE_NAME_ENABLE
-      case ABP_EPL_IA_MANF_DEV_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( EPL_IA_MANF_DEVICE_NAME_VALUE );
-
-         /*
-         ** Copy the 6th Instance 1 attribute (Manufacturer device name) to the
-         ** message.
-         */
-         ABCC_SetMsgString( psNewMessage, EPL_IA_MANF_DEVICE_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
+   ABCC_HOST_ATTR_STR( ABP_EPL_IA_MANF_DEV_NAME,
+                       EPL_IA_MANF_DEVICE_NAME_VALUE ),
 #endif
 #if EPL_IA_MANF_HW_VERSION_ENABLE
-      case ABP_EPL_IA_MANF_HW_VER:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( EPL_IA_MANF_HW_VERSION_VALUE );
-
-
-         /*
-         ** Copy the 7th Instance 1 attribute (Manufacturer hardware version) to
-         ** the message.
-         */
-         ABCC_SetMsgString( psNewMessage, EPL_IA_MANF_HW_VERSION_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-      }
-      break;
+   ABCC_HOST_ATTR_STR( ABP_EPL_IA_MANF_HW_VER, EPL_IA_MANF_HW_VERSION_VALUE ),
 #endif
 #if EPL_IA_MANF_SW_VERSION_ENABLE
-      case ABP_EPL_IA_MANF_SW_VER:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( EPL_IA_MANF_SW_VERSION_VALUE );
-
-         /*
-         ** Copy the 8th Instance 1 attribute (Manufacturer software version) to
-         ** the message.
-         */
-         ABCC_SetMsgString( psNewMessage, EPL_IA_MANF_SW_VERSION_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-      }
-      break;
+   ABCC_HOST_ATTR_STR( ABP_EPL_IA_MANF_SW_VER, EPL_IA_MANF_SW_VERSION_VALUE ),
 #endif
 #if EPL_IA_DEVICE_TYPE_ENABLE
-      case ABP_EPL_IA_DEVICE_TYPE:
-
-         /*
-         ** Copy the 10th Instance 1 attribute (Device type) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, EPL_IA_DEVICE_TYPE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EPL_IA_DEVICE_TYPE_DS );
-         break;
+   ABCC_HOST_ATTR_U32( ABP_EPL_IA_DEVICE_TYPE, EPL_IA_DEVICE_TYPE_VALUE ),
 #endif
 #if EPL_IA_MANF_NAME_ENABLE
-      case ABP_EPL_IA_MANF_NAME:
-      {
-         UINT16 iStrLength;
+   ABCC_HOST_ATTR_STR( ABP_EPL_IA_MANF_NAME, EPL_IA_MANF_NAME_VALUE ),
+#endif
+   ABCC_HOST_ATTR_END
+};
 
-         iStrLength = (UINT16)strlen( EPL_IA_MANF_NAME_VALUE );
+/*------------------------------------------------------------------------------
+** Processes commands to EPL Instances
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void InstanceCommand( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** This function processes commands to the Ethernet POWERLINK Instance.
+   */
+   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
+   {
+      /*
+      ** The Instance does not exist.
+      */
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
 
-         /*
-         ** Copy the 14th Instance 1 attribute (Manufacturer name) to the
-         ** message.
-         */
-         ABCC_SetMsgString( psNewMessage, EPL_IA_MANF_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-#endif
-      default:
+      return;
+   }
 
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   {
+   case ABP_CMD_GET_ATTR:
 
+      ABCC_HostAttrCommand( psNewMessage, epl_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( epl_asInstAttr ) );
       break;
-   }
+
    default:
 
       /*
@@ -256,59 +173,8 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    {
    case ABP_CMD_GET_ATTR:
 
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( EPL_OA_NAME_VALUE );
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgString( psNewMessage, EPL_OA_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-
-         ABCC_SetMsgData8( psNewMessage, epl_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_UINT8_SIZEOF );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, epl_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_UINT16_SIZEOF );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, epl_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_UINT16_SIZEOF );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-
-      } /* End of switch( Attribute number ) */
-
+      ABCC_HostAttrCommand( psNewMessage, epl_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( epl_asObjAttr ) );
       break;
 
    default:
@@ -25,6 +25,7 @@
 #include "string.h"
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_host_attribute.h"
 
 #if EIP_OBJ_ENABLE
 
@@ -37,19 +38,6 @@
 #define EIP_OA_NUM_INST_VALUE                      1
 #define EIP_OA_HIGHEST_INST_VALUE                  1
 
-/*------------------------------------------------------------------------------
-** Structure describing an Ethernet/IP Object.
-**------------------------------------------------------------------------------
-*/
-typedef struct eip_Object
-{
-   const  char* pcName;
-   UINT8  bRevision;
-   UINT16 iNumberOfInstances;
-   UINT16 iHighestInstanceNo;
-}
-eip_ObjectType;
-
 /*------------------------------------------------------------------------------
 ** Structure describing an EtherNet/IP Instance Map used for attribute 27 and 28.
 **------------------------------------------------------------------------------
@@ -84,13 +72,27 @@ eip_InstanceType;
 */
 static void InstanceCommand( ABP_MsgType* psNewMessage );
 static void ObjectCommand( ABP_MsgType* psNewMessage );
+#if EIP_IA_SERIAL_NUMBER_ENABLE
+static void GetSerialNumber( ABP_MsgType* psNewMessage );
+#endif
+#if EIP_IA_PROD_INSTANCE_ENABLE
+static void GetProdInstance( ABP_MsgType* psNewMessage );
+#endif
+#if EIP_IA_CONS_INSTANCE_ENABLE
+static void GetConsInstance( ABP_MsgType* psNewMessage );
+#endif
 
-static const eip_ObjectType eip_sObject =
+/*------------------------------------------------------------------------------
+** Object attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType eip_asObjAttr[] =
 {
-   EIP_OA_NAME_VALUE,                           /* Name.                                              */
-   EIP_OA_REV_VALUE,                            /* Revision.                                          */
-   EIP_OA_NUM_INST_VALUE,                       /* Number of instances.                               */
-   EIP_OA_HIGHEST_INST_VALUE                    /* Highest instance number.                           */
+   ABCC_HOST_ATTR_OBJECT( EIP_OA_NAME_VALUE,
+                          EIP_OA_REV_VALUE,
+                          EIP_OA_NUM_INST_VALUE,
+                          EIP_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
 };
 
 #if( EIP_IA_PROD_INSTANCE_ENABLE || EIP_IA_CONS_INSTANCE_ENABLE )
@@ -104,371 +106,244 @@ static const eip_InstanceType eip_sInstance =
 #endif
 };
 #endif
-void EIP_ProcessCmdMsg( ABP_MsgType* psNewMessage )
-{
-   /*
-   ** This function processes commands to the Ethernet/IP Object and it's Instance.
-   */
-   if( ABCC_GetMsgInstance( psNewMessage ) == ABP_INST_OBJ )
-   {
-      /*
-      ** Ethernet/IP object Command.
-      */
-      ObjectCommand( psNewMessage );
-   }
-   else
-   {
-      /*
-      ** Ethernet/IP instance Command.
-      */
-      InstanceCommand( psNewMessage );
-   }
-
-   ABCC_SendRespMsg( psNewMessage );
-}
 
 /*------------------------------------------------------------------------------
-** Processes commands to EIP Instances
-**------------------------------------------------------------------------------
-** Arguments:
-**    psNewMessage      - Pointer to a ABP_MsgType message.
-**
-** Returns:
-**    None
+** Instance 1 attributes.
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage )
+static const ABCC_HostAttrType eip_asInstAttr[] =
 {
-   /*
-   ** This function processes commands to the Ethernet/IP Instance.
-   */
-   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
-   {
-      /*
-      ** The Instance does not exist.
-      */
-      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
-      return;
-   }
-
-   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
-   {
-   case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
 #if EIP_IA_VENDOR_ID_ENABLE
-      case ABP_EIP_IA_VENDOR_ID:
-
-         /*
-         ** Copy the 1st Instance 1 attribute (Vendor ID) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_VENDOR_ID_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_VENDOR_ID_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_VENDOR_ID, EIP_IA_VENDOR_ID_VALUE ),
 #endif
 #if EIP_IA_DEVICE_TYPE_ENABLE
-      case ABP_EIP_IA_DEVICE_TYPE:
-
-         /*
-         ** Copy the 2nd Instance 1 attribute (Device type) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_DEVICE_TYPE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_DEVICE_TYPE_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_DEVICE_TYPE, EIP_IA_DEVICE_TYPE_VALUE ),
 #endif
 #if EIP_IA_PRODUCT_CODE_ENABLE
-      case ABP_EIP_IA_PRODUCT_CODE:
-
-         /*
-         ** Copy the 3rd Instance 1 attribute (Product code) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_PRODUCT_CODE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_PRODUCT_CODE_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_PRODUCT_CODE, EIP_IA_PRODUCT_CODE_VALUE ),
 #endif
 #if EIP_IA_REVISION_ENABLE
-      case ABP_EIP_IA_REVISION:
-
-         /*
-         ** Copy the 4th Instance 1 attribute (Revision) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_REVISION_MAJOR_VALUE, 0 );
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_REVISION_MINOR_VALUE, 1 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_REVISION_DS );
-         break;
+   ABCC_HOST_ATTR_U8X2( ABP_EIP_IA_REVISION, EIP_IA_REVISION_MAJOR_VALUE,
+                        EIP_IA_REVISION_MINOR_VALUE ),
 #endif
 #if EIP_IA_SERIAL_NUMBER_ENABLE
-      case ABP_EIP_IA_SERIAL_NUMBER:
-
-         /*
-         ** Copy the 5th Instance 1 attribute (Serial number) to the message.
-         */
-         ABCC_SetMsgData32( psNewMessage, EIP_IA_SERIAL_NUMBER_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_SERIAL_NUMBER_DS );
-         break;
+   ABCC_HOST_ATTR_FUNC( ABP_EIP_IA_SERIAL_NUMBER, GetSerialNumber, NULL ),
 #endif
 #if EIP_IA_PRODUCT_NAME_ENABLE
-      case ABP_EIP_IA_PRODUCT_NAME:
-      {
-         UINT16 iStrLength;
-
-         iStrLength = (UINT16)strlen( EIP_IA_PRODUCT_NAME_VALUE );
-
-         /*
-         ** Copy the 6th Instance 1 attribute (Product name) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, EIP_IA_PRODUCT_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
+   ABCC_HOST_ATTR_STR( ABP_EIP_IA_PRODUCT_NAME, EIP_IA_PRODUCT_NAME_VALUE ),
 #endif
 #if EIP_IA_PROD_INSTANCE_ENABLE
-      case ABP_EIP_IA_PROD_INSTANCE:
-      {
-         UINT16  iIndex;
-
-         /*
-         ** Copy the 7th Instance 1 attribute (Producing instance number) to the message.
-         */
-         for( iIndex = 0; iIndex < EIP_IA_PROD_INSTANCE_ARRAY_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage, eip_sInstance.aiProducingInstanceNumber[ iIndex ], 2 * iIndex );
-         }
-
-         /*
-         ** The value of ABP_EIP_IA_PROD_INSTANCE_DS is counted per element, and
-         ** should therefore be divided by 6 as long as ABP_EIP_IA_PROD_INSTANCE_DS
-         ** is defined to be multiplied by 6 in abp_eip.h as ( 6 * ABP_UINT16_SIZEOF ).
-         */
-         ABP_SetMsgResponse( psNewMessage, EIP_IA_PROD_INSTANCE_ARRAY_SIZE * ( ABP_EIP_IA_PROD_INSTANCE_DS / 6 ) );
-         break;
-      }
+   ABCC_HOST_ATTR_FUNC( ABP_EIP_IA_PROD_INSTANCE, GetProdInstance, NULL ),
 #endif
 #if EIP_IA_CONS_INSTANCE_ENABLE
-      case ABP_EIP_IA_CONS_INSTANCE:
-      {
-         UINT16  iIndex;
-
-         /*
-         ** Copy the 8th Instance 1 attribute (Consuming instance number) to the message.
-         */
-         for( iIndex = 0; iIndex < EIP_IA_CONS_INSTANCE_ARRAY_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData16( psNewMessage, eip_sInstance.aiConsumingInstanceNumber[ iIndex ], 2 * iIndex );
-         }
-
-         /*
-         ** The value of ABP_EIP_IA_CONS_INSTANCE_DS is counted per element, and
-         ** should therefore be divided by 6 as long as ABP_EIP_IA_CONS_INSTANCE_DS
-         ** is defined to be multiplied by 6 in abp_eip.h as ( 6 * ABP_UINT16_SIZEOF ).
-         */
-         ABP_SetMsgResponse( psNewMessage, EIP_IA_CONS_INSTANCE_ARRAY_SIZE * ( ABP_EIP_IA_CONS_INSTANCE_DS / 6 ) );
-         break;
-      }
+   ABCC_HOST_ATTR_FUNC( ABP_EIP_IA_CONS_INSTANCE, GetConsInstance, NULL ),
 #endif
 #if EIP_IA_COMM_SETTINGS_FROM_NET_ENABLE
-      case ABP_EIP_IA_COMM_SETTINGS_FROM_NET:
-
-         /*
-         ** Copy the 9th Instance 1 attribute (Enable communication settings from net) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_COMM_SETTINGS_FROM_NET_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_COMM_SETTINGS_FROM_NET_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_COMM_SETTINGS_FROM_NET,
+                      EIP_IA_COMM_SETTINGS_FROM_NET_VALUE ),
 #endif
 #if EIP_IA_ENABLE_APP_CIP_OBJECTS_ENABLE
-      case ABP_EIP_IA_ENABLE_APP_CIP_OBJECTS:
-
-         /*
-         ** Copy the 11th Instance 1 attribute (Enable CIP request forwarding) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_ENABLE_APP_CIP_OBJECTS_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_ENABLE_APP_CIP_OBJECTS_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_ENABLE_APP_CIP_OBJECTS,
+                      EIP_IA_ENABLE_APP_CIP_OBJECTS_VALUE ),
 #endif
 #if EIP_IA_ENABLE_PARAM_OBJECT_ENABLE
-      case ABP_EIP_IA_ENABLE_PARAM_OBJECT:
-
-         /*
-         ** Copy the 12th Instance 1 attribute (Enable Parameter object) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_ENABLE_PARAM_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_ENABLE_PARAM_OBJECT_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_ENABLE_PARAM_OBJECT,
+                      EIP_IA_ENABLE_PARAM_OBJECT_VALUE ),
 #endif
 #if EIP_IA_INPUT_INSTANCE_OBJECT_ENABLE
-      case ABP_EIP_IA_INPUT_INSTANCE_OBJECT:
-
-         /*
-         ** Copy the 13th Instance 1 attribute (Input only heartbeat instance number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_INPUT_INSTANCE_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_INPUT_INSTANCE_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_INPUT_INSTANCE_OBJECT,
+                       EIP_IA_INPUT_INSTANCE_OBJECT_VALUE ),
 #endif
 #if EIP_IA_LISTEN_INSTANCE_OBJECT_ENABLE
-      case ABP_EIP_IA_LISTEN_INSTANCE_OBJECT:
-
-         /*
-         ** Copy the 14th Instance 1 attribute (Listen only heartbeat instance number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_LISTEN_INSTANCE_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_LISTEN_INSTANCE_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_LISTEN_INSTANCE_OBJECT,
+                       EIP_IA_LISTEN_INSTANCE_OBJECT_VALUE ),
 #endif
 #if EIP_IA_CONFIG_INSTANCE_ENABLE
-      case ABP_EIP_IA_CONFIG_INSTANCE:
-
-         /*
-         ** Copy the 15th Instance 1 attribute (Assembly object Configuration instance number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_CONFIG_INSTANCE_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_CONFIG_INSTANCE_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_CONFIG_INSTANCE,
+                       EIP_IA_CONFIG_INSTANCE_VALUE ),
 #endif
 #if EIP_IA_DISABLE_STRICT_IO_MATCH_ENABLE
-      case ABP_EIP_IA_DISABLE_STRICT_IO_MATCH:
-
-         /*
-         ** Copy the 16th Instance 1 attribute (Disable Strict IO match) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_DISABLE_STRICT_IO_MATCH_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_DISABLE_STRICT_IO_MATCH_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_DISABLE_STRICT_IO_MATCH,
+                      EIP_IA_DISABLE_STRICT_IO_MATCH_VALUE ),
 #endif
 #if EIP_IA_ENABLE_UNCONNECTED_SEND_ENABLE
-      case ABP_EIP_IA_ENABLE_UNCONNECTED_SEND:
-
-         /*
-         ** Copy the 17th Instance 1 attribute (Enable unconnected routing) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_ENABLE_UNCONNECTED_SEND_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_ENABLE_UNCONNECTED_SEND_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_ENABLE_UNCONNECTED_SEND,
+                      EIP_IA_ENABLE_UNCONNECTED_SEND_VALUE ),
 #endif
 #if EIP_IA_INPUT_EXT_INSTANCE_OBJECT_ENABLE
-      case ABP_EIP_IA_INPUT_EXT_INSTANCE_OBJECT:
-
-         /*
-         ** Copy the 18th Instance 1 attribute (Input only extended heartbeat instance number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_INPUT_EXT_INSTANCE_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_INPUT_EXT_INSTANCE_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_INPUT_EXT_INSTANCE_OBJECT,
+                       EIP_IA_INPUT_EXT_INSTANCE_OBJECT_VALUE ),
 #endif
 #if EIP_IA_LISTEN_EXT_INSTANCE_OBJECT_ENABLE
-      case ABP_EIP_IA_LISTEN_EXT_INSTANCE_OBJECT:
-
-         /*
-         ** Copy the 19th Instance 1 attribute (Listen only extended heartbeat instance number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_LISTEN_EXT_INSTANCE_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_LISTEN_EXT_INSTANCE_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_LISTEN_EXT_INSTANCE_OBJECT,
+                       EIP_IA_LISTEN_EXT_INSTANCE_OBJECT_VALUE ),
 #endif
 #if EIP_IA_IF_LABEL_PORT_1_ENABLE
-      case ABP_EIP_IA_IF_LABEL_PORT_1:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the 20th Instance 1 attribute (Interface label port 1) to the message.
-         */
-         iStrLength = (UINT16)strlen( EIP_IA_IF_LABEL_PORT_1_VALUE );
-         ABCC_SetMsgString( psNewMessage, EIP_IA_IF_LABEL_PORT_1_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
+   ABCC_HOST_ATTR_STR( ABP_EIP_IA_IF_LABEL_PORT_1,
+                       EIP_IA_IF_LABEL_PORT_1_VALUE ),
 #endif
 #if EIP_IA_IF_LABEL_PORT_2_ENABLE
-      case ABP_EIP_IA_IF_LABEL_PORT_2:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the 21st Instance 1 attribute (Interface label port 2) to the message.
-         */
-         iStrLength = (UINT16)strlen( EIP_IA_IF_LABEL_PORT_2_VALUE );
-         ABCC_SetMsgString( psNewMessage, EIP_IA_IF_LABEL_PORT_2_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
+   ABCC_HOST_ATTR_STR( ABP_EIP_IA_IF_LABEL_PORT_2,
+                       EIP_IA_IF_LABEL_PORT_2_VALUE ),
 #endif
 #if EIP_IA_IF_LABEL_PORT_INT_ENABLE
-      case ABP_EIP_IA_IF_LABEL_PORT_INT:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the 22nd Instance 1 attribute (Interface label internal port) to the message.
-         */
-         iStrLength = (UINT16)strlen( EIP_IA_IF_LABEL_PORT_INT_VALUE );
-         ABCC_SetMsgString( psNewMessage, EIP_IA_IF_LABEL_PORT_INT_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
+   ABCC_HOST_ATTR_STR( ABP_EIP_IA_IF_LABEL_PORT_INT,
+                       EIP_IA_IF_LABEL_PORT_INT_VALUE ),
 #endif
 #if EIP_IA_ENABLE_EIP_QC_ENABLE
-      case ABP_EIP_IA_ENABLE_EIP_QC:
-
-         /*
-         ** Copy the 26th Instance 1 attribute (Enable EtherNet/IP QuickConnect) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_ENABLE_EIP_QC_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_ENABLE_EIP_QC_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_ENABLE_EIP_QC, EIP_IA_ENABLE_EIP_QC_VALUE ),
 #endif
 #if EIP_IA_IGNORE_SEQ_COUNT_CHECK_ENABLE
-      case ABP_EIP_IA_IGNORE_SEQ_COUNT_CHECK:
-
-         /*
-         ** Copy the 29th Instance 1 attribute (Ignore Sequence Count Check) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_IGNORE_SEQ_COUNT_CHECK_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_IGNORE_SEQ_COUNT_CHECK_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_IGNORE_SEQ_COUNT_CHECK,
+                      EIP_IA_IGNORE_SEQ_COUNT_CHECK_VALUE ),
 #endif
 #if EIP_IA_ABCC_ADI_OBJECT_ENABLE
-      case ABP_EIP_IA_ABCC_ADI_OBJECT:
-
-         /*
-         ** Copy the 30th Instance 1 attribute (ABCC ADI Object number) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, EIP_IA_ABCC_ADI_OBJECT_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_ABCC_ADI_OBJECT_DS );
-         break;
+   ABCC_HOST_ATTR_U16( ABP_EIP_IA_ABCC_ADI_OBJECT,
+                       EIP_IA_ABCC_ADI_OBJECT_VALUE ),
 #endif
 #if EIP_IA_ABCC_ENABLE_DLR_ENABLE
-      case ABP_EIP_IA_ABCC_ENABLE_DLR:
-
-         /*
-         ** Copy the 31st Instance 1 attribute (Enable DLR) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_ABCC_ENABLE_DLR_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_ABCC_ENABLE_DLR_DS );
-         break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_ABCC_ENABLE_DLR,
+                      EIP_IA_ABCC_ENABLE_DLR_VALUE ),
 #endif
 #if EIP_IA_ABCC_ENABLE_CIP_SYNC_ENABLE
-      case ABP_EIP_IA_ABCC_ENABLE_CIP_SYNC:
-
-         /*
-         ** Copy the 32nd Instance 1 attribute (Enable CIP Sync) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, EIP_IA_ABCC_ENABLE_CIP_SYNC_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_ABCC_ENABLE_CIP_SYNC_DS );
-         break;
-#endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
-      break;
+   ABCC_HOST_ATTR_U8( ABP_EIP_IA_ABCC_ENABLE_CIP_SYNC,
+                      EIP_IA_ABCC_ENABLE_CIP_SYNC_VALUE ),
+#endif
+   ABCC_HOST_ATTR_END
+};
+
+void EIP_ProcessCmdMsg( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** This function processes commands to the Ethernet/IP Object and it's Instance.
+   */
+   if( ABCC_GetMsgInstance( psNewMessage ) == ABP_INST_OBJ )
+   {
+      /*
+      ** Ethernet/IP object Command.
+      */
+      ObjectCommand( psNewMessage );
    }
+   else
+   {
+      /*
+      ** Ethernet/IP instance Command.
+      */
+      InstanceCommand( psNewMessage );
+   }
+
+   ABCC_SendRespMsg( psNewMessage );
+}
+
+#if EIP_IA_SERIAL_NUMBER_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Serial number (Instance 1) to the message. The value may be a
+** function call or a variable, see abcc_identification.h.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetSerialNumber( ABP_MsgType* psNewMessage )
+{
+   ABCC_SetMsgData32( psNewMessage, EIP_IA_SERIAL_NUMBER_VALUE, 0 );
+   ABP_SetMsgResponse( psNewMessage, ABP_EIP_IA_SERIAL_NUMBER_DS );
+}
+#endif
+
+#if EIP_IA_PROD_INSTANCE_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Producing instance number list (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetProdInstance( ABP_MsgType* psNewMessage )
+{
+   UINT16  iIndex;
+
+   for( iIndex = 0; iIndex < EIP_IA_PROD_INSTANCE_ARRAY_SIZE; ++iIndex )
+   {
+      ABCC_SetMsgData16( psNewMessage, eip_sInstance.aiProducingInstanceNumber[ iIndex ], 2 * iIndex );
+   }
+
+   /*
+   ** The value of ABP_EIP_IA_PROD_INSTANCE_DS is counted per element, and
+   ** should therefore be divided by 6 as long as ABP_EIP_IA_PROD_INSTANCE_DS
+   ** is defined to be multiplied by 6 in abp_eip.h as ( 6 * ABP_UINT16_SIZEOF ).
+   */
+   ABP_SetMsgResponse( psNewMessage, EIP_IA_PROD_INSTANCE_ARRAY_SIZE * ( ABP_EIP_IA_PROD_INSTANCE_DS / 6 ) );
+}
+#endif
+
+#if EIP_IA_CONS_INSTANCE_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Consuming instance number list (Instance 1) to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetConsInstance( ABP_MsgType* psNewMessage )
+{
+   UINT16  iIndex;
+
+   for( iIndex = 0; iIndex < EIP_IA_CONS_INSTANCE_ARRAY_SIZE; ++iIndex )
+   {
+      ABCC_SetMsgData16( psNewMessage, eip_sInstance.aiConsumingInstanceNumber[ iIndex ], 2 * iIndex );
+   }
+
+   /*
+   ** The value of ABP_EIP_IA_CONS_INSTANCE_DS is counted per element, and
+   ** should therefore be divided by 6 as long as ABP_EIP_IA_CONS_INSTANCE_DS
+   ** is defined to be multiplied by 6 in abp_eip.h as ( 6 * ABP_UINT16_SIZEOF ).
+   */
+   ABP_SetMsgResponse( psNewMessage, EIP_IA_CONS_INSTANCE_ARRAY_SIZE * ( ABP_EIP_IA_CONS_INSTANCE_DS / 6 ) );
+}
+#endif
+
+/*------------------------------------------------------------------------------
+** Processes commands to EIP Instances
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void InstanceCommand( ABP_MsgType* psNewMessage )
+{
+   /*
+   ** This function processes commands to the Ethernet/IP Instance.
+   */
+   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
+   {
+      /*
+      ** The Instance does not exist.
+      */
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
+      return;
+   }
+
+   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   {
+   case ABP_CMD_GET_ATTR:
+
+      ABCC_HostAttrCommand( psNewMessage, eip_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( eip_asInstAttr ) );
+      break;
+
    default:
 
       /*
@@ -498,61 +373,11 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         iStrLength = (UINT16)strlen( eip_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, eip_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData8( psNewMessage, eip_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, eip_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, eip_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-
-      } /* End of switch( Attribute number ) */
 
+      ABCC_HostAttrCommand( psNewMessage, eip_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( eip_asObjAttr ) );
       break;
-   }
+
    case ABP_EIP_CMD_PROCESS_CIP_OBJ_REQUEST:
 
       /*
@@ -24,6 +24,7 @@
 #include "string.h"
 #include "application_abcc_handler.h"
 #include "abcc_port.h"
+#include "abcc_host_attribute.h"
 
 #if MOD_OBJ_ENABLE
 
@@ -37,31 +38,67 @@
 #define MOD_OA_HIGHEST_INST_VALUE                  1
 
 /*------------------------------------------------------------------------------
-** Structure describing an Modbus Object.
+** Forward declarations
 **------------------------------------------------------------------------------
 */
-typedef struct mod_Object
-{
-   const  char* pcName;
-   UINT8  bRevision;
-   UINT16 iNumberOfInstances;
-   UINT16 iHighestInstanceNo;
-}
-mod_ObjectType;
+static void InstanceCommand( ABP_MsgType* psNewMessage );
+static void ObjectCommand( ABP_MsgType* psNewMessage );
 
 /*------------------------------------------------------------------------------
-** Forward declarations
+** Object attributes.
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage );
-static void ObjectCommand( ABP_MsgType* psNewMessage );
+static const ABCC_HostAttrType mod_asObjAttr[] =
+{
+   ABCC_HOST_ATTR_OBJECT( MOD_OA_NAME_VALUE,
+                          MOD_OA_REV_VALUE,
+                          MOD_OA_NUM_INST_VALUE,
+                          MOD_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
-static const mod_ObjectType mod_sObject =
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType mod_asInstAttr[] =
 {
-   MOD_OA_NAME_VALUE,                           /* Name.                                              */
-   MOD_OA_REV_VALUE,                            /* Revision.                                          */
-   MOD_OA_NUM_INST_VALUE,                       /* Number of instances.                               */
-   MOD_OA_HIGHEST_INST_VALUE                    /* Highest instance number.                           */
+#if MOD_IA_VENDOR_NAME_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_MOD_IA_VENDOR_NAME, MOD_IA_VENDOR_NAME_VALUE ),
+#endif
+#if MOD_IA_PRODUCT_CODE_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_MOD_IA_PRODUCT_CODE, MOD_IA_PRODUCT_CODE_VALUE ),
+#endif
+#if MOD_IA_REVISION_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_MOD_IA_REVISION, MOD_IA_REVISION_VALUE ),
+#endif
+#if MOD_IA_VENDOR_URL_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_MOD_IA_VENDOR_URL, MOD_IA_VENDOR_URL_VALUE ),
+#endif
+#if MOD_IA_PRODUCT_NAME_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_MOD_IA_PRODUCT_NAME, MOD_IA_PRODUCT_NAME_VALUE ),
+#endif
+#if MOD_IA_MODEL_NAME_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_MOD_IA_MODEL_NAME, MOD_IA_MODEL_NAME_VALUE ),
+#endif
+#if MOD_IA_USER_APP_NAME_ENABLE
+   ABCC_HOST_ATTR_STR( ABP_MOD_IA_USER_APP_NAME, MOD_IA_USER_APP_NAME_VALUE ),
+#endif
+#if MOD_IA_DEVICE_ID_ENABLE
+   ABCC_HOST_ATTR_OCT( ABP_MOD_IA_DEVICE_ID, MOD_IA_DEVICE_ID_VALUE,
+                       MOD_IA_DEVICE_ID_ARRAY_SIZE ),
+#endif
+#if MOD_IA_ADI_INDEXING_BITS_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_MOD_IA_ADI_INDEXING_BITS, MOD_IA_ADI_INDEXING_BITS_VALUE ),
+#endif
+#if MOD_IA_MESSAGE_FORWARDING_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_MOD_IA_MESSAGE_FORWARDING, MOD_IA_MESSAGE_FORWARDING_VALUE ),
+#endif
+#if MOD_IA_RW_OFFSET_ENABLE
+   ABCC_HOST_ATTR_U16X2( ABP_MOD_IA_RW_OFFSET, MOD_IA_RW_OFFSET_READ_VALUE,
+                         MOD_IA_RW_OFFSET_WRITE_VALUE ),
+#endif
+   ABCC_HOST_ATTR_END
 };
 
 void MOD_ProcessCmdMsg( ABP_MsgType* psNewMessage )
@@ -99,12 +136,6 @@ void MOD_ProcessCmdMsg( ABP_MsgType* psNewMessage )
 */
 static void InstanceCommand( ABP_MsgType* psNewMessage )
 {
-   UINT16 iIndex;
-   UINT16 iStrLength;
-
-   (void)iIndex;
-   (void)iStrLength;
-
    /*
    ** This function processes commands to the Modbus Instance.
    */
@@ -120,145 +151,11 @@ static void InstanceCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if MOD_IA_VENDOR_NAME_ENABLE
-      case ABP_MOD_IA_VENDOR_NAME:
-
-         iStrLength = (UINT16)strlen( MOD_IA_VENDOR_NAME_VALUE );
-
-         /*
-         ** Copy the 1st Instance 1 attribute (Vendor name) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, MOD_IA_VENDOR_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-#endif
-#if MOD_IA_PRODUCT_CODE_ENABLE
-      case ABP_MOD_IA_PRODUCT_CODE:
-
-         iStrLength = (UINT16)strlen( MOD_IA_PRODUCT_CODE_VALUE );
-
-         /*
-         ** Copy the 2nd Instance 1 attribute (Product code) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, MOD_IA_PRODUCT_CODE_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-#endif
-#if MOD_IA_REVISION_ENABLE
-      case ABP_MOD_IA_REVISION:
-
-         iStrLength = (UINT16)strlen( MOD_IA_REVISION_VALUE );
-
-         /*
-         ** Copy the 3rd Instance 1 attribute (Revision) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, MOD_IA_REVISION_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-#endif
-#if MOD_IA_VENDOR_URL_ENABLE
-      case ABP_MOD_IA_VENDOR_URL:
-
-         iStrLength = (UINT16)strlen( MOD_IA_VENDOR_URL_VALUE );
-
-         /*
-         ** Copy the 4th Instance 1 attribute (Vendor URL) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, MOD_IA_VENDOR_URL_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-#endif
-#if MOD_IA_PRODUCT_NAME_ENABLE
-      case ABP_MOD_IA_PRODUCT_NAME:
-
-         iStrLength = (UINT16)strlen( MOD_IA_PRODUCT_NAME_VALUE );
-
-         /*
-         ** Copy the 5th Instance 1 attribute (Product name) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, MOD_IA_PRODUCT_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-#endif
-#if MOD_IA_MODEL_NAME_ENABLE
-      case ABP_MOD_IA_MODEL_NAME:
-
-         iStrLength = (UINT16)strlen( MOD_IA_MODEL_NAME_VALUE );
-
-         /*
-         ** Copy the 6th Instance 1 attribute (Model name) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, MOD_IA_MODEL_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-#endif
-#if MOD_IA_USER_APP_NAME_ENABLE
-      case ABP_MOD_IA_USER_APP_NAME:
-
-         iStrLength = (UINT16)strlen( MOD_IA_USER_APP_NAME_VALUE );
-
-         /*
-         ** Copy the 7th Instance 1 attribute (User application name) to the message.
-         */
-         ABCC_SetMsgString( psNewMessage, MOD_IA_USER_APP_NAME_VALUE, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-#endif
-#if MOD_IA_DEVICE_ID_ENABLE
-      case ABP_MOD_IA_DEVICE_ID:
-
-         /*
-         ** Copy the 8th Instance 1 attribute (Device ID) to the message.
-         */
-         for( iIndex = 0; iIndex < MOD_IA_DEVICE_ID_ARRAY_SIZE; ++iIndex )
-         {
-            ABCC_SetMsgData8( psNewMessage, MOD_IA_DEVICE_ID_VALUE[ iIndex ], iIndex );
-         }
 
-         ABP_SetMsgResponse( psNewMessage, MOD_IA_DEVICE_ID_ARRAY_SIZE );
-         break;
-#endif
-#if MOD_IA_ADI_INDEXING_BITS_ENABLE
-      case ABP_MOD_IA_ADI_INDEXING_BITS:
-         /*
-         ** Copy the 9th Instance 1 attribute (No. of ADI indexing bits) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, MOD_IA_ADI_INDEXING_BITS_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_MOD_IA_ADI_INDEXING_BITS_DS );
-         break;
-#endif
-#if MOD_IA_MESSAGE_FORWARDING_ENABLE
-      case ABP_MOD_IA_MESSAGE_FORWARDING:
-         /*
-         ** Copy the 10th Instance 1 attribute (Enable Modbus Message forwarding) to the message.
-         */
-         ABCC_SetMsgData8( psNewMessage, MOD_IA_MESSAGE_FORWARDING_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_MOD_IA_MESSAGE_FORWARDING_DS );
-         break;
-#endif
-#if MOD_IA_RW_OFFSET_ENABLE
-      case ABP_MOD_IA_RW_OFFSET:
-         /*
-         ** Copy the 11th Instance 1 attribute (Modbus read/write registers command offset) to the message.
-         */
-         ABCC_SetMsgData16( psNewMessage, MOD_IA_RW_OFFSET_READ_VALUE, 0 );
-         ABCC_SetMsgData16( psNewMessage, MOD_IA_RW_OFFSET_WRITE_VALUE, 2 );
-         ABP_SetMsgResponse( psNewMessage, ABP_MOD_IA_RW_OFFSET_DS );
-         break;
-#endif
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, mod_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( mod_asInstAttr ) );
       break;
-   }
+
    default:
 
       /*
@@ -289,61 +186,10 @@ static void ObjectCommand( ABP_MsgType* psNewMessage )
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-      {
-         UINT16 iStrLength;
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         iStrLength = (UINT16)strlen( mod_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, mod_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, (UINT8)iStrLength );
-         break;
-      }
-
-      case ABP_OA_REV:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData8( psNewMessage, mod_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, mod_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** Copy the attribute to a message.
-         */
-         ABCC_SetMsgData16( psNewMessage, mod_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-
-      } /* End of switch( Attribute number ) */
 
+      ABCC_HostAttrCommand( psNewMessage, mod_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( mod_asObjAttr ) );
       break;
-   }
 
    default:
 
@@ -22,6 +22,7 @@
 #include "abcc_port.h"
 #include "abp_opcua.h"
 #include "opcua_object.h"
+#include "abcc_host_attribute.h"
 
 #if OPCUA_OBJ_ENABLE
 
@@ -38,27 +39,6 @@
 #define OPCUA_APPLICATION_MODEL_ENTRY_DS           ( ABP_UINT8_SIZEOF + ABP_UINT8_SIZEOF + ABP_UINT16_SIZEOF )
 #endif
 
-/*------------------------------------------------------------------------------
-** Structure describing an OPC UA object.
-**------------------------------------------------------------------------------
-*/
-typedef struct opcua_Object
-{
-   const char* pcName;
-   UINT8  bRevision;
-   UINT16 iNumberOfInstances;
-   UINT16 iHighestInstanceNo;
-}
-opcua_ObjectType;
-
-static const opcua_ObjectType opcua_sObject =
-{
-   OPCUA_OA_NAME_VALUE,                            /* Name.                                      */
-   OPCUA_OA_REV_VALUE,                             /* Revision.                                  */
-   OPCUA_OA_NUM_INST_VALUE,                        /* Number of instances.                       */
-   OPCUA_OA_HIGHEST_INST_VALUE                     /* Highest instance number.                   */
-};
-
 #if OPCUA_IA_SERVER_STATUS_ENABLE
 static OPCUA_ServerStatusType opcua_sServerStatus =
 {
@@ -67,8 +47,9 @@ static OPCUA_ServerStatusType opcua_sServerStatus =
 };
 #endif
 
+#if OPCUA_IA_LIMITS_ENABLE
 /*------------------------------------------------------------------------------
-** The function that processes the commands to the OPC UA Instance.
+** Copies the Limits (Instance 1) to the message.
 **------------------------------------------------------------------------------
 ** Arguments:
 **    psNewMessage      - Pointer to a ABP_MsgType message.
@@ -77,225 +58,195 @@ static OPCUA_ServerStatusType opcua_sServerStatus =
 **    None
 **------------------------------------------------------------------------------
 */
-static void InstanceCommand( ABP_MsgType* psNewMessage )
+static void GetLimits( ABP_MsgType* psNewMessage )
 {
-#if OPCUA_IA_APPLICATION_URI_ENABLE        ||                                  \
-    OPCUA_IA_VENDOR_NAMESPACE_URI_ENABLE   ||                                  \
-    OPCUA_IA_DEVICE_TYPE_NAME_ENABLE       ||                                  \
-    OPCUA_IA_DEVICE_INST_NAME_ENABLE       ||                                  \
-    OPCUA_IA_PRODUCT_URI_ENABLE
-   char*  pcStr;
-   UINT16 iStrLength;
+   ABCC_SetMsgData16( psNewMessage, OPCUA_IA_LIMITS_MAX_NUM_MON_ITEMS, 0 );
+   ABCC_SetMsgData32( psNewMessage, OPCUA_IA_LIMITS_MIN_PUBLISHING_INT_MS, ABP_UINT16_SIZEOF );
+   ABCC_SetMsgData32( psNewMessage, OPCUA_IA_LIMITS_MIN_SAMPLING_INT_MS, ABP_UINT16_SIZEOF + ABP_UINT32_SIZEOF );
+   ABCC_SetMsgData32( psNewMessage, OPCUA_IA_LIMITS_MAX_QUEUE_SIZE, ABP_UINT16_SIZEOF + ABP_UINT32_SIZEOF + ABP_UINT32_SIZEOF );
+
+   ABP_SetMsgResponse( psNewMessage, ABP_OPCUA_IA_LIMITS_DS );
+}
 #endif
 
-   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
-   {
-      /*
-      ** The requested instance does not exist.
-      ** Respond with a error.
-      */
-      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
+#if OPCUA_IA_APPLICATION_MODELS_ENABLE
+/*------------------------------------------------------------------------------
+** Copies the Application models list (Instance 1) provided by the
+** application to the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void GetApplicationModels( ABP_MsgType* psNewMessage )
+{
+   UINT8 bNumOfListEntries;
+   OPCUA_ApplicationModelEntryType const * pasApplModelList;
+   UINT8 bListIndex;
+   UINT16 iMsgDataOffset;
 
+   bNumOfListEntries = OPCUA_CbfGetApplModelListNum();
+   if( ( bNumOfListEntries == 0 ) || ( bNumOfListEntries > ABP_OPCUA_IA_APPLICATIONS_MODELS_MAX  ) )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_GENERAL_ERROR );
       return;
    }
 
-   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   pasApplModelList = OPCUA_CbfGetApplModelList();
+   if( pasApplModelList == NULL )
    {
-   case ABP_CMD_GET_ATTR:
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_GENERAL_ERROR );
+      return;
+   }
+
+   iMsgDataOffset = 0;
+   for( bListIndex = 0; bListIndex < bNumOfListEntries; bListIndex++ )
    {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
+      if( ( iMsgDataOffset + OPCUA_APPLICATION_MODEL_ENTRY_DS ) > ABCC_GetMaxMessageSize() )
       {
-#if OPCUA_IA_MODEL_ENABLE
-      case ABP_OPCUA_IA_MODEL:
-
-         /*
-         ** The 'OPC UA model' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, OPCUA_IA_MODEL_VALUE, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OPCUA_IA_MODEL_DS );
-         break;
+         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
+         return;
+      }
+
+      ABCC_SetMsgData8( psNewMessage, pasApplModelList[ bListIndex ].bModelFilenameIndex, iMsgDataOffset );
+      iMsgDataOffset += ABP_UINT8_SIZEOF;
+      ABCC_SetMsgData8( psNewMessage, pasApplModelList[ bListIndex ].bNamespaceUriIndex, iMsgDataOffset );
+      iMsgDataOffset += ABP_UINT8_SIZEOF;
+      ABCC_SetMsgData16( psNewMessage, pasApplModelList[ bListIndex ].iAdiOffset, iMsgDataOffset );
+      iMsgDataOffset += ABP_UINT16_SIZEOF;
+   }
+   ABP_SetMsgResponse( psNewMessage, iMsgDataOffset );
+}
 #endif
-#if OPCUA_IA_APPLICATION_URI_ENABLE
-      case ABP_OPCUA_IA_APPLICATION_URI:
 
-         /*
-         ** The 'Application/Local namespace URI' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         pcStr = OPCUA_IA_APPLICATION_URI_VALUE;
-         iStrLength = (UINT16)strnlen( pcStr, ABP_OPCUA_IA_APPLICATION_URI_MAX_DS );
+#if OPCUA_IA_SERVER_STATUS_ENABLE
+/*------------------------------------------------------------------------------
+** Sets the Server status (Instance 1) from the message.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void SetServerStatus( ABP_MsgType* psNewMessage )
+{
+   UINT8 bTemp;
 
-         ABCC_SetMsgString( psNewMessage, pcStr, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
+   if( ABCC_GetMsgDataSize( psNewMessage ) > ABP_OPCUA_IA_STATUS_DS )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
+      return;
+   }
+   else if( ABCC_GetMsgDataSize( psNewMessage ) < ABP_OPCUA_IA_STATUS_DS )
+   {
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
+      return;
+   }
+
+   ABCC_GetMsgData8( psNewMessage, &bTemp, 0 );
+   opcua_sServerStatus.eState = (ABP_OpcuaStateType)bTemp;
+   ABCC_GetMsgData8( psNewMessage, &opcua_sServerStatus.bActiveSessions, ABP_ENUM_SIZEOF );
+   ABP_SetMsgResponse( psNewMessage, 0 );
+}
 #endif
-#if OPCUA_IA_VENDOR_NAMESPACE_URI_ENABLE
-      case ABP_OPCUA_IA_VENDOR_NAMESPACE_URI:
 
-         /*
-         ** The 'Vendor namespace URI' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         pcStr = OPCUA_IA_VENDOR_NAMESPACE_URI_VALUE;
-         iStrLength = (UINT16)strnlen( pcStr, ABP_OPCUA_IA_VENDOR_NAMESPACE_URI_MAX_DS );
+/*------------------------------------------------------------------------------
+** Object attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType opcua_asObjAttr[] =
+{
+   ABCC_HOST_ATTR_OBJECT( OPCUA_OA_NAME_VALUE,
+                          OPCUA_OA_REV_VALUE,
+                          OPCUA_OA_NUM_INST_VALUE,
+                          OPCUA_OA_HIGHEST_INST_VALUE ),
+   ABCC_HOST_ATTR_END
+};
 
-         ABCC_SetMsgString( psNewMessage, pcStr, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
+/*------------------------------------------------------------------------------
+** Instance 1 attributes.
+**------------------------------------------------------------------------------
+*/
+static const ABCC_HostAttrType opcua_asInstAttr[] =
+{
+#if OPCUA_IA_MODEL_ENABLE
+   ABCC_HOST_ATTR_U8( ABP_OPCUA_IA_MODEL, OPCUA_IA_MODEL_VALUE ),
+#endif
+#if OPCUA_IA_APPLICATION_URI_ENABLE
+   ABCC_HOST_ATTR_STR_MAX( ABP_OPCUA_IA_APPLICATION_URI,
+                           OPCUA_IA_APPLICATION_URI_VALUE,
+                           ABP_OPCUA_IA_APPLICATION_URI_MAX_DS ),
+#endif
+#if OPCUA_IA_VENDOR_NAMESPACE_URI_ENABLE
+   ABCC_HOST_ATTR_STR_MAX( ABP_OPCUA_IA_VENDOR_NAMESPACE_URI,
+                           OPCUA_IA_VENDOR_NAMESPACE_URI_VALUE,
+                           ABP_OPCUA_IA_VENDOR_NAMESPACE_URI_MAX_DS ),
 #endif
 #if OPCUA_IA_DEVICE_TYPE_NAME_ENABLE
-      case ABP_OPCUA_IA_DEVICE_TYPE_NAME:
-
-         /*
-         ** The 'DeviceType name' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         pcStr = OPCUA_IA_DEVICE_TYPE_NAME_VALUE;
-         iStrLength = (UINT16)strnlen( pcStr, ABP_OPCUA_IA_DEVICE_TYPE_NAME_MAX_DS );
-
-         ABCC_SetMsgString( psNewMessage, pcStr, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
+   ABCC_HOST_ATTR_STR_MAX( ABP_OPCUA_IA_DEVICE_TYPE_NAME,
+                           OPCUA_IA_DEVICE_TYPE_NAME_VALUE,
+                           ABP_OPCUA_IA_DEVICE_TYPE_NAME_MAX_DS ),
 #endif
 #if OPCUA_IA_DEVICE_INST_NAME_ENABLE
-      case ABP_OPCUA_IA_DEVICE_INST_NAME:
-
-         /*
-         ** The 'Device instance name' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         pcStr = OPCUA_IA_DEVICE_INST_NAME_VALUE;
-         iStrLength = (UINT16)strnlen( pcStr, ABP_OPCUA_IA_DEVICE_INST_NAME_MAX_DS );
-
-         ABCC_SetMsgString( psNewMessage, pcStr, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
+   ABCC_HOST_ATTR_STR_MAX( ABP_OPCUA_IA_DEVICE_INST_NAME,
+                           OPCUA_IA_DEVICE_INST_NAME_VALUE,
+                           ABP_OPCUA_IA_DEVICE_INST_NAME_MAX_DS ),
 #endif
 #if OPCUA_IA_PRODUCT_URI_ENABLE
-      case ABP_OPCUA_IA_PRODUCT_URI:
-
-         /*
-         ** The 'Product URI' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         pcStr = OPCUA_IA_PRODUCT_URI_VALUE;
-         iStrLength = (UINT16)strnlen( pcStr, ABP_OPCUA_IA_PRODUCT_URI_MAX_DS );
-
-         ABCC_SetMsgString( psNewMessage, pcStr, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
+   ABCC_HOST_ATTR_STR_MAX( ABP_OPCUA_IA_PRODUCT_URI,
+                           OPCUA_IA_PRODUCT_URI_VALUE,
+                           ABP_OPCUA_IA_PRODUCT_URI_MAX_DS ),
 #endif
 #if OPCUA_IA_LIMITS_ENABLE
-      case ABP_OPCUA_IA_LIMITS:
-
-         /*
-         ** The 'Limits' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData16( psNewMessage, OPCUA_IA_LIMITS_MAX_NUM_MON_ITEMS, 0 );
-         ABCC_SetMsgData32( psNewMessage, OPCUA_IA_LIMITS_MIN_PUBLISHING_INT_MS, ABP_UINT16_SIZEOF );
-         ABCC_SetMsgData32( psNewMessage, OPCUA_IA_LIMITS_MIN_SAMPLING_INT_MS, ABP_UINT16_SIZEOF + ABP_UINT32_SIZEOF );
-         ABCC_SetMsgData32( psNewMessage, OPCUA_IA_LIMITS_MAX_QUEUE_SIZE, ABP_UINT16_SIZEOF + ABP_UINT32_SIZEOF + ABP_UINT32_SIZEOF );
-
-         ABP_SetMsgResponse( psNewMessage, ABP_OPCUA_IA_LIMITS_DS );
-         break;
+   ABCC_HOST_ATTR_FUNC( ABP_OPCUA_IA_LIMITS, GetLimits, NULL ),
 #endif
-
 #if OPCUA_IA_APPLICATION_MODELS_ENABLE
-      case ABP_OPCUA_IA_APPLICATION_MODELS:
-      {
-         UINT8 bNumOfListEntries;
-         OPCUA_ApplicationModelEntryType const * pasApplModelList;
-         UINT8 bListIndex;
-         UINT16 iMsgDataOffset;
-
-         bNumOfListEntries = OPCUA_CbfGetApplModelListNum();
-         if( ( bNumOfListEntries == 0 ) || ( bNumOfListEntries > ABP_OPCUA_IA_APPLICATIONS_MODELS_MAX  ) )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_GENERAL_ERROR );
-            break;
-         }
-
-         pasApplModelList = OPCUA_CbfGetApplModelList();
-         if( pasApplModelList == NULL )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_GENERAL_ERROR );
-            break;
-         }
-
-         iMsgDataOffset = 0;
-         for( bListIndex = 0; bListIndex < bNumOfListEntries; bListIndex++ )
-         {
-            if( ( iMsgDataOffset + OPCUA_APPLICATION_MODEL_ENTRY_DS ) > ABCC_GetMaxMessageSize() )
-            {
-               ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
-               break;
-            }
-
-            ABCC_SetMsgData8( psNewMessage, pasApplModelList[ bListIndex ].bModelFilenameIndex, iMsgDataOffset );
-            iMsgDataOffset += ABP_UINT8_SIZEOF;
-            ABCC_SetMsgData8( psNewMessage, pasApplModelList[ bListIndex ].bNamespaceUriIndex, iMsgDataOffset );
-            iMsgDataOffset += ABP_UINT8_SIZEOF;
-            ABCC_SetMsgData16( psNewMessage, pasApplModelList[ bListIndex ].iAdiOffset, iMsgDataOffset );
-            iMsgDataOffset += ABP_UINT16_SIZEOF;
-         }
-         ABP_SetMsgResponse( psNewMessage, iMsgDataOffset );
-
-         break;
-      }
+   ABCC_HOST_ATTR_FUNC( ABP_OPCUA_IA_APPLICATION_MODELS,
+                        GetApplicationModels, NULL ),
+#endif
+#if OPCUA_IA_SERVER_STATUS_ENABLE
+   ABCC_HOST_ATTR_FUNC( ABP_OPCUA_IA_STATUS, NULL, SetServerStatus ),
 #endif
+   ABCC_HOST_ATTR_END
+};
 
-      default:
+/*------------------------------------------------------------------------------
+** The function that processes the commands to the OPC UA Instance.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psNewMessage      - Pointer to a ABP_MsgType message.
+**
+** Returns:
+**    None
+**------------------------------------------------------------------------------
+*/
+static void InstanceCommand( ABP_MsgType* psNewMessage )
+{
+   if( ABCC_GetMsgInstance( psNewMessage ) != 1 )
+   {
+      /*
+      ** The requested instance does not exist.
+      ** Respond with a error.
+      */
+      ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_UNSUP_INST );
 
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
-      break;
+      return;
    }
-#if OPCUA_IA_SERVER_STATUS_ENABLE
-   case ABP_CMD_SET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-#if OPCUA_IA_SERVER_STATUS_ENABLE
-      case ABP_OPCUA_IA_STATUS:
-      {
-         UINT8 bTemp;
-
-         if( ABCC_GetMsgDataSize( psNewMessage ) > ABP_OPCUA_IA_STATUS_DS )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_TOO_MUCH_DATA );
-            break;
-         }
-         else if( ABCC_GetMsgDataSize( psNewMessage ) < ABP_OPCUA_IA_STATUS_DS )
-         {
-            ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_NOT_ENOUGH_DATA );
-            break;
-         }
-
-         ABCC_GetMsgData8( psNewMessage, &bTemp, 0 );
-         opcua_sServerStatus.eState = (ABP_OpcuaStateType)bTemp;
-         ABCC_GetMsgData8( psNewMessage, &opcua_sServerStatus.bActiveSessions, ABP_ENUM_SIZEOF );
-         ABP_SetMsgResponse( psNewMessage, 0 );
 
-         break;
-      }
-#endif
-      default:
+   switch( ABCC_GetMsgCmdBits( psNewMessage ) )
+   {
+   case ABP_CMD_GET_ATTR:
+   case ABP_CMD_SET_ATTR:
 
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
+      ABCC_HostAttrCommand( psNewMessage, opcua_asInstAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( opcua_asInstAttr ) );
       break;
-   }
-#endif
+
    default:
 
       /*
@@ -318,66 +269,13 @@ static void InstanceCommand( ABP_MsgType* psNewMessage )
 */
 static void ObjectCommand( ABP_MsgType* psNewMessage )
 {
-   UINT16 iStrLength;
-
    switch( ABCC_GetMsgCmdBits( psNewMessage ) )
    {
    case ABP_CMD_GET_ATTR:
-   {
-      switch( ABCC_GetMsgCmdExt0( psNewMessage ) )
-      {
-      case ABP_OA_NAME:
-
-         /*
-         ** The 'name' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         iStrLength = (UINT16)strlen( opcua_sObject.pcName );
-         ABCC_SetMsgString( psNewMessage, opcua_sObject.pcName, iStrLength, 0 );
-         ABP_SetMsgResponse( psNewMessage, iStrLength );
-         break;
-
-      case ABP_OA_REV:
-
-         /*
-         ** The 'revision' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData8( psNewMessage, opcua_sObject.bRevision, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_REV_DS );
-         break;
-
-      case ABP_OA_NUM_INST:
-
-         /*
-         ** The 'Number of Instances' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData16( psNewMessage, opcua_sObject.iNumberOfInstances, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_NUM_INST_DS );
-         break;
-
-      case ABP_OA_HIGHEST_INST:
-
-         /*
-         ** The 'Highest Instance Number' attribute is requested.
-         ** Copy the attribute to a response message.
-         */
-         ABCC_SetMsgData16( psNewMessage, opcua_sObject.iHighestInstanceNo, 0 );
-         ABP_SetMsgResponse( psNewMessage, ABP_OA_HIGHEST_INST_DS );
-         break;
-
-      default:
-
-         /*
-         ** Unsupported attribute.
-         */
-         ABP_SetMsgErrorResponse( psNewMessage, 1, ABP_ERR_INV_CMD_EXT_0 );
-         break;
-      }
 
+      ABCC_HostAttrCommand( psNewMessage, opcua_asObjAttr,
+                            ABCC_HOST_ATTR_TABLE_SIZE( opcua_asObjAttr ) );
       break;
-   } /* End 'case ABP_CMD_GET_ATTR' */
 
    case ABP_OPCUA_CMD_METHOD_CALL:
    {
@@ -30,6 +30,8 @@
 #include "../abcc_handler.h"
 #include "../abcc_timer.h"
 #include "../abcc_command_sequencer.h"
+#include "../abcc_segmentation.h"
+#include "../abcc_trace.h"
 
 #if ( ABCC_CFG_INT_ENABLE_MASK_PAR & ABP_INTMASK_SYNCIEN )
 #error "Use ABCC_CFG_USE_ABCC_SYNC_SIGNAL_ENABLED define in abcc_driver_config.h to choose sync interrupt source. Do not use ABP_INTMASK_SYNCIEN"
@@ -97,6 +99,8 @@ ABCC_ErrorCodeType ABCC_ParRunDriver( void )
       return( ABCC_EC_INCORRECT_STATE );
    }
 
+   ABCC_TRACE( ABCC_TRACE_RUN_DRIVER_BEGIN, eMainState );
+
    if( ( ABCC_iInterruptEnableMask & ( ABP_INTMASK_WRMSGIEN | ABP_INTMASK_ANBRIEN ) ) == 0 )
    {
       ABCC_LinkCheckSendMessage();
@@ -119,6 +123,10 @@ ABCC_ErrorCodeType ABCC_ParRunDriver( void )
 #if ABCC_CFG_DRV_CMD_SEQ_ENABLED
    ABCC_CmdSequencerExec();
 #endif
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   ABCC_SegmentationExec();
+#endif
+   ABCC_TRACE( ABCC_TRACE_RUN_DRIVER_END, eMainState );
    return( ABCC_EC_NO_ERROR );
 }
 #if ABCC_CFG_INT_ENABLED
@@ -364,12 +364,23 @@ ABP_MsgType* ABCC_DrvParReadMessage( void )
 {
    UINT16 iBufctrl;
    UINT16 iMsgSize;
+   ABP_MsgHeaderType16 sHeader;
 
    iBufctrl = ABCC_DrvRead16( iBufCtrlAdrOffset );
 
    if( iLeExtBusTOi( iBufctrl ) & iRDMSGFlag  )
    {
-      DrvParSetMsgReceiverBuffer( ABCC_MemAlloc() );
+      /*
+      ** We have message data to read. First read the header and allocate a
+      ** buffer that fits the message.
+      */
+      ABCC_DrvParallelRead( iRdMsgAdrOffset,
+                            &sHeader,
+                            ABCC_MSG_HEADER_TYPE_SIZEOF );
+
+      DrvParSetMsgReceiverBuffer(
+         ABCC_MemAllocRxMsg( ( ABCC_GetLowAddrOct( sHeader.iCmdReserved ) & ABP_MSG_HEADER_C_BIT ) != 0,
+                             iLeTOi( sHeader.iDataSize ) ) );
 
       if( par_drv_uReadMessageData.psMsg == NULL )
       {
@@ -377,13 +388,9 @@ ABP_MsgType* ABCC_DrvParReadMessage( void )
          return( NULL );
       }
 
-      /*
-      ** We have message data to read. First read the header and check the size
-      ** of data area.
-      */
-      ABCC_DrvParallelRead( iRdMsgAdrOffset,
-                            par_drv_uReadMessageData.psMsg16,
-                            ABCC_MSG_HEADER_TYPE_SIZEOF );
+      ABCC_PORT_MemCpy( par_drv_uReadMessageData.psMsg16,
+                        &sHeader,
+                        ABCC_MSG_HEADER_TYPE_SIZEOF );
 
       iMsgSize = iLeTOi( par_drv_uReadMessageData.psMsg16->sHeader.iDataSize );
 
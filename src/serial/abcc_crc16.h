@@ -44,4 +44,41 @@
 
 EXTFUNC UINT16 CRC_Crc16( UINT8* pbBufferStart, UINT16 iLength );
 
+/*---------------------------------------------------------------------------
+**
+** CRC_Crc16Start()
+** CRC_Crc16Update()
+** CRC_Crc16Finish()
+**
+** Streaming calculation of the same CRC16 checksum as CRC_Crc16(). The
+** checksum can be fed in parts as data arrives, e.g. from the UART receive
+** path, and is ready as soon as the last part has been added.
+**
+**---------------------------------------------------------------------------
+**
+** Inputs:
+**    iCrc                     - Intermediate value from CRC_Crc16Start() or
+**                               a previous CRC_Crc16Update()
+**    pbBufferStart            - Where to continue calculation
+**    iLength                  - The amount of bytes to include
+**
+** Outputs:
+**    Returns                  - CRC_Crc16Start()/CRC_Crc16Update(): The
+**                               intermediate value
+**                               CRC_Crc16Finish(): The calculated CRC16
+**                               checksum
+**
+** Usage:
+**    iCrc = CRC_Crc16Start();
+**    iCrc = CRC_Crc16Update( iCrc, pbStart, 10 );
+**    iCrc = CRC_Crc16Update( iCrc, pbStart + 10, 10 );
+**    iCrc = CRC_Crc16Finish( iCrc );
+**
+**---------------------------------------------------------------------------
+*/
+
+EXTFUNC UINT16 CRC_Crc16Start( void );
+EXTFUNC UINT16 CRC_Crc16Update( UINT16 iCrc, const UINT8* pbBufferStart, UINT16 iLength );
+EXTFUNC UINT16 CRC_Crc16Finish( UINT16 iCrc );
+
 #endif  /* inclusion lock */
@@ -25,6 +25,8 @@
 #include "../abcc_handler.h"
 #include "../abcc_timer.h"
 #include "../abcc_command_sequencer.h"
+#include "../abcc_segmentation.h"
+#include "../abcc_trace.h"
 
 
 /*------------------------------------------------------------------------------
@@ -47,16 +49,23 @@ ABCC_ErrorCodeType ABCC_SerRunDriver( void )
       return( ABCC_EC_INCORRECT_STATE );
    }
 
+   ABCC_TRACE( ABCC_TRACE_RUN_DRIVER_BEGIN, eMainState );
    ABCC_LinkRunDriverRx();
    ABCC_TriggerRdPdUpdate();
    ABCC_TriggerAnbStatusUpdate();
    ABCC_TriggerReceiveMessage();
 #if ABCC_CFG_DRV_CMD_SEQ_ENABLED
    ABCC_CmdSequencerExec();
+#endif
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   ABCC_SegmentationExec();
 #endif
    ABCC_CheckWrPdUpdate();
    ABCC_LinkCheckSendMessage();
+   ABCC_TRACE( ABCC_TRACE_DRV_TX_BEGIN, 0 );
    pnABCC_DrvRunDriverTx();
+   ABCC_TRACE( ABCC_TRACE_DRV_TX_END, 0 );
+   ABCC_TRACE( ABCC_TRACE_RUN_DRIVER_END, eMainState );
 
    return( ABCC_EC_NO_ERROR );
 }
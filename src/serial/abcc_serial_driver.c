@@ -119,6 +119,10 @@ static RdMsgFragType     sRxFragHandle;
 static BOOL              fSendWriteMessageEndMark;   /* Indicate end of message */
 
 static BOOL              drv_fNewRxTelegramReceived; /* Serail driver has a complete message */
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+static UINT16            drv_iRxCrc;                 /* Running CRC of the received Rx telegram octets */
+static UINT16            drv_iRxCrcNumOctets;        /* Number of Rx telegram octets included in drv_iRxCrc */
+#endif
 static UINT8*            drv_bpRdPd;                 /* Pointer to valid read process data */
 
 /*
@@ -128,7 +132,7 @@ static ABCC_TimerHandle xWdTmoHandle;
 static BOOL             fWdTmo;             /* Current wd timeout status */
 static ABCC_TimerHandle xTelegramTmoHandle;
 static BOOL             fTelegramTmo;       /* Current telegram tmo status */
-static UINT16           iTelegramTmoMs;     /* Telegram timeout  */
+static UINT32           lTelegramTmoUs;     /* Telegram timeout  */
 
 
 /*******************************************************************************
@@ -152,6 +156,60 @@ static void drv_RxTelegramReceived( void )
    drv_fNewRxTelegramReceived = TRUE;
 }
 
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+/*------------------------------------------------------------------------------
+** Restart the running CRC of the Rx telegram. Must be called before the
+** physical layer starts a new reception.
+**------------------------------------------------------------------------------
+** Arguments:
+**       None.
+**
+** Returns:
+**       None.
+**------------------------------------------------------------------------------
+*/
+static void drv_RxCrcRestart( void )
+{
+   drv_iRxCrc = CRC_Crc16Start();
+   drv_iRxCrcNumOctets = 0;
+}
+
+/*------------------------------------------------------------------------------
+** Callback from the physical layer to indicate that part of the RX telegram
+** has been received. The new octets are added to the running CRC.
+**------------------------------------------------------------------------------
+** Arguments:
+**       iNumOctetsReceived   Total number of octets received of the telegram.
+**
+** Returns:
+**       None.
+**------------------------------------------------------------------------------
+*/
+static void drv_RxTelegramPartReceived( UINT16 iNumOctetsReceived )
+{
+   /*
+   ** The CRC itself is not included in the calculation.
+   */
+   if( iNumOctetsReceived > drv_iRxFrameSize )
+   {
+      iNumOctetsReceived = drv_iRxFrameSize;
+   }
+
+   if( iNumOctetsReceived < drv_iRxCrcNumOctets )
+   {
+      /*
+      ** The reception has been restarted by the physical layer.
+      */
+      drv_RxCrcRestart();
+   }
+
+   drv_iRxCrc = CRC_Crc16Update( drv_iRxCrc,
+                                 (UINT8*)&drv_sRxTelegram + drv_iRxCrcNumOctets,
+                                 iNumOctetsReceived - drv_iRxCrcNumOctets );
+   drv_iRxCrcNumOctets = iNumOctetsReceived;
+}
+#endif
+
 /*------------------------------------------------------------------------------
 ** Init write message fragmentation
 **------------------------------------------------------------------------------
@@ -357,16 +415,16 @@ void ABCC_DrvSerInit( UINT8 bOpmode )
    switch( bOpmode )
    {
    case ABP_OP_MODE_SERIAL_19_2:
-      iTelegramTmoMs = ABCC_CFG_SERIAL_TMO_19_2;
+      lTelegramTmoUs = ABCC_CFG_SERIAL_TMO_19_2 * 1000UL;
       break;
    case ABP_OP_MODE_SERIAL_57_6:
-      iTelegramTmoMs = ABCC_CFG_SERIAL_TMO_57_6;
+      lTelegramTmoUs = ABCC_CFG_SERIAL_TMO_57_6 * 1000UL;
       break;
    case ABP_OP_MODE_SERIAL_115_2:
-      iTelegramTmoMs = ABCC_CFG_SERIAL_TMO_115_2;
+      lTelegramTmoUs = ABCC_CFG_SERIAL_TMO_115_2 * 1000UL;
       break;
    case ABP_OP_MODE_SERIAL_625:
-      iTelegramTmoMs = ABCC_CFG_SERIAL_TMO_625;
+      lTelegramTmoUs = ABCC_CFG_SERIAL_TMO_625_US;
       break;
    default:
       ABCC_ASSERT_ERR( FALSE, ABCC_SEV_FATAL, ABCC_EC_INCORRECT_OPERATING_MODE, (UINT32)bOpmode );
@@ -380,6 +438,10 @@ void ABCC_DrvSerInit( UINT8 bOpmode )
    ** Register the PONG indicator for the physical serial driver.
    */
    ABCC_SYS_SerRegDataReceived( drv_RxTelegramReceived );
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+   drv_RxCrcRestart();
+   ABCC_SYS_SerRegPartialDataReceived( drv_RxTelegramPartReceived );
+#endif
 }
 
 /*------------------------------------------------------------------------------
@@ -480,7 +542,10 @@ void ABCC_DrvSerRunDriverTx( void )
       ** Send  TX telegram and received Rx telegram.
       */
       ABCC_DEBUG_HEXDUMP_UART( "HEXDUMP_TX:", (UINT8*)&drv_sTxTelegram, drv_iTxFrameSize + SER_CRC_LEN );
-      ABCC_TimerStart( xTelegramTmoHandle, iTelegramTmoMs );
+      ABCC_TimerStartUs( xTelegramTmoHandle, lTelegramTmoUs );
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+      drv_RxCrcRestart();
+#endif
       ABCC_SYS_SerSendReceive( (UINT8*)&drv_sTxTelegram,  (UINT8*)&drv_sRxTelegram, drv_iTxFrameSize + SER_CRC_LEN, drv_iRxFrameSize + SER_CRC_LEN );
    }
 }
@@ -508,6 +573,9 @@ ABP_MsgType* ABCC_DrvSerRunDriverRx( void )
       {
          if( fTelegramTmo )
          {
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+            drv_RxCrcRestart();
+#endif
             ABCC_SYS_SerRestart();
             drv_eState = SM_SER_RDY_TO_SEND_PING;
          }
@@ -525,7 +593,15 @@ ABP_MsgType* ABCC_DrvSerRunDriverRx( void )
 
       ABCC_DEBUG_HEXDUMP_UART( "HEXDUMP_RX:", (UINT8*)&drv_sRxTelegram, drv_iRxFrameSize + SER_CRC_LEN );
 
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+      /*
+      ** Add any octets not yet reported by the physical layer.
+      */
+      drv_RxTelegramPartReceived( drv_iRxFrameSize );
+      iReceivedCrc = CRC_Crc16Finish( drv_iRxCrc );
+#else
       iReceivedCrc = CRC_Crc16( (UINT8*)&drv_sRxTelegram, drv_iRxFrameSize );
+#endif
 
       /*
       ** Read the CRC that is sent with the telegram.
@@ -540,6 +616,9 @@ ABP_MsgType* ABCC_DrvSerRunDriverRx( void )
 #if ABCC_CFG_DEBUG_CRC_ERROR_CNT_ENABLED
          DEBUG_iCrcErrorCnt++;
          ABCC_ERROR( ABCC_SEV_INFORMATION, ABCC_EC_CHECKSUM_MISMATCH, (UINT32)DEBUG_iCrcErrorCnt );
+#endif
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+         drv_RxCrcRestart();
 #endif
          ABCC_SYS_SerRestart();
          return( NULL );
@@ -40,4 +40,34 @@
 */
 EXTFUNC UINT32 CRC_Crc32( UINT16* piBufferStart, UINT16 iLength );
 
+/*------------------------------------------------------------------------------
+** CRC_Crc32Start()
+** CRC_Crc32Update()
+** CRC_Crc32Finish()
+** Incremental calculation of the same CRC32 checksum as CRC_Crc32(). This
+** allows the checksum to be calculated in parts, e.g. while a frame is
+** assembled. The intermediate value is only meaningful to these functions.
+**------------------------------------------------------------------------------
+** Inputs:
+**    lCrc                     - Intermediate value from CRC_Crc32Start() or
+**                               a previous CRC_Crc32Update().
+**    piBufferStart            - Where to continue the calculation.
+**    iLength                  - The amount of bytes to include. Must be even
+**                               for all but the last part.
+** Outputs:
+**    Returns                  - CRC_Crc32Start()/CRC_Crc32Update(): The
+**                               intermediate value.
+**                               CRC_Crc32Finish(): The calculated CRC32
+**                               checksum for the SPI.
+** Usage:
+**    lCrc = CRC_Crc32Start();
+**    lCrc = CRC_Crc32Update( lCrc, piHeader, 10 );
+**    lCrc = CRC_Crc32Update( lCrc, piData, 20 );
+**    lCrc = CRC_Crc32Finish( lCrc );
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT32 CRC_Crc32Start( void );
+EXTFUNC UINT32 CRC_Crc32Update( UINT32 lCrc, const UINT16* piBufferStart, UINT16 iLength );
+EXTFUNC UINT32 CRC_Crc32Finish( UINT32 lCrc );
+
 #endif  /* inclusion lock */
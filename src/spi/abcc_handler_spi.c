@@ -30,6 +30,8 @@
 #include "../abcc_handler.h"
 #include "../abcc_timer.h"
 #include "../abcc_command_sequencer.h"
+#include "../abcc_segmentation.h"
+#include "../abcc_trace.h"
 
 /*------------------------------------------------------------------------------
 ** ABCC_RunDriver()
@@ -51,13 +53,16 @@ ABCC_ErrorCodeType ABCC_SpiRunDriver( void )
       return( ABCC_EC_INCORRECT_STATE );
    }
 
+   ABCC_TRACE( ABCC_TRACE_RUN_DRIVER_BEGIN, eMainState );
    ABCC_CheckWrPdUpdate();
    ABCC_LinkCheckSendMessage();
 
    /*
    ** Send MOSI frame
    */
+   ABCC_TRACE( ABCC_TRACE_DRV_TX_BEGIN, 0 );
    pnABCC_DrvRunDriverTx();
+   ABCC_TRACE( ABCC_TRACE_DRV_TX_END, 0 );
 
 #if ABCC_CFG_SYNC_MEASUREMENT_IP_ENABLED
    /*
@@ -82,6 +87,10 @@ ABCC_ErrorCodeType ABCC_SpiRunDriver( void )
 #if ABCC_CFG_DRV_CMD_SEQ_ENABLED
    ABCC_CmdSequencerExec();
 #endif
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   ABCC_SegmentationExec();
+#endif
+   ABCC_TRACE( ABCC_TRACE_RUN_DRIVER_END, eMainState );
    return( ABCC_EC_NO_ERROR );
    /* end of AnybusMain() */
 }
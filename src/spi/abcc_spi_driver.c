@@ -91,6 +91,15 @@ static const UINT16 iSpiStatusNewPd =     ABP_SPI_STATUS_NEW_PD << 8;
 #define EXTRACT_SPI_STATUS_CMDCNT( status ) ( ( ( status ) & iSpiStatusCmdCnt ) >> iSpiStatusCmdCntShift )
 #define SPI_BASE_FRAME_WORD_LEN  5 /* Frame length excluding MSG and PD data */
 
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+/*
+** Header lengths in words and max number of scatter/gather segments.
+*/
+#define SPI_MOSI_HEADER_WORD_LEN 4
+#define SPI_MISO_HEADER_WORD_LEN 5
+#define SPI_MAX_NUM_IO_VEC       3
+#endif
+
 /*------------------------------------------------------------------------------
 ** SPI MOSI structure (7044 - ABCC40).
 **------------------------------------------------------------------------------
@@ -136,6 +145,7 @@ typedef struct
   ABP_MsgType* psReadMsg;                 /* Pointer to the receive message buffer. */
   UINT16*            puCurrPtr;           /* Pointer to the current position in receive buffer. */
   UINT16             iNumWordsReceived;   /* Number of words received. */
+  UINT16             iMaxNumWords;        /* Number of words the receive buffer holds. */
 } drv_SpiReadMsgFragInfoType;
 
 /*------------------------------------------------------------------------------
@@ -193,12 +203,155 @@ static BOOL                         fWdTmo;                       /* Current wd
 
 static UINT16                       spi_drv_iMsgLen;              /* Message length ( in words ) */
 
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+static ABCC_SYS_SpiIoVecType        spi_drv_asMosiVec[ SPI_MAX_NUM_IO_VEC ]; /* MOSI segments. */
+static ABCC_SYS_SpiIoVecType        spi_drv_asMisoVec[ SPI_MAX_NUM_IO_VEC ]; /* MISO segments. */
+static UINT8                        spi_drv_bNumMosiVec;          /* Number of MOSI segments. */
+static UINT8                        spi_drv_bNumMisoVec;          /* Number of MISO segments. */
+static BOOL                         spi_drv_fMisoMsgInPlace;      /* MISO message field received directly into the read message. */
+#endif
+
 static void spi_drv_DataReceived( void );
+static ABP_MsgType* spi_drv_AllocReadMsg( void );
 static void spi_drv_ResetReadFragInfo( void );
 static void spi_drv_ResetWriteFragInfo( void );
 
 static void DrvSpiSetMsgReceiverBuffer( ABP_MsgType* const psReadMsg );
 
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+/*------------------------------------------------------------------------------
+**  Calculates the SPI CRC32 over a list of segments.
+**------------------------------------------------------------------------------
+** Arguments:
+**       pasVec:        Segments.
+**       bNumVec:       Number of segments.
+**       iLength:       Number of bytes to include, counted from the start of
+**                      the first segment.
+**
+** Returns:
+**       The CRC32 checksum.
+**------------------------------------------------------------------------------
+*/
+static UINT32 DrvSpiCalcVecCrc( const ABCC_SYS_SpiIoVecType* pasVec,
+                                UINT8 bNumVec,
+                                UINT16 iLength )
+{
+   UINT32 lCrc;
+   UINT16 iSegLength;
+   UINT8 i;
+
+   lCrc = CRC_Crc32Start();
+
+   for( i = 0; ( i < bNumVec ) && ( iLength > 0 ); i++ )
+   {
+      iSegLength = pasVec[ i ].iLength;
+
+      if( iSegLength > iLength )
+      {
+         iSegLength = iLength;
+      }
+
+      lCrc = CRC_Crc32Update( lCrc, (UINT16*)pasVec[ i ].pxBase, iSegLength );
+      iLength -= iSegLength;
+   }
+
+   return( CRC_Crc32Finish( lCrc ) );
+}
+
+/*------------------------------------------------------------------------------
+**  Builds the MOSI and MISO segment lists, applies the MOSI CRC and starts the
+**  SPI transaction.
+**------------------------------------------------------------------------------
+** Arguments:
+**       fWriteMsgFrag: TRUE if a write message fragment shall be sent.
+**
+** Returns:
+**       None.
+**------------------------------------------------------------------------------
+*/
+static void DrvSpiSendReceiveVec( BOOL fWriteMsgFrag )
+{
+   UINT32 lCrc;
+   UINT16 iFragLength;
+   UINT8 i;
+
+   /*
+   ** MOSI: Header, write message fragment taken directly from the message
+   ** buffer, rest of the frame from the MOSI frame buffer.
+   */
+   spi_drv_bNumMosiVec = 0;
+   iFragLength = 0;
+
+   if( fWriteMsgFrag )
+   {
+      iFragLength = spi_drv_sWriteFragInfo.iCurrFragLength;
+
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec ].pxBase = &spi_drv_sMosiFrame;
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec++ ].iLength = SPI_MOSI_HEADER_WORD_LEN << 1;
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec ].pxBase = spi_drv_sWriteFragInfo.puCurrPtr;
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec++ ].iLength = iFragLength << 1;
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec ].pxBase = &spi_drv_sMosiFrame.iData[ iFragLength ];
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec++ ].iLength =
+         ( spi_drv_iSpiFrameSize - SPI_MOSI_HEADER_WORD_LEN - iFragLength ) << 1;
+   }
+   else
+   {
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec ].pxBase = &spi_drv_sMosiFrame;
+      spi_drv_asMosiVec[ spi_drv_bNumMosiVec++ ].iLength = spi_drv_iSpiFrameSize << 1;
+   }
+
+   /*
+   ** MISO: Header, message field directly into the read message if one is in
+   ** progress and the field fits, rest of the frame into the MISO frame
+   ** buffer. If the frame turns out not to carry a message fragment the
+   ** message buffer area after the current position is simply overwritten
+   ** again by the next fragment.
+   */
+   spi_drv_bNumMisoVec = 0;
+   spi_drv_fMisoMsgInPlace =
+      ( spi_drv_sReadFragInfo.puCurrPtr != NULL ) &&
+      ( ( spi_drv_sReadFragInfo.iNumWordsReceived + spi_drv_iMsgLen ) <=
+        spi_drv_sReadFragInfo.iMaxNumWords );
+
+   if( spi_drv_fMisoMsgInPlace )
+   {
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec ].pxBase = &spi_drv_sMisoFrame;
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec++ ].iLength = SPI_MISO_HEADER_WORD_LEN << 1;
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec ].pxBase = spi_drv_sReadFragInfo.puCurrPtr;
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec++ ].iLength = spi_drv_iMsgLen << 1;
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec ].pxBase = &spi_drv_sMisoFrame.iData[ spi_drv_iPdOffset ];
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec++ ].iLength =
+         ( spi_drv_iSpiFrameSize - SPI_MISO_HEADER_WORD_LEN - spi_drv_iMsgLen ) << 1;
+   }
+   else
+   {
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec ].pxBase = &spi_drv_sMisoFrame;
+      spi_drv_asMisoVec[ spi_drv_bNumMisoVec++ ].iLength = spi_drv_iSpiFrameSize << 1;
+   }
+
+   /*
+   ** Apply the CRC checksum.
+   */
+   lCrc = DrvSpiCalcVecCrc( spi_drv_asMosiVec, spi_drv_bNumMosiVec,
+                            spi_drv_iSpiFrameSize*2 - 6 );
+   lCrc = lTOlLe( lCrc );
+
+   ABCC_PORT_MemCpy( &spi_drv_sMosiFrame.iData[ spi_drv_iCrcOffset ],
+                     &lCrc,
+                     ABP_UINT32_SIZEOF );
+
+   /*
+   ** Send the MOSI frame.
+   */
+   for( i = 0; i < spi_drv_bNumMosiVec; i++ )
+   {
+      ABCC_DEBUG_HEXDUMP_SPI( "HEXDUMP_MOSI:", (UINT16*)spi_drv_asMosiVec[ i ].pxBase, spi_drv_asMosiVec[ i ].iLength >> 1 );
+   }
+   ABCC_SYS_SpiSendReceiveVec( spi_drv_asMosiVec, spi_drv_bNumMosiVec,
+                               spi_drv_asMisoVec, spi_drv_bNumMisoVec );
+}
+#endif
+
 /*------------------------------------------------------------------------------
 **  Handles preparation and transmission of the MOSI frame.
 **  Depending on the physical implementation of the SPI transaction this method
@@ -268,12 +421,14 @@ void ABCC_DrvSpiRunDriverTx( void )
             spi_drv_sWriteFragInfo.iCurrFragLength = spi_drv_iMsgLen;
          }
 
+#if !ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
          /*
          ** Copy the message into the MOSI frame buffer.
          */
          ABCC_PORT_MemCpy( (void*)spi_drv_sMosiFrame.iData,
                            (void*)spi_drv_sWriteFragInfo.puCurrPtr,
                            spi_drv_sWriteFragInfo.iCurrFragLength << 1 );
+#endif
       }
       else
       {
@@ -299,10 +454,14 @@ void ABCC_DrvSpiRunDriverTx( void )
       ABCC_SetHighAddrOct( spi_drv_sMosiFrame.iIntMaskAppStatus, spi_drv_bNextIntMask );
       spi_drv_bpRdPd = NULL;
 
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+      (void)lCrc;
+      DrvSpiSendReceiveVec( fHandleWriteMsg );
+#else
       /*
       ** Apply the CRC checksum.
       */
-      lCrc = CRC_Crc32( (UINT16*)&spi_drv_sMosiFrame, spi_drv_iSpiFrameSize*2 - 6 );
+      lCrc = ABCC_PORT_Crc32( (UINT16*)&spi_drv_sMosiFrame, spi_drv_iSpiFrameSize*2 - 6 );
       lCrc = lTOlLe( lCrc );
 
       ABCC_PORT_MemCpy( &spi_drv_sMosiFrame.iData[ spi_drv_iCrcOffset ],
@@ -314,6 +473,7 @@ void ABCC_DrvSpiRunDriverTx( void )
       */
       ABCC_DEBUG_HEXDUMP_SPI( "HEXDUMP_MOSI:", (UINT16*)&spi_drv_sMosiFrame, spi_drv_iSpiFrameSize );
       ABCC_SYS_SpiSendReceive( &spi_drv_sMosiFrame, &spi_drv_sMisoFrame, spi_drv_iSpiFrameSize << 1 );
+#endif
    }
    else if( spi_drv_eState == SM_SPI_INIT )
    {
@@ -337,6 +497,7 @@ ABP_MsgType* ABCC_DrvSpiRunDriverRx( void )
    UINT32 lRecievedCrc;
    UINT32 lCalculatedCrc;
    ABP_MsgType* psWriteMsg = NULL;
+   UINT16 iNumWords;
 
    if( spi_drv_eState == SM_SPI_WAITING_FOR_MISO )
    {
@@ -352,9 +513,23 @@ ABP_MsgType* ABCC_DrvSpiRunDriverRx( void )
          spi_drv_fNewMisoReceived = FALSE;
       }
 
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+      {
+         UINT8 i;
+
+         for( i = 0; i < spi_drv_bNumMisoVec; i++ )
+         {
+            ABCC_DEBUG_HEXDUMP_SPI( "HEXDUMP_MISO:", (UINT16*)spi_drv_asMisoVec[ i ].pxBase, spi_drv_asMisoVec[ i ].iLength >> 1 );
+         }
+      }
+
+      lCalculatedCrc = DrvSpiCalcVecCrc( spi_drv_asMisoVec, spi_drv_bNumMisoVec,
+                                         spi_drv_iSpiFrameSize*2 - 4 );
+#else
       ABCC_DEBUG_HEXDUMP_SPI( "HEXDUMP_MISO:", (UINT16*)&spi_drv_sMisoFrame, spi_drv_iSpiFrameSize );
 
-      lCalculatedCrc = CRC_Crc32( (UINT16*)&spi_drv_sMisoFrame, spi_drv_iSpiFrameSize*2 - 4 );
+      lCalculatedCrc = ABCC_PORT_Crc32( (UINT16*)&spi_drv_sMisoFrame, spi_drv_iSpiFrameSize*2 - 4 );
+#endif
       lCalculatedCrc = lLeTOl( lCalculatedCrc );
 
       ABCC_PORT_MemCpy( &lRecievedCrc,
@@ -449,7 +624,7 @@ ABP_MsgType* ABCC_DrvSpiRunDriverRx( void )
 
          if( spi_drv_sReadFragInfo.puCurrPtr == 0 )
          {
-            DrvSpiSetMsgReceiverBuffer( ABCC_MemAlloc() );
+            DrvSpiSetMsgReceiverBuffer( spi_drv_AllocReadMsg() );
 
             if( spi_drv_sReadFragInfo.puCurrPtr == 0 )
             {
@@ -458,18 +633,36 @@ ABP_MsgType* ABCC_DrvSpiRunDriverRx( void )
             }
          }
 
-         if( ( ( spi_drv_sReadFragInfo.iNumWordsReceived + spi_drv_iMsgLen ) << 1 ) <=
-             ( ABCC_CFG_MAX_MSG_SIZE + ABCC_MSG_HEADER_TYPE_SIZEOF ) )
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+         if( spi_drv_fMisoMsgInPlace )
          {
             /*
-            ** Message fits in buffer so read it.
+            ** The fragment was received directly into the message buffer.
             */
+            spi_drv_sReadFragInfo.puCurrPtr += spi_drv_iMsgLen;
+            spi_drv_sReadFragInfo.iNumWordsReceived += spi_drv_iMsgLen;
+         }
+         else
+#endif
+         {
+            /*
+            ** Read as much of the fragment as fits in the buffer. The buffer
+            ** is sized by the message header, so the last fragment is cut
+            ** after the message data.
+            */
+            iNumWords = spi_drv_sReadFragInfo.iMaxNumWords -
+                        spi_drv_sReadFragInfo.iNumWordsReceived;
+            if( iNumWords > spi_drv_iMsgLen )
+            {
+               iNumWords = spi_drv_iMsgLen;
+            }
+
             ABCC_PORT_MemCpy( spi_drv_sReadFragInfo.puCurrPtr,
                               spi_drv_sMisoFrame.iData,
-                              spi_drv_iMsgLen << 1 );
+                              iNumWords << 1 );
 
-            spi_drv_sReadFragInfo.puCurrPtr += spi_drv_iMsgLen;
-            spi_drv_sReadFragInfo.iNumWordsReceived += spi_drv_iMsgLen;
+            spi_drv_sReadFragInfo.puCurrPtr += iNumWords;
+            spi_drv_sReadFragInfo.iNumWordsReceived += iNumWords;
          }
 
          if( spi_drv_sMisoFrame.iSpiStatusAnbStatus & iSpiStatusLastFrag )
@@ -517,6 +710,36 @@ static void spi_drv_DataReceived( void )
    spi_drv_fNewMisoReceived = TRUE;
 }
 
+/*------------------------------------------------------------------------------
+** Allocate the read message buffer when the first fragment of a message is
+** received. The size is taken from the message header in the fragment.
+**------------------------------------------------------------------------------
+** Arguments:
+**       None.
+**
+** Returns:
+**       Pointer to the buffer. NULL if no buffer is available.
+**------------------------------------------------------------------------------
+*/
+static ABP_MsgType* spi_drv_AllocReadMsg( void )
+{
+   const ABP_MsgHeaderType16* psHeader;
+
+   if( ( spi_drv_iMsgLen << 1 ) < ABCC_MSG_HEADER_TYPE_SIZEOF )
+   {
+      /*
+      ** The header is not complete in the first fragment.
+      */
+      return( ABCC_MemAlloc() );
+   }
+
+   psHeader = (const ABP_MsgHeaderType16*)spi_drv_sMisoFrame.iData;
+
+   return( ABCC_MemAllocRxMsg(
+      ( ABCC_GetLowAddrOct( psHeader->iCmdReserved ) & ABP_MSG_HEADER_C_BIT ) != 0,
+      iLeTOi( psHeader->iDataSize ) ) );
+}
+
 /*------------------------------------------------------------------------------
 ** Reset the read fragmentation information.
 **------------------------------------------------------------------------------
@@ -530,6 +753,7 @@ static void spi_drv_DataReceived( void )
 static void spi_drv_ResetReadFragInfo( void )
 {
    spi_drv_sReadFragInfo.iNumWordsReceived = 0;
+   spi_drv_sReadFragInfo.iMaxNumWords = 0;
    spi_drv_sReadFragInfo.psReadMsg = NULL;
    spi_drv_sReadFragInfo.puCurrPtr = NULL;
 }
@@ -746,6 +970,8 @@ static void DrvSpiSetMsgReceiverBuffer( ABP_MsgType* const psReadMsg )
    #pragma GCC diagnostic pop
 #endif
       spi_drv_sReadFragInfo.iNumWordsReceived = 0;
+      spi_drv_sReadFragInfo.iMaxNumWords =
+         NUM_BYTES_2_WORDS( ABCC_MemGetMaxDataSize( psReadMsg ) + ABCC_MSG_HEADER_TYPE_SIZEOF );
    }
    else
    {
@@ -0,0 +1,370 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Host benchmark of the driver against the simulated module.
+**
+** The same program is linked to each configuration variant of the driver (see
+** test/CMakeLists.txt, target bench), so A/B numbers of an option are the
+** lines of two variants that differ only in that option. All times are
+** wall clock nanoseconds per operation, the best of BENCH_NUM_RUNS runs.
+**
+**    run_cycle        - One application cycle in PROCESS_ACTIVE: handler,
+**                       write process data update, one SPI frame or serial
+**                       telegram (both ends, CRC included) or the parallel
+**                       register handshake, and read process data update.
+**    pd_write_update  - AD_UpdatePdWriteData() of the full default map.
+**    pd_read_update   - AD_UpdatePdReadData() of the full default map.
+**    msg_round_trip   - Get_Attribute from the module to the AD object and
+**                       back, including the cycles it takes.
+**    adi_lookup       - AD_GetAdiInstEntry() of 10000 random instances.
+**    spi_crc32        - CRC_Crc32() of a maximum size SPI frame (SPI only),
+**                       byte table, or nibble table in variant crc32_nibble.
+**    port_crc32       - ABCC_PORT_Crc32() of the same frame, the CRC the SPI
+**                       driver uses. Same as spi_crc32 unless the port
+**                       overrides it.
+**    serial_crc16     - CRC_Crc16() of a maximum size serial telegram (serial
+**                       only).
+********************************************************************************
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "application_data_object.h"
+#include "spi/abcc_crc32.h"
+#include "serial/abcc_crc16.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define BENCH_NUM_RUNS                 ( 5 )
+#define BENCH_NUM_CYCLES               ( 20000 )
+#define BENCH_NUM_PD_UPDATES           ( 200000 )
+#define BENCH_NUM_MSG                  ( 2000 )
+#define BENCH_NUM_LOOKUPS              ( 10000 )
+#define BENCH_NUM_LOOKUP_ROUNDS        ( 20 )
+#define BENCH_NUM_CRC                  ( 20000 )
+
+/*
+** Largest SPI frame in words: header, message fragment, process data, CRC.
+** Largest serial telegram in octets: control, message fragment, process data.
+*/
+#if ABCC_CFG_DRV_SPI_ENABLED
+#define BENCH_CRC_FRAME_WORDS          ( 5 + ABCC_CFG_SPI_MSG_FRAG_LEN / 2 + \
+                                         ABCC_CFG_MAX_PROCESS_DATA_SIZE / 2 + 2 )
+#endif
+#define BENCH_CRC_TELEGRAM_OCTETS      ( 1 + 16 + ABP_MAX_PROCESS_DATA )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT8  bench_abPd[ SIM_MAX_PD_SIZE ];
+static UINT16 bench_aiLookup[ BENCH_NUM_LOOKUPS ];
+#if ABCC_CFG_DRV_SPI_ENABLED
+static UINT16 bench_aiFrame[ BENCH_CRC_FRAME_WORDS ];
+#endif
+#if ABCC_CFG_DRV_SERIAL_ENABLED
+static UINT8  bench_abTelegram[ BENCH_CRC_TELEGRAM_OCTETS ];
+#endif
+
+/*
+** Keeps the compiler from removing the measured calls.
+*/
+static volatile UINT32 bench_lSink;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static double NowNs( void )
+{
+   struct timespec sTime;
+
+   clock_gettime( CLOCK_MONOTONIC, &sTime );
+   return( (double)sTime.tv_sec * 1e9 + (double)sTime.tv_nsec );
+}
+
+static void Report( const char* pcName, double rBestNs, UINT32 lNumOps )
+{
+   printf( "%-18s %10.1f ns/op\n", pcName, rBestNs / (double)lNumOps );
+}
+
+static void BenchRunCycle( void )
+{
+   double rBest = 0;
+   double rStart;
+   UINT32 lRun;
+   UINT32 lCycle;
+
+   for( lRun = 0; lRun < BENCH_NUM_RUNS; lRun++ )
+   {
+      rStart = NowNs();
+      for( lCycle = 0; lCycle < BENCH_NUM_CYCLES; lCycle++ )
+      {
+         SIM_aiAdi[ SIM_NUM_MAPPED_ADI ] = (UINT16)lCycle;
+         (void)SIM_APPL_RunCycle();
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBest ) )
+      {
+         rBest = rStart;
+      }
+   }
+   Report( "run_cycle", rBest, BENCH_NUM_CYCLES );
+}
+
+static void BenchPdUpdate( void )
+{
+   double rBestWr = 0;
+   double rBestRd = 0;
+   double rStart;
+   UINT32 lRun;
+   UINT32 lUpdate;
+
+   for( lRun = 0; lRun < BENCH_NUM_RUNS; lRun++ )
+   {
+      rStart = NowNs();
+      for( lUpdate = 0; lUpdate < BENCH_NUM_PD_UPDATES; lUpdate++ )
+      {
+#if AD_WRPD_DIRTY_TRACKING_ENABLE
+         AD_MarkAllAdisDirty();
+#endif
+         bench_lSink += AD_UpdatePdWriteData( bench_abPd );
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBestWr ) )
+      {
+         rBestWr = rStart;
+      }
+
+      rStart = NowNs();
+      for( lUpdate = 0; lUpdate < BENCH_NUM_PD_UPDATES; lUpdate++ )
+      {
+         bench_abPd[ 0 ] = (UINT8)lUpdate;
+         AD_UpdatePdReadData( bench_abPd );
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBestRd ) )
+      {
+         rBestRd = rStart;
+      }
+   }
+   Report( "pd_write_update", rBestWr, BENCH_NUM_PD_UPDATES );
+   Report( "pd_read_update", rBestRd, BENCH_NUM_PD_UPDATES );
+}
+
+static void BenchMsgRoundTrip( void )
+{
+   ABP_MsgType sMsg;
+   double rBest = 0;
+   double rStart;
+   UINT32 lRun;
+   UINT32 lMsg;
+   UINT32 lNumCycles = 0;
+
+   for( lRun = 0; lRun < BENCH_NUM_RUNS; lRun++ )
+   {
+      lNumCycles = 0;
+      rStart = NowNs();
+      for( lMsg = 0; lMsg < BENCH_NUM_MSG; lMsg++ )
+      {
+         memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+         sMsg.sHeader.bSourceId = (UINT8)lMsg;
+         sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+         sMsg.sHeader.iInstance = SIM_ADI_INST( lMsg % SIM_NUM_ADI );
+         sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+         sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+         lNumCycles += SIM_APPL_Transact( &sMsg, 100 );
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBest ) )
+      {
+         rBest = rStart;
+      }
+   }
+   Report( "msg_round_trip", rBest, BENCH_NUM_MSG );
+   printf( "%-18s %10.2f cycles/op\n", "msg_round_trip",
+           (double)lNumCycles / BENCH_NUM_MSG );
+}
+
+static void BenchAdiLookup( void )
+{
+   double rBest = 0;
+   double rStart;
+   UINT32 lRun;
+   UINT32 lRound;
+   UINT32 lLookup;
+   UINT32 lSeed = 12345;
+
+   /*
+   ** Random existing instances, the same sequence for all variants.
+   */
+   for( lLookup = 0; lLookup < BENCH_NUM_LOOKUPS; lLookup++ )
+   {
+      lSeed = lSeed * 1103515245UL + 12345UL;
+      bench_aiLookup[ lLookup ] = SIM_ADI_INST( ( lSeed >> 16 ) % SIM_NUM_ADI );
+   }
+
+   for( lRun = 0; lRun < BENCH_NUM_RUNS; lRun++ )
+   {
+      rStart = NowNs();
+      for( lRound = 0; lRound < BENCH_NUM_LOOKUP_ROUNDS; lRound++ )
+      {
+         for( lLookup = 0; lLookup < BENCH_NUM_LOOKUPS; lLookup++ )
+         {
+            bench_lSink += AD_GetAdiInstEntry( bench_aiLookup[ lLookup ] )->bNumOfElements;
+         }
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBest ) )
+      {
+         rBest = rStart;
+      }
+   }
+   Report( "adi_lookup", rBest, BENCH_NUM_LOOKUPS * BENCH_NUM_LOOKUP_ROUNDS );
+}
+
+#if ABCC_CFG_DRV_SPI_ENABLED
+static BOOL BenchCrc( void )
+{
+   double rBest = 0;
+   double rBestPort = 0;
+   double rStart;
+   UINT32 lRun;
+   UINT32 lCrc;
+
+   for( lCrc = 0; lCrc < BENCH_CRC_FRAME_WORDS; lCrc++ )
+   {
+      bench_aiFrame[ lCrc ] = (UINT16)( lCrc * 40503UL );
+   }
+
+   /*
+   ** Both must match the bitwise reference of the simulated module.
+   */
+   lCrc = SIM_Crc32( (UINT8*)bench_aiFrame, sizeof( bench_aiFrame ) );
+   if( ( CRC_Crc32( bench_aiFrame, sizeof( bench_aiFrame ) ) != lCrc ) ||
+       ( ABCC_PORT_Crc32( bench_aiFrame, sizeof( bench_aiFrame ) ) != lCrc ) )
+   {
+      printf( "CRC32 differs from the reference\n" );
+      return( FALSE );
+   }
+
+   for( lRun = 0; lRun < BENCH_NUM_RUNS; lRun++ )
+   {
+      rStart = NowNs();
+      for( lCrc = 0; lCrc < BENCH_NUM_CRC; lCrc++ )
+      {
+         bench_aiFrame[ 0 ] = (UINT16)lCrc;
+         bench_lSink += CRC_Crc32( bench_aiFrame, sizeof( bench_aiFrame ) );
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBest ) )
+      {
+         rBest = rStart;
+      }
+
+      rStart = NowNs();
+      for( lCrc = 0; lCrc < BENCH_NUM_CRC; lCrc++ )
+      {
+         bench_aiFrame[ 0 ] = (UINT16)lCrc;
+         bench_lSink += ABCC_PORT_Crc32( bench_aiFrame, sizeof( bench_aiFrame ) );
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBestPort ) )
+      {
+         rBestPort = rStart;
+      }
+   }
+   Report( "spi_crc32", rBest, BENCH_NUM_CRC );
+   Report( "port_crc32", rBestPort, BENCH_NUM_CRC );
+
+   return( TRUE );
+}
+#endif
+
+#if ABCC_CFG_DRV_SERIAL_ENABLED
+static void BenchCrc16( void )
+{
+   double rBest = 0;
+   double rStart;
+   UINT32 lRun;
+   UINT32 lCrc;
+
+   for( lCrc = 0; lCrc < BENCH_CRC_TELEGRAM_OCTETS; lCrc++ )
+   {
+      bench_abTelegram[ lCrc ] = (UINT8)( lCrc * 151UL );
+   }
+
+   for( lRun = 0; lRun < BENCH_NUM_RUNS; lRun++ )
+   {
+      rStart = NowNs();
+      for( lCrc = 0; lCrc < BENCH_NUM_CRC; lCrc++ )
+      {
+         bench_abTelegram[ 0 ] = (UINT8)lCrc;
+         bench_lSink += CRC_Crc16( bench_abTelegram, BENCH_CRC_TELEGRAM_OCTETS );
+      }
+      rStart = NowNs() - rStart;
+      if( ( lRun == 0 ) || ( rStart < rBest ) )
+      {
+         rBest = rStart;
+      }
+   }
+   Report( "serial_crc16", rBest, BENCH_NUM_CRC );
+}
+#endif
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( int argc, char* argv[] )
+{
+   printf( "== %s (%d ADIs, %d mapped per direction)\n",
+           argc > 1 ? argv[ 1 ] : "abcc_bench",
+           SIM_NUM_ADI, SIM_NUM_MAPPED_ADI );
+
+   if( ( ABCC_HwInit() != ABCC_EC_NO_ERROR ) || !SIM_APPL_Start() )
+   {
+      printf( "Driver did not reach PROCESS_ACTIVE\n" );
+      return( 1 );
+   }
+
+   SIM_SetPdLoopback( TRUE );
+
+   BenchRunCycle();
+   BenchPdUpdate();
+   BenchMsgRoundTrip();
+   BenchAdiLookup();
+#if ABCC_CFG_DRV_SPI_ENABLED
+   if( !BenchCrc() )
+   {
+      return( 1 );
+   }
+#endif
+#if ABCC_CFG_DRV_SERIAL_ENABLED
+   BenchCrc16();
+#endif
+
+   return( 0 );
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2015-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Driver configuration of the host simulator build.
+**
+** Only options needed by the simulated module are set here, everything else
+** keeps the defaults of abcc_config.h and abcc_object_config.h. Benchmark
+** variants override options on the compiler command line (see
+** test/CMakeLists.txt), so nothing here may be defined unconditionally unless
+** it is fixed for all variants.
+********************************************************************************
+*/
+
+#ifndef ABCC_DRV_CFG_H_
+#define ABCC_DRV_CFG_H_
+
+#include "abcc_types.h"
+
+/*
+** The simulated module is connected with SPI unless a variant selects the
+** serial or the parallel driver and the matching operating mode. The parallel
+** interface memory is reached through the HAL, it is not memory mapped.
+*/
+#ifndef ABCC_CFG_DRV_SPI_ENABLED
+#define ABCC_CFG_DRV_SPI_ENABLED                   1
+#endif
+#ifndef ABCC_CFG_ABCC_OP_MODE
+#define ABCC_CFG_ABCC_OP_MODE                      ABP_OP_MODE_SPI
+#endif
+#define ABCC_CFG_MEMORY_MAPPED_ACCESS_ENABLED      0
+
+#ifndef ABCC_CFG_SPI_MSG_FRAG_LEN
+#define ABCC_CFG_SPI_MSG_FRAG_LEN                  ( 64 )
+#endif
+
+/*
+** The simulator has no interrupt line, the driver is polled.
+*/
+#define ABCC_CFG_INT_ENABLED                       0
+#define ABCC_CFG_POLL_ABCC_IRQ_PIN_ENABLED         0
+
+#define ABCC_CFG_STARTUP_TIME_MS                   ( 10 )
+
+#endif  /* inclusion lock */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Platform dependent macros and functions of the host simulator build.
+**
+** Critical sections take one process wide recursive mutex, so the driver can
+** be run from several threads, e.g. the application thread and a simulated
+** ABCC interrupt thread.
+********************************************************************************
+*/
+
+#ifndef ABCC_SW_PORT_H_
+#define ABCC_SW_PORT_H_
+
+#include <stdio.h>
+#include <stdarg.h>
+#include "abcc_types.h"
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Enter/exit the simulator critical section. Implemented in sim_port.c.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_PORT_EnterCritical( void );
+EXTFUNC void SIM_PORT_ExitCritical( void );
+
+/*------------------------------------------------------------------------------
+** Monotonic timestamp in nanoseconds, wrapping at 2^32.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT32 SIM_PORT_GetTimestamp( void );
+
+/*------------------------------------------------------------------------------
+** printf() of the driver. The formatted text is also passed to the function
+** set by SIM_PORT_SetPrintHook(), if any, so that a test can check it.
+**------------------------------------------------------------------------------
+*/
+typedef void (*SIM_PORT_PrintHookType)( const char* pcText );
+
+EXTFUNC void SIM_PORT_Printf( const char* pcFormat, ... );
+EXTFUNC void SIM_PORT_SetPrintHook( SIM_PORT_PrintHookType pnHook );
+
+/*------------------------------------------------------------------------------
+** Atomic exchange, see ABCC_PORT_AtomicExchange8(). Used by variants built
+** with SIM_PORT_ATOMIC_HOOK_ENABLE. The function set by
+** SIM_PORT_SetAtomicHook(), if any, is called right after the exchange, the
+** way an interrupt could preempt the caller there.
+**------------------------------------------------------------------------------
+*/
+typedef void (*SIM_PORT_AtomicHookType)( volatile UINT8* pbTarget, UINT8 bValue );
+
+EXTFUNC UINT8 SIM_PORT_AtomicExchange8( volatile UINT8* pbTarget, UINT8 bValue );
+EXTFUNC void SIM_PORT_SetAtomicHook( SIM_PORT_AtomicHookType pnHook );
+
+#define ABCC_PORT_printf( ... )          SIM_PORT_Printf( __VA_ARGS__ )
+#define ABCC_PORT_vprintf( ... )         vprintf( __VA_ARGS__ )
+
+#define ABCC_PORT_UseCritical()
+#define ABCC_PORT_EnterCritical()        SIM_PORT_EnterCritical()
+#define ABCC_PORT_ExitCritical()         SIM_PORT_ExitCritical()
+
+#define ABCC_PORT_GetTimestamp()         SIM_PORT_GetTimestamp()
+
+#if SIM_PORT_ATOMIC_HOOK_ENABLE
+#define ABCC_PORT_AtomicExchange8( pbTarget, bValue ) \
+   SIM_PORT_AtomicExchange8( pbTarget, bValue )
+#endif
+
+#endif  /* inclusion lock */
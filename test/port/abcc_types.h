@@ -0,0 +1,77 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Standard type definitions of the host simulator build.
+********************************************************************************
+*/
+
+#ifndef ABCC_TYPES_H_
+#define ABCC_TYPES_H_
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stddef.h>
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#ifdef __cplusplus
+   #define CPLUSPLUS
+#endif
+
+#ifndef TRUE
+   #define TRUE   1
+#endif
+
+#ifndef FALSE
+   #define FALSE  0
+#endif
+
+#ifdef CPLUSPLUS
+   #define EXTFUNC extern "C"
+   #define EXTVAR  extern "C"
+#else
+   #define EXTFUNC extern
+   #define EXTVAR  extern
+#endif
+
+/*
+** All ABP structures and serial telegrams are naturally aligned on the hosts
+** the simulator runs on.
+*/
+#define PACKED_STRUCT
+#define ABCC_SYS_PACK_ON
+#define ABCC_SYS_PACK_OFF
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+typedef uint8_t   BOOL8;
+typedef int       BOOL;
+typedef char      CHAR;
+typedef int8_t    INT8;
+typedef uint8_t   UINT8;
+typedef int16_t   INT16;
+typedef uint16_t  UINT16;
+typedef int32_t   INT32;
+typedef uint32_t  UINT32;
+typedef int64_t   INT64;
+typedef uint64_t  UINT64;
+typedef float     FLOAT32;
+typedef double    FLOAT64;
+
+#endif  /* inclusion lock */
@@ -0,0 +1,1244 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Simulated ABCC40 module, see abcc_sim.h.
+**
+** The simulator only runs on little endian hosts, the frames, telegrams and
+** the parallel interface memory are handled as octet arrays in ABP (little
+** endian) order.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc_sim.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+/*
+** Octet offsets in the SPI frames.
+*/
+#define SIM_MOSI_CTRL            ( 0 )
+#define SIM_MOSI_MSG_LEN         ( 2 )
+#define SIM_MOSI_PD_LEN          ( 4 )
+#define SIM_MOSI_APP_STATUS      ( 6 )
+#define SIM_MOSI_DATA            ( 8 )
+
+#define SIM_MISO_LED_STAT        ( 2 )
+#define SIM_MISO_ANB_STATUS      ( 4 )
+#define SIM_MISO_SPI_STATUS      ( 5 )
+#define SIM_MISO_DATA            ( 10 )
+
+/*
+** Octet offsets and sizes in the serial telegrams. Messages are sent in the
+** 255 octet format, starting at the source ID with the data size in the
+** reserved octet of the header.
+*/
+#define SIM_SER_CTRL             ( 0 )
+#define SIM_SER_MSG              ( 1 )
+#define SIM_SER_PD               ( 17 )
+#define SIM_SER_FRAG_LEN         ( 16 )
+#define SIM_SER_OVERHEAD         ( SIM_SER_PD + 2 )
+#define SIM_SER_MSG_START        ( 4 )
+#define SIM_SER_MSG_DATA_SIZE    ( 9 )
+
+/*
+** Size of the parallel interface memory and the flags of the buffer control
+** register.
+*/
+#define SIM_PAR_MEM_SIZE         ( 0x4000 )
+
+#define SIM_PAR_BUFCTRL_WRPD     ( 0x01 )
+#define SIM_PAR_BUFCTRL_RDPD     ( 0x02 )
+#define SIM_PAR_BUFCTRL_WRMSG    ( 0x04 )
+#define SIM_PAR_BUFCTRL_RDMSG    ( 0x08 )
+#define SIM_PAR_BUFCTRL_ANBR     ( 0x10 )
+#define SIM_PAR_BUFCTRL_APPR     ( 0x20 )
+#define SIM_PAR_BUFCTRL_APPRCLR  ( 0x40 )
+
+/*
+** Message header size and the maximum size of a message in octets.
+*/
+#define SIM_MSG_HEADER_SIZE      ( 12 )
+#define SIM_MSG_SIZE             ( SIM_MSG_HEADER_SIZE + ABP_MAX_MSG_DATA_BYTES )
+
+/*
+** Depth of the message queues towards the host.
+*/
+#define SIM_MSG_QUEUE_SIZE       ( 8 )
+
+#define SIM_MAX_FRAME_SIZE       ( 2 * SIM_MSG_SIZE + SIM_MAX_PD_SIZE )
+
+#define SIM_MODULE_TYPE          ( 0x0403 )
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Queue of complete messages. alReadyFrame is the frame number from which
+** each message may be sent, see SIM_SetRespDelay().
+**------------------------------------------------------------------------------
+*/
+typedef struct sim_MsgQueueType
+{
+   ABP_MsgType asMsg[ SIM_MSG_QUEUE_SIZE ];
+   UINT32      alReadyFrame[ SIM_MSG_QUEUE_SIZE ];
+   UINT8       bReadIndex;
+   UINT8       bNumMsg;
+}
+sim_MsgQueueType;
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static ABP_AnbStateType sim_eAnbState;
+static UINT16           sim_iNwType = ABP_NW_TYPE_ECT;
+static UINT8            sim_bDataFormat = ABP_NW_DATA_FORMAT_LSB_FIRST;
+
+static UINT32           sim_lReadPdBits;
+static UINT32           sim_lWritePdBits;
+static UINT8            sim_abReadPd[ SIM_MAX_PD_SIZE ];
+static UINT8            sim_abWritePd[ SIM_MAX_PD_SIZE ];
+static BOOL             sim_fPdLoopback;
+
+/*
+** Messages towards the host. Responses are sent before commands, commands
+** only when the host has announced that it can take one.
+*/
+static sim_MsgQueueType sim_sRespQueue;
+static sim_MsgQueueType sim_sCmdQueue;
+static sim_MsgQueueType sim_sHostRespQueue;
+
+/*
+** Message currently sent to the host and the number of octets sent so far.
+*/
+static UINT8            sim_abTxMsg[ SIM_MSG_SIZE ];
+static UINT16           sim_iTxMsgSize;
+static UINT16           sim_iTxMsgOffset;
+static BOOL             sim_fTxMsgIsResp;
+
+/*
+** Message currently received from the host.
+*/
+static UINT8            sim_abRxMsg[ SIM_MSG_SIZE ];
+static UINT16           sim_iRxMsgOffset;
+
+static UINT8            sim_bNumHostCmds;
+static UINT8            sim_bHostCmdCredit;
+static UINT8            sim_bLastToggle;
+static BOOL             sim_fFirstFrame;
+static UINT16           sim_iNumCorruptCrc;
+
+/*
+** Last MISO frame or serial pong telegram, sent again on retransmissions.
+*/
+static UINT8            sim_abLastMiso[ SIM_MAX_FRAME_SIZE ];
+static UINT16           sim_iLastMisoLength;
+
+/*
+** Memory and buffer control register of the parallel interface.
+*/
+static UINT8            sim_abParMem[ SIM_PAR_MEM_SIZE ];
+static UINT16           sim_iParBufCtrl;
+
+static SIM_StatsType    sim_sStats;
+
+/*
+** ADIs mapped during SETUP, one bit per ADI number.
+*/
+static UINT8            sim_abMappedAdi[ 0x10000 / 8 ];
+
+/*
+** Response delay, see SIM_SetRespDelay().
+*/
+static UINT8            sim_bDelayObj;
+static UINT8            sim_bDelayCmd;
+static UINT16           sim_iDelayFrames;
+
+/*
+** See SIM_SetSpiMonitor().
+*/
+static SIM_SpiMonitorFuncType sim_pnSpiMonitor;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static UINT16 GetLe16( const UINT8* pbData )
+{
+   return( (UINT16)( pbData[ 0 ] | ( pbData[ 1 ] << 8 ) ) );
+}
+
+static void PutLe16( UINT8* pbData, UINT16 iValue )
+{
+   pbData[ 0 ] = (UINT8)iValue;
+   pbData[ 1 ] = (UINT8)( iValue >> 8 );
+}
+
+static void PutLe32( UINT8* pbData, UINT32 lValue )
+{
+   PutLe16( pbData, (UINT16)lValue );
+   PutLe16( pbData + 2, (UINT16)( lValue >> 16 ) );
+}
+
+static UINT32 GetLe32( const UINT8* pbData )
+{
+   return( (UINT32)GetLe16( pbData ) | ( (UINT32)GetLe16( pbData + 2 ) << 16 ) );
+}
+
+static BOOL QueuePut( sim_MsgQueueType* psQueue, const void* pxMsg )
+{
+   UINT8 bIndex;
+
+   if( psQueue->bNumMsg >= SIM_MSG_QUEUE_SIZE )
+   {
+      return( FALSE );
+   }
+
+   bIndex = (UINT8)( ( psQueue->bReadIndex + psQueue->bNumMsg ) % SIM_MSG_QUEUE_SIZE );
+   memcpy( &psQueue->asMsg[ bIndex ], pxMsg, sizeof( ABP_MsgType ) );
+   psQueue->alReadyFrame[ bIndex ] = 0;
+   psQueue->bNumMsg++;
+
+   return( TRUE );
+}
+
+static BOOL QueueGet( sim_MsgQueueType* psQueue, void* pxMsg )
+{
+   if( ( psQueue->bNumMsg == 0 ) ||
+       ( psQueue->alReadyFrame[ psQueue->bReadIndex ] > sim_sStats.lNumFrames ) )
+   {
+      return( FALSE );
+   }
+
+   memcpy( pxMsg, &psQueue->asMsg[ psQueue->bReadIndex ], sizeof( ABP_MsgType ) );
+   psQueue->bReadIndex = (UINT8)( ( psQueue->bReadIndex + 1 ) % SIM_MSG_QUEUE_SIZE );
+   psQueue->bNumMsg--;
+
+   return( TRUE );
+}
+
+/*------------------------------------------------------------------------------
+** Size in bits of one element of an ABP data type.
+**------------------------------------------------------------------------------
+*/
+static UINT16 TypeBits( UINT8 bType )
+{
+   if( ABP_Is_PADx( bType ) )
+   {
+      return( (UINT16)( bType - ABP_PAD0 ) );
+   }
+
+   if( ABP_Is_BITx( bType ) )
+   {
+      return( (UINT16)( bType - ABP_BIT1 + 1 ) );
+   }
+
+   switch( bType )
+   {
+   case ABP_BOOL1:
+      return( 1 );
+   case ABP_SINT16:
+   case ABP_UINT16:
+   case ABP_BITS16:
+      return( 16 );
+   case ABP_SINT32:
+   case ABP_UINT32:
+   case ABP_BITS32:
+   case ABP_FLOAT:
+      return( 32 );
+   case ABP_SINT64:
+   case ABP_UINT64:
+   case ABP_DOUBLE:
+      return( 64 );
+   default:
+      return( 8 );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Turns the message in psMsg into a response.
+**------------------------------------------------------------------------------
+*/
+static void SetResp( ABP_MsgType* psMsg, UINT16 iDataSize )
+{
+   psMsg->sHeader.bCmd &= (UINT8)~ABP_MSG_HEADER_C_BIT;
+   PutLe16( (UINT8*)&psMsg->sHeader.iDataSize, iDataSize );
+}
+
+static void SetErrResp( ABP_MsgType* psMsg, UINT8 bErr )
+{
+   psMsg->sHeader.bCmd &= (UINT8)~ABP_MSG_HEADER_C_BIT;
+   psMsg->sHeader.bCmd |= ABP_MSG_HEADER_E_BIT;
+   psMsg->abData[ 0 ] = bErr;
+   PutLe16( (UINT8*)&psMsg->sHeader.iDataSize, 1 );
+}
+
+/*------------------------------------------------------------------------------
+** Anybus object, instance 1.
+**------------------------------------------------------------------------------
+*/
+static void AnbCommand( ABP_MsgType* psMsg )
+{
+   UINT8 bCmd;
+
+   bCmd = psMsg->sHeader.bCmd & ABP_MSG_HEADER_CMD_BITS;
+
+   if( GetLe16( (UINT8*)&psMsg->sHeader.iInstance ) != 1 )
+   {
+      SetErrResp( psMsg, ABP_ERR_UNSUP_INST );
+      return;
+   }
+
+   if( bCmd == ABP_CMD_GET_ATTR )
+   {
+      switch( psMsg->sHeader.bCmdExt0 )
+      {
+      case ABP_ANB_IA_MODULE_TYPE:
+         PutLe16( psMsg->abData, SIM_MODULE_TYPE );
+         SetResp( psMsg, 2 );
+         break;
+      case ABP_ANB_IA_FW_VERSION:
+         psMsg->abData[ 0 ] = 1;
+         psMsg->abData[ 1 ] = 2;
+         psMsg->abData[ 2 ] = 3;
+         SetResp( psMsg, 3 );
+         break;
+      case ABP_ANB_IA_EXCEPTION:
+         psMsg->abData[ 0 ] = 0;
+         SetResp( psMsg, 1 );
+         break;
+      default:
+         SetErrResp( psMsg, ABP_ERR_INV_CMD_EXT_0 );
+         break;
+      }
+   }
+   else if( ( bCmd == ABP_CMD_SET_ATTR ) &&
+            ( psMsg->sHeader.bCmdExt0 == ABP_ANB_IA_SETUP_COMPLETE ) )
+   {
+      if( sim_eAnbState != ABP_ANB_STATE_SETUP )
+      {
+         SetErrResp( psMsg, ABP_ERR_INV_STATE );
+      }
+      else
+      {
+         /*
+         ** The network initialization is done before the next frame.
+         */
+         sim_eAnbState = ABP_ANB_STATE_WAIT_PROCESS;
+         SetResp( psMsg, 0 );
+      }
+   }
+   else
+   {
+      SetErrResp( psMsg, ABP_ERR_UNSUP_CMD );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Network object, instance 1.
+**------------------------------------------------------------------------------
+*/
+static void NwCommand( ABP_MsgType* psMsg )
+{
+   UINT8  bCmd;
+   UINT8  bNumItems;
+   UINT16 iOffset;
+   UINT32 lBits;
+
+   bCmd = psMsg->sHeader.bCmd & ABP_MSG_HEADER_CMD_BITS;
+
+   if( GetLe16( (UINT8*)&psMsg->sHeader.iInstance ) != 1 )
+   {
+      SetErrResp( psMsg, ABP_ERR_UNSUP_INST );
+      return;
+   }
+
+   switch( bCmd )
+   {
+   case ABP_CMD_GET_ATTR:
+
+      switch( psMsg->sHeader.bCmdExt0 )
+      {
+      case ABP_NW_IA_NW_TYPE:
+         PutLe16( psMsg->abData, sim_iNwType );
+         SetResp( psMsg, 2 );
+         break;
+      case ABP_NW_IA_DATA_FORMAT:
+         psMsg->abData[ 0 ] = sim_bDataFormat;
+         SetResp( psMsg, 1 );
+         break;
+      case ABP_NW_IA_PARAM_SUPPORT:
+         psMsg->abData[ 0 ] = TRUE;
+         SetResp( psMsg, 1 );
+         break;
+      case ABP_NW_IA_READ_PD_SIZE:
+         PutLe16( psMsg->abData, SIM_GetReadPdSize() );
+         SetResp( psMsg, 2 );
+         break;
+      case ABP_NW_IA_WRITE_PD_SIZE:
+         PutLe16( psMsg->abData, SIM_GetWritePdSize() );
+         SetResp( psMsg, 2 );
+         break;
+      case ABP_NW_IA_EXCEPTION_INFO:
+         psMsg->abData[ 0 ] = 0;
+         SetResp( psMsg, 1 );
+         break;
+      default:
+         SetErrResp( psMsg, ABP_ERR_INV_CMD_EXT_0 );
+         break;
+      }
+      break;
+
+   case ABP_NW_CMD_MAP_ADI_READ_EXT_AREA:
+   case ABP_NW_CMD_MAP_ADI_WRITE_EXT_AREA:
+
+      if( sim_eAnbState != ABP_ANB_STATE_SETUP )
+      {
+         SetErrResp( psMsg, ABP_ERR_INV_STATE );
+         break;
+      }
+
+      /*
+      ** Items: ADI (2), total elements, start index, number of elements,
+      ** number of type descriptors, type descriptors.
+      */
+      lBits = 0;
+      iOffset = 0;
+      for( bNumItems = psMsg->sHeader.bCmdExt0; bNumItems > 0; bNumItems-- )
+      {
+         UINT16 iAdi;
+         UINT8 bNumElem;
+         UINT8 bNumTypes;
+         UINT8 i;
+
+         iAdi = GetLe16( &psMsg->abData[ iOffset ] );
+         if( sim_abMappedAdi[ iAdi >> 3 ] & ( 1 << ( iAdi & 7 ) ) )
+         {
+            sim_sStats.lNumMapDuplicates++;
+         }
+         sim_abMappedAdi[ iAdi >> 3 ] |= (UINT8)( 1 << ( iAdi & 7 ) );
+
+         bNumElem = psMsg->abData[ iOffset + 4 ];
+         bNumTypes = psMsg->abData[ iOffset + 5 ];
+
+         for( i = 0; i < bNumElem; i++ )
+         {
+            lBits += TypeBits( psMsg->abData[ iOffset + 6 + ( bNumTypes > 1 ? i : 0 ) ] );
+         }
+
+         iOffset = (UINT16)( iOffset + 6 + bNumTypes );
+      }
+
+      if( bCmd == ABP_NW_CMD_MAP_ADI_READ_EXT_AREA )
+      {
+         sim_lReadPdBits += lBits;
+      }
+      else
+      {
+         sim_lWritePdBits += lBits;
+      }
+
+      SetResp( psMsg, 0 );
+      break;
+
+   default:
+
+      SetErrResp( psMsg, ABP_ERR_UNSUP_CMD );
+      break;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Handles a complete message from the host.
+**------------------------------------------------------------------------------
+*/
+static void HandleMsgFromHost( ABP_MsgType* psMsg )
+{
+   sim_sStats.lNumMsgFromHost++;
+
+   if( !( psMsg->sHeader.bCmd & ABP_MSG_HEADER_C_BIT ) )
+   {
+      /*
+      ** Response to a command sent by the module.
+      */
+      (void)QueuePut( &sim_sHostRespQueue, psMsg );
+      return;
+   }
+
+   sim_bNumHostCmds++;
+
+   switch( psMsg->sHeader.bDestObj )
+   {
+   case ABP_OBJ_NUM_ANB:
+      AnbCommand( psMsg );
+      break;
+   case ABP_OBJ_NUM_NW:
+      NwCommand( psMsg );
+      break;
+   case ABP_OBJ_NUM_NC:
+      /*
+      ** Network configuration values are accepted but not stored.
+      */
+      if( ( psMsg->sHeader.bCmd & ABP_MSG_HEADER_CMD_BITS ) == ABP_CMD_SET_ATTR )
+      {
+         SetResp( psMsg, 0 );
+      }
+      else
+      {
+         SetErrResp( psMsg, ABP_ERR_UNSUP_CMD );
+      }
+      break;
+   default:
+      SetErrResp( psMsg, ABP_ERR_UNSUP_OBJ );
+      break;
+   }
+
+   if( QueuePut( &sim_sRespQueue, psMsg ) &&
+       ( sim_iDelayFrames > 0 ) &&
+       ( psMsg->sHeader.bDestObj == sim_bDelayObj ) &&
+       ( ( psMsg->sHeader.bCmd & ABP_MSG_HEADER_CMD_BITS ) == sim_bDelayCmd ) )
+   {
+      sim_sRespQueue.alReadyFrame[ ( sim_sRespQueue.bReadIndex + sim_sRespQueue.bNumMsg - 1 ) %
+                                   SIM_MSG_QUEUE_SIZE ] = sim_sStats.lNumFrames + sim_iDelayFrames;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Handles new write process data from the host.
+**------------------------------------------------------------------------------
+*/
+static void NewWritePd( const UINT8* pbData, UINT16 iSize )
+{
+   if( iSize > SIM_GetWritePdSize() )
+   {
+      iSize = SIM_GetWritePdSize();
+   }
+
+   memcpy( sim_abWritePd, pbData, iSize );
+   sim_sStats.lNumWrPd++;
+
+   if( sim_fPdLoopback )
+   {
+      UINT16 iReadSize;
+
+      iReadSize = SIM_GetReadPdSize();
+      memcpy( sim_abReadPd, sim_abWritePd, iReadSize < iSize ? iReadSize : iSize );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** TRUE if the module sends read process data to the host.
+**------------------------------------------------------------------------------
+*/
+static BOOL IsReadPdValid( void )
+{
+   return( ( ( sim_eAnbState == ABP_ANB_STATE_IDLE ) ||
+             ( sim_eAnbState == ABP_ANB_STATE_PROCESS_ACTIVE ) ) &&
+           ( SIM_GetReadPdSize() > 0 ) );
+}
+
+/*------------------------------------------------------------------------------
+** Picks the next message to send to the host if none is in progress.
+**------------------------------------------------------------------------------
+*/
+static void SelectTxMsg( void )
+{
+   ABP_MsgType* psMsg;
+
+   if( sim_iTxMsgSize != 0 )
+   {
+      return;
+   }
+
+   psMsg = (ABP_MsgType*)sim_abTxMsg;
+
+   if( QueueGet( &sim_sRespQueue, psMsg ) )
+   {
+      sim_fTxMsgIsResp = TRUE;
+   }
+   else if( ( sim_bHostCmdCredit > 0 ) && QueueGet( &sim_sCmdQueue, psMsg ) )
+   {
+      sim_fTxMsgIsResp = FALSE;
+   }
+   else
+   {
+      return;
+   }
+
+   sim_iTxMsgSize = (UINT16)( SIM_MSG_HEADER_SIZE +
+                              GetLe16( (UINT8*)&psMsg->sHeader.iDataSize ) );
+   sim_iTxMsgOffset = 0;
+}
+
+/*------------------------------------------------------------------------------
+** The message in progress has been sent completely. Every outstanding host
+** command holds one slot until its response has been sent.
+**------------------------------------------------------------------------------
+*/
+static void TxMsgDone( void )
+{
+   sim_iTxMsgSize = 0;
+   sim_sStats.lNumMsgToHost++;
+
+   if( sim_fTxMsgIsResp && ( sim_bNumHostCmds > 0 ) )
+   {
+      sim_bNumHostCmds--;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Handles the MOSI frame. Returns FALSE if the frame was rejected.
+**------------------------------------------------------------------------------
+*/
+static BOOL HandleMosi( const UINT8* pbMosi, UINT16 iMsgLen, UINT16 iPdLen )
+{
+   UINT8  bCtrl;
+   UINT16 iFragSize;
+
+   bCtrl = pbMosi[ SIM_MOSI_CTRL ];
+   sim_bHostCmdCredit = (UINT8)( ( bCtrl & ABP_SPI_CTRL_CMDCNT ) >> 1 );
+
+   if( bCtrl & ABP_SPI_CTRL_WRPD_VALID )
+   {
+      NewWritePd( &pbMosi[ SIM_MOSI_DATA + iMsgLen * 2 ], (UINT16)( iPdLen * 2 ) );
+   }
+
+   if( bCtrl & ABP_SPI_CTRL_M )
+   {
+      iFragSize = (UINT16)( iMsgLen * 2 );
+      if( sim_iRxMsgOffset + iFragSize > SIM_MSG_SIZE )
+      {
+         iFragSize = (UINT16)( SIM_MSG_SIZE - sim_iRxMsgOffset );
+      }
+
+      memcpy( &sim_abRxMsg[ sim_iRxMsgOffset ], &pbMosi[ SIM_MOSI_DATA ], iFragSize );
+      sim_iRxMsgOffset = (UINT16)( sim_iRxMsgOffset + iFragSize );
+
+      if( bCtrl & ABP_SPI_CTRL_LAST_FRAG )
+      {
+         sim_iRxMsgOffset = 0;
+         HandleMsgFromHost( (ABP_MsgType*)sim_abRxMsg );
+      }
+   }
+
+   return( TRUE );
+}
+
+/*------------------------------------------------------------------------------
+** Builds the MISO frame.
+**------------------------------------------------------------------------------
+*/
+static void BuildMiso( UINT8* pbMiso, UINT16 iMsgLen, UINT16 iPdLen, BOOL fWrMsgFull )
+{
+   UINT8  bSpiStatus;
+   UINT8  bCmdCnt;
+   UINT16 iLength;
+   UINT16 iPdSize;
+
+   iLength = (UINT16)( ( 7 + iMsgLen + iPdLen ) * 2 );
+   memset( pbMiso, 0, iLength );
+
+   bSpiStatus = 0;
+   if( fWrMsgFull )
+   {
+      bSpiStatus |= ABP_SPI_STATUS_WRMSG_FULL;
+   }
+
+   /*
+   ** Every outstanding host command holds one slot until its response has
+   ** been sent completely.
+   */
+   bCmdCnt = (UINT8)( sim_bNumHostCmds < SIM_MAX_HOST_CMDS ?
+                      SIM_MAX_HOST_CMDS - sim_bNumHostCmds : 0 );
+   bSpiStatus |= (UINT8)( bCmdCnt << 1 ) & ABP_SPI_STATUS_CMDCNT;
+
+   SelectTxMsg();
+
+   if( sim_iTxMsgSize != 0 )
+   {
+      UINT16 iFragSize;
+
+      iFragSize = (UINT16)( sim_iTxMsgSize - sim_iTxMsgOffset );
+      if( iFragSize > iMsgLen * 2 )
+      {
+         iFragSize = (UINT16)( iMsgLen * 2 );
+      }
+
+      memcpy( &pbMiso[ SIM_MISO_DATA ], &sim_abTxMsg[ sim_iTxMsgOffset ], iFragSize );
+      sim_iTxMsgOffset = (UINT16)( sim_iTxMsgOffset + iFragSize );
+      bSpiStatus |= ABP_SPI_STATUS_M;
+
+      if( sim_iTxMsgOffset >= sim_iTxMsgSize )
+      {
+         bSpiStatus |= ABP_SPI_STATUS_LAST_FRAG;
+         TxMsgDone();
+      }
+   }
+
+   if( IsReadPdValid() )
+   {
+      iPdSize = SIM_GetReadPdSize();
+      if( iPdSize > iPdLen * 2 )
+      {
+         iPdSize = (UINT16)( iPdLen * 2 );
+      }
+
+      memcpy( &pbMiso[ SIM_MISO_DATA + iMsgLen * 2 ], sim_abReadPd, iPdSize );
+      bSpiStatus |= ABP_SPI_STATUS_NEW_PD;
+   }
+
+   pbMiso[ SIM_MISO_ANB_STATUS ] = (UINT8)sim_eAnbState;
+   pbMiso[ SIM_MISO_SPI_STATUS ] = bSpiStatus;
+
+   PutLe32( &pbMiso[ SIM_MISO_DATA + ( iMsgLen + iPdLen ) * 2 ],
+            SIM_Crc32( pbMiso, (UINT16)( iLength - 4 ) ) );
+}
+
+/*------------------------------------------------------------------------------
+** CRC of the serial telegrams, CRC-16/MODBUS computed one bit at a time.
+**------------------------------------------------------------------------------
+*/
+static UINT16 Crc16( const UINT8* pbData, UINT16 iLength )
+{
+   UINT16 iCrc;
+   UINT16 i;
+   UINT8  bBit;
+
+   iCrc = 0xFFFF;
+
+   for( i = 0; i < iLength; i++ )
+   {
+      iCrc ^= pbData[ i ];
+
+      for( bBit = 0; bBit < 8; bBit++ )
+      {
+         iCrc = ( iCrc & 1 ) ? (UINT16)( ( iCrc >> 1 ) ^ 0xA001 ) : (UINT16)( iCrc >> 1 );
+      }
+   }
+
+   return( iCrc );
+}
+
+/*------------------------------------------------------------------------------
+** Handles a serial ping telegram with a correct CRC. A ping with the M bit
+** carries the next message fragment, the first ping without it after the
+** fragments completes the message.
+**------------------------------------------------------------------------------
+*/
+static void HandlePing( const UINT8* pbTx, UINT16 iPdLen )
+{
+   UINT8 bCtrl;
+
+   bCtrl = pbTx[ SIM_SER_CTRL ];
+   sim_bHostCmdCredit = ( bCtrl & ABP_CTRL_R_BIT ) ? 1 : 0;
+
+   if( iPdLen > 0 )
+   {
+      NewWritePd( &pbTx[ SIM_SER_PD ], iPdLen );
+   }
+
+   if( bCtrl & ABP_CTRL_M_BIT )
+   {
+      if( SIM_SER_MSG_START + sim_iRxMsgOffset + SIM_SER_FRAG_LEN <= SIM_MSG_SIZE )
+      {
+         memcpy( &sim_abRxMsg[ SIM_SER_MSG_START + sim_iRxMsgOffset ],
+                 &pbTx[ SIM_SER_MSG ], SIM_SER_FRAG_LEN );
+      }
+
+      sim_iRxMsgOffset = (UINT16)( sim_iRxMsgOffset + SIM_SER_FRAG_LEN );
+   }
+   else if( sim_iRxMsgOffset != 0 )
+   {
+      sim_iRxMsgOffset = 0;
+      PutLe16( &sim_abRxMsg[ 0 ], sim_abRxMsg[ SIM_SER_MSG_DATA_SIZE ] );
+      PutLe16( &sim_abRxMsg[ 2 ], 0 );
+      HandleMsgFromHost( (ABP_MsgType*)sim_abRxMsg );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Builds the serial pong telegram answering a ping with the T bit bToggle.
+** Messages towards the host are fragmented the same way as the pings, a pong
+** without the M bit after the fragments is the end mark.
+**------------------------------------------------------------------------------
+*/
+static void BuildPong( UINT8* pbRx, UINT16 iRxLength, UINT8 bToggle )
+{
+   UINT8  bStatus;
+   UINT16 iPdSize;
+   UINT16 iCrc;
+
+   memset( pbRx, 0, iRxLength );
+
+   bStatus = (UINT8)( ( (UINT8)sim_eAnbState & ABP_STAT_S_BITS ) | bToggle );
+   if( sim_bNumHostCmds < SIM_MAX_HOST_CMDS )
+   {
+      bStatus |= ABP_STAT_R_BIT;
+   }
+
+   SelectTxMsg();
+
+   if( sim_iTxMsgSize != 0 )
+   {
+      if( sim_iTxMsgOffset == 0 )
+      {
+         sim_abTxMsg[ SIM_SER_MSG_DATA_SIZE ] = sim_abTxMsg[ 0 ];
+         sim_iTxMsgOffset = SIM_SER_MSG_START;
+      }
+
+      if( sim_iTxMsgOffset < sim_iTxMsgSize )
+      {
+         memcpy( &pbRx[ SIM_SER_MSG ], &sim_abTxMsg[ sim_iTxMsgOffset ], SIM_SER_FRAG_LEN );
+         sim_iTxMsgOffset = (UINT16)( sim_iTxMsgOffset + SIM_SER_FRAG_LEN );
+         bStatus |= ABP_STAT_M_BIT;
+      }
+      else
+      {
+         TxMsgDone();
+      }
+   }
+
+   if( IsReadPdValid() )
+   {
+      iPdSize = SIM_GetReadPdSize();
+      if( iPdSize > iRxLength - SIM_SER_OVERHEAD )
+      {
+         iPdSize = (UINT16)( iRxLength - SIM_SER_OVERHEAD );
+      }
+
+      memcpy( &pbRx[ SIM_SER_PD ], sim_abReadPd, iPdSize );
+   }
+
+   pbRx[ SIM_SER_CTRL ] = bStatus;
+
+   iCrc = Crc16( pbRx, (UINT16)( iRxLength - 2 ) );
+   pbRx[ iRxLength - 2 ] = (UINT8)( iCrc >> 8 );
+   pbRx[ iRxLength - 1 ] = (UINT8)iCrc;
+}
+
+/*------------------------------------------------------------------------------
+** Updates the parallel buffer control register before the host reads it.
+** Every read counts as one frame: the next message towards the host is placed
+** in the read message area and new read process data is announced.
+**------------------------------------------------------------------------------
+*/
+static void UpdateParBufCtrl( void )
+{
+   sim_sStats.lNumFrames++;
+
+   sim_bHostCmdCredit = ( sim_iParBufCtrl & SIM_PAR_BUFCTRL_APPR ) ? 1 : 0;
+
+   if( !( sim_iParBufCtrl & SIM_PAR_BUFCTRL_RDMSG ) )
+   {
+      SelectTxMsg();
+
+      if( sim_iTxMsgSize != 0 )
+      {
+         memcpy( &sim_abParMem[ ABP_RDMSG_ADR_OFFSET ], sim_abTxMsg, sim_iTxMsgSize );
+         sim_iParBufCtrl |= SIM_PAR_BUFCTRL_RDMSG;
+      }
+   }
+
+   sim_iParBufCtrl &= (UINT16)~SIM_PAR_BUFCTRL_ANBR;
+   if( sim_bNumHostCmds < SIM_MAX_HOST_CMDS )
+   {
+      sim_iParBufCtrl |= SIM_PAR_BUFCTRL_ANBR;
+   }
+
+   if( IsReadPdValid() )
+   {
+      sim_iParBufCtrl |= SIM_PAR_BUFCTRL_RDPD;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Handles the flags the host writes to the parallel buffer control register.
+** Messages from the host are handled at once, so the write message buffer is
+** always free again when the host reads the register.
+**------------------------------------------------------------------------------
+*/
+static void HandleParBufCtrl( UINT16 iFlags )
+{
+   if( iFlags & SIM_PAR_BUFCTRL_WRPD )
+   {
+      NewWritePd( &sim_abParMem[ ABP_WRPD_ADR_OFFSET ], SIM_GetWritePdSize() );
+   }
+
+   if( iFlags & SIM_PAR_BUFCTRL_RDPD )
+   {
+      memcpy( &sim_abParMem[ ABP_RDPD_ADR_OFFSET ], sim_abReadPd, SIM_GetReadPdSize() );
+      sim_iParBufCtrl &= (UINT16)~SIM_PAR_BUFCTRL_RDPD;
+   }
+
+   if( iFlags & SIM_PAR_BUFCTRL_WRMSG )
+   {
+      UINT16 iSize;
+
+      iSize = (UINT16)( SIM_MSG_HEADER_SIZE +
+                        GetLe16( &sim_abParMem[ ABP_WRMSG_ADR_OFFSET ] ) );
+      if( iSize > SIM_MSG_SIZE )
+      {
+         iSize = SIM_MSG_SIZE;
+      }
+
+      memcpy( sim_abRxMsg, &sim_abParMem[ ABP_WRMSG_ADR_OFFSET ], iSize );
+      HandleMsgFromHost( (ABP_MsgType*)sim_abRxMsg );
+   }
+
+   if( ( iFlags & SIM_PAR_BUFCTRL_RDMSG ) && ( sim_iParBufCtrl & SIM_PAR_BUFCTRL_RDMSG ) )
+   {
+      sim_iParBufCtrl &= (UINT16)~SIM_PAR_BUFCTRL_RDMSG;
+      TxMsgDone();
+   }
+
+   if( iFlags & SIM_PAR_BUFCTRL_APPR )
+   {
+      sim_iParBufCtrl |= SIM_PAR_BUFCTRL_APPR;
+   }
+
+   if( iFlags & SIM_PAR_BUFCTRL_APPRCLR )
+   {
+      sim_iParBufCtrl &= (UINT16)~SIM_PAR_BUFCTRL_APPR;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** One SPI transaction, see SIM_SpiTransfer().
+**------------------------------------------------------------------------------
+*/
+static void SpiTransfer( const UINT8* pbMosi, UINT8* pbMiso, UINT16 iLength )
+{
+   UINT16       iMsgLen;
+   UINT16       iPdLen;
+   UINT8        bToggle;
+   BOOL         fCrcOk;
+
+   sim_sStats.lNumFrames++;
+
+   iMsgLen = GetLe16( &pbMosi[ SIM_MOSI_MSG_LEN ] );
+   iPdLen = GetLe16( &pbMosi[ SIM_MOSI_PD_LEN ] );
+
+   if( ( ( 7 + iMsgLen + iPdLen ) * 2 != iLength ) ||
+       ( iLength > SIM_MAX_FRAME_SIZE ) )
+   {
+      /*
+      ** The frame length does not match the header, nothing sensible can be
+      ** answered.
+      */
+      memset( pbMiso, 0xFF, iLength );
+      sim_sStats.lNumMosiCrcErrors++;
+      return;
+   }
+
+   fCrcOk = ( GetLe32( &pbMosi[ SIM_MOSI_DATA + ( iMsgLen + iPdLen ) * 2 ] ) ==
+              SIM_Crc32( pbMosi, (UINT16)( iLength - 6 ) ) );
+
+   bToggle = pbMosi[ SIM_MOSI_CTRL ] & ABP_SPI_CTRL_T;
+
+   if( fCrcOk && !sim_fFirstFrame && ( bToggle == sim_bLastToggle ) &&
+       ( sim_iLastMisoLength == iLength ) )
+   {
+      /*
+      ** The host did not receive the last MISO frame, send it again.
+      */
+      sim_sStats.lNumRetransmits++;
+      memcpy( pbMiso, sim_abLastMiso, iLength );
+      return;
+   }
+
+   if( fCrcOk )
+   {
+      sim_fFirstFrame = FALSE;
+      sim_bLastToggle = bToggle;
+      (void)HandleMosi( pbMosi, iMsgLen, iPdLen );
+   }
+   else
+   {
+      sim_sStats.lNumMosiCrcErrors++;
+   }
+
+   /*
+   ** A rejected frame is reported as a full write message buffer so the
+   ** host sends the fragment again.
+   */
+   BuildMiso( pbMiso, iMsgLen, iPdLen, !fCrcOk );
+
+   memcpy( sim_abLastMiso, pbMiso, iLength );
+   sim_iLastMisoLength = iLength;
+
+   if( sim_iNumCorruptCrc > 0 )
+   {
+      sim_iNumCorruptCrc--;
+      pbMiso[ iLength - 1 ] ^= 0x5A;
+   }
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+UINT32 SIM_Crc32( const UINT8* pbData, UINT16 iLength )
+{
+   UINT32 lCrc;
+   UINT16 i;
+   UINT8  bBit;
+
+   lCrc = 0xFFFFFFFFUL;
+
+   for( i = 0; i < iLength; i++ )
+   {
+      lCrc ^= (UINT32)pbData[ i ] << 24;
+
+      for( bBit = 0; bBit < 8; bBit++ )
+      {
+         lCrc = ( lCrc & 0x80000000UL ) ? ( lCrc << 1 ) ^ 0x04C11DB7UL : ( lCrc << 1 );
+      }
+   }
+
+   lCrc = ~lCrc;
+
+   return( ( ( lCrc >> 24 ) & 0x000000FFUL ) |
+           ( ( lCrc >> 8 )  & 0x0000FF00UL ) |
+           ( ( lCrc << 8 )  & 0x00FF0000UL ) |
+           ( ( lCrc << 24 ) & 0xFF000000UL ) );
+}
+
+void SIM_SetNetwork( UINT16 iNwType, UINT8 bDataFormat )
+{
+   sim_iNwType = iNwType;
+   sim_bDataFormat = bDataFormat;
+}
+
+void SIM_Reset( void )
+{
+   sim_eAnbState = ABP_ANB_STATE_SETUP;
+
+   sim_lReadPdBits = 0;
+   sim_lWritePdBits = 0;
+   memset( sim_abReadPd, 0, sizeof( sim_abReadPd ) );
+   memset( sim_abWritePd, 0, sizeof( sim_abWritePd ) );
+   sim_fPdLoopback = FALSE;
+
+   memset( &sim_sRespQueue, 0, sizeof( sim_sRespQueue ) );
+   memset( &sim_sCmdQueue, 0, sizeof( sim_sCmdQueue ) );
+   memset( &sim_sHostRespQueue, 0, sizeof( sim_sHostRespQueue ) );
+
+   sim_iTxMsgSize = 0;
+   sim_iTxMsgOffset = 0;
+   sim_iRxMsgOffset = 0;
+   sim_bNumHostCmds = 0;
+   sim_bHostCmdCredit = 0;
+   sim_bLastToggle = 0;
+   sim_fFirstFrame = TRUE;
+   sim_iNumCorruptCrc = 0;
+   sim_iLastMisoLength = 0;
+
+   memset( sim_abParMem, 0, sizeof( sim_abParMem ) );
+   sim_iParBufCtrl = 0;
+
+   memset( &sim_sStats, 0, sizeof( sim_sStats ) );
+   memset( sim_abMappedAdi, 0, sizeof( sim_abMappedAdi ) );
+}
+
+void SIM_SpiTransfer( const UINT16* piMosi, UINT16* piMiso, UINT16 iLength )
+{
+   SpiTransfer( (const UINT8*)piMosi, (UINT8*)piMiso, iLength );
+
+   if( sim_pnSpiMonitor != NULL )
+   {
+      sim_pnSpiMonitor( piMosi, piMiso, iLength );
+   }
+}
+
+void SIM_SetSpiMonitor( SIM_SpiMonitorFuncType pnMonitor )
+{
+   sim_pnSpiMonitor = pnMonitor;
+}
+
+BOOL SIM_SerialTransfer( const UINT8* pbTx, UINT16 iTxLength, UINT8* pbRx, UINT16 iRxLength )
+{
+   UINT8 bToggle;
+
+   sim_sStats.lNumFrames++;
+
+   if( ( iTxLength < SIM_SER_OVERHEAD ) ||
+       ( iRxLength < SIM_SER_OVERHEAD ) ||
+       ( iRxLength > SIM_MAX_FRAME_SIZE ) ||
+       ( (UINT16)( ( pbTx[ iTxLength - 2 ] << 8 ) | pbTx[ iTxLength - 1 ] ) !=
+         Crc16( pbTx, (UINT16)( iTxLength - 2 ) ) ) )
+   {
+      /*
+      ** Not answered, the host times out and sends the ping again.
+      */
+      sim_sStats.lNumMosiCrcErrors++;
+      return( FALSE );
+   }
+
+   bToggle = pbTx[ SIM_SER_CTRL ] & ABP_CTRL_T_BIT;
+
+   if( !sim_fFirstFrame && ( bToggle == sim_bLastToggle ) &&
+       ( sim_iLastMisoLength == iRxLength ) )
+   {
+      /*
+      ** The host did not receive the last pong, send it again.
+      */
+      sim_sStats.lNumRetransmits++;
+      memcpy( pbRx, sim_abLastMiso, iRxLength );
+      return( TRUE );
+   }
+
+   sim_fFirstFrame = FALSE;
+   sim_bLastToggle = bToggle;
+
+   HandlePing( pbTx, (UINT16)( iTxLength - SIM_SER_OVERHEAD ) );
+   BuildPong( pbRx, iRxLength, bToggle );
+
+   memcpy( sim_abLastMiso, pbRx, iRxLength );
+   sim_iLastMisoLength = iRxLength;
+
+   if( sim_iNumCorruptCrc > 0 )
+   {
+      sim_iNumCorruptCrc--;
+      pbRx[ iRxLength - 1 ] ^= 0x5A;
+   }
+
+   return( TRUE );
+}
+
+void SIM_ParallelRead( UINT16 iOffset, void* pxData, UINT16 iLength )
+{
+   if( iOffset + iLength > SIM_PAR_MEM_SIZE )
+   {
+      iLength = (UINT16)( iOffset < SIM_PAR_MEM_SIZE ? SIM_PAR_MEM_SIZE - iOffset : 0 );
+   }
+
+   memcpy( pxData, &sim_abParMem[ iOffset ], iLength );
+}
+
+void SIM_ParallelWrite( UINT16 iOffset, const void* pxData, UINT16 iLength )
+{
+   if( iOffset + iLength > SIM_PAR_MEM_SIZE )
+   {
+      iLength = (UINT16)( iOffset < SIM_PAR_MEM_SIZE ? SIM_PAR_MEM_SIZE - iOffset : 0 );
+   }
+
+   memcpy( &sim_abParMem[ iOffset ], pxData, iLength );
+}
+
+UINT16 SIM_ParallelRead16( UINT16 iOffset )
+{
+   switch( iOffset )
+   {
+   case ABP_BUFCTRL_ADR_OFFSET:
+      UpdateParBufCtrl();
+      return( sim_iParBufCtrl );
+   case ABP_ANBSTATUS_ADR_OFFSET:
+      return( (UINT16)( (UINT8)sim_eAnbState & ABP_STAT_S_BITS ) );
+   default:
+      if( iOffset + 2 > SIM_PAR_MEM_SIZE )
+      {
+         return( 0 );
+      }
+      return( GetLe16( &sim_abParMem[ iOffset ] ) );
+   }
+}
+
+void SIM_ParallelWrite16( UINT16 iOffset, UINT16 iData )
+{
+   if( iOffset == ABP_BUFCTRL_ADR_OFFSET )
+   {
+      HandleParBufCtrl( iData );
+   }
+   else if( iOffset + 2 <= SIM_PAR_MEM_SIZE )
+   {
+      PutLe16( &sim_abParMem[ iOffset ], iData );
+   }
+}
+
+void SIM_SetAnbState( ABP_AnbStateType eState )
+{
+   sim_eAnbState = eState;
+}
+
+ABP_AnbStateType SIM_GetAnbState( void )
+{
+   return( sim_eAnbState );
+}
+
+UINT16 SIM_GetReadPdSize( void )
+{
+   return( (UINT16)( ( sim_lReadPdBits + 7 ) / 8 ) );
+}
+
+UINT16 SIM_GetWritePdSize( void )
+{
+   return( (UINT16)( ( sim_lWritePdBits + 7 ) / 8 ) );
+}
+
+void SIM_SetReadPd( const void* pxData, UINT16 iSize )
+{
+   if( iSize > SIM_MAX_PD_SIZE )
+   {
+      iSize = SIM_MAX_PD_SIZE;
+   }
+
+   memcpy( sim_abReadPd, pxData, iSize );
+}
+
+void SIM_SetPdLoopback( BOOL fEnable )
+{
+   sim_fPdLoopback = fEnable;
+}
+
+const UINT8* SIM_GetWritePd( void )
+{
+   return( sim_abWritePd );
+}
+
+BOOL SIM_SendCmd( const ABP_MsgType* psCmd )
+{
+   return( QueuePut( &sim_sCmdQueue, psCmd ) );
+}
+
+BOOL SIM_GetResp( ABP_MsgType* psResp )
+{
+   return( QueueGet( &sim_sHostRespQueue, psResp ) );
+}
+
+void SIM_CorruptMisoCrc( UINT16 iNumFrames )
+{
+   sim_iNumCorruptCrc = iNumFrames;
+}
+
+void SIM_SetRespDelay( UINT8 bObj, UINT8 bCmd, UINT16 iNumFrames )
+{
+   sim_bDelayObj = bObj;
+   sim_bDelayCmd = bCmd;
+   sim_iDelayFrames = iNumFrames;
+}
+
+const SIM_StatsType* SIM_GetStats( void )
+{
+   return( &sim_sStats );
+}
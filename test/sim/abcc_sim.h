@@ -0,0 +1,309 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Simulated ABCC40 module for host builds of the driver.
+**
+** The simulator is the far end of the HAL (sim_hardware_abstraction.c) in all
+** three operating modes the driver supports:
+**
+**    SPI      - SIM_SpiTransfer(), MOSI and MISO frames checked with a bitwise
+**               CRC32, messages fragmented in both directions.
+**    Serial   - SIM_SerialTransfer(), ping and pong telegrams checked with a
+**               bitwise CRC16, messages in 16 octet fragments.
+**    Parallel - SIM_ParallelRead/Write(), the interface memory with the
+**               buffer control register handshake, polled by the driver.
+**
+** Behind the framing the module answers the setup sequence of the driver (ANB
+** and Network object attributes, ADI mapping commands), keeps track of the
+** anybus state and the process data and sends messages towards the host.
+** Commands towards the host objects can be queued by the test program.
+**
+** The model covers the parts of the ABCC40 protocols the driver depends on.
+** It is not a reference for the protocols.
+********************************************************************************
+*/
+
+#ifndef ABCC_SIM_H_
+#define ABCC_SIM_H_
+
+#include "abcc_types.h"
+#include "abcc_config.h"
+#include "abp.h"
+
+/*------------------------------------------------------------------------------
+** With ABCC_CFG_INSTANCE_PREFIX each driver instance gets its own simulated
+** module, renamed like the driver, see abcc_instance.h.
+**------------------------------------------------------------------------------
+*/
+#ifdef ABCC_CFG_INSTANCE_PREFIX
+#define SIM_CorruptMisoCrc             ABCC_INSTANCE_NAME( SIM_CorruptMisoCrc )
+#define SIM_Crc32                      ABCC_INSTANCE_NAME( SIM_Crc32 )
+#define SIM_GetAnbState                ABCC_INSTANCE_NAME( SIM_GetAnbState )
+#define SIM_GetReadPdSize              ABCC_INSTANCE_NAME( SIM_GetReadPdSize )
+#define SIM_GetResp                    ABCC_INSTANCE_NAME( SIM_GetResp )
+#define SIM_GetStats                   ABCC_INSTANCE_NAME( SIM_GetStats )
+#define SIM_GetWritePd                 ABCC_INSTANCE_NAME( SIM_GetWritePd )
+#define SIM_GetWritePdSize             ABCC_INSTANCE_NAME( SIM_GetWritePdSize )
+#define SIM_ParallelRead               ABCC_INSTANCE_NAME( SIM_ParallelRead )
+#define SIM_ParallelRead16             ABCC_INSTANCE_NAME( SIM_ParallelRead16 )
+#define SIM_ParallelWrite              ABCC_INSTANCE_NAME( SIM_ParallelWrite )
+#define SIM_ParallelWrite16            ABCC_INSTANCE_NAME( SIM_ParallelWrite16 )
+#define SIM_Reset                      ABCC_INSTANCE_NAME( SIM_Reset )
+#define SIM_SendCmd                    ABCC_INSTANCE_NAME( SIM_SendCmd )
+#define SIM_SerialTransfer             ABCC_INSTANCE_NAME( SIM_SerialTransfer )
+#define SIM_SetAnbState                ABCC_INSTANCE_NAME( SIM_SetAnbState )
+#define SIM_SetNetwork                 ABCC_INSTANCE_NAME( SIM_SetNetwork )
+#define SIM_SetPdLoopback              ABCC_INSTANCE_NAME( SIM_SetPdLoopback )
+#define SIM_SetReadPd                  ABCC_INSTANCE_NAME( SIM_SetReadPd )
+#define SIM_SetRespDelay               ABCC_INSTANCE_NAME( SIM_SetRespDelay )
+#define SIM_SetSpiMonitor              ABCC_INSTANCE_NAME( SIM_SetSpiMonitor )
+#define SIM_SpiTransfer                ABCC_INSTANCE_NAME( SIM_SpiTransfer )
+#endif
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Size of the simulated process data buffers in octets.
+**------------------------------------------------------------------------------
+*/
+#define SIM_MAX_PD_SIZE                ( 1536 )
+
+/*------------------------------------------------------------------------------
+** Number of commands the simulated module accepts in parallel from the host.
+**------------------------------------------------------------------------------
+*/
+#define SIM_MAX_HOST_CMDS              ( 3 )
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Counters of the simulated module.
+**------------------------------------------------------------------------------
+** lNumFrames        - SPI transactions, serial telegrams or reads of the
+**                     parallel buffer control register.
+** lNumMosiCrcErrors - MOSI frames or pings with a bad CRC.
+** lNumRetransmits   - MOSI frames or pings where the T bit was not toggled.
+** lNumMsgFromHost   - Complete messages received from the host.
+** lNumMsgToHost     - Complete messages sent to the host.
+** lNumWrPd          - Write process data updates received from the host.
+** lNumMapDuplicates - ADIs mapped more than once during SETUP.
+**------------------------------------------------------------------------------
+*/
+typedef struct SIM_StatsType
+{
+   UINT32 lNumFrames;
+   UINT32 lNumMosiCrcErrors;
+   UINT32 lNumRetransmits;
+   UINT32 lNumMsgFromHost;
+   UINT32 lNumMsgToHost;
+   UINT32 lNumWrPd;
+   UINT32 lNumMapDuplicates;
+}
+SIM_StatsType;
+
+/*------------------------------------------------------------------------------
+** SPI transaction monitor, see SIM_SetSpiMonitor().
+**------------------------------------------------------------------------------
+*/
+typedef void (*SIM_SpiMonitorFuncType)( const UINT16* piMosi,
+                                        const UINT16* piMiso,
+                                        UINT16 iLength );
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Network the simulated module reports. Kept over resets, the default is
+** ABP_NW_TYPE_ECT with LSB first data format.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iNwType        - Value of the network type attribute.
+**    bDataFormat    - ABP_NW_DATA_FORMAT_LSB_FIRST or _MSB_FIRST.
+**
+** Returns:
+**    None.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_SetNetwork( UINT16 iNwType, UINT8 bDataFormat );
+
+/*------------------------------------------------------------------------------
+** Power on reset of the simulated module, called when the HAL releases the
+** reset. Clears the mapping, the queues and the counters and enters
+** ABP_ANB_STATE_SETUP.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_Reset( void );
+
+/*------------------------------------------------------------------------------
+** One SPI transaction. Called by the simulated HAL with the complete MOSI
+** frame, fills in the complete MISO frame of the same length.
+**------------------------------------------------------------------------------
+** Arguments:
+**    piMosi         - MOSI frame.
+**    piMiso         - MISO frame.
+**    iLength        - Frame length in octets.
+**
+** Returns:
+**    None.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_SpiTransfer( const UINT16* piMosi, UINT16* piMiso, UINT16 iLength );
+
+/*------------------------------------------------------------------------------
+** Sets a function called after each SPI transaction with the MOSI frame and
+** the MISO frame as sent, e.g. to record the frames. Kept over resets.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pnMonitor      - Monitor function, NULL for none.
+**
+** Returns:
+**    None.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_SetSpiMonitor( SIM_SpiMonitorFuncType pnMonitor );
+
+/*------------------------------------------------------------------------------
+** One serial ping/pong exchange. Called by the simulated HAL with the complete
+** ping telegram, fills in the complete pong telegram. The process data sizes
+** are given by the telegram lengths. Messages towards the host must not have
+** more than 255 octets of data.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pbTx           - Ping telegram, CRC included.
+**    iTxLength      - Ping length in octets.
+**    pbRx           - Pong telegram, CRC included.
+**    iRxLength      - Pong length in octets.
+**
+** Returns:
+**    FALSE if the ping is not answered because of a bad CRC.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC BOOL SIM_SerialTransfer( const UINT8* pbTx, UINT16 iTxLength,
+                                 UINT8* pbRx, UINT16 iRxLength );
+
+/*------------------------------------------------------------------------------
+** Accesses to the parallel interface memory, offsets in octets. The 16 bit
+** accesses of the buffer control register run the handshake: the module
+** updates the register before each read and handles the flags of each write.
+** The anybus status register reflects SIM_GetAnbState().
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_ParallelRead( UINT16 iOffset, void* pxData, UINT16 iLength );
+EXTFUNC void SIM_ParallelWrite( UINT16 iOffset, const void* pxData, UINT16 iLength );
+EXTFUNC UINT16 SIM_ParallelRead16( UINT16 iOffset );
+EXTFUNC void SIM_ParallelWrite16( UINT16 iOffset, UINT16 iData );
+
+/*------------------------------------------------------------------------------
+** Anybus state of the simulated module. The module leaves SETUP by itself when
+** the host sets SETUP_COMPLETE and then stops in WAIT_PROCESS. All other
+** transitions are made by the test program.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_SetAnbState( ABP_AnbStateType eState );
+EXTFUNC ABP_AnbStateType SIM_GetAnbState( void );
+
+/*------------------------------------------------------------------------------
+** Process data sizes in octets as mapped by the host during setup.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT16 SIM_GetReadPdSize( void );
+EXTFUNC UINT16 SIM_GetWritePdSize( void );
+
+/*------------------------------------------------------------------------------
+** Read process data the module sends in every frame while in IDLE or
+** PROCESS_ACTIVE. With loopback enabled the latest write process data is sent
+** back as read process data, as far as the sizes allow.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_SetReadPd( const void* pxData, UINT16 iSize );
+EXTFUNC void SIM_SetPdLoopback( BOOL fEnable );
+
+/*------------------------------------------------------------------------------
+** Latest valid write process data received from the host.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC const UINT8* SIM_GetWritePd( void );
+
+/*------------------------------------------------------------------------------
+** Queues a command from the module to a host object. The source ID, the
+** destination object and the command must be set by the caller.
+**------------------------------------------------------------------------------
+** Returns:
+**    TRUE if queued, FALSE if the queue is full.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC BOOL SIM_SendCmd( const ABP_MsgType* psCmd );
+
+/*------------------------------------------------------------------------------
+** Fetches the oldest response from the host to a command queued with
+** SIM_SendCmd().
+**------------------------------------------------------------------------------
+** Returns:
+**    TRUE if a response was copied to psResp, FALSE if there is none.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC BOOL SIM_GetResp( ABP_MsgType* psResp );
+
+/*------------------------------------------------------------------------------
+** Corrupts the CRC of the next iNumFrames MISO frames or pongs. The
+** retransmitted frame is sent with a correct CRC. Not used in parallel mode.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_CorruptMisoCrc( UINT16 iNumFrames );
+
+/*------------------------------------------------------------------------------
+** Delays the responses to the given command of the given object by iNumFrames
+** frames (see SIM_StatsType) from when the command was received. Responses are still
+** sent in order, so the responses after a delayed one wait as well. Kept over
+** resets.
+**------------------------------------------------------------------------------
+** Arguments:
+**    bObj           - Destination object of the command.
+**    bCmd           - Command, without the C bit.
+**    iNumFrames     - Delay, 0 for none.
+**
+** Returns:
+**    None.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC void SIM_SetRespDelay( UINT8 bObj, UINT8 bCmd, UINT16 iNumFrames );
+
+/*------------------------------------------------------------------------------
+** Counters since the last SIM_Reset().
+**------------------------------------------------------------------------------
+*/
+EXTFUNC const SIM_StatsType* SIM_GetStats( void );
+
+/*------------------------------------------------------------------------------
+** Bitwise reference implementation of the SPI CRC32, independent of the
+** driver implementation in abcc_crc32.c.
+**------------------------------------------------------------------------------
+** Arguments:
+**    pbData         - Data, in frame order.
+**    iLength        - Number of octets.
+**
+** Returns:
+**    The CRC in the same representation as CRC_Crc32().
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT32 SIM_Crc32( const UINT8* pbData, UINT16 iLength );
+
+#endif  /* inclusion lock */
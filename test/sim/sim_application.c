@@ -0,0 +1,299 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Application of the host simulator build, see sim_application.h.
+********************************************************************************
+*/
+
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_application_data_interface.h"
+#include "application_data_instance_config.h"
+#include "application_abcc_handler.h"
+#include "abcc_sim.h"
+#include "abcc_object_config.h"
+#include "bacnet_object.h"
+#include "sim_application.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define SIM_ADI_DESC ( ABP_APPD_DESCR_GET_ACCESS |                             \
+                       ABP_APPD_DESCR_SET_ACCESS |                             \
+                       ABP_APPD_DESCR_MAPPABLE_READ_PD |                       \
+                       ABP_APPD_DESCR_MAPPABLE_WRITE_PD )
+
+#if ( SIM_NUM_MAPPED_ADI * 2 ) > SIM_NUM_ADI
+#error "SIM_NUM_MAPPED_ADI too large for SIM_NUM_ADI"
+#endif
+
+/*------------------------------------------------------------------------------
+** Descriptor of UINT16 ADI number i (0 based). The mapped ADIs always have
+** SIM_ADI_DESC. With SIM_ADI_DESC_VARIED every third of the others is read
+** process data mappable, two in five write process data mappable and one in
+** seven an NVS parameter.
+**------------------------------------------------------------------------------
+*/
+#if SIM_ADI_DESC_VARIED
+#define SIM_ADI_DESC_OF( i )                                                   \
+   ( ( (i) < ( SIM_NUM_MAPPED_ADI * 2 ) ) ? SIM_ADI_DESC :                     \
+     ( ABP_APPD_DESCR_GET_ACCESS |                                             \
+       ABP_APPD_DESCR_SET_ACCESS |                                             \
+       ( ( ( (i) % 3 ) == 0 ) ? ABP_APPD_DESCR_MAPPABLE_READ_PD : 0 ) |        \
+       ( ( ( (i) % 5 ) < 2 ) ? ABP_APPD_DESCR_MAPPABLE_WRITE_PD : 0 ) |        \
+       ( ( ( (i) % 7 ) == 3 ) ? ABP_APPD_DESCR_NVS_PARAMETER : 0 ) ) )
+#else
+#define SIM_ADI_DESC_OF( i )           SIM_ADI_DESC
+#endif
+
+/*------------------------------------------------------------------------------
+** Table generators. SIM_ADI_<n>( i ) expands to the entries of the UINT16 ADIs
+** i..i+n-1 and SIM_MAP_<n>( i, dir ) to their map entries.
+**------------------------------------------------------------------------------
+*/
+#define SIM_ADI_1( i )     { SIM_ADI_INST( i ), "Adi", SIM_ADI_TYPE, 1, SIM_ADI_DESC_OF( i ), { { &SIM_aiAdi[ i ], NULL } } },
+#define SIM_ADI_2( i )     SIM_ADI_1( i )    SIM_ADI_1( (i) + 1 )
+#define SIM_ADI_4( i )     SIM_ADI_2( i )    SIM_ADI_2( (i) + 2 )
+#define SIM_ADI_8( i )     SIM_ADI_4( i )    SIM_ADI_4( (i) + 4 )
+#define SIM_ADI_16( i )    SIM_ADI_8( i )    SIM_ADI_8( (i) + 8 )
+#define SIM_ADI_32( i )    SIM_ADI_16( i )   SIM_ADI_16( (i) + 16 )
+#define SIM_ADI_64( i )    SIM_ADI_32( i )   SIM_ADI_32( (i) + 32 )
+#define SIM_ADI_128( i )   SIM_ADI_64( i )   SIM_ADI_64( (i) + 64 )
+#define SIM_ADI_256( i )   SIM_ADI_128( i )  SIM_ADI_128( (i) + 128 )
+#define SIM_ADI_512( i )   SIM_ADI_256( i )  SIM_ADI_256( (i) + 256 )
+#define SIM_ADI_1024( i )  SIM_ADI_512( i )  SIM_ADI_512( (i) + 512 )
+#define SIM_ADI_2048( i )  SIM_ADI_1024( i ) SIM_ADI_1024( (i) + 1024 )
+#define SIM_ADI_4096( i )  SIM_ADI_2048( i ) SIM_ADI_2048( (i) + 2048 )
+
+#define SIM_MAP_1( i, d )  { SIM_ADI_INST( i ), d, AD_MAP_ALL_ELEM, 0 },
+#define SIM_MAP_2( i, d )  SIM_MAP_1( i, d )  SIM_MAP_1( (i) + 1, d )
+#define SIM_MAP_4( i, d )  SIM_MAP_2( i, d )  SIM_MAP_2( (i) + 2, d )
+#define SIM_MAP_8( i, d )  SIM_MAP_4( i, d )  SIM_MAP_4( (i) + 4, d )
+#define SIM_MAP_16( i, d ) SIM_MAP_8( i, d )  SIM_MAP_8( (i) + 8, d )
+#define SIM_MAP_32( i, d ) SIM_MAP_16( i, d ) SIM_MAP_16( (i) + 16, d )
+#define SIM_MAP_64( i, d ) SIM_MAP_32( i, d ) SIM_MAP_32( (i) + 32, d )
+
+#define SIM_ADI_N_( n )    SIM_ADI_##n
+#define SIM_ADI_N( n )     SIM_ADI_N_( n )
+#define SIM_MAP_N_( n )    SIM_MAP_##n
+#define SIM_MAP_N( n )     SIM_MAP_N_( n )
+
+#if BAC_OBJ_ENABLE
+#if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE
+/*------------------------------------------------------------------------------
+** BACnet object of UINT16 ADI number i (0 based). The analog, binary and
+** multi-state value types and analog input (type 0) take turns, and the
+** instance numbers repeat every 192 ADIs, so later ADIs have the type and
+** instance of earlier ones. One in 23 is not assigned and one in 23 has an
+** instance number out of range. SIM_BAC_<n>( i ) expands to the object list
+** entries of the UINT16 ADIs i..i+n-1.
+**------------------------------------------------------------------------------
+*/
+#define SIM_BAC_TYPE_OF( i )                                                   \
+   ( ( ( (i) % 23 ) == 22 ) ? 0xFFFF :                                         \
+     ( ( (i) % 4 ) == 0 ) ? BAC_OBJ_TYPE_AN_VAL :                              \
+     ( ( (i) % 4 ) == 1 ) ? BAC_OBJ_TYPE_BIN_VAL :                             \
+     ( ( (i) % 4 ) == 2 ) ? BAC_OBJ_TYPE_MS_VAL : 0 )
+
+#define SIM_BAC_INST_OF( i )                                                   \
+   ( ( ( (i) % 23 ) == 22 ) ? 0xFFFFFFFFUL :                                   \
+     ( ( (i) % 23 ) == 11 ) ? ( 2040UL + (i) ) :                               \
+     (UINT32)( ( (i) / 4 ) % 48 ) )
+
+#define SIM_BAC_1( i )     { SIM_BAC_TYPE_OF( i ), SIM_BAC_INST_OF( i ) },
+#define SIM_BAC_2( i )     SIM_BAC_1( i )    SIM_BAC_1( (i) + 1 )
+#define SIM_BAC_4( i )     SIM_BAC_2( i )    SIM_BAC_2( (i) + 2 )
+#define SIM_BAC_8( i )     SIM_BAC_4( i )    SIM_BAC_4( (i) + 4 )
+#define SIM_BAC_16( i )    SIM_BAC_8( i )    SIM_BAC_8( (i) + 8 )
+#define SIM_BAC_32( i )    SIM_BAC_16( i )   SIM_BAC_16( (i) + 16 )
+#define SIM_BAC_64( i )    SIM_BAC_32( i )   SIM_BAC_32( (i) + 32 )
+#define SIM_BAC_128( i )   SIM_BAC_64( i )   SIM_BAC_64( (i) + 64 )
+#define SIM_BAC_256( i )   SIM_BAC_128( i )  SIM_BAC_128( (i) + 128 )
+#define SIM_BAC_512( i )   SIM_BAC_256( i )  SIM_BAC_256( (i) + 256 )
+#define SIM_BAC_1024( i )  SIM_BAC_512( i )  SIM_BAC_512( (i) + 512 )
+#define SIM_BAC_2048( i )  SIM_BAC_1024( i ) SIM_BAC_1024( (i) + 1024 )
+#define SIM_BAC_4096( i )  SIM_BAC_2048( i ) SIM_BAC_2048( (i) + 2048 )
+
+#define SIM_BAC_N_( n )    SIM_BAC_##n
+#define SIM_BAC_N( n )     SIM_BAC_N_( n )
+#endif
+#endif
+
+/*------------------------------------------------------------------------------
+** Cycles SIM_APPL_Start() waits for PROCESS_ACTIVE.
+**------------------------------------------------------------------------------
+*/
+#define SIM_START_MAX_CYCLES           ( 10000 )
+
+/*******************************************************************************
+** Public Globals
+********************************************************************************
+*/
+
+UINT16  SIM_aiAdi[ SIM_NUM_ADI ];
+UINT16  SIM_aiArray16[ 64 ];
+FLOAT32 SIM_arArray32[ 32 ];
+UINT8   SIM_abBitsRd[ 128 ];
+UINT8   SIM_abBitsWr[ 40 ];
+
+#if SIM_LARGE_ADI_ENABLE
+UINT16  SIM_aiLarge16[ 200 ];
+UINT8   SIM_abLargeBits[ ( 255 * 7 + 7 ) / 8 ];
+SIM_StructType SIM_sStruct;
+
+#if ABCC_CFG_STRUCT_DATA_TYPE_ENABLED
+static const AD_StructDataType sim_asStruct[] =
+{
+   { "Bits5",  ABP_BIT5,   1,  SIM_ADI_DESC, 0, { { SIM_sStruct.abBits,   NULL } } },
+   { "Bits4",  ABP_BIT4,   1,  SIM_ADI_DESC, 5, { { SIM_sStruct.abBits,   NULL } } },
+   { "Pad7",   ABP_PAD7,   1,  SIM_ADI_DESC, 0, { { NULL,                 NULL } } },
+   { "Words",  ABP_UINT16, 16, SIM_ADI_DESC, 0, { { SIM_sStruct.aiWords,  NULL } } },
+   { "Bits3",  ABP_BIT3,   10, SIM_ADI_DESC, 0, { { SIM_sStruct.abBits3,  NULL } } },
+   { "Pad2",   ABP_PAD2,   1,  SIM_ADI_DESC, 0, { { NULL,                 NULL } } },
+   { "Longs",  ABP_UINT32, 8,  SIM_ADI_DESC, 0, { { SIM_sStruct.alLongs,  NULL } } },
+   { "Bools",  ABP_BOOL1,  12, SIM_ADI_DESC, 0, { { SIM_sStruct.abBools,  NULL } } },
+   { "Pad4",   ABP_PAD4,   1,  SIM_ADI_DESC, 0, { { NULL,                 NULL } } },
+   { "Octets", ABP_UINT8,  20, SIM_ADI_DESC, 0, { { SIM_sStruct.abOctets, NULL } } }
+};
+#endif
+#endif
+
+const AD_AdiEntryType APPL_asAdiEntryList[] =
+{
+   SIM_ADI_N( SIM_NUM_ADI )( 0 )
+   { SIM_ADI_INST_ARRAY16, "Array16", ABP_UINT16, 64,  SIM_ADI_DESC, { { SIM_aiArray16, NULL } } },
+   { SIM_ADI_INST_ARRAY32, "Array32", ABP_FLOAT,  32,  SIM_ADI_DESC, { { SIM_arArray32, NULL } } },
+   { SIM_ADI_INST_BITS_RD, "BitsRd",  ABP_BOOL1,  128, SIM_ADI_DESC, { { SIM_abBitsRd,  NULL } } },
+   { SIM_ADI_INST_BITS_WR, "BitsWr",  ABP_BIT3,   40,  SIM_ADI_DESC, { { SIM_abBitsWr,  NULL } } },
+#if SIM_LARGE_ADI_ENABLE
+   { SIM_ADI_INST_LARGE16,    "Large16",   ABP_UINT16, 200, SIM_ADI_DESC, { { SIM_aiLarge16,   NULL } } },
+   { SIM_ADI_INST_LARGE_BITS, "LargeBits", ABP_BIT7,   255, SIM_ADI_DESC, { { SIM_abLargeBits, NULL } } },
+#if ABCC_CFG_STRUCT_DATA_TYPE_ENABLED
+   { SIM_ADI_INST_STRUCT,     "Struct",    DONT_CARE,
+     sizeof( sim_asStruct ) / sizeof( AD_StructDataType ), SIM_ADI_DESC, { { NULL, NULL } }, sim_asStruct },
+#endif
+#endif
+};
+
+const AD_MapType APPL_asAdObjDefaultMap[] =
+{
+   { SIM_ADI_INST_ARRAY16, PD_READ,  AD_MAP_ALL_ELEM, 0 },
+   { SIM_ADI_INST_BITS_RD, PD_READ,  AD_MAP_ALL_ELEM, 0 },
+   SIM_MAP_N( SIM_NUM_MAPPED_ADI )( 0, PD_READ )
+   { SIM_ADI_INST_ARRAY32, PD_WRITE, AD_MAP_ALL_ELEM, 0 },
+   { SIM_ADI_INST_BITS_WR, PD_WRITE, AD_MAP_ALL_ELEM, 0 },
+   SIM_MAP_N( SIM_NUM_MAPPED_ADI )( SIM_NUM_MAPPED_ADI, PD_WRITE )
+   { AD_MAP_END_ENTRY }
+};
+
+#if BAC_OBJ_ENABLE
+#if BAC_IA_SUPPORT_ADV_MAPPING_ENABLE && BAC_IA_SUPPORT_ADV_MAPPING_VALUE
+/*
+** Matches APPL_asAdiEntryList 1:1. The named ADIs also share object types and
+** instances.
+*/
+const BAC_ObjectListType BAC_asObjectList[] =
+{
+   SIM_BAC_N( SIM_NUM_ADI )( 0 )
+   { BAC_OBJ_TYPE_AN_VAL,  2039 },
+   { BAC_OBJ_TYPE_AN_VAL,  2039 },
+   { BAC_OBJ_TYPE_IGNORE },
+   { BAC_OBJ_TYPE_BIN_VAL, 2039 },
+#if SIM_LARGE_ADI_ENABLE
+   { BAC_OBJ_TYPE_MS_VAL,  2039 },
+   { BAC_OBJ_TYPE_IGNORE },
+#if ABCC_CFG_STRUCT_DATA_TYPE_ENABLED
+   { BAC_OBJ_TYPE_AN_VAL,  1 },
+#endif
+#endif
+};
+#endif
+#endif
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+UINT16 APPL_GetNumAdi( void )
+{
+   return( sizeof( APPL_asAdiEntryList ) / sizeof( AD_AdiEntryType ) );
+}
+
+void APPL_Init( void )
+{
+}
+
+void APPL_CyclicalProcessing( void )
+{
+}
+
+APPL_AbccHandlerStatusType SIM_APPL_RunCycle( void )
+{
+   APPL_AbccHandlerStatusType eStatus;
+
+   eStatus = APPL_HandleAbcc();
+   ABCC_RunTimerSystem( 1 );
+
+   return( eStatus );
+}
+
+BOOL SIM_APPL_Start( void )
+{
+   UINT16 iCycle;
+
+   for( iCycle = 0; iCycle < SIM_START_MAX_CYCLES; iCycle++ )
+   {
+      if( SIM_APPL_RunCycle() != APPL_MODULE_NO_ERROR )
+      {
+         return( FALSE );
+      }
+
+      if( SIM_GetAnbState() == ABP_ANB_STATE_WAIT_PROCESS )
+      {
+         SIM_SetAnbState( ABP_ANB_STATE_PROCESS_ACTIVE );
+      }
+
+      if( ABCC_AnbState() == ABP_ANB_STATE_PROCESS_ACTIVE )
+      {
+         return( TRUE );
+      }
+   }
+
+   return( FALSE );
+}
+
+UINT16 SIM_APPL_Transact( ABP_MsgType* psCmd, UINT16 iMaxCycles )
+{
+   UINT16 iCycle;
+
+   if( !SIM_SendCmd( psCmd ) )
+   {
+      return( 0 );
+   }
+
+   for( iCycle = 1; iCycle <= iMaxCycles; iCycle++ )
+   {
+      (void)SIM_APPL_RunCycle();
+
+      if( SIM_GetResp( psCmd ) )
+      {
+         return( iCycle );
+      }
+   }
+
+   return( 0 );
+}
@@ -0,0 +1,211 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Application of the host simulator build.
+**
+** The ADI table consists of SIM_NUM_ADI UINT16 ADIs, with instance numbers
+** SIM_ADI_STRIDE apart, followed by a few array ADIs:
+**
+**    SIM_ADI_INST_ARRAY16    - UINT16[ 64 ], read process data.
+**    SIM_ADI_INST_ARRAY32    - FLOAT[ 32 ], write process data.
+**    SIM_ADI_INST_BITS_RD    - BOOL1[ 128 ], read process data.
+**    SIM_ADI_INST_BITS_WR    - BIT3[ 40 ], write process data.
+**
+** SIM_LARGE_ADI_ENABLE adds unmapped ADIs larger than small message sizes:
+**
+**    SIM_ADI_INST_LARGE16    - UINT16[ 200 ].
+**    SIM_ADI_INST_LARGE_BITS - BIT7[ 255 ].
+**    SIM_ADI_INST_STRUCT     - SIM_StructType, bit, pad and octet members.
+**                              Only with ABCC_CFG_STRUCT_DATA_TYPE_ENABLED.
+**
+** The default map maps the array ADIs and the first SIM_NUM_MAPPED_ADI UINT16
+** ADIs in each direction. SIM_ADI_TYPE is the data type of the UINT16 ADIs,
+** any type of at most 16 bits. All of these can be overridden on the compiler
+** command line, SIM_NUM_ADI must be a power of two between 64 and 4096.
+**
+** With BACnet advanced mapping enabled, BAC_asObjectList gives the ADIs
+** BACnet objects with repeated types and instances, see SIM_BAC_TYPE_OF().
+********************************************************************************
+*/
+
+#ifndef SIM_APPLICATION_H_
+#define SIM_APPLICATION_H_
+
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "application_abcc_handler.h"
+
+/*------------------------------------------------------------------------------
+** Renamed per driver instance, see abcc_sim.h.
+**------------------------------------------------------------------------------
+*/
+#ifdef ABCC_CFG_INSTANCE_PREFIX
+#define SIM_APPL_RunCycle              ABCC_INSTANCE_NAME( SIM_APPL_RunCycle )
+#define SIM_APPL_Start                 ABCC_INSTANCE_NAME( SIM_APPL_Start )
+#define SIM_APPL_Transact              ABCC_INSTANCE_NAME( SIM_APPL_Transact )
+#define SIM_abBitsRd                   ABCC_INSTANCE_NAME( SIM_abBitsRd )
+#define SIM_abBitsWr                   ABCC_INSTANCE_NAME( SIM_abBitsWr )
+#define SIM_aiAdi                      ABCC_INSTANCE_NAME( SIM_aiAdi )
+#define SIM_aiArray16                  ABCC_INSTANCE_NAME( SIM_aiArray16 )
+#define SIM_arArray32                  ABCC_INSTANCE_NAME( SIM_arArray32 )
+#define SIM_aiLarge16                  ABCC_INSTANCE_NAME( SIM_aiLarge16 )
+#define SIM_abLargeBits                ABCC_INSTANCE_NAME( SIM_abLargeBits )
+#define SIM_sStruct                    ABCC_INSTANCE_NAME( SIM_sStruct )
+#endif
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#ifndef SIM_NUM_ADI
+#define SIM_NUM_ADI                    256
+#endif
+
+#ifndef SIM_ADI_STRIDE
+#define SIM_ADI_STRIDE                 ( 1 )
+#endif
+
+#ifndef SIM_NUM_MAPPED_ADI
+#define SIM_NUM_MAPPED_ADI             32
+#endif
+
+#ifndef SIM_ADI_TYPE
+#define SIM_ADI_TYPE                   ABP_UINT16
+#endif
+
+#define SIM_ADI_INST_ARRAY16           ( 0xF001 )
+#define SIM_ADI_INST_ARRAY32           ( 0xF002 )
+#define SIM_ADI_INST_BITS_RD           ( 0xF003 )
+#define SIM_ADI_INST_BITS_WR           ( 0xF004 )
+
+#ifndef SIM_LARGE_ADI_ENABLE
+#define SIM_LARGE_ADI_ENABLE           0
+#endif
+
+/*
+** If 1 the UINT16 ADIs after the mapped ones get descriptors that vary with
+** the ADI number, see SIM_ADI_DESC_OF(), instead of all being read and write
+** process data mappable.
+*/
+#ifndef SIM_ADI_DESC_VARIED
+#define SIM_ADI_DESC_VARIED            0
+#endif
+
+#define SIM_ADI_INST_LARGE16           ( 0xF005 )
+#define SIM_ADI_INST_LARGE_BITS        ( 0xF006 )
+#define SIM_ADI_INST_STRUCT            ( 0xF007 )
+
+/*------------------------------------------------------------------------------
+** Instance number of UINT16 ADI number n (0 based).
+**------------------------------------------------------------------------------
+*/
+#define SIM_ADI_INST( n )              ( (UINT16)( (n) * SIM_ADI_STRIDE + 1 ) )
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+#if SIM_LARGE_ADI_ENABLE
+/*------------------------------------------------------------------------------
+** Storage of the SIM_ADI_INST_STRUCT members, in order:
+**
+**    BIT5        - abBits bits 0-4.
+**    BIT4        - abBits bits 5-8.
+**    PAD7
+**    UINT16[ 16 ]- aiWords.
+**    BIT3[ 10 ]  - abBits3 bits 0-29.
+**    PAD2
+**    UINT32[ 8 ] - alLongs.
+**    BOOL1[ 12 ] - abBools bits 0-11.
+**    PAD4
+**    UINT8[ 20 ] - abOctets.
+**------------------------------------------------------------------------------
+*/
+typedef struct SIM_Struct
+{
+   UINT8  abBits[ 2 ];
+   UINT16 aiWords[ 16 ];
+   UINT8  abBits3[ 4 ];
+   UINT32 alLongs[ 8 ];
+   UINT8  abBools[ 2 ];
+   UINT8  abOctets[ 20 ];
+}
+SIM_StructType;
+#endif
+
+/*******************************************************************************
+** Public Globals
+********************************************************************************
+*/
+
+/*
+** ADI values.
+*/
+EXTVAR UINT16  SIM_aiAdi[ SIM_NUM_ADI ];
+EXTVAR UINT16  SIM_aiArray16[ 64 ];
+EXTVAR FLOAT32 SIM_arArray32[ 32 ];
+EXTVAR UINT8   SIM_abBitsRd[ 128 ];
+EXTVAR UINT8   SIM_abBitsWr[ 40 ];
+
+#if SIM_LARGE_ADI_ENABLE
+EXTVAR UINT16  SIM_aiLarge16[ 200 ];
+EXTVAR UINT8   SIM_abLargeBits[ ( 255 * 7 + 7 ) / 8 ];
+EXTVAR SIM_StructType SIM_sStruct;
+#endif
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Starts the driver against the simulated module and runs it until the module
+** is in PROCESS_ACTIVE with the default map.
+**------------------------------------------------------------------------------
+** Arguments:
+**    None.
+**
+** Returns:
+**    TRUE if PROCESS_ACTIVE was reached.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC BOOL SIM_APPL_Start( void );
+
+/*------------------------------------------------------------------------------
+** Runs one application cycle: APPL_HandleAbcc() (one SPI frame) and one
+** millisecond of the timer system.
+**------------------------------------------------------------------------------
+** Returns:
+**    Status of APPL_HandleAbcc().
+**------------------------------------------------------------------------------
+*/
+EXTFUNC APPL_AbccHandlerStatusType SIM_APPL_RunCycle( void );
+
+/*------------------------------------------------------------------------------
+** Sends a command from the simulated module to the host and runs cycles until
+** the response arrives.
+**------------------------------------------------------------------------------
+** Arguments:
+**    psCmd          - Command. Returns the response.
+**    iMaxCycles     - Number of cycles to wait at most.
+**
+** Returns:
+**    Number of cycles it took, 0 on timeout.
+**------------------------------------------------------------------------------
+*/
+EXTFUNC UINT16 SIM_APPL_Transact( ABP_MsgType* psCmd, UINT16 iMaxCycles );
+
+#endif  /* inclusion lock */
@@ -0,0 +1,251 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Hardware abstraction of the host simulator build. The SPI transactions,
+** serial telegrams and parallel memory accesses are handed to the simulated
+** module (abcc_sim.c) and complete before the HAL function returns. The
+** operating mode is selected with ABCC_CFG_ABCC_OP_MODE, see
+** abcc_driver_config.h.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abcc_config.h"
+#include "abcc_hardware_abstraction.h"
+#include "abcc_hardware_abstraction_spi.h"
+#include "abcc_hardware_abstraction_serial.h"
+#include "abcc_hardware_abstraction_parallel.h"
+#include "abcc_sim.h"
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+#if ABCC_CFG_DRV_SPI_ENABLED
+static ABCC_SYS_SpiDataReceivedCbfType sys_pnDataReceived = NULL;
+
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+static UINT16 sys_aiMosi[ ( 2 * ( ABP_MAX_MSG_DATA_BYTES + 12 ) + SIM_MAX_PD_SIZE ) / 2 ];
+static UINT16 sys_aiMiso[ ( 2 * ( ABP_MAX_MSG_DATA_BYTES + 12 ) + SIM_MAX_PD_SIZE ) / 2 ];
+#endif
+#endif
+
+#if ABCC_CFG_DRV_SERIAL_ENABLED
+static ABCC_SYS_SerDataReceivedCbfType sys_pnSerDataReceived = NULL;
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+static ABCC_SYS_SerPartialDataReceivedCbfType sys_pnSerPartialDataReceived = NULL;
+#endif
+#endif
+
+#if ABCC_CFG_DRV_PARALLEL_ENABLED
+/*
+** Process data buffers of the driver, the simulated interface memory is not
+** memory mapped.
+*/
+static UINT8 sys_abRdPd[ SIM_MAX_PD_SIZE ];
+static UINT8 sys_abWrPd[ SIM_MAX_PD_SIZE ];
+#endif
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+BOOL ABCC_SYS_HwInit( void )
+{
+   return( TRUE );
+}
+
+BOOL ABCC_SYS_Init( void )
+{
+   return( TRUE );
+}
+
+void ABCC_SYS_Close( void )
+{
+}
+
+void ABCC_SYS_HWReset( void )
+{
+}
+
+void ABCC_SYS_HWReleaseReset( void )
+{
+   SIM_Reset();
+}
+
+#if ABCC_CFG_MOD_DETECT_PINS_CONN
+BOOL ABCC_SYS_ModuleDetect( void )
+{
+   return( TRUE );
+}
+#endif
+
+#if ABCC_CFG_MODULE_ID_PINS_CONN
+UINT8 ABCC_SYS_ReadModuleId( void )
+{
+   return( ABP_MODULE_ID_ACTIVE_ABCC40 );
+}
+#endif
+
+#if ABCC_CFG_OP_MODE_SETTABLE
+void ABCC_SYS_SetOpmode( UINT8 bOpMode )
+{
+   (void)bOpMode;
+}
+#endif
+
+#if ABCC_CFG_OP_MODE_GETTABLE
+UINT8 ABCC_SYS_GetOpmode( void )
+{
+   return( ABCC_CFG_ABCC_OP_MODE );
+}
+#endif
+
+#if ABCC_CFG_DRV_SPI_ENABLED
+void ABCC_SYS_SpiRegDataReceived( ABCC_SYS_SpiDataReceivedCbfType pnDataReceived )
+{
+   sys_pnDataReceived = pnDataReceived;
+}
+
+void ABCC_SYS_SpiSendReceive( void* pxSendDataBuffer, void* pxReceiveDataBuffer, UINT16 iLength )
+{
+   SIM_SpiTransfer( (const UINT16*)pxSendDataBuffer, (UINT16*)pxReceiveDataBuffer, iLength );
+
+   if( sys_pnDataReceived != NULL )
+   {
+      sys_pnDataReceived();
+   }
+}
+
+#if ABCC_CFG_SPI_SCATTER_GATHER_ENABLED
+void ABCC_SYS_SpiSendReceiveVec( const ABCC_SYS_SpiIoVecType* pasMosiVec,
+                                 UINT8 bNumMosiVec,
+                                 const ABCC_SYS_SpiIoVecType* pasMisoVec,
+                                 UINT8 bNumMisoVec )
+{
+   UINT16 iLength;
+   UINT16 iOffset;
+   UINT8  i;
+
+   /*
+   ** Gather the MOSI frame, run the transaction and scatter the MISO frame,
+   ** like a chained DMA descriptor list would.
+   */
+   iLength = 0;
+   for( i = 0; i < bNumMosiVec; i++ )
+   {
+      memcpy( (UINT8*)sys_aiMosi + iLength, pasMosiVec[ i ].pxBase, pasMosiVec[ i ].iLength );
+      iLength = (UINT16)( iLength + pasMosiVec[ i ].iLength );
+   }
+
+   SIM_SpiTransfer( sys_aiMosi, sys_aiMiso, iLength );
+
+   iOffset = 0;
+   for( i = 0; i < bNumMisoVec; i++ )
+   {
+      memcpy( pasMisoVec[ i ].pxBase, (UINT8*)sys_aiMiso + iOffset, pasMisoVec[ i ].iLength );
+      iOffset = (UINT16)( iOffset + pasMisoVec[ i ].iLength );
+   }
+
+   if( sys_pnDataReceived != NULL )
+   {
+      sys_pnDataReceived();
+   }
+}
+#endif
+#endif /* ABCC_CFG_DRV_SPI_ENABLED */
+
+#if ABCC_CFG_DRV_SERIAL_ENABLED
+void ABCC_SYS_SerRegDataReceived( ABCC_SYS_SerDataReceivedCbfType pnDataReceived )
+{
+   sys_pnSerDataReceived = pnDataReceived;
+}
+
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+void ABCC_SYS_SerRegPartialDataReceived( ABCC_SYS_SerPartialDataReceivedCbfType pnPartialDataReceived )
+{
+   sys_pnSerPartialDataReceived = pnPartialDataReceived;
+}
+#endif
+
+void ABCC_SYS_SerSendReceive( void* pxTxDataBuffer, void* pxRxDataBuffer,
+                              UINT16 iTxSize, UINT16 iRxSize )
+{
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+   UINT16 iNumOctets;
+#endif
+
+   if( !SIM_SerialTransfer( (const UINT8*)pxTxDataBuffer, iTxSize,
+                            (UINT8*)pxRxDataBuffer, iRxSize ) )
+   {
+      return;
+   }
+
+#if ABCC_CFG_SERIAL_RX_STREAMING_CRC_ENABLED
+   /*
+   ** Report the pong in pieces, like a receive interrupt would.
+   */
+   for( iNumOctets = 8; iNumOctets < iRxSize; iNumOctets = (UINT16)( iNumOctets + 8 ) )
+   {
+      if( sys_pnSerPartialDataReceived != NULL )
+      {
+         sys_pnSerPartialDataReceived( iNumOctets );
+      }
+   }
+#endif
+
+   if( sys_pnSerDataReceived != NULL )
+   {
+      sys_pnSerDataReceived();
+   }
+}
+
+void ABCC_SYS_SerRestart( void )
+{
+}
+#endif /* ABCC_CFG_DRV_SERIAL_ENABLED */
+
+#if ABCC_CFG_DRV_PARALLEL_ENABLED
+void ABCC_SYS_ParallelRead( UINT16 iMemOffset, void* pxData, UINT16 iLength )
+{
+   SIM_ParallelRead( iMemOffset, pxData, iLength );
+}
+
+UINT16 ABCC_SYS_ParallelRead16( UINT16 iMemOffset )
+{
+   return( SIM_ParallelRead16( iMemOffset ) );
+}
+
+void ABCC_SYS_ParallelWrite( UINT16 iMemOffset, void* pxData, UINT16 iLength )
+{
+   SIM_ParallelWrite( iMemOffset, pxData, iLength );
+}
+
+void ABCC_SYS_ParallelWrite16( UINT16 iMemOffset, UINT16 iData )
+{
+   SIM_ParallelWrite16( iMemOffset, iData );
+}
+
+void* ABCC_SYS_ParallelGetRdPdBuffer( void )
+{
+   return( sys_abRdPd );
+}
+
+void* ABCC_SYS_ParallelGetWrPdBuffer( void )
+{
+   return( sys_abWrPd );
+}
+#endif /* ABCC_CFG_DRV_PARALLEL_ENABLED */
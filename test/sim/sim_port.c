@@ -0,0 +1,103 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Port functions of the host simulator build, see abcc_software_port.h.
+********************************************************************************
+*/
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+#include "abcc_types.h"
+#include "abcc_software_port.h"
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static pthread_mutex_t port_xCritical = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+/*
+** See SIM_PORT_SetPrintHook() and SIM_PORT_SetAtomicHook().
+*/
+static SIM_PORT_PrintHookType  port_pnPrintHook = NULL;
+static SIM_PORT_AtomicHookType port_pnAtomicHook = NULL;
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+void SIM_PORT_EnterCritical( void )
+{
+   (void)pthread_mutex_lock( &port_xCritical );
+}
+
+void SIM_PORT_ExitCritical( void )
+{
+   (void)pthread_mutex_unlock( &port_xCritical );
+}
+
+UINT32 SIM_PORT_GetTimestamp( void )
+{
+   struct timespec sNow;
+
+   (void)clock_gettime( CLOCK_MONOTONIC, &sNow );
+
+   return( (UINT32)( (UINT64)sNow.tv_sec * 1000000000ULL + (UINT64)sNow.tv_nsec ) );
+}
+
+void SIM_PORT_Printf( const char* pcFormat, ... )
+{
+   va_list argp;
+   char acText[ 256 ];
+
+   va_start( argp, pcFormat );
+   if( port_pnPrintHook == NULL )
+   {
+      (void)vprintf( pcFormat, argp );
+   }
+   else
+   {
+      (void)vsnprintf( acText, sizeof( acText ), pcFormat, argp );
+      (void)fputs( acText, stdout );
+      port_pnPrintHook( acText );
+   }
+   va_end( argp );
+}
+
+void SIM_PORT_SetPrintHook( SIM_PORT_PrintHookType pnHook )
+{
+   port_pnPrintHook = pnHook;
+}
+
+UINT8 SIM_PORT_AtomicExchange8( volatile UINT8* pbTarget, UINT8 bValue )
+{
+   UINT8 bPrevious;
+
+   bPrevious = __atomic_exchange_n( pbTarget, bValue, __ATOMIC_SEQ_CST );
+   if( port_pnAtomicHook != NULL )
+   {
+      port_pnAtomicHook( pbTarget, bValue );
+   }
+
+   return( bPrevious );
+}
+
+void SIM_PORT_SetAtomicHook( SIM_PORT_AtomicHookType pnHook )
+{
+   port_pnAtomicHook = pnHook;
+}
@@ -0,0 +1,225 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Bit copies of the AD object, CopyBitsInWord() and CopyBitRange(), against a
+** per-bit reference. All bits outside the copied range must be left
+** untouched.
+**
+** The functions are private, so the AD object is compiled into this program.
+** Its public functions then resolve here instead of in the driver library.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "../../src/host_objects/application_data_object.c"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_BUF_SIZE                  ( 160 )
+#define TEST_MAX_BITS                  ( 600 )
+#define TEST_NUM_RANDOM                ( 20000 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT8  test_abSrc[ TEST_BUF_SIZE ];
+static UINT8  test_abDest[ TEST_BUF_SIZE ];
+static UINT8  test_abExpected[ TEST_BUF_SIZE ];
+static UINT32 test_lSeed = 12345;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static UINT16 Random( void )
+{
+   test_lSeed = test_lSeed * 1103515245UL + 12345UL;
+   return( (UINT16)( test_lSeed >> 16 ) );
+}
+
+/*------------------------------------------------------------------------------
+** Fills source and destination with random octets and sets up the expected
+** destination one bit at a time. Bit n is bit n % 8 of octet n / 8.
+**------------------------------------------------------------------------------
+*/
+static void Prepare( UINT16 iDestBitOffset, UINT16 iSrcBitOffset,
+                     UINT16 iNumBits )
+{
+   UINT16 i;
+   UINT16 iSrcBit;
+   UINT16 iDestBit;
+
+   for( i = 0; i < TEST_BUF_SIZE; i++ )
+   {
+      test_abSrc[ i ] = (UINT8)Random();
+      test_abDest[ i ] = (UINT8)Random();
+   }
+   memcpy( test_abExpected, test_abDest, TEST_BUF_SIZE );
+
+   for( i = 0; i < iNumBits; i++ )
+   {
+      iSrcBit = iSrcBitOffset + i;
+      iDestBit = iDestBitOffset + i;
+      test_abExpected[ iDestBit >> 3 ] &= (UINT8)~( 1 << ( iDestBit & 7 ) );
+      test_abExpected[ iDestBit >> 3 ] |=
+         (UINT8)( ( ( test_abSrc[ iSrcBit >> 3 ] >> ( iSrcBit & 7 ) ) & 1 ) <<
+                  ( iDestBit & 7 ) );
+   }
+}
+
+static BOOL Verify( const char* pcFunc, UINT16 iDestBitOffset,
+                    UINT16 iSrcBitOffset, UINT16 iNumBits )
+{
+   if( memcmp( test_abDest, test_abExpected, TEST_BUF_SIZE ) != 0 )
+   {
+      printf( "%s: %u bits from bit %u to bit %u differ from the reference\n",
+              pcFunc, iNumBits, iSrcBitOffset, iDestBitOffset );
+      TEST_CHECK( FALSE );
+      return( FALSE );
+   }
+   return( TRUE );
+}
+
+/*------------------------------------------------------------------------------
+** CopyBitsInWord() for all bit offsets within a char and all field sizes it
+** accepts.
+**------------------------------------------------------------------------------
+*/
+static void TestCopyBitsInWord( void )
+{
+   UINT16 iDestBitOffset;
+   UINT16 iSrcBitOffset;
+   UINT16 iNumBits;
+
+   for( iDestBitOffset = 0; iDestBitOffset < AD_BITS_PER_CHAR; iDestBitOffset++ )
+   {
+      for( iSrcBitOffset = 0; iSrcBitOffset < AD_BITS_PER_CHAR; iSrcBitOffset++ )
+      {
+         for( iNumBits = 1; iNumBits <= AD_MAX_BIT_CHUNK; iNumBits++ )
+         {
+            Prepare( 24 + iDestBitOffset, 40 + iSrcBitOffset, iNumBits );
+            CopyBitsInWord( test_abDest, 3, iDestBitOffset,
+                            test_abSrc, 5, iSrcBitOffset, iNumBits );
+            if( !Verify( "CopyBitsInWord", 24 + iDestBitOffset,
+                         40 + iSrcBitOffset, iNumBits ) )
+            {
+               return;
+            }
+         }
+      }
+   }
+}
+
+/*------------------------------------------------------------------------------
+** CopyBitRange() for all offset pairs within 32 bits with sizes around the
+** chunk and word boundaries, and for random offsets and sizes.
+**------------------------------------------------------------------------------
+*/
+static void TestCopyBitRange( void )
+{
+   UINT16 iDestBitOffset;
+   UINT16 iSrcBitOffset;
+   UINT16 iNumBits;
+   UINT16 i;
+
+   for( iDestBitOffset = 0; iDestBitOffset < 32; iDestBitOffset++ )
+   {
+      for( iSrcBitOffset = 0; iSrcBitOffset < 32; iSrcBitOffset++ )
+      {
+         for( iNumBits = 0; iNumBits <= 130; iNumBits++ )
+         {
+            Prepare( iDestBitOffset, iSrcBitOffset, iNumBits );
+            CopyBitRange( test_abDest, iDestBitOffset,
+                          test_abSrc, iSrcBitOffset, iNumBits );
+            if( !Verify( "CopyBitRange", iDestBitOffset, iSrcBitOffset,
+                         iNumBits ) )
+            {
+               return;
+            }
+         }
+      }
+   }
+
+   for( i = 0; i < TEST_NUM_RANDOM; i++ )
+   {
+      iDestBitOffset = Random() % ( TEST_BUF_SIZE * 8 - TEST_MAX_BITS );
+      iSrcBitOffset = Random() % ( TEST_BUF_SIZE * 8 - TEST_MAX_BITS );
+      iNumBits = Random() % ( TEST_MAX_BITS + 1 );
+
+      Prepare( iDestBitOffset, iSrcBitOffset, iNumBits );
+      CopyBitRange( test_abDest, iDestBitOffset,
+                    test_abSrc, iSrcBitOffset, iNumBits );
+      if( !Verify( "CopyBitRange", iDestBitOffset, iSrcBitOffset, iNumBits ) )
+      {
+         return;
+      }
+   }
+}
+
+/*------------------------------------------------------------------------------
+** CopyBitData() of BOOL1 and BIT1-BIT7 arrays returns the size of the array
+** and copies it as one packed range.
+**------------------------------------------------------------------------------
+*/
+static void TestCopyBitData( void )
+{
+   UINT8  bDataType;
+   UINT16 iBitsPerElem;
+   UINT16 iNumElem;
+   UINT16 iDestBitOffset;
+   UINT16 iSrcBitOffset;
+
+   for( bDataType = ABP_BIT1; bDataType <= ABP_BIT7; bDataType++ )
+   {
+      iBitsPerElem = ( bDataType - ABP_BIT1 ) + 1;
+      for( iNumElem = 0; iNumElem <= 150; iNumElem += 7 )
+      {
+         iDestBitOffset = Random() % 64;
+         iSrcBitOffset = Random() % 64;
+
+         Prepare( iDestBitOffset, iSrcBitOffset, iBitsPerElem * iNumElem );
+         TEST_CHECK_EQ( CopyBitData( test_abDest, iDestBitOffset,
+                                     test_abSrc, iSrcBitOffset,
+                                     bDataType, iNumElem ),
+                        iBitsPerElem * iNumElem );
+         (void)Verify( "CopyBitData", iDestBitOffset, iSrcBitOffset,
+                       iBitsPerElem * iNumElem );
+      }
+   }
+
+   Prepare( 5, 11, 77 );
+   TEST_CHECK_EQ( CopyBitData( test_abDest, 5, test_abSrc, 11, ABP_BOOL1, 77 ),
+                  77 );
+   (void)Verify( "CopyBitData", 5, 11, 77 );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   TestCopyBitsInWord();
+   TestCopyBitRange();
+   TestCopyBitData();
+
+   return( TEST_Result() );
+}
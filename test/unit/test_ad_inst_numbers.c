@@ -0,0 +1,304 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Get_Instance_Numbers of the application data object, answered from the
+** ordinal lists (AD_ORDINAL_LIST_SIZE) or by a scan of the ADI list. Each
+** list type is read page by page, with several page sizes and starting
+** orders, and compared with the instances found by a scan of the ADI table
+** made here. The ADIs have varying descriptors (SIM_ADI_DESC_VARIED), so the
+** four lists differ.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "application_abcc_handler.h"
+#include "application_data_instance_config.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_NUM_LISTS                 ( 4 )
+#define TEST_MAX_NUM_ADI               ( SIM_NUM_ADI + 16 )
+#define TEST_MAX_PAGE                  ( ABCC_CFG_MAX_MSG_SIZE / ABP_UINT16_SIZEOF )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+/*
+** List type (command extension 1), descriptor bits of the ADIs in the list
+** (0 for all) and the object attribute with the number of ADIs in it.
+*/
+static const UINT8 test_abListType[ TEST_NUM_LISTS ] =
+{
+   ABP_APPD_LIST_TYPE_ALL,
+   ABP_APPD_LIST_TYPE_RD_PD_MAPPABLE,
+   ABP_APPD_LIST_TYPE_WR_PD_MAPPABLE,
+   ABP_APPD_LIST_TYPE_NVS_PARAMS
+};
+
+static const UINT8 test_abListDesc[ TEST_NUM_LISTS ] =
+{
+   0,
+   ABP_APPD_DESCR_MAPPABLE_READ_PD,
+   ABP_APPD_DESCR_MAPPABLE_WRITE_PD,
+   ABP_APPD_DESCR_NVS_PARAMETER
+};
+
+static const UINT8 test_abListCountAttr[ TEST_NUM_LISTS ] =
+{
+   ABP_OA_NUM_INST,
+   ABP_APPD_OA_NR_READ_PD_MAPPABLE_INSTANCES,
+   ABP_APPD_OA_NR_WRITE_PD_MAPPABLE_INSTANCES,
+   ABP_APPD_OA_NR_NV_INSTANCES
+};
+
+/*
+** Instance numbers of each list, found by a scan of the ADI table.
+*/
+static UINT16 test_aaiList[ TEST_NUM_LISTS ][ TEST_MAX_NUM_ADI ];
+static UINT16 test_aiNumInList[ TEST_NUM_LISTS ];
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static void ScanAdiTable( void )
+{
+   UINT16 iIndex;
+   UINT8 bList;
+
+   TEST_CHECK( APPL_GetNumAdi() <= TEST_MAX_NUM_ADI );
+
+   for( iIndex = 0; iIndex < APPL_GetNumAdi(); iIndex++ )
+   {
+      for( bList = 0; bList < TEST_NUM_LISTS; bList++ )
+      {
+         if( ( test_abListDesc[ bList ] == 0 ) ||
+             ( APPL_asAdiEntryList[ iIndex ].bDesc & test_abListDesc[ bList ] ) )
+         {
+            test_aaiList[ bList ][ test_aiNumInList[ bList ]++ ] =
+               APPL_asAdiEntryList[ iIndex ].iInstance;
+         }
+      }
+   }
+
+   /*
+   ** The lists must differ for the test to mean anything.
+   */
+   for( bList = 1; bList < TEST_NUM_LISTS; bList++ )
+   {
+      TEST_CHECK( test_aiNumInList[ bList ] > 0 );
+      TEST_CHECK( test_aiNumInList[ bList ] < test_aiNumInList[ 0 ] );
+   }
+}
+
+static void BuildObjCmd( ABP_MsgType* psMsg, UINT8 bCmd, UINT8 bCmdExt0, UINT8 bCmdExt1 )
+{
+   memset( &psMsg->sHeader, 0, sizeof( psMsg->sHeader ) );
+   psMsg->sHeader.bSourceId = 1;
+   psMsg->sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+   psMsg->sHeader.iInstance = ABP_INST_OBJ;
+   psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT | bCmd;
+   psMsg->sHeader.bCmdExt0 = bCmdExt0;
+   psMsg->sHeader.bCmdExt1 = bCmdExt1;
+}
+
+/*------------------------------------------------------------------------------
+** Sends Get_Instance_Numbers.
+**------------------------------------------------------------------------------
+** Arguments:
+**    bListType      - List type (command extension 1).
+**    iStartingOrder - Order number of the first instance, 1 based.
+**    iReqInstances  - Number of instances requested.
+**    piInstances    - Destination of the instance numbers.
+**    pbErrCode      - Error code of an error response, ABP_ERR_NO_ERROR if
+**                     none.
+**
+** Returns:
+**    Number of instances in the response.
+**------------------------------------------------------------------------------
+*/
+static UINT16 GetInstanceNumbers( UINT8 bListType, UINT16 iStartingOrder,
+                                  UINT16 iReqInstances, UINT16* piInstances,
+                                  UINT8* pbErrCode )
+{
+   ABP_MsgType sMsg;
+   UINT16 i;
+
+   BuildObjCmd( &sMsg, ABP_APPD_GET_INSTANCE_NUMBERS, 0, bListType );
+   sMsg.sHeader.iDataSize = 2 * ABP_UINT16_SIZEOF;
+   sMsg.abData[ 0 ] = (UINT8)iStartingOrder;
+   sMsg.abData[ 1 ] = (UINT8)( iStartingOrder >> 8 );
+   sMsg.abData[ 2 ] = (UINT8)iReqInstances;
+   sMsg.abData[ 3 ] = (UINT8)( iReqInstances >> 8 );
+
+   *pbErrCode = ABP_ERR_NO_ERROR;
+   if( SIM_APPL_Transact( &sMsg, 100 ) == 0 )
+   {
+      TEST_CHECK( FALSE );
+      *pbErrCode = ABP_ERR_GENERAL_ERROR;
+      return( 0 );
+   }
+
+   if( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT )
+   {
+      *pbErrCode = sMsg.abData[ 0 ];
+      return( 0 );
+   }
+
+   TEST_CHECK_EQ( sMsg.sHeader.iDataSize & 1, 0 );
+   for( i = 0; i < sMsg.sHeader.iDataSize / ABP_UINT16_SIZEOF; i++ )
+   {
+      piInstances[ i ] = (UINT16)( sMsg.abData[ 2 * i ] | ( sMsg.abData[ 2 * i + 1 ] << 8 ) );
+   }
+
+   return( (UINT16)( sMsg.sHeader.iDataSize / ABP_UINT16_SIZEOF ) );
+}
+
+static UINT16 GetObjAttr16( UINT8 bAttr )
+{
+   ABP_MsgType sMsg;
+
+   BuildObjCmd( &sMsg, ABP_CMD_GET_ATTR, bAttr, 0 );
+   TEST_CHECK( SIM_APPL_Transact( &sMsg, 100 ) != 0 );
+   TEST_CHECK( !( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) );
+   TEST_CHECK_EQ( sMsg.sHeader.iDataSize, ABP_UINT16_SIZEOF );
+
+   return( (UINT16)( sMsg.abData[ 0 ] | ( sMsg.abData[ 1 ] << 8 ) ) );
+}
+
+/*------------------------------------------------------------------------------
+** Reads a whole list, iPageSize instances at a time starting at
+** iStartingOrder, and compares it with the scan.
+**------------------------------------------------------------------------------
+*/
+static void CheckPages( UINT8 bList, UINT16 iStartingOrder, UINT16 iPageSize )
+{
+   UINT16 aiPage[ TEST_MAX_PAGE ];
+   UINT16 iNumExpected;
+   UINT16 iNum;
+   UINT8 bErrCode;
+
+   for( ; ; iStartingOrder += iPageSize )
+   {
+      iNumExpected = 0;
+      if( iStartingOrder <= test_aiNumInList[ bList ] )
+      {
+         iNumExpected = (UINT16)( test_aiNumInList[ bList ] - iStartingOrder + 1 );
+      }
+      if( iNumExpected > iPageSize )
+      {
+         iNumExpected = iPageSize;
+      }
+
+      iNum = GetInstanceNumbers( test_abListType[ bList ], iStartingOrder,
+                                 iPageSize, aiPage, &bErrCode );
+      TEST_CHECK_EQ( bErrCode, ABP_ERR_NO_ERROR );
+      TEST_CHECK_EQ( iNum, iNumExpected );
+      if( iNum == iNumExpected )
+      {
+         TEST_CHECK( memcmp( aiPage, &test_aaiList[ bList ][ iStartingOrder - 1 ],
+                             iNum * sizeof( UINT16 ) ) == 0 );
+      }
+
+      /*
+      ** Stop after the last page, full or not.
+      */
+      if( iNumExpected < iPageSize )
+      {
+         break;
+      }
+   }
+}
+
+static void CheckList( UINT8 bList )
+{
+   static const UINT16 aiPageSize[] = { 1, 2, 7, 50, TEST_MAX_PAGE };
+   UINT16 aiPage[ TEST_MAX_PAGE ];
+   UINT16 iNumInList;
+   UINT8 bErrCode;
+   UINT8 i;
+
+   iNumInList = test_aiNumInList[ bList ];
+   TEST_CHECK_EQ( GetObjAttr16( test_abListCountAttr[ bList ] ), iNumInList );
+
+   for( i = 0; i < sizeof( aiPageSize ) / sizeof( aiPageSize[ 0 ] ); i++ )
+   {
+      CheckPages( bList, 1, aiPageSize[ i ] );
+      CheckPages( bList, 3, aiPageSize[ i ] );
+   }
+
+   /*
+   ** The last instance alone, and past the end.
+   */
+   CheckPages( bList, iNumInList, 1 );
+   CheckPages( bList, iNumInList, TEST_MAX_PAGE );
+   CheckPages( bList, (UINT16)( iNumInList + 1 ), 1 );
+   CheckPages( bList, 0xFFFF, 1 );
+
+   /*
+   ** More than requested fit, but only the requested ones are returned. More
+   ** than fit in a message is refused if there are that many left.
+   */
+   if( iNumInList > TEST_MAX_PAGE )
+   {
+      (void)GetInstanceNumbers( test_abListType[ bList ], 1, TEST_MAX_PAGE + 1,
+                                aiPage, &bErrCode );
+      TEST_CHECK_EQ( bErrCode, ABP_ERR_OUT_OF_RANGE );
+   }
+   CheckPages( bList, (UINT16)( iNumInList > 5 ? iNumInList - 5 : 1 ), 0xFFFF );
+
+   (void)GetInstanceNumbers( test_abListType[ bList ], 0, 1, aiPage, &bErrCode );
+   TEST_CHECK_EQ( bErrCode, ABP_ERR_OUT_OF_RANGE );
+   (void)GetInstanceNumbers( test_abListType[ bList ], 1, 0, aiPage, &bErrCode );
+   TEST_CHECK_EQ( bErrCode, ABP_ERR_OUT_OF_RANGE );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   UINT16 aiPage[ 1 ];
+   UINT8 bErrCode;
+   UINT8 bList;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   ScanAdiTable();
+   for( bList = 0; bList < TEST_NUM_LISTS; bList++ )
+   {
+      CheckList( bList );
+   }
+
+   (void)GetInstanceNumbers( 0, 1, 1, aiPage, &bErrCode );
+   TEST_CHECK_EQ( bErrCode, ABP_ERR_INV_CMD_EXT_1 );
+   (void)GetInstanceNumbers( ABP_APPD_LIST_TYPE_NVS_PARAMS + 1, 1, 1, aiPage, &bErrCode );
+   TEST_CHECK_EQ( bErrCode, ABP_ERR_INV_CMD_EXT_1 );
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,327 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Segmented Get_Attribute of ADI values larger than a message
+** (AD_SEG_VALUE_ENABLE). The segments are put together and compared octet by
+** octet with the value packed here from the ADI storage. Run with LSB first
+** network data, where UINT16 arrays are sent straight from the storage, and
+** with MSB first, where they are swapped AD_SEG_GET_BLOCK_SIZE octets at a
+** time. Bit type and structured ADIs are converted block by block in both.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "application_abcc_handler.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_MAX_VALUE_SIZE            ( 512 )
+#define TEST_MAX_SEGMENTS              ( 64 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT32 test_lSeed = 12345;
+static BOOL   test_fMsbFirst;
+
+/*
+** Value packed here and the value put together from the segments.
+*/
+static UINT8  test_abExpected[ TEST_MAX_VALUE_SIZE ];
+static UINT32 test_lExpectedBits;
+static UINT8  test_abValue[ TEST_MAX_VALUE_SIZE ];
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static UINT8 Random( void )
+{
+   test_lSeed = test_lSeed * 1103515245UL + 12345UL;
+   return( (UINT8)( test_lSeed >> 16 ) );
+}
+
+static void FillRandom( void* pxData, UINT16 iSize )
+{
+   UINT16 i;
+
+   for( i = 0; i < iSize; i++ )
+   {
+      ( (UINT8*)pxData )[ i ] = Random();
+   }
+}
+
+/*
+** Bit n of a bit packed buffer is bit n % 8 of octet n / 8.
+*/
+static UINT32 GetBits( const UINT8* pbSrc, UINT16 iBitOffset, UINT8 bNumBits )
+{
+   UINT32 lValue;
+   UINT8 i;
+
+   lValue = 0;
+   for( i = 0; i < bNumBits; i++ )
+   {
+      if( pbSrc[ ( iBitOffset + i ) >> 3 ] & ( 1 << ( ( iBitOffset + i ) & 7 ) ) )
+      {
+         lValue |= 1UL << i;
+      }
+   }
+
+   return( lValue );
+}
+
+static void PutBits( UINT32 lValue, UINT8 bNumBits )
+{
+   UINT8 i;
+
+   for( i = 0; i < bNumBits; i++ )
+   {
+      if( lValue & ( 1UL << i ) )
+      {
+         test_abExpected[ test_lExpectedBits >> 3 ] |=
+            (UINT8)( 1 << ( test_lExpectedBits & 7 ) );
+      }
+      test_lExpectedBits++;
+   }
+}
+
+/*
+** Octet aligned value of bSize octets in network order.
+*/
+static void PutValue( UINT32 lValue, UINT8 bSize )
+{
+   UINT8 i;
+
+   TEST_CHECK( ( test_lExpectedBits & 7 ) == 0 );
+
+   for( i = 0; i < bSize; i++ )
+   {
+      test_abExpected[ ( test_lExpectedBits >> 3 ) +
+                       ( test_fMsbFirst ? bSize - 1 - i : i ) ] =
+         (UINT8)( lValue >> ( i * 8 ) );
+   }
+   test_lExpectedBits += bSize * 8;
+}
+
+static void StartExpected( void )
+{
+   memset( test_abExpected, 0, sizeof( test_abExpected ) );
+   test_lExpectedBits = 0;
+}
+
+/*------------------------------------------------------------------------------
+** Gets the value of an ADI with a segmented Get_Attribute into test_abValue.
+** Every segment but the last must be full, the first one flagged
+** SEG_FIRST and only the last one SEG_LAST.
+**------------------------------------------------------------------------------
+** Returns:
+**    Size of the value, 0 on error.
+**------------------------------------------------------------------------------
+*/
+static UINT16 GetSegmented( UINT16 iInstance, UINT16* piNumSegments )
+{
+   ABP_MsgType sMsg;
+   UINT16 iSize;
+   UINT16 iSegSize;
+   UINT16 iSegment;
+   UINT8 bCmdExt1;
+
+   iSize = 0;
+   bCmdExt1 = 0;
+
+   for( iSegment = 0; iSegment < TEST_MAX_SEGMENTS; iSegment++ )
+   {
+      /*
+      ** The request is repeated as is to acknowledge each segment.
+      */
+      memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+      sMsg.sHeader.bSourceId = 1;
+      sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+      sMsg.sHeader.iInstance = iInstance;
+      sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+      sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+
+      if( SIM_APPL_Transact( &sMsg, 100 ) == 0 )
+      {
+         TEST_CHECK( FALSE );
+         return( 0 );
+      }
+
+      if( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT )
+      {
+         TEST_CHECK_EQ( sMsg.abData[ 0 ], ABP_ERR_NO_ERROR );
+         return( 0 );
+      }
+
+      iSegSize = sMsg.sHeader.iDataSize;
+      bCmdExt1 = sMsg.sHeader.bCmdExt1;
+
+      TEST_CHECK_EQ( bCmdExt1 & ABP_MSG_CMDEXT1_SEG_FIRST,
+                     iSegment == 0 ? ABP_MSG_CMDEXT1_SEG_FIRST : 0 );
+      TEST_CHECK( iSegSize <= ABCC_CFG_MAX_MSG_SIZE );
+      TEST_CHECK( ( bCmdExt1 & ABP_MSG_CMDEXT1_SEG_LAST ) ||
+                  ( iSegSize == ABCC_CFG_MAX_MSG_SIZE ) );
+
+      if( ( iSize + iSegSize ) > TEST_MAX_VALUE_SIZE )
+      {
+         TEST_CHECK( FALSE );
+         return( 0 );
+      }
+      memcpy( &test_abValue[ iSize ], sMsg.abData, iSegSize );
+      iSize += iSegSize;
+
+      if( bCmdExt1 & ABP_MSG_CMDEXT1_SEG_LAST )
+      {
+         *piNumSegments = iSegment + 1;
+         return( iSize );
+      }
+   }
+
+   TEST_CHECK( FALSE );
+   return( 0 );
+}
+
+/*------------------------------------------------------------------------------
+** Gets the value of an ADI and compares it with test_abExpected.
+**------------------------------------------------------------------------------
+*/
+static void CheckAdi( UINT16 iInstance )
+{
+   UINT16 iSize;
+   UINT16 iExpectedSize;
+   UINT16 iNumSegments;
+
+   iExpectedSize = (UINT16)( ( test_lExpectedBits + 7 ) >> 3 );
+   iNumSegments = 0;
+   iSize = GetSegmented( iInstance, &iNumSegments );
+
+   TEST_CHECK_EQ( iSize, iExpectedSize );
+   TEST_CHECK_EQ( iNumSegments, ( iExpectedSize + ABCC_CFG_MAX_MSG_SIZE - 1 ) /
+                                ABCC_CFG_MAX_MSG_SIZE );
+   if( iSize == iExpectedSize )
+   {
+      TEST_CHECK( memcmp( test_abValue, test_abExpected, iSize ) == 0 );
+   }
+}
+
+static void CheckLarge16( void )
+{
+   UINT16 i;
+
+   FillRandom( SIM_aiLarge16, sizeof( SIM_aiLarge16 ) );
+
+   StartExpected();
+   for( i = 0; i < 200; i++ )
+   {
+      PutValue( SIM_aiLarge16[ i ], ABP_UINT16_SIZEOF );
+   }
+   CheckAdi( SIM_ADI_INST_LARGE16 );
+}
+
+static void CheckLargeBits( void )
+{
+   UINT16 i;
+
+   FillRandom( SIM_abLargeBits, sizeof( SIM_abLargeBits ) );
+
+   StartExpected();
+   for( i = 0; i < 255; i++ )
+   {
+      PutBits( GetBits( SIM_abLargeBits, i * 7, 7 ), 7 );
+   }
+   CheckAdi( SIM_ADI_INST_LARGE_BITS );
+}
+
+#if ABCC_CFG_STRUCT_DATA_TYPE_ENABLED
+static void CheckStruct( void )
+{
+   UINT16 i;
+
+   FillRandom( &SIM_sStruct, sizeof( SIM_sStruct ) );
+
+   StartExpected();
+   PutBits( GetBits( SIM_sStruct.abBits, 0, 5 ), 5 );
+   PutBits( GetBits( SIM_sStruct.abBits, 5, 4 ), 4 );
+   PutBits( 0, 7 );
+   for( i = 0; i < 16; i++ )
+   {
+      PutValue( SIM_sStruct.aiWords[ i ], ABP_UINT16_SIZEOF );
+   }
+   for( i = 0; i < 10; i++ )
+   {
+      PutBits( GetBits( SIM_sStruct.abBits3, i * 3, 3 ), 3 );
+   }
+   PutBits( 0, 2 );
+   for( i = 0; i < 8; i++ )
+   {
+      PutValue( SIM_sStruct.alLongs[ i ], ABP_UINT32_SIZEOF );
+   }
+   for( i = 0; i < 12; i++ )
+   {
+      PutBits( GetBits( SIM_sStruct.abBools, i, 1 ), 1 );
+   }
+   PutBits( 0, 4 );
+   for( i = 0; i < 20; i++ )
+   {
+      PutValue( SIM_sStruct.abOctets[ i ], ABP_UINT8_SIZEOF );
+   }
+   CheckAdi( SIM_ADI_INST_STRUCT );
+}
+#endif
+
+static void CheckAll( void )
+{
+   /*
+   ** Twice, so that the second time starts after a completed session and
+   ** blocks left from other ADIs.
+   */
+   CheckLarge16();
+   CheckLargeBits();
+#if ABCC_CFG_STRUCT_DATA_TYPE_ENABLED
+   CheckStruct();
+   CheckStruct();
+#endif
+   CheckLargeBits();
+   CheckLarge16();
+}
+
+int main( void )
+{
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+
+   test_fMsbFirst = FALSE;
+   TEST_CHECK( SIM_APPL_Start() );
+   CheckAll();
+
+   test_fMsbFirst = TRUE;
+   SIM_SetNetwork( ABP_NW_TYPE_ECT, ABP_NW_DATA_FORMAT_MSB_FIRST );
+   APPL_RestartAbcc();
+   (void)SIM_APPL_RunCycle();
+   TEST_CHECK( SIM_APPL_Start() );
+   CheckAll();
+
+   return( TEST_Result() );
+}
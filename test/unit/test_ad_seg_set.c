@@ -0,0 +1,93 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Segmented Set_Attribute of an ADI value (AD_SEG_SET_BUFFER_SIZE): an
+** abandoned segmented request does not swallow later unsegmented requests.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "test_util.h"
+
+/*
+** An ADI that is not mapped, so that process data does not overwrite it.
+*/
+#define TEST_ADI                       ( SIM_NUM_ADI - 1 )
+
+/*
+** Sends a Set_Attribute of the TEST_ADI value with iSize octets of bFill and
+** returns the error code of the response, ABP_ERR_NO_ERROR if none.
+*/
+static UINT8 SetAdi( UINT8 bCmdExt1, UINT16 iSize, UINT8 bFill )
+{
+   ABP_MsgType sMsg;
+
+   memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+   sMsg.sHeader.bSourceId = 1;
+   sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+   sMsg.sHeader.iInstance = SIM_ADI_INST( TEST_ADI );
+   sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_SET_ATTR;
+   sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+   sMsg.sHeader.bCmdExt1 = bCmdExt1;
+   sMsg.sHeader.iDataSize = iSize;
+   memset( sMsg.abData, bFill, iSize );
+
+   TEST_CHECK( SIM_APPL_Transact( &sMsg, 100 ) != 0 );
+
+   if( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT )
+   {
+      return( sMsg.abData[ 0 ] );
+   }
+
+   return( ABP_ERR_NO_ERROR );
+}
+
+int main( void )
+{
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   /*
+   ** Complete segmented request.
+   */
+   TEST_CHECK_EQ( SetAdi( ABP_MSG_CMDEXT1_SEG_FIRST, 1, 0x11 ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( SIM_aiAdi[ TEST_ADI ], 0 );
+   TEST_CHECK_EQ( SetAdi( ABP_MSG_CMDEXT1_SEG_LAST, 1, 0x11 ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( SIM_aiAdi[ TEST_ADI ], 0x1111 );
+
+   /*
+   ** Abandoned after the first segment, followed by an unsegmented request
+   ** that cannot be a segment of it.
+   */
+   TEST_CHECK_EQ( SetAdi( ABP_MSG_CMDEXT1_SEG_FIRST, 1, 0x22 ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( SetAdi( 0, 2, 0x33 ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( SIM_aiAdi[ TEST_ADI ], 0x3333 );
+
+#if ABCC_CFG_SEG_SESSION_TMO_MS > 0
+   /*
+   ** Abandoned after an empty first segment. The next unsegmented request
+   ** fits as a segment and is only taken as unsegmented after the timeout.
+   */
+   TEST_CHECK_EQ( SetAdi( ABP_MSG_CMDEXT1_SEG_FIRST, 0, 0 ), ABP_ERR_NO_ERROR );
+   ABCC_RunTimerSystem( ABCC_CFG_SEG_SESSION_TMO_MS );
+   TEST_CHECK_EQ( SetAdi( 0, 2, 0x44 ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( SIM_aiAdi[ TEST_ADI ], 0x4444 );
+#endif
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,408 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** BACnet advanced mapping lookups (BAC_ADV_MAPPING_INDEX_SIZE and
+** BAC_ADV_MAPPING_BITMAP_TYPES). Get_ADI_By_BACnet_Object_Instance,
+** Get_ADI_By_BACnet_Object_Instance_Name, Get_All_BACnet_Object_Instances and
+** Get_BACnet_Object_Instance_By_ADI responses are compared with a linear scan
+** of the ADI list and BAC_asObjectList, for keys found once, several times
+** (the first entry wins) and not at all.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abp_bac.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "abcc_object_config.h"
+#include "bacnet_object.h"
+#include "application_data_instance_config.h"
+#include "sim_application.h"
+#include "application_abcc_handler.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_MAX_INSTANCE              ( 2040 )
+#define TEST_NAME_LENGTH_MAX           ( 252 )
+#define TEST_BITMAP_SIZE               ( 255 )
+
+/*
+** Object types 0..TEST_NUM_TYPES-1 and 0xFFFF are requested, with instance
+** numbers 0..TEST_NUM_LOW-1 and test_alHighInstance. Most types are not in
+** the object list at all, but some of them share hash table probe sequences
+** with objects of the same instance number and another type.
+*/
+#define TEST_NUM_TYPES                 ( 256 )
+#define TEST_NUM_LOW                   ( 52 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+
+static const UINT32 test_alHighInstance[] =
+{
+   TEST_MAX_INSTANCE - 1,
+   TEST_MAX_INSTANCE,
+   TEST_MAX_INSTANCE + 11,
+   0x00010000UL,
+   0xFFFFFFFFUL
+};
+
+/*
+** Names not in the ADI list, besides the ones that are.
+*/
+static const char* const test_apcOtherName[] =
+{
+   "adi",
+   "Ad",
+   "Adi ",
+   "Array1",
+   "Array160",
+   "X"
+};
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static void SendObjCmd( ABP_MsgType* psMsg, UINT8 bCmd, UINT16 iDataSize )
+{
+   psMsg->sHeader.bSourceId = 1;
+   psMsg->sHeader.bDestObj = ABP_OBJ_NUM_BAC;
+   psMsg->sHeader.iInstance = iTOiLe( ABP_INST_OBJ );
+   psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT | bCmd;
+   psMsg->sHeader.bCmdExt0 = 0;
+   psMsg->sHeader.bCmdExt1 = 0;
+   psMsg->sHeader.iDataSize = iTOiLe( iDataSize );
+
+   TEST_CHECK( SIM_APPL_Transact( psMsg, 100 ) != 0 );
+}
+
+static BOOL IsError( const ABP_MsgType* psMsg, UINT8 bErr )
+{
+   return( ( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) &&
+           ( iLeTOi( psMsg->sHeader.iDataSize ) >= 1 ) &&
+           ( psMsg->abData[ 0 ] == bErr ) );
+}
+
+static BOOL IsResponse( const ABP_MsgType* psMsg, UINT16 iDataSize )
+{
+   return( !( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) &&
+           ( iLeTOi( psMsg->sHeader.iDataSize ) == iDataSize ) );
+}
+
+static UINT16 GetData16( const ABP_MsgType* psMsg, UINT16 iOffset )
+{
+   return( (UINT16)( psMsg->abData[ iOffset ] |
+                     ( psMsg->abData[ iOffset + 1 ] << 8 ) ) );
+}
+
+static UINT32 GetData32( const ABP_MsgType* psMsg, UINT16 iOffset )
+{
+   return( (UINT32)GetData16( psMsg, iOffset ) |
+           ( (UINT32)GetData16( psMsg, (UINT16)( iOffset + 2 ) ) << 16 ) );
+}
+
+/*------------------------------------------------------------------------------
+** Linear scans, returning the first matching list index or
+** ABCC_ADI_INDEX_NOT_FOUND.
+**------------------------------------------------------------------------------
+*/
+static UINT16 ScanObjInst( UINT16 iObjType, UINT32 lInstance )
+{
+   UINT16 i;
+
+   if( lInstance >= TEST_MAX_INSTANCE )
+   {
+      return( ABCC_ADI_INDEX_NOT_FOUND );
+   }
+
+   for( i = 0; i < APPL_GetNumAdi(); i++ )
+   {
+      if( ( BAC_asObjectList[ i ].iObjType == iObjType ) &&
+          ( BAC_asObjectList[ i ].lInstance == lInstance ) )
+      {
+         return( i );
+      }
+   }
+
+   return( ABCC_ADI_INDEX_NOT_FOUND );
+}
+
+static UINT16 ScanName( const char* pcName )
+{
+   UINT16 i;
+
+   for( i = 0; i < APPL_GetNumAdi(); i++ )
+   {
+      if( ( APPL_asAdiEntryList[ i ].pacName != NULL ) &&
+          ( strcmp( APPL_asAdiEntryList[ i ].pacName, pcName ) == 0 ) )
+      {
+         return( i );
+      }
+   }
+
+   return( ABCC_ADI_INDEX_NOT_FOUND );
+}
+
+/*
+** ADI numbers from the number of ADIs and on are not looked up at all.
+*/
+static UINT16 ScanAdi( UINT16 iAdi )
+{
+   UINT16 i;
+
+   if( iAdi >= APPL_GetNumAdi() )
+   {
+      return( ABCC_ADI_INDEX_NOT_FOUND );
+   }
+
+   for( i = 0; i < APPL_GetNumAdi(); i++ )
+   {
+      if( APPL_asAdiEntryList[ i ].iInstance == iAdi )
+      {
+         return( i );
+      }
+   }
+
+   return( ABCC_ADI_INDEX_NOT_FOUND );
+}
+
+/*------------------------------------------------------------------------------
+** Get_ADI_By_BACnet_Object_Instance of one object type and instance.
+**------------------------------------------------------------------------------
+*/
+static void CheckObjInst( UINT16 iObjType, UINT32 lInstance )
+{
+   ABP_MsgType sMsg;
+   UINT16 iIndex;
+
+   ABCC_SetMsgData16( &sMsg, iObjType, 0 );
+   ABCC_SetMsgData32( &sMsg, lInstance, 2 );
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST,
+               ABP_UINT16_SIZEOF + ABP_UINT32_SIZEOF );
+
+   iIndex = ScanObjInst( iObjType, lInstance );
+   if( iIndex == ABCC_ADI_INDEX_NOT_FOUND )
+   {
+      TEST_CHECK( IsError( &sMsg, ABP_ERR_OUT_OF_RANGE ) );
+   }
+   else
+   {
+      TEST_CHECK( IsResponse( &sMsg, ABP_UINT16_SIZEOF ) );
+      TEST_CHECK_EQ( GetData16( &sMsg, 0 ), APPL_asAdiEntryList[ iIndex ].iInstance );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Get_ADI_By_BACnet_Object_Instance_Name of a name found or not found.
+**------------------------------------------------------------------------------
+*/
+static void CheckName( const char* pcName )
+{
+   ABP_MsgType sMsg;
+   UINT16 iLength;
+   UINT16 iIndex;
+
+   iLength = (UINT16)strlen( pcName );
+   memcpy( sMsg.abData, pcName, iLength );
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST_NAME, iLength );
+
+   iIndex = ScanName( pcName );
+   if( iIndex == ABCC_ADI_INDEX_NOT_FOUND )
+   {
+      TEST_CHECK( IsError( &sMsg, ABP_ERR_OUT_OF_RANGE ) );
+   }
+   else
+   {
+      TEST_CHECK( IsResponse( &sMsg, ABP_UINT16_SIZEOF * 2 + ABP_UINT32_SIZEOF ) );
+      TEST_CHECK_EQ( GetData16( &sMsg, 0 ), APPL_asAdiEntryList[ iIndex ].iInstance );
+      TEST_CHECK_EQ( GetData16( &sMsg, 2 ), BAC_asObjectList[ iIndex ].iObjType );
+      TEST_CHECK_EQ( GetData32( &sMsg, 4 ), BAC_asObjectList[ iIndex ].lInstance );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Get_BACnet_Object_Instance_By_ADI of one ADI number.
+**------------------------------------------------------------------------------
+*/
+static void CheckAdi( UINT16 iAdi )
+{
+   ABP_MsgType sMsg;
+   UINT16 iIndex;
+
+   ABCC_SetMsgData16( &sMsg, iAdi, 0 );
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_BACNET_OBJ_INST_BY_ADI, ABP_UINT16_SIZEOF );
+
+   iIndex = ScanAdi( iAdi );
+   if( iIndex == ABCC_ADI_INDEX_NOT_FOUND )
+   {
+      TEST_CHECK( IsError( &sMsg, ABP_ERR_OUT_OF_RANGE ) );
+   }
+   else
+   {
+      TEST_CHECK( IsResponse( &sMsg, ABP_UINT16_SIZEOF + ABP_UINT32_SIZEOF ) );
+      TEST_CHECK_EQ( GetData16( &sMsg, 0 ), BAC_asObjectList[ iIndex ].iObjType );
+      TEST_CHECK_EQ( GetData32( &sMsg, 2 ), BAC_asObjectList[ iIndex ].lInstance );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Get_All_BACnet_Object_Instances of one object type.
+**------------------------------------------------------------------------------
+*/
+static void CheckAllInstances( UINT16 iObjType )
+{
+   ABP_MsgType sMsg;
+   UINT8 abExpected[ TEST_BITMAP_SIZE ];
+   UINT32 lInstance;
+   UINT16 i;
+
+   memset( abExpected, 0, sizeof( abExpected ) );
+   for( i = 0; i < APPL_GetNumAdi(); i++ )
+   {
+      lInstance = BAC_asObjectList[ i ].lInstance;
+      if( ( BAC_asObjectList[ i ].iObjType == iObjType ) &&
+          ( lInstance < TEST_MAX_INSTANCE ) )
+      {
+         abExpected[ lInstance >> 3 ] |= (UINT8)( 1 << ( lInstance & 7 ) );
+      }
+   }
+
+   /*
+   ** Leftovers of an earlier response must not show.
+   */
+   memset( sMsg.abData, 0xFF, TEST_BITMAP_SIZE );
+   ABCC_SetMsgData16( &sMsg, iObjType, 0 );
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_ALL_BACNET_OBJ_INSTANCES, ABP_UINT16_SIZEOF );
+
+   TEST_CHECK( IsResponse( &sMsg, TEST_BITMAP_SIZE ) );
+   TEST_CHECK( memcmp( sMsg.abData, abExpected, TEST_BITMAP_SIZE ) == 0 );
+}
+
+/*------------------------------------------------------------------------------
+** Name requests rejected before any lookup.
+**------------------------------------------------------------------------------
+*/
+static void CheckBadNames( void )
+{
+   ABP_MsgType sMsg;
+
+   memset( sMsg.abData, 'A', TEST_NAME_LENGTH_MAX + 1 );
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST_NAME,
+               TEST_NAME_LENGTH_MAX );
+   TEST_CHECK( IsError( &sMsg, ABP_ERR_OUT_OF_RANGE ) );
+
+   memset( sMsg.abData, 'A', TEST_NAME_LENGTH_MAX + 1 );
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST_NAME,
+               TEST_NAME_LENGTH_MAX + 1 );
+   TEST_CHECK( IsError( &sMsg, ABP_ERR_TOO_MUCH_DATA ) );
+
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST_NAME, 0 );
+   TEST_CHECK( IsError( &sMsg, ABP_ERR_NOT_ENOUGH_DATA ) );
+
+   memcpy( sMsg.abData, "\0Adi", 4 );
+   SendObjCmd( &sMsg, ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST_NAME, 4 );
+   TEST_CHECK( IsError( &sMsg, ABP_ERR_NOT_ENOUGH_DATA ) );
+}
+
+static void CheckAll( void )
+{
+   UINT32 lInstance;
+   UINT16 iObjType;
+   UINT16 iType;
+   UINT16 i;
+
+   for( iType = 0; iType <= TEST_NUM_TYPES; iType++ )
+   {
+      iObjType = ( iType < TEST_NUM_TYPES ) ? iType : 0xFFFF;
+
+      for( lInstance = 0; lInstance < TEST_NUM_LOW; lInstance++ )
+      {
+         CheckObjInst( iObjType, lInstance );
+      }
+      for( i = 0; i < sizeof( test_alHighInstance ) / sizeof( test_alHighInstance[ 0 ] ); i++ )
+      {
+         CheckObjInst( iObjType, test_alHighInstance[ i ] );
+      }
+
+      CheckAllInstances( iObjType );
+   }
+
+   /*
+   ** Every ADI name, most of them the same, and some that are not there.
+   */
+   for( i = 0; i < APPL_GetNumAdi(); i++ )
+   {
+      if( ( APPL_asAdiEntryList[ i ].pacName != NULL ) &&
+          ( APPL_asAdiEntryList[ i ].pacName[ 0 ] != 0 ) &&
+          ( ScanName( APPL_asAdiEntryList[ i ].pacName ) == i ) )
+      {
+         CheckName( APPL_asAdiEntryList[ i ].pacName );
+      }
+   }
+   for( i = 0; i < sizeof( test_apcOtherName ) / sizeof( test_apcOtherName[ 0 ] ); i++ )
+   {
+      CheckName( test_apcOtherName[ i ] );
+   }
+   CheckBadNames();
+
+   /*
+   ** Every ADI number, with and without an ADI, and the named ADIs.
+   */
+   for( i = 0; i <= APPL_GetNumAdi() + 2; i++ )
+   {
+      CheckAdi( i );
+   }
+   for( i = 0; i < APPL_GetNumAdi(); i++ )
+   {
+      if( APPL_asAdiEntryList[ i ].iInstance > APPL_GetNumAdi() )
+      {
+         CheckAdi( APPL_asAdiEntryList[ i ].iInstance );
+      }
+   }
+   CheckAdi( 0xFFFF );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   CheckAll();
+
+   /*
+   ** The index is built again after a restart.
+   */
+   APPL_RestartAbcc();
+   (void)SIM_APPL_RunCycle();
+   TEST_CHECK( SIM_APPL_Start() );
+
+   CheckAll();
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Command sequence response timeouts (ABCC_CFG_CMD_SEQ_RESP_TMO_MS) during the
+** setup: the module answers the first Map_ADI_Read_Ext commands too late.
+** The setup must end without mapping any ADI twice, i.e. the map commands the
+** module has already executed must not be sent again. The variant has enough
+** command resources for them to be sent again if the step allowed it.
+********************************************************************************
+*/
+
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "test_util.h"
+
+/*
+** Map responses are delayed by many times the response timeout (one cycle is
+** one frame and one millisecond).
+*/
+#define TEST_MAP_RESP_DELAY            ( 10 * ABCC_CFG_CMD_SEQ_RESP_TMO_MS )
+
+int main( void )
+{
+   UINT16 iCycle;
+
+   SIM_SetRespDelay( ABP_OBJ_NUM_NW, ABP_NW_CMD_MAP_ADI_READ_EXT_AREA,
+                     TEST_MAP_RESP_DELAY );
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( !SIM_APPL_Start() );
+
+   /*
+   ** Let the late responses arrive.
+   */
+   for( iCycle = 0; iCycle < 2 * TEST_MAP_RESP_DELAY; iCycle++ )
+   {
+      (void)SIM_APPL_RunCycle();
+   }
+
+   TEST_CHECK_EQ( SIM_GetStats()->lNumMapDuplicates, 0 );
+   TEST_CHECK_EQ( SIM_GetAnbState(), ABP_ANB_STATE_SETUP );
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Endian swapping copies of 16, 32 and 64 bit values are byte exact against a
+** per-octet reference, for all source and destination offsets within a 16
+** octet block and element counts crossing several blocks. The octets around
+** the destination must be left untouched.
+**
+** The program is built once per kernel of abcc_copy.c (see test/CMakeLists.txt)
+** and prints which one it tests.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abcc.h"
+#include "abcc_port.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_MAX_OFFSET                ( 16 )
+#define TEST_MAX_OCTETS                ( 200 )
+#define TEST_GUARD                     ( 0xA5 )
+#define TEST_BUF_SIZE                  ( TEST_MAX_OFFSET + TEST_MAX_OCTETS + 16 )
+
+#if defined( __SSSE3__ )
+#define TEST_KERNEL                    "SSSE3"
+#elif defined( __SSE2__ )
+#define TEST_KERNEL                    "SSE2"
+#elif defined( __ARM_NEON )
+#define TEST_KERNEL                    "NEON"
+#else
+#define TEST_KERNEL                    "scalar"
+#endif
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+typedef void (*test_CopyFuncType)( void* pxDest, UINT16 iDestOctetOffset,
+                                   const void* pxSrc, UINT16 iSrcOctetOffset,
+                                   UINT16 iNumElem );
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT8 test_abSrc[ TEST_BUF_SIZE ];
+static UINT8 test_abDest[ TEST_BUF_SIZE ];
+static UINT8 test_abExpected[ TEST_BUF_SIZE ];
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Copies with one kernel for every offset pair and element count up to
+** TEST_MAX_OCTETS and compares the whole destination buffer to the
+** reference. Reports the first mismatch of each element count only.
+**------------------------------------------------------------------------------
+*/
+static void TestCopy( test_CopyFuncType pnCopy, UINT8 bElemSize )
+{
+   UINT16 iSrcOffset;
+   UINT16 iDestOffset;
+   UINT16 iNumElem;
+   UINT16 iElem;
+   UINT16 i;
+   UINT8  b;
+
+   for( iNumElem = 0; iNumElem <= TEST_MAX_OCTETS / bElemSize; iNumElem++ )
+   {
+      for( iSrcOffset = 0; iSrcOffset < TEST_MAX_OFFSET; iSrcOffset++ )
+      {
+         for( iDestOffset = 0; iDestOffset < TEST_MAX_OFFSET; iDestOffset++ )
+         {
+            memset( test_abDest, TEST_GUARD, sizeof( test_abDest ) );
+            memset( test_abExpected, TEST_GUARD, sizeof( test_abExpected ) );
+
+            for( iElem = 0; iElem < iNumElem; iElem++ )
+            {
+               for( b = 0; b < bElemSize; b++ )
+               {
+                  test_abExpected[ iDestOffset + iElem * bElemSize + b ] =
+                     test_abSrc[ iSrcOffset + iElem * bElemSize + bElemSize - 1 - b ];
+               }
+            }
+
+            pnCopy( test_abDest, iDestOffset, test_abSrc, iSrcOffset, iNumElem );
+
+            for( i = 0; i < TEST_BUF_SIZE; i++ )
+            {
+               if( test_abDest[ i ] != test_abExpected[ i ] )
+               {
+                  break;
+               }
+            }
+
+            if( i < TEST_BUF_SIZE )
+            {
+               printf( "%u bit, %u elements, src offset %u, dest offset %u: "
+                       "octet %u is 0x%02x, expected 0x%02x\n",
+                       bElemSize * 8, iNumElem, iSrcOffset, iDestOffset, i,
+                       test_abDest[ i ], test_abExpected[ i ] );
+               TEST_CHECK( i == TEST_BUF_SIZE );
+               iSrcOffset = TEST_MAX_OFFSET;
+               break;
+            }
+         }
+      }
+   }
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   UINT16 i;
+
+   printf( "Kernel: %s\n", TEST_KERNEL );
+
+   /*
+   ** Distinct octets, so any misplaced octet shows.
+   */
+   for( i = 0; i < TEST_BUF_SIZE; i++ )
+   {
+      test_abSrc[ i ] = (UINT8)( i * 7 + 1 );
+   }
+
+   TestCopy( ABCC_PORT_Copy16WithEndianSwap, 2 );
+   TestCopy( ABCC_PORT_Copy32WithEndianSwap, 4 );
+#if ( ABCC_CFG_64BIT_ADI_SUPPORT_ENABLED || ABCC_CFG_DOUBLE_ADI_SUPPORT_ENABLED )
+   TestCopy( ABCC_PORT_Copy64WithEndianSwap, 8 );
+#endif
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Serial telegram CRC16: CRC_Crc16() and the streaming functions against a
+** bitwise calculation, for random telegrams of 0-600 octets fed in random
+** parts as the receive progress callback would.
+**
+** The program is built once per table layout of abcc_crc16.c (see
+** test/CMakeLists.txt). The ABCC_SYS_16_BIT_CHAR build only selects the
+** single word table, the data is still one octet per char.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "serial/abcc_crc16.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_MAX_OCTETS                ( 600 )
+#define TEST_NUM_TELEGRAMS             ( 2000 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT8  test_abTelegram[ TEST_MAX_OCTETS ];
+static UINT32 test_lSeed = 12345;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static UINT16 Random( void )
+{
+   test_lSeed = test_lSeed * 1103515245UL + 12345UL;
+   return( (UINT16)( test_lSeed >> 16 ) );
+}
+
+/*------------------------------------------------------------------------------
+** CRC-16/MODBUS one bit at a time: reflected polynomial 0xA001, initial value
+** 0xFFFF and no final XOR.
+**------------------------------------------------------------------------------
+*/
+static UINT16 BitwiseCrc16( const UINT8* pbData, UINT16 iLength )
+{
+   UINT16 iCrc;
+   UINT16 i;
+   UINT8  bBit;
+
+   iCrc = 0xFFFF;
+
+   for( i = 0; i < iLength; i++ )
+   {
+      iCrc ^= pbData[ i ];
+
+      for( bBit = 0; bBit < 8; bBit++ )
+      {
+         iCrc = ( iCrc & 1 ) ? (UINT16)( ( iCrc >> 1 ) ^ 0xA001 ) : (UINT16)( iCrc >> 1 );
+      }
+   }
+
+   return( iCrc );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   UINT16 iTelegram;
+   UINT16 iLength;
+   UINT16 iDone;
+   UINT16 iPart;
+   UINT16 i;
+   UINT16 iExpected;
+   UINT16 iCrc;
+
+   /*
+   ** CRC-16/MODBUS of "123456789" is 0x4B37.
+   */
+   memcpy( test_abTelegram, "123456789", 9 );
+   TEST_CHECK_EQ( CRC_Crc16( test_abTelegram, 9 ), 0x4B37 );
+
+   for( iTelegram = 0; iTelegram < TEST_NUM_TELEGRAMS; iTelegram++ )
+   {
+      iLength = Random() % ( TEST_MAX_OCTETS + 1 );
+      for( i = 0; i < iLength; i++ )
+      {
+         test_abTelegram[ i ] = (UINT8)Random();
+      }
+
+      iExpected = BitwiseCrc16( test_abTelegram, iLength );
+      TEST_CHECK_EQ( CRC_Crc16( test_abTelegram, iLength ), iExpected );
+
+      /*
+      ** Same telegram in parts of 0-31 octets.
+      */
+      iCrc = CRC_Crc16Start();
+      for( iDone = 0; iDone < iLength; iDone += iPart )
+      {
+         iPart = Random() % 32;
+         if( iPart > iLength - iDone )
+         {
+            iPart = iLength - iDone;
+         }
+         iCrc = CRC_Crc16Update( iCrc, &test_abTelegram[ iDone ], iPart );
+      }
+      TEST_CHECK_EQ( CRC_Crc16Finish( iCrc ), iExpected );
+
+      if( TEST_Result() != 0 )
+      {
+         printf( "Telegram of %u octets\n", iLength );
+         break;
+      }
+   }
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,138 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** SPI frame CRC32: CRC_Crc32() and the incremental functions against a bitwise
+** calculation, for random frames of 0-1600 octets split at random points.
+**
+** The program is built once per table size of abcc_crc32.c (see
+** ABCC_CFG_SPI_CRC32_BYTE_TABLE_ENABLED and test/CMakeLists.txt).
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "spi/abcc_crc32.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_MAX_WORDS                 ( 800 )
+#define TEST_NUM_FRAMES                ( 2000 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT16 test_aiFrame[ TEST_MAX_WORDS ];
+static UINT32 test_lSeed = 12345;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static UINT16 Random( void )
+{
+   test_lSeed = test_lSeed * 1103515245UL + 12345UL;
+   return( (UINT16)( test_lSeed >> 16 ) );
+}
+
+/*------------------------------------------------------------------------------
+** CRC-32/BZIP2 of the frame octets in memory order, one bit at a time, with
+** the octets of the result reversed as the SPI expects. This is the same
+** calculation as SIM_Crc32() in the simulated module.
+**------------------------------------------------------------------------------
+*/
+static UINT32 BitwiseCrc32( const UINT8* pbData, UINT16 iLength )
+{
+   UINT32 lCrc;
+   UINT16 i;
+   UINT8  bBit;
+
+   lCrc = 0xFFFFFFFFUL;
+
+   for( i = 0; i < iLength; i++ )
+   {
+      lCrc ^= (UINT32)pbData[ i ] << 24;
+
+      for( bBit = 0; bBit < 8; bBit++ )
+      {
+         lCrc = ( lCrc & 0x80000000UL ) ? ( lCrc << 1 ) ^ 0x04C11DB7UL : ( lCrc << 1 );
+      }
+   }
+
+   lCrc = ~lCrc;
+
+   return( ( ( lCrc >> 24 ) & 0x000000FFUL ) |
+           ( ( lCrc >> 8 )  & 0x0000FF00UL ) |
+           ( ( lCrc << 8 )  & 0x00FF0000UL ) |
+           ( ( lCrc << 24 ) & 0xFF000000UL ) );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   UINT16 iFrame;
+   UINT16 iNumWords;
+   UINT16 iSplit;
+   UINT16 i;
+   UINT32 lExpected;
+   UINT32 lCrc;
+
+   /*
+   ** CRC-32/BZIP2 of "12345678" is 0xB61C3D04, octet reversed for the SPI.
+   */
+   memcpy( test_aiFrame, "12345678", 8 );
+   TEST_CHECK_EQ( CRC_Crc32( test_aiFrame, 8 ), 0x043D1CB6UL );
+
+   for( iFrame = 0; iFrame < TEST_NUM_FRAMES; iFrame++ )
+   {
+      iNumWords = Random() % ( TEST_MAX_WORDS + 1 );
+      for( i = 0; i < iNumWords; i++ )
+      {
+         test_aiFrame[ i ] = Random();
+      }
+
+      lExpected = BitwiseCrc32( (const UINT8*)test_aiFrame,
+                                (UINT16)( iNumWords * 2 ) );
+      TEST_CHECK_EQ( CRC_Crc32( test_aiFrame, (UINT16)( iNumWords * 2 ) ),
+                     lExpected );
+
+      /*
+      ** Same frame in two parts, as when the header and the data are
+      ** added separately. All parts but the last have an even length.
+      */
+      iSplit = Random() % ( iNumWords + 1 );
+      lCrc = CRC_Crc32Start();
+      lCrc = CRC_Crc32Update( lCrc, test_aiFrame, (UINT16)( iSplit * 2 ) );
+      lCrc = CRC_Crc32Update( lCrc, &test_aiFrame[ iSplit ],
+                              (UINT16)( ( iNumWords - iSplit ) * 2 ) );
+      TEST_CHECK_EQ( CRC_Crc32Finish( lCrc ), lExpected );
+
+      if( TEST_Result() != 0 )
+      {
+         printf( "Frame of %u octets, split at %u\n", iNumWords * 2, iSplit * 2 );
+         break;
+      }
+   }
+
+   return( TEST_Result() );
+}
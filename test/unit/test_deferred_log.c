@@ -0,0 +1,319 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Deferred debug log (ABCC_CFG_DEBUG_DEFERRED_LOG_ENABLED) with a small log
+** buffer. Entries that do not fit, and entries stored while another context
+** holds the buffer, must be dropped and counted, while the stored ones are
+** printed by ABCC_LogFlush() in order with their arguments. The output is
+** captured with SIM_PORT_SetPrintHook() and the buffer is taken by a nested
+** writer, as by an interrupt, with SIM_PORT_SetAtomicHook().
+********************************************************************************
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_port.h"
+#include "abcc_debug_error.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_OUTPUT_SIZE               ( 16384 )
+#define TEST_MAX_LINE_LEN              ( 64 )
+#define TEST_NUM_OVERFLOW_ENTRIES      ( 100 )
+#define TEST_NUM_WRAP_ROUNDS           ( 20 )
+#define TEST_NUM_WRAP_ENTRIES          ( 7 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+/*
+** Output captured during ABCC_LogFlush().
+*/
+static char   test_acOutput[ TEST_OUTPUT_SIZE ];
+static UINT16 test_iOutputSize;
+static BOOL   test_fOutputOverflow;
+
+/*
+** Number of the next entry to store and of the next one expected to be
+** printed.
+*/
+static UINT16 test_iNextEntry;
+static UINT16 test_iNextPrinted;
+
+/*
+** Entries expected to be counted as lost by ABCC_LogGetLostCount().
+*/
+static UINT16 test_iExpectedLost;
+
+/*
+** Set to let the atomic hook store an entry while the log buffer is held.
+*/
+static BOOL test_fPreempt;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static void PrintHook( const char* pcText )
+{
+   size_t iLen;
+
+   iLen = strlen( pcText );
+   if( ( test_iOutputSize + iLen ) >= TEST_OUTPUT_SIZE )
+   {
+      test_fOutputOverflow = TRUE;
+      return;
+   }
+   memcpy( &test_acOutput[ test_iOutputSize ], pcText, iLen + 1 );
+   test_iOutputSize += (UINT16)iLen;
+}
+
+/*
+** Called right after each exchange of the log buffer lock. When the lock has
+** just been taken, a nested entry is stored the way an interrupt could do it.
+*/
+static void AtomicHook( volatile UINT8* pbTarget, UINT8 bValue )
+{
+   (void)pbTarget;
+
+   if( test_fPreempt && ( bValue == 1 ) )
+   {
+      test_fPreempt = FALSE;
+      ABCC_LogPrintf( "preempted\n" );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Text of entry number iEntry. The number of arguments, and the size of the
+** entry, depends on the entry number.
+**------------------------------------------------------------------------------
+*/
+static void FormatEntry( char* pcLine, UINT16 iEntry )
+{
+   switch( iEntry % 3 )
+   {
+   case 0:
+      (void)snprintf( pcLine, TEST_MAX_LINE_LEN, "E %u", iEntry );
+      break;
+   case 1:
+      (void)snprintf( pcLine, TEST_MAX_LINE_LEN, "E %u %d", iEntry, -(int)iEntry );
+      break;
+   default:
+      (void)snprintf( pcLine, TEST_MAX_LINE_LEN, "E %u %s %lx", iEntry, "s",
+                      (unsigned long)iEntry * 0x10001UL );
+      break;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Stores the next entry.
+**------------------------------------------------------------------------------
+*/
+static void LogEntry( void )
+{
+   UINT16 iEntry;
+
+   iEntry = test_iNextEntry++;
+   switch( iEntry % 3 )
+   {
+   case 0:
+      ABCC_LogPrintf( "E %u\n", iEntry );
+      break;
+   case 1:
+      ABCC_LogPrintf( "E %u %d\n", iEntry, -(int)iEntry );
+      break;
+   default:
+      ABCC_LogPrintf( "E %u %s %lx\n", iEntry, "s",
+                      (unsigned long)iEntry * 0x10001UL );
+      break;
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Flushes the log and checks the output: a report of the entries lost since
+** the last flush, if any, followed by the stored entries in order. An entry
+** that did not fit may be followed by a smaller one that did.
+**------------------------------------------------------------------------------
+** Arguments:
+**    iExpectedReport - Number of entries reported as lost.
+**
+** Returns:
+**    Number of entries printed.
+**------------------------------------------------------------------------------
+*/
+static UINT16 Flush( UINT16 iExpectedReport )
+{
+   char acExpected[ TEST_MAX_LINE_LEN ];
+   char* pcLine;
+   char* pcEnd;
+   unsigned int iReported;
+   unsigned int iEntry;
+   UINT16 iNumPrinted;
+
+   test_iOutputSize = 0;
+   test_acOutput[ 0 ] = '\0';
+   SIM_PORT_SetPrintHook( PrintHook );
+   ABCC_LogFlush();
+   SIM_PORT_SetPrintHook( NULL );
+   TEST_CHECK( !test_fOutputOverflow );
+
+   iReported = 0;
+   iNumPrinted = 0;
+   pcLine = test_acOutput;
+   while( *pcLine != '\0' )
+   {
+      pcEnd = strchr( pcLine, '\n' );
+      TEST_CHECK( pcEnd != NULL );
+      if( pcEnd == NULL )
+      {
+         break;
+      }
+      *pcEnd = '\0';
+
+      if( ( pcLine == test_acOutput ) &&
+          ( sscanf( pcLine, "ABCC log: %u entries lost", &iReported ) == 1 ) )
+      {
+         TEST_CHECK( iReported != 0 );
+      }
+      else if( ( sscanf( pcLine, "E %u", &iEntry ) == 1 ) &&
+               ( iEntry >= test_iNextPrinted ) && ( iEntry < test_iNextEntry ) )
+      {
+         FormatEntry( acExpected, (UINT16)iEntry );
+         TEST_CHECK( strcmp( pcLine, acExpected ) == 0 );
+         test_iNextPrinted = (UINT16)( iEntry + 1 );
+         iNumPrinted++;
+      }
+      else
+      {
+         TEST_CHECK( FALSE );
+      }
+
+      pcLine = pcEnd + 1;
+   }
+
+   TEST_CHECK_EQ( iReported, iExpectedReport );
+   TEST_CHECK_EQ( ABCC_LogGetLostCount(), test_iExpectedLost );
+
+   test_iNextPrinted = test_iNextEntry;
+
+   return( iNumPrinted );
+}
+
+/*------------------------------------------------------------------------------
+** Stores more entries than fit and checks that each one is either printed or
+** counted as lost.
+**------------------------------------------------------------------------------
+*/
+static void CheckOverflow( void )
+{
+   UINT16 iNumPrinted;
+   UINT16 iNumLost;
+   UINT16 i;
+
+   for( i = 0; i < TEST_NUM_OVERFLOW_ENTRIES; i++ )
+   {
+      LogEntry();
+   }
+
+   /*
+   ** The number printed is only known after the flush, so the expected lost
+   ** count is set from the one reported by the driver and then checked
+   ** against the number printed.
+   */
+   iNumLost = (UINT16)( ABCC_LogGetLostCount() - test_iExpectedLost );
+   test_iExpectedLost = ABCC_LogGetLostCount();
+   iNumPrinted = Flush( iNumLost );
+
+   TEST_CHECK( iNumPrinted > 0 );
+   TEST_CHECK( iNumLost > 0 );
+   TEST_CHECK_EQ( iNumPrinted + iNumLost, TEST_NUM_OVERFLOW_ENTRIES );
+}
+
+/*------------------------------------------------------------------------------
+** Stores a few entries of different sizes at a time, which always fit, until
+** the entries have wrapped around the end of the buffer several times.
+**------------------------------------------------------------------------------
+*/
+static void CheckWrap( void )
+{
+   UINT16 iRound;
+   UINT16 i;
+
+   for( iRound = 0; iRound < TEST_NUM_WRAP_ROUNDS; iRound++ )
+   {
+      for( i = 0; i < TEST_NUM_WRAP_ENTRIES; i++ )
+      {
+         LogEntry();
+      }
+      TEST_CHECK_EQ( Flush( 0 ), TEST_NUM_WRAP_ENTRIES );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Entries stored while another context holds the log buffer, and entries that
+** can never fit, are dropped and counted.
+**------------------------------------------------------------------------------
+*/
+static void CheckDropped( void )
+{
+   static UINT8 abData[ ABCC_CFG_DEBUG_LOG_BUFFER_SIZE ];
+
+   SIM_PORT_SetAtomicHook( AtomicHook );
+   test_fPreempt = TRUE;
+   LogEntry();
+   TEST_CHECK( !test_fPreempt );
+   SIM_PORT_SetAtomicHook( NULL );
+   test_iExpectedLost++;
+   TEST_CHECK_EQ( Flush( 1 ), 1 );
+
+   ABCC_LogData( ABCC_LOG_HEXDUMP_SPI, "too large", abData, sizeof( abData ) );
+   ABCC_LogPrintf( "%d %d %d %d %d %d %d %d %d\n", 1, 2, 3, 4, 5, 6, 7, 8, 9 );
+   test_iExpectedLost += 2;
+   LogEntry();
+   TEST_CHECK_EQ( Flush( 2 ), 1 );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   test_iNextEntry = 0;
+   test_iNextPrinted = 0;
+   test_iExpectedLost = 0;
+
+   TEST_CHECK_EQ( Flush( 0 ), 0 );
+
+   CheckOverflow();
+   TEST_CHECK_EQ( Flush( 0 ), 0 );
+
+   CheckWrap();
+   CheckOverflow();
+   CheckDropped();
+   CheckWrap();
+   CheckOverflow();
+
+   return( TEST_Result() );
+}
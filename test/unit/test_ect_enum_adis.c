@@ -0,0 +1,106 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** ENUM ADI list of the EtherCAT object (attribute 9) with more ENUM ADIs than
+** fit in one message: the list is sent as a segmented response.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "test_util.h"
+
+static UINT8 test_abList[ SIM_NUM_ADI * ABP_UINT16_SIZEOF ];
+
+/*
+** Sends a Get_Attribute of the ENUM ADI list, which is also the request for
+** the next segment, and returns the response in psMsg.
+*/
+static void GetEnumAdis( ABP_MsgType* psMsg )
+{
+   memset( &psMsg->sHeader, 0, sizeof( psMsg->sHeader ) );
+   psMsg->sHeader.bSourceId = 1;
+   psMsg->sHeader.bDestObj = ABP_OBJ_NUM_ECT;
+   psMsg->sHeader.iInstance = 1;
+   psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+   psMsg->sHeader.bCmdExt0 = ABP_ECT_IA_ENUM_ADIS;
+
+   TEST_CHECK( SIM_APPL_Transact( psMsg, 100 ) != 0 );
+   TEST_CHECK( ( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) == 0 );
+}
+
+/*
+** Reads the whole segmented ENUM ADI list into test_abList and returns its
+** size in octets.
+*/
+static UINT16 ReadEnumAdis( void )
+{
+   ABP_MsgType sMsg;
+   UINT16 iSize;
+   UINT16 iNumSeg;
+
+   GetEnumAdis( &sMsg );
+   TEST_CHECK( sMsg.sHeader.bCmdExt1 & ABP_MSG_CMDEXT1_SEG_FIRST );
+
+   iSize = 0;
+   for( iNumSeg = 1; iNumSeg < 100; iNumSeg++ )
+   {
+      if( ( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) ||
+          ( iSize + sMsg.sHeader.iDataSize > sizeof( test_abList ) ) )
+      {
+         TEST_CHECK( FALSE );
+         break;
+      }
+      memcpy( &test_abList[ iSize ], sMsg.abData, sMsg.sHeader.iDataSize );
+      iSize += sMsg.sHeader.iDataSize;
+
+      if( sMsg.sHeader.bCmdExt1 & ABP_MSG_CMDEXT1_SEG_LAST )
+      {
+         break;
+      }
+      GetEnumAdis( &sMsg );
+   }
+
+   return( iSize );
+}
+
+int main( void )
+{
+   UINT16 iAdi;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   TEST_CHECK( SIM_NUM_ADI * ABP_UINT16_SIZEOF > ABCC_CFG_MAX_MSG_SIZE );
+
+   TEST_CHECK_EQ( ReadEnumAdis(), SIM_NUM_ADI * ABP_UINT16_SIZEOF );
+   for( iAdi = 0; iAdi < SIM_NUM_ADI; iAdi++ )
+   {
+      TEST_CHECK_EQ( test_abList[ iAdi * 2 ] | ( test_abList[ iAdi * 2 + 1 ] << 8 ),
+                     SIM_ADI_INST( iAdi ) );
+   }
+
+   /*
+   ** The next request starts a new list once the first one is sent.
+   */
+   memset( test_abList, 0, sizeof( test_abList ) );
+   TEST_CHECK_EQ( ReadEnumAdis(), SIM_NUM_ADI * ABP_UINT16_SIZEOF );
+   TEST_CHECK_EQ( test_abList[ sizeof( test_abList ) - 2 ],
+                  SIM_ADI_INST( SIM_NUM_ADI - 1 ) & 0xFF );
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,431 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Table driven attribute handling (abcc_host_attribute.c). A local attribute
+** table with every kind of attribute, and gaps in the attribute numbers, is
+** passed requests directly, and the PROFINET IO, Modbus and Ethernet objects,
+** which use such tables, are sent requests through the simulated module.
+** Each case is a Get_Attribute or Set_Attribute and the expected value or
+** error response: unknown attributes, Set of attributes that can only be got,
+** Get of attributes that can only be set, and strings cut at their maximum
+** length.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "abcc_object_config.h"
+#include "abcc_host_attribute.h"
+#include "sim_application.h"
+#include "application_abcc_handler.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+/*
+** Object number of the cases sent to test_asAttr directly.
+*/
+#define TEST_LOCAL                     ( 0 )
+
+/*
+** Expected response value kinds.
+*/
+#define TEST_NONE                      ( 0 )
+#define TEST_U8                        ( 1 )
+#define TEST_U16                       ( 2 )
+#define TEST_U32                       ( 3 )
+#define TEST_DATA                      ( 4 )
+
+#define TEST_MIN( a, b )               ( ( (a) < (b) ) ? (a) : (b) )
+#define TEST_STR( pcStr )              (pcStr), ( sizeof( pcStr ) - 1 )
+#define TEST_STR_MAX( pcStr, iMax )    (pcStr), TEST_MIN( sizeof( pcStr ) - 1, iMax )
+
+#define TEST_GET                       ABP_CMD_GET_ATTR
+#define TEST_SET                       ABP_CMD_SET_ATTR
+
+#define TEST_FUNC_VALUE                ( 0xBEEF )
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Request and expected response.
+**------------------------------------------------------------------------------
+** bObj           - Object, TEST_LOCAL for test_asAttr.
+** iInstance      - Instance.
+** bCmd           - TEST_GET or TEST_SET.
+** bAttr          - Attribute.
+** iSetSize       - Size of the Set_Attribute data.
+** bErr           - Expected error code, ABP_ERR_NO_ERROR for a response.
+** bKind          - Kind of the expected value.
+** lValue         - Expected TEST_U8/TEST_U16/TEST_U32 value.
+** pxData         - Expected TEST_DATA value.
+** iSize          - Size of the TEST_DATA value.
+**------------------------------------------------------------------------------
+*/
+typedef struct test_Case
+{
+   UINT8       bObj;
+   UINT16      iInstance;
+   UINT8       bCmd;
+   UINT8       bAttr;
+   UINT16      iSetSize;
+   UINT8       bErr;
+   UINT8       bKind;
+   UINT32      lValue;
+   const void* pxData;
+   UINT16      iSize;
+}
+test_CaseType;
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static const UINT8 test_abOctets[ 5 ] = { 0x01, 0x80, 0x00, 0xFF, 0x7E };
+
+/*
+** Zero terminated strings limited to 8 characters, as the table macros make
+** them for compilers that cannot tell an array from a pointer.
+*/
+static const char test_acShort[] = "short";
+static const char test_acExact[] = "exactly8";
+static const char test_acLong[] = "longer than eight";
+static const char test_acEmpty[] = "";
+
+static UINT16 test_iNumFuncGet;
+static UINT16 test_iNumFuncSet;
+static UINT16 test_iFuncSetSize;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static void FuncGet( ABP_MsgType* psNewMessage )
+{
+   test_iNumFuncGet++;
+   ABCC_SetMsgData16( psNewMessage, TEST_FUNC_VALUE, 0 );
+   ABP_SetMsgResponse( psNewMessage, ABP_UINT16_SIZEOF );
+}
+
+static void FuncSet( ABP_MsgType* psNewMessage )
+{
+   test_iNumFuncSet++;
+   test_iFuncSetSize = ABCC_GetMsgDataSize( psNewMessage );
+   ABP_SetMsgResponse( psNewMessage, 0 );
+}
+
+/*
+** Attributes 1-8 are consecutive (direct index), the rest are found by the
+** binary search.
+*/
+static const ABCC_HostAttrType test_asAttr[] =
+{
+   ABCC_HOST_ATTR_U8( 1, 0x12 ),
+   ABCC_HOST_ATTR_U16( 2, 0x3456 ),
+   ABCC_HOST_ATTR_U32( 3, 0x789ABCDEUL ),
+   ABCC_HOST_ATTR_U8X2( 4, 0x01, 0xF2 ),
+   ABCC_HOST_ATTR_U16X2( 5, 0x1122, 0xF344 ),
+   ABCC_HOST_ATTR_OCT( 6, test_abOctets, sizeof( test_abOctets ) ),
+   ABCC_HOST_ATTR_STR( 7, "Text" ),
+   ABCC_HOST_ATTR_STR_MAX( 8, "Longer text", 6 ),
+   { 10, ABCC_HOST_ATTR_KIND_CSTRING, 8, 0, test_acShort, NULL, NULL },
+   { 11, ABCC_HOST_ATTR_KIND_CSTRING, 8, 0, test_acExact, NULL, NULL },
+   { 12, ABCC_HOST_ATTR_KIND_CSTRING, 8, 0, test_acLong, NULL, NULL },
+   { 13, ABCC_HOST_ATTR_KIND_CSTRING, 8, 0, test_acEmpty, NULL, NULL },
+   ABCC_HOST_ATTR_FUNC( 20, FuncGet, NULL ),
+   ABCC_HOST_ATTR_FUNC( 21, NULL, FuncSet ),
+   ABCC_HOST_ATTR_FUNC( 22, FuncGet, FuncSet ),
+   ABCC_HOST_ATTR_U8( 200, 0xC8 ),
+   ABCC_HOST_ATTR_U8( 255, 0xFF ),
+   ABCC_HOST_ATTR_END
+};
+
+static const test_CaseType test_asCase[] =
+{
+   /*
+   ** Every kind of attribute.
+   */
+   { TEST_LOCAL, 1, TEST_GET, 1, 0, ABP_ERR_NO_ERROR, TEST_U8, 0x12, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 2, 0, ABP_ERR_NO_ERROR, TEST_U16, 0x3456, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 3, 0, ABP_ERR_NO_ERROR, TEST_U32, 0x789ABCDEUL, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 4, 0, ABP_ERR_NO_ERROR, TEST_U16, 0xF201, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 5, 0, ABP_ERR_NO_ERROR, TEST_U32, 0xF3441122UL, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 6, 0, ABP_ERR_NO_ERROR, TEST_DATA, 0, test_abOctets, 5 },
+   { TEST_LOCAL, 1, TEST_GET, 7, 0, ABP_ERR_NO_ERROR, TEST_DATA, 0, TEST_STR( "Text" ) },
+   { TEST_LOCAL, 1, TEST_GET, 8, 0, ABP_ERR_NO_ERROR, TEST_DATA, 0, TEST_STR( "Longer" ) },
+   { TEST_LOCAL, 1, TEST_GET, 10, 0, ABP_ERR_NO_ERROR, TEST_DATA, 0, TEST_STR( "short" ) },
+   { TEST_LOCAL, 1, TEST_GET, 11, 0, ABP_ERR_NO_ERROR, TEST_DATA, 0, TEST_STR( "exactly8" ) },
+   { TEST_LOCAL, 1, TEST_GET, 12, 0, ABP_ERR_NO_ERROR, TEST_DATA, 0, TEST_STR( "longer t" ) },
+   { TEST_LOCAL, 1, TEST_GET, 13, 0, ABP_ERR_NO_ERROR, TEST_DATA, 0, TEST_STR( "" ) },
+   { TEST_LOCAL, 1, TEST_GET, 20, 0, ABP_ERR_NO_ERROR, TEST_U16, TEST_FUNC_VALUE, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 22, 0, ABP_ERR_NO_ERROR, TEST_U16, TEST_FUNC_VALUE, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 200, 0, ABP_ERR_NO_ERROR, TEST_U8, 0xC8, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 255, 0, ABP_ERR_NO_ERROR, TEST_U8, 0xFF, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 21, 3, ABP_ERR_NO_ERROR, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 22, 2, ABP_ERR_NO_ERROR, TEST_NONE, 0, NULL, 0 },
+
+   /*
+   ** Unknown attributes, before, between and after the known ones.
+   */
+   { TEST_LOCAL, 1, TEST_GET, 0, 0, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 9, 0, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 14, 0, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 199, 0, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 201, 0, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 9, 1, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+
+   /*
+   ** Set of constants and of a function without set function, Get of a
+   ** function without get function, and other commands.
+   */
+   { TEST_LOCAL, 1, TEST_SET, 1, 1, ABP_ERR_ATTR_NOT_SETABLE, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 3, 4, ABP_ERR_ATTR_NOT_SETABLE, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 6, 5, ABP_ERR_ATTR_NOT_SETABLE, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 7, 4, ABP_ERR_ATTR_NOT_SETABLE, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 12, 2, ABP_ERR_ATTR_NOT_SETABLE, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_SET, 20, 2, ABP_ERR_ATTR_NOT_SETABLE, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, TEST_GET, 21, 0, ABP_ERR_ATTR_NOT_GETABLE, TEST_NONE, 0, NULL, 0 },
+   { TEST_LOCAL, 1, ABP_CMD_GET_ENUM_STR, 1, 0, ABP_ERR_UNSUP_CMD, TEST_NONE, 0, NULL, 0 },
+
+   /*
+   ** PROFINET IO object.
+   */
+   { ABP_OBJ_NUM_PNIO, ABP_INST_OBJ, TEST_GET, ABP_OA_NAME, 0, ABP_ERR_NO_ERROR,
+     TEST_DATA, 0, TEST_STR( "PROFINET IO" ) },
+   { ABP_OBJ_NUM_PNIO, ABP_INST_OBJ, TEST_GET, ABP_OA_REV, 0, ABP_ERR_NO_ERROR,
+     TEST_U8, 1, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, ABP_INST_OBJ, TEST_GET, ABP_OA_NUM_INST, 0, ABP_ERR_NO_ERROR,
+     TEST_U16, 1, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, ABP_INST_OBJ, TEST_GET, ABP_OA_HIGHEST_INST, 0, ABP_ERR_NO_ERROR,
+     TEST_U16, 1, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, ABP_INST_OBJ, TEST_GET, ABP_OA_HIGHEST_INST + 1, 0,
+     ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, ABP_PNIO_IA_DEVICE_ID, 0, ABP_ERR_NO_ERROR,
+     TEST_U16, PRT_IA_DEVICE_ID_VALUE, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, ABP_PNIO_IA_STATION_TYPE, 0, ABP_ERR_NO_ERROR,
+     TEST_DATA, 0, TEST_STR_MAX( PRT_IA_STATION_TYPE_VALUE, ABP_PNIO_IA_STATION_TYPE_DS ) },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, ABP_PNIO_IA_MAX_AR, 0, ABP_ERR_NO_ERROR,
+     TEST_U32, PRT_IA_MAX_AR_VALUE, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, ABP_PNIO_IA_IM_SERIAL_NBR, 0, ABP_ERR_NO_ERROR,
+     TEST_DATA, 0, TEST_STR_MAX( PRT_IA_IM_SERIAL_NBR_VALUE, ABP_PNIO_IA_IM_SERIAL_NBR_DS ) },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, ABP_PNIO_IA_IM_SW_REV, 0, ABP_ERR_NO_ERROR,
+     TEST_U32, (UINT32)PRT_IA_IM_SW_REV_SYMBOL_VALUE |
+               ( (UINT32)PRT_IA_IM_SW_REV_MAJOR_VALUE << 8 ) |
+               ( (UINT32)PRT_IA_IM_SW_REV_MINOR_VALUE << 16 ) |
+               ( (UINT32)PRT_IA_IM_SW_REV_BUILD_VALUE << 24 ), NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, ABP_PNIO_IA_SYSTEM_CONTACT, 0, ABP_ERR_NO_ERROR,
+     TEST_DATA, 0, TEST_STR( PRT_IA_SYSTEM_CONTACT_VALUE ) },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_SET, ABP_PNIO_IA_DEVICE_ID, 2, ABP_ERR_ATTR_NOT_SETABLE,
+     TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_SET, ABP_PNIO_IA_MAX_AR, 4, ABP_ERR_ATTR_NOT_SETABLE,
+     TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, ABP_PNIO_IA_S2_PRIMARY_AR_HANDLE, 0,
+     ABP_ERR_ATTR_NOT_GETABLE, TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_SET, ABP_PNIO_IA_S2_PRIMARY_AR_HANDLE, 2,
+     ABP_ERR_NO_ERROR, TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, 0, 0, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_PNIO, 1, TEST_GET, 255, 0, ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+
+   /*
+   ** Modbus object, which has no settable attributes.
+   */
+   { ABP_OBJ_NUM_MOD, ABP_INST_OBJ, TEST_GET, ABP_OA_NAME, 0, ABP_ERR_NO_ERROR,
+     TEST_DATA, 0, TEST_STR( "Modbus" ) },
+   { ABP_OBJ_NUM_MOD, 1, TEST_GET, ABP_MOD_IA_VENDOR_NAME, 0, ABP_ERR_NO_ERROR,
+     TEST_DATA, 0, TEST_STR( MOD_IA_VENDOR_NAME_VALUE ) },
+   { ABP_OBJ_NUM_MOD, 1, TEST_GET, ABP_MOD_IA_ADI_INDEXING_BITS, 0, ABP_ERR_NO_ERROR,
+     TEST_U8, MOD_IA_ADI_INDEXING_BITS_VALUE, NULL, 0 },
+   { ABP_OBJ_NUM_MOD, 1, TEST_GET, ABP_MOD_IA_RW_OFFSET, 0, ABP_ERR_NO_ERROR,
+     TEST_U32, MOD_IA_RW_OFFSET_READ_VALUE |
+               ( (UINT32)MOD_IA_RW_OFFSET_WRITE_VALUE << 16 ), NULL, 0 },
+   { ABP_OBJ_NUM_MOD, 1, TEST_GET, ABP_MOD_IA_ADI_INDEXING_BITS + 1, 0,
+     ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_MOD, 1, TEST_SET, ABP_MOD_IA_VENDOR_NAME, 1, ABP_ERR_UNSUP_CMD,
+     TEST_NONE, 0, NULL, 0 },
+
+   /*
+   ** Ethernet object.
+   */
+   { ABP_OBJ_NUM_ETN, ABP_INST_OBJ, TEST_GET, ABP_OA_REV, 0, ABP_ERR_NO_ERROR,
+     TEST_U8, 2, NULL, 0 },
+   { ABP_OBJ_NUM_ETN, 1, TEST_GET, ABP_ETN_IA_ENABLE_WEB, 0, ABP_ERR_NO_ERROR,
+     TEST_U8, ETN_IA_ENABLE_WEB_VALUE, NULL, 0 },
+   { ABP_OBJ_NUM_ETN, 1, TEST_GET, ABP_ETN_IA_ETH_PHY_CONFIG, 0, ABP_ERR_NO_ERROR,
+     TEST_U32, ETN_IA_ETH_PHY_CONFIG_PORT1_VALUE |
+               ( (UINT32)ETN_IA_ETH_PHY_CONFIG_PORT2_VALUE << 16 ), NULL, 0 },
+   { ABP_OBJ_NUM_ETN, 1, TEST_SET, ABP_ETN_IA_ENABLE_WEB, 1, ABP_ERR_ATTR_NOT_SETABLE,
+     TEST_NONE, 0, NULL, 0 },
+   { ABP_OBJ_NUM_ETN, 1, TEST_SET, ABP_ETN_IA_ETH_PHY_CONFIG + 1, 1,
+     ABP_ERR_INV_CMD_EXT_0, TEST_NONE, 0, NULL, 0 }
+};
+
+/*------------------------------------------------------------------------------
+** Builds the request of a case, with iSetSize octets of data for a Set.
+**------------------------------------------------------------------------------
+*/
+static void BuildRequest( ABP_MsgType* psMsg, const test_CaseType* psCase )
+{
+   UINT16 i;
+
+   memset( &psMsg->sHeader, 0, sizeof( psMsg->sHeader ) );
+   psMsg->sHeader.bSourceId = 1;
+   psMsg->sHeader.bDestObj = psCase->bObj;
+   psMsg->sHeader.iInstance = iTOiLe( psCase->iInstance );
+   psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT | psCase->bCmd;
+   psMsg->sHeader.bCmdExt0 = psCase->bAttr;
+   psMsg->sHeader.iDataSize = iTOiLe( psCase->iSetSize );
+   for( i = 0; i < psCase->iSetSize; i++ )
+   {
+      psMsg->abData[ i ] = (UINT8)( 0xA0 + i );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Checks the response of a case.
+**------------------------------------------------------------------------------
+*/
+static void CheckResponse( const ABP_MsgType* psMsg, const test_CaseType* psCase,
+                           UINT16 iCase )
+{
+   UINT8 abExpected[ ABP_UINT32_SIZEOF ];
+   const void* pxExpected;
+   UINT16 iExpectedSize;
+   UINT16 iSize;
+   BOOL fOk;
+
+   iSize = iLeTOi( psMsg->sHeader.iDataSize );
+
+   if( psCase->bErr != ABP_ERR_NO_ERROR )
+   {
+      fOk = ( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) &&
+            ( iSize >= 1 ) && ( psMsg->abData[ 0 ] == psCase->bErr );
+   }
+   else
+   {
+      abExpected[ 0 ] = (UINT8)psCase->lValue;
+      abExpected[ 1 ] = (UINT8)( psCase->lValue >> 8 );
+      abExpected[ 2 ] = (UINT8)( psCase->lValue >> 16 );
+      abExpected[ 3 ] = (UINT8)( psCase->lValue >> 24 );
+      pxExpected = abExpected;
+
+      switch( psCase->bKind )
+      {
+      case TEST_U8:
+         iExpectedSize = ABP_UINT8_SIZEOF;
+         break;
+      case TEST_U16:
+         iExpectedSize = ABP_UINT16_SIZEOF;
+         break;
+      case TEST_U32:
+         iExpectedSize = ABP_UINT32_SIZEOF;
+         break;
+      case TEST_DATA:
+         pxExpected = psCase->pxData;
+         iExpectedSize = psCase->iSize;
+         break;
+      default:
+         iExpectedSize = 0;
+         break;
+      }
+
+      fOk = !( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) &&
+            ( iSize == iExpectedSize ) &&
+            ( memcmp( psMsg->abData, pxExpected, iExpectedSize ) == 0 );
+   }
+
+   if( !fOk )
+   {
+      TEST_CHECK_EQ( iCase, 0xFFFF );
+   }
+   TEST_CHECK( !( psMsg->sHeader.bCmd & ABP_MSG_HEADER_C_BIT ) );
+}
+
+/*------------------------------------------------------------------------------
+** ABCC_HostAttrFind() finds exactly the attributes in the table.
+**------------------------------------------------------------------------------
+*/
+static void CheckFind( void )
+{
+   const ABCC_HostAttrType* psExpected;
+   UINT16 iAttr;
+   UINT8 bIndex;
+
+   for( iAttr = 0; iAttr <= 0xFF; iAttr++ )
+   {
+      psExpected = NULL;
+      for( bIndex = 0; bIndex < ABCC_HOST_ATTR_TABLE_SIZE( test_asAttr ); bIndex++ )
+      {
+         if( test_asAttr[ bIndex ].bAttr == iAttr )
+         {
+            psExpected = &test_asAttr[ bIndex ];
+         }
+      }
+
+      TEST_CHECK( ABCC_HostAttrFind( test_asAttr,
+                                     ABCC_HOST_ATTR_TABLE_SIZE( test_asAttr ),
+                                     (UINT8)iAttr ) == psExpected );
+   }
+
+   TEST_CHECK( ABCC_HostAttrFind( test_asAttr, 0, 1 ) == NULL );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   ABP_MsgType sMsg;
+   UINT16 iCase;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   CheckFind();
+
+   for( iCase = 0; iCase < sizeof( test_asCase ) / sizeof( test_asCase[ 0 ] ); iCase++ )
+   {
+      BuildRequest( &sMsg, &test_asCase[ iCase ] );
+      if( test_asCase[ iCase ].bObj == TEST_LOCAL )
+      {
+         ABCC_HostAttrCommand( &sMsg, test_asAttr,
+                               ABCC_HOST_ATTR_TABLE_SIZE( test_asAttr ) );
+      }
+      else
+      {
+         TEST_CHECK( SIM_APPL_Transact( &sMsg, 100 ) != 0 );
+      }
+      CheckResponse( &sMsg, &test_asCase[ iCase ], iCase );
+   }
+
+   /*
+   ** The get and set functions are called once per request, with the data.
+   */
+   TEST_CHECK_EQ( test_iNumFuncGet, 2 );
+   TEST_CHECK_EQ( test_iNumFuncSet, 2 );
+   TEST_CHECK_EQ( test_iFuncSetSize, 2 );
+
+   return( TEST_Result() );
+}
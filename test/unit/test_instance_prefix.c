@@ -0,0 +1,340 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Two driver instances in one program (ABCC_CFG_INSTANCE_PREFIX ABCC1 and
+** ABCC2), each with its own simulated module, driven through the context
+** handle API of abcc_context.h. The instances run interleaved from one loop
+** and must not see each other's state, messages, ADIs or process data.
+**
+** This file is compiled without a prefix. The prefixed names of the
+** simulator functions are declared here.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_context.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_NUM_INSTANCES             ( 2 )
+#define TEST_MAX_CYCLES                ( 10000 )
+#define TEST_SOURCE_ID                 ( 200 )
+
+/*
+** ADI instance number n of the simulated application, see sim_application.h.
+** Instance ABCC1 has 256 ADIs and ABCC2 128. ADI 100 is not mapped.
+*/
+#define TEST_ADI_INST( n )             ( (UINT16)( (n) + 1 ) )
+#define TEST_ADI_UNMAPPED              ( 100 )
+#define TEST_ADI_ONLY_IN_ABCC1         ( 200 )
+
+/*
+** First UINT16 ADI of the write process data, after FLOAT[ 32 ] and
+** BIT3[ 40 ].
+*/
+#define TEST_ADI_FIRST_WRITE           ( 32 )
+#define TEST_WRPD_OFFSET_FIRST_WRITE   ( 128 + 15 )
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** One driver instance and its simulated module.
+**------------------------------------------------------------------------------
+*/
+typedef struct test_Instance
+{
+   const ABCC_CtxType* psCtx;
+   void ( *pnSimSetAnbState )( ABP_AnbStateType eState );
+   ABP_AnbStateType ( *pnSimGetAnbState )( void );
+   void ( *pnSimSetNetwork )( UINT16 iNwType, UINT8 bDataFormat );
+   const UINT8* ( *pnSimGetWritePd )( void );
+   UINT16 ( *pnSimTransact )( ABP_MsgType* psCmd, UINT16 iMaxCycles );
+   UINT16* paiAdi;
+   ABCC_MsgHandlerFuncType pnRespHandler;
+   UINT16 iNwType;
+}
+test_InstanceType;
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+#define TEST_DECLARE_INSTANCE( prefix )                                        \
+   ABCC_CTX_DECLARE( prefix );                                                 \
+   EXTFUNC void ABCC_INSTANCE_PASTE( prefix, SIM_SetAnbState )( ABP_AnbStateType eState ); \
+   EXTFUNC ABP_AnbStateType ABCC_INSTANCE_PASTE( prefix, SIM_GetAnbState )( void ); \
+   EXTFUNC void ABCC_INSTANCE_PASTE( prefix, SIM_SetNetwork )( UINT16 iNwType, UINT8 bDataFormat ); \
+   EXTFUNC const UINT8* ABCC_INSTANCE_PASTE( prefix, SIM_GetWritePd )( void ); \
+   EXTFUNC UINT16 ABCC_INSTANCE_PASTE( prefix, SIM_APPL_Transact )( ABP_MsgType* psCmd, UINT16 iMaxCycles ); \
+   EXTVAR UINT16 ABCC_INSTANCE_PASTE( prefix, SIM_aiAdi )[]
+
+#define TEST_INSTANCE( prefix, pnRespHandler, iNwType )                        \
+   {                                                                           \
+      ABCC_CTX( prefix ),                                                      \
+      ABCC_INSTANCE_PASTE( prefix, SIM_SetAnbState ),                          \
+      ABCC_INSTANCE_PASTE( prefix, SIM_GetAnbState ),                          \
+      ABCC_INSTANCE_PASTE( prefix, SIM_SetNetwork ),                           \
+      ABCC_INSTANCE_PASTE( prefix, SIM_GetWritePd ),                           \
+      ABCC_INSTANCE_PASTE( prefix, SIM_APPL_Transact ),                        \
+      ABCC_INSTANCE_PASTE( prefix, SIM_aiAdi ),                                \
+      pnRespHandler,                                                           \
+      iNwType                                                                  \
+   }
+
+TEST_DECLARE_INSTANCE( ABCC1 );
+TEST_DECLARE_INSTANCE( ABCC2 );
+
+static void RespHandler1( ABP_MsgType* psMsg );
+static void RespHandler2( ABP_MsgType* psMsg );
+
+static const test_InstanceType test_asInstance[ TEST_NUM_INSTANCES ] =
+{
+   TEST_INSTANCE( ABCC1, RespHandler1, ABP_NW_TYPE_ECT ),
+   TEST_INSTANCE( ABCC2, RespHandler2, ABP_NW_TYPE_EPL )
+};
+
+/*
+** Network type received by the response handler of each instance, 0 if none.
+*/
+static UINT16 test_aiRespNwType[ TEST_NUM_INSTANCES ];
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static void RespHandler( UINT8 bInstance, ABP_MsgType* psMsg )
+{
+   TEST_CHECK( !( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) );
+   TEST_CHECK_EQ( psMsg->sHeader.iDataSize, ABP_UINT16_SIZEOF );
+   test_aiRespNwType[ bInstance ] = (UINT16)( psMsg->abData[ 0 ] |
+                                              ( psMsg->abData[ 1 ] << 8 ) );
+}
+
+static void RespHandler1( ABP_MsgType* psMsg )
+{
+   RespHandler( 0, psMsg );
+}
+
+static void RespHandler2( ABP_MsgType* psMsg )
+{
+   RespHandler( 1, psMsg );
+}
+
+/*------------------------------------------------------------------------------
+** Runs one application cycle of an instance, see SIM_APPL_RunCycle().
+**------------------------------------------------------------------------------
+*/
+static void RunCycle( const test_InstanceType* psInst )
+{
+   TEST_CHECK_EQ( APPL_CtxHandleAbcc( psInst->psCtx ), APPL_MODULE_NO_ERROR );
+   ABCC_CtxRunTimerSystem( psInst->psCtx, 1 );
+
+   if( psInst->pnSimGetAnbState() == ABP_ANB_STATE_WAIT_PROCESS )
+   {
+      psInst->pnSimSetAnbState( ABP_ANB_STATE_PROCESS_ACTIVE );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Runs both instances, one cycle each at a time, until both are in
+** PROCESS_ACTIVE.
+**------------------------------------------------------------------------------
+*/
+static BOOL RunUntilProcessActive( void )
+{
+   UINT16 iCycle;
+   UINT8 i;
+   UINT8 bNumActive;
+
+   for( iCycle = 0; iCycle < TEST_MAX_CYCLES; iCycle++ )
+   {
+      bNumActive = 0;
+      for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+      {
+         RunCycle( &test_asInstance[ i ] );
+         if( ABCC_CtxAnbState( test_asInstance[ i ].psCtx ) == ABP_ANB_STATE_PROCESS_ACTIVE )
+         {
+            bNumActive++;
+         }
+      }
+
+      if( bNumActive == TEST_NUM_INSTANCES )
+      {
+         return( TRUE );
+      }
+   }
+
+   return( FALSE );
+}
+
+/*------------------------------------------------------------------------------
+** Gets the value of an ADI from the simulated module of an instance.
+**------------------------------------------------------------------------------
+** Returns:
+**    The value, or the error code ORed with 0x10000 on an error response.
+**------------------------------------------------------------------------------
+*/
+static UINT32 GetAdi( const test_InstanceType* psInst, UINT16 iAdi )
+{
+   ABP_MsgType sMsg;
+
+   memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+   sMsg.sHeader.bSourceId = 1;
+   sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+   sMsg.sHeader.iInstance = TEST_ADI_INST( iAdi );
+   sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+   sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+
+   TEST_CHECK( psInst->pnSimTransact( &sMsg, 100 ) != 0 );
+
+   if( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT )
+   {
+      return( 0x10000UL | sMsg.abData[ 0 ] );
+   }
+
+   TEST_CHECK_EQ( sMsg.sHeader.iDataSize, ABP_UINT16_SIZEOF );
+
+   return( (UINT32)( sMsg.abData[ 0 ] | ( sMsg.abData[ 1 ] << 8 ) ) );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   const test_InstanceType* psInst;
+   ABP_MsgType* psMsg;
+   const UINT8* pbWrPd;
+   UINT16 iCycle;
+   UINT8 i;
+
+   /*
+   ** Start both.
+   */
+   for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+   {
+      psInst = &test_asInstance[ i ];
+      psInst->pnSimSetNetwork( psInst->iNwType, ABP_NW_DATA_FORMAT_LSB_FIRST );
+      TEST_CHECK_EQ( ABCC_CtxHwInit( psInst->psCtx ), ABCC_EC_NO_ERROR );
+   }
+   TEST_CHECK( RunUntilProcessActive() );
+
+   for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+   {
+      TEST_CHECK_EQ( ABCC_CtxNetworkType( test_asInstance[ i ].psCtx ),
+                     test_asInstance[ i ].iNwType );
+   }
+
+   /*
+   ** Commands towards the modules, responses routed to the handler of the
+   ** instance that sent them.
+   */
+   for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+   {
+      psInst = &test_asInstance[ i ];
+      psMsg = ABCC_CtxGetCmdMsgBuffer( psInst->psCtx );
+      TEST_CHECK( psMsg != NULL );
+      if( psMsg == NULL )
+      {
+         return( TEST_Result() );
+      }
+
+      memset( &psMsg->sHeader, 0, sizeof( psMsg->sHeader ) );
+      psMsg->sHeader.bSourceId = TEST_SOURCE_ID;
+      psMsg->sHeader.bDestObj = ABP_OBJ_NUM_NW;
+      psMsg->sHeader.iInstance = 1;
+      psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+      psMsg->sHeader.bCmdExt0 = ABP_NW_IA_NW_TYPE;
+      TEST_CHECK_EQ( ABCC_CtxSendCmdMsg( psInst->psCtx, psMsg,
+                                         psInst->pnRespHandler ),
+                     ABCC_EC_NO_ERROR );
+   }
+
+   for( iCycle = 0; iCycle < 100; iCycle++ )
+   {
+      for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+      {
+         RunCycle( &test_asInstance[ i ] );
+      }
+   }
+
+   for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+   {
+      TEST_CHECK_EQ( test_aiRespNwType[ i ], test_asInstance[ i ].iNwType );
+   }
+
+   /*
+   ** Commands towards the host, each answered from the ADI table and the ADI
+   ** values of its own instance.
+   */
+   test_asInstance[ 0 ].paiAdi[ TEST_ADI_UNMAPPED ] = 0x1111;
+   test_asInstance[ 1 ].paiAdi[ TEST_ADI_UNMAPPED ] = 0x2222;
+   TEST_CHECK_EQ( GetAdi( &test_asInstance[ 0 ], TEST_ADI_UNMAPPED ), 0x1111 );
+   TEST_CHECK_EQ( GetAdi( &test_asInstance[ 1 ], TEST_ADI_UNMAPPED ), 0x2222 );
+   TEST_CHECK_EQ( GetAdi( &test_asInstance[ 0 ], TEST_ADI_ONLY_IN_ABCC1 ), 0 );
+   TEST_CHECK_EQ( GetAdi( &test_asInstance[ 1 ], TEST_ADI_ONLY_IN_ABCC1 ),
+                  0x10000UL | ABP_ERR_UNSUP_INST );
+
+   /*
+   ** Write process data.
+   */
+   test_asInstance[ 0 ].paiAdi[ TEST_ADI_FIRST_WRITE ] = 0x3344;
+   test_asInstance[ 1 ].paiAdi[ TEST_ADI_FIRST_WRITE ] = 0x5566;
+   for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+   {
+      ABCC_CtxTriggerWrPdUpdate( test_asInstance[ i ].psCtx );
+   }
+   for( iCycle = 0; iCycle < 10; iCycle++ )
+   {
+      for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+      {
+         RunCycle( &test_asInstance[ i ] );
+      }
+   }
+   pbWrPd = test_asInstance[ 0 ].pnSimGetWritePd();
+   TEST_CHECK_EQ( pbWrPd[ TEST_WRPD_OFFSET_FIRST_WRITE ], 0x44 );
+   TEST_CHECK_EQ( pbWrPd[ TEST_WRPD_OFFSET_FIRST_WRITE + 1 ], 0x33 );
+   pbWrPd = test_asInstance[ 1 ].pnSimGetWritePd();
+   TEST_CHECK_EQ( pbWrPd[ TEST_WRPD_OFFSET_FIRST_WRITE ], 0x66 );
+   TEST_CHECK_EQ( pbWrPd[ TEST_WRPD_OFFSET_FIRST_WRITE + 1 ], 0x55 );
+
+   /*
+   ** Restarting one instance leaves the other in PROCESS_ACTIVE.
+   */
+   APPL_CtxRestartAbcc( test_asInstance[ 0 ].psCtx );
+   RunCycle( &test_asInstance[ 0 ] );
+   RunCycle( &test_asInstance[ 0 ] );
+   TEST_CHECK( ABCC_CtxAnbState( test_asInstance[ 0 ].psCtx ) !=
+               ABP_ANB_STATE_PROCESS_ACTIVE );
+   TEST_CHECK_EQ( ABCC_CtxAnbState( test_asInstance[ 1 ].psCtx ),
+                  ABP_ANB_STATE_PROCESS_ACTIVE );
+   TEST_CHECK( RunUntilProcessActive() );
+   TEST_CHECK_EQ( GetAdi( &test_asInstance[ 0 ], TEST_ADI_UNMAPPED ), 0x1111 );
+   TEST_CHECK_EQ( GetAdi( &test_asInstance[ 1 ], TEST_ADI_UNMAPPED ), 0x2222 );
+
+   return( TEST_Result() );
+}
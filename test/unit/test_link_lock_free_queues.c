@@ -0,0 +1,220 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Lock-free link queues (ABCC_CFG_LINK_LOCK_FREE_QUEUES_ENABLED) under load
+** from two threads. A producer thread sends commands to the module as fast as
+** the command queue takes them, while the main thread runs the driver as the
+** ABCC interrupt and answers commands from the module. Both threads dequeue and write messages,
+** so each queue has its producer in one thread and consumers in both. Every
+** command must get its own response, in order, and no response to the module
+** may be lost.
+********************************************************************************
+*/
+
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "test_util.h"
+
+#define TEST_NUM_CMDS                  ( 20000 )
+#define TEST_MAX_CYCLES                ( TEST_NUM_CMDS * 20 )
+
+/*
+** A command from the module is sent every TEST_MODULE_CMD_INTERVAL cycles.
+** Responses are sent before commands, so a command every cycle would starve
+** the producer.
+*/
+#define TEST_MODULE_CMD_INTERVAL       ( 4 )
+
+/*
+** Source ids of the commands in send order, written by the producer before
+** each command is sent.
+*/
+static UINT8 test_abSrcId[ TEST_NUM_CMDS ];
+
+/*
+** Counted by the response handler, i.e. in the main thread.
+*/
+static UINT32 test_lNumResp;
+static UINT32 test_lNumBadResp;
+
+/*
+** Set by the main thread to stop the producer, read under the critical
+** section.
+*/
+static BOOL test_fStop;
+
+static BOOL IsStopped( void )
+{
+   BOOL fStop;
+
+   SIM_PORT_EnterCritical();
+   fStop = test_fStop;
+   SIM_PORT_ExitCritical();
+
+   return( fStop );
+}
+
+static void Stop( void )
+{
+   SIM_PORT_EnterCritical();
+   test_fStop = TRUE;
+   SIM_PORT_ExitCritical();
+}
+
+static void HandleResp( ABP_MsgType* psMsg )
+{
+   UINT16 iModuleType = 0;
+
+   ABCC_GetMsgData16( psMsg, &iModuleType, 0 );
+
+   if( ( test_lNumResp >= TEST_NUM_CMDS ) ||
+       ( ABCC_VerifyMessage( psMsg ) != ABCC_EC_NO_ERROR ) ||
+       ( ABCC_GetMsgDataSize( psMsg ) != ABP_UINT16_SIZEOF ) ||
+       ( iModuleType == 0 ) ||
+       ( ABCC_GetMsgSourceId( psMsg ) != test_abSrcId[ test_lNumResp ] ) )
+   {
+      test_lNumBadResp++;
+   }
+
+   test_lNumResp++;
+}
+
+static void* Producer( void* pxArg )
+{
+   ABP_MsgType* psMsg;
+   UINT32 lCmd;
+
+   (void)pxArg;
+
+   for( lCmd = 0; lCmd < TEST_NUM_CMDS; lCmd++ )
+   {
+      /*
+      ** This is the only producer of the command queue, the queue can only
+      ** get more room until the command is sent.
+      */
+      psMsg = NULL;
+      while( !IsStopped() )
+      {
+         if( ABCC_GetCmdQueueSize() > 0 )
+         {
+            psMsg = ABCC_GetCmdMsgBuffer();
+            if( psMsg != NULL )
+            {
+               break;
+            }
+         }
+         (void)sched_yield();
+      }
+
+      if( psMsg == NULL )
+      {
+         break;
+      }
+
+      test_abSrcId[ lCmd ] = ABCC_GetNewSourceId();
+      ABCC_GetAttribute( psMsg, ABP_OBJ_NUM_ANB, 1, ABP_ANB_IA_MODULE_TYPE,
+                         test_abSrcId[ lCmd ] );
+
+      if( ABCC_SendCmdMsg( psMsg, HandleResp ) != ABCC_EC_NO_ERROR )
+      {
+         break;
+      }
+   }
+
+   return( NULL );
+}
+
+int main( void )
+{
+   pthread_t xProducer;
+   APPL_AbccHandlerStatusType eStatus;
+   ABP_MsgType sMsg;
+   UINT32 lCycle;
+   UINT32 lNumModuleCmds = 0;
+   UINT32 lNumModuleResp = 0;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   TEST_CHECK( pthread_create( &xProducer, NULL, Producer, NULL ) == 0 );
+
+   for( lCycle = 0; lCycle < TEST_MAX_CYCLES; lCycle++ )
+   {
+      if( ( test_lNumResp == TEST_NUM_CMDS ) &&
+          ( lNumModuleResp == lNumModuleCmds ) )
+      {
+         break;
+      }
+
+      /*
+      ** Keep commands from the module coming while the producer has work, so
+      ** that responses are queued from this thread at the same time.
+      */
+      if( ( test_lNumResp < TEST_NUM_CMDS ) &&
+          ( ( lCycle % TEST_MODULE_CMD_INTERVAL ) == 0 ) )
+      {
+         memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+         sMsg.sHeader.bSourceId = (UINT8)lNumModuleCmds;
+         sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+         sMsg.sHeader.iInstance = SIM_ADI_INST( lNumModuleCmds % SIM_NUM_ADI );
+         sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+         sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+         if( SIM_SendCmd( &sMsg ) )
+         {
+            lNumModuleCmds++;
+         }
+      }
+
+      /*
+      ** The driver is run as an interrupt would be, i.e. not while the
+      ** producer is in a critical section. The lock-free queue operations of
+      ** the producer run concurrently with it.
+      */
+      SIM_PORT_EnterCritical();
+      eStatus = SIM_APPL_RunCycle();
+      SIM_PORT_ExitCritical();
+
+      /*
+      ** Lets the producer run on a single CPU.
+      */
+      (void)sched_yield();
+
+      if( eStatus != APPL_MODULE_NO_ERROR )
+      {
+         break;
+      }
+
+      while( SIM_GetResp( &sMsg ) )
+      {
+         TEST_CHECK( ( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) == 0 );
+         TEST_CHECK_EQ( sMsg.sHeader.bSourceId, (UINT8)lNumModuleResp );
+         lNumModuleResp++;
+      }
+   }
+
+   Stop();
+   TEST_CHECK( pthread_join( xProducer, NULL ) == 0 );
+
+   TEST_CHECK_EQ( test_lNumResp, TEST_NUM_CMDS );
+   TEST_CHECK_EQ( test_lNumBadResp, 0 );
+   TEST_CHECK( lNumModuleCmds > 0 );
+   TEST_CHECK_EQ( lNumModuleResp, lNumModuleCmds );
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,285 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Dispatch of received commands to the host objects. With the object registry
+** (ABCC_CFG_OBJ_REGISTRY_ENABLED) a vendor object registered with
+** ABCC_RegisterObject() must receive its commands, and a host object of the
+** application can be replaced by another handler and registered back. An
+** unregistered object is unsupported. Without the registry the commands are
+** passed to the application's own object list.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "application_abcc_handler.h"
+#include "application_data_instance_config.h"
+#include "application_data_object.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+/*
+** Object number not used by any object of the driver or the module.
+*/
+#define TEST_OBJ_NUM_VENDOR            ( 0x7F )
+
+#define TEST_VENDOR_CMD                ( 0x10 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+/*
+** Commands received by the handlers registered here.
+*/
+static UINT16 test_iNumVendorCmds;
+static UINT16 test_iNumOtherCmds;
+static ABP_MsgHeaderType test_sLastHeader;
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+/*
+** Responds with the command data reversed.
+*/
+static void VendorObjHandler( ABP_MsgType* psMsg )
+{
+   UINT8 abData[ ABCC_CFG_MAX_MSG_SIZE ];
+   UINT16 iSize;
+   UINT16 i;
+
+   test_iNumVendorCmds++;
+   memcpy( &test_sLastHeader, &psMsg->sHeader, sizeof( test_sLastHeader ) );
+
+   iSize = ABCC_GetMsgDataSize( psMsg );
+   for( i = 0; i < iSize; i++ )
+   {
+      abData[ i ] = ABCC_GetMsgDataPtr( psMsg )[ iSize - 1 - i ];
+   }
+   memcpy( ABCC_GetMsgDataPtr( psMsg ), abData, iSize );
+   ABP_SetMsgResponse( psMsg, iSize );
+   ABCC_SendRespMsg( psMsg );
+}
+
+static void OtherObjHandler( ABP_MsgType* psMsg )
+{
+   test_iNumOtherCmds++;
+   ABP_SetMsgErrorResponse( psMsg, 1, ABP_ERR_OBJ_SPECIFIC );
+   ABCC_SendRespMsg( psMsg );
+}
+#endif
+
+/*------------------------------------------------------------------------------
+** Sends a command with three octets of data to an object.
+**------------------------------------------------------------------------------
+** Arguments:
+**    bObj           - Destination object.
+**    psMsg          - Response.
+**
+** Returns:
+**    Error code of an error response, ABP_ERR_NO_ERROR if none.
+**------------------------------------------------------------------------------
+*/
+static UINT8 SendCmd( UINT8 bObj, ABP_MsgType* psMsg )
+{
+   memset( &psMsg->sHeader, 0, sizeof( psMsg->sHeader ) );
+   psMsg->sHeader.bSourceId = 1;
+   psMsg->sHeader.bDestObj = bObj;
+   psMsg->sHeader.iInstance = 2;
+   psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT | TEST_VENDOR_CMD;
+   psMsg->sHeader.bCmdExt0 = 3;
+   psMsg->sHeader.bCmdExt1 = 4;
+   psMsg->sHeader.iDataSize = 3;
+   psMsg->abData[ 0 ] = 0x11;
+   psMsg->abData[ 1 ] = 0x22;
+   psMsg->abData[ 2 ] = 0x33;
+
+   if( SIM_APPL_Transact( psMsg, 100 ) == 0 )
+   {
+      TEST_CHECK( FALSE );
+      return( ABP_ERR_GENERAL_ERROR );
+   }
+
+   if( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT )
+   {
+      return( psMsg->abData[ 0 ] );
+   }
+
+   return( ABP_ERR_NO_ERROR );
+}
+
+/*------------------------------------------------------------------------------
+** Checks that the application data object answers, or that it is
+** unsupported.
+**------------------------------------------------------------------------------
+*/
+static void CheckAppd( BOOL fSupported )
+{
+   ABP_MsgType sMsg;
+
+   memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+   sMsg.sHeader.bSourceId = 1;
+   sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+   sMsg.sHeader.iInstance = ABP_INST_OBJ;
+   sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+   sMsg.sHeader.bCmdExt0 = ABP_OA_NUM_INST;
+
+   TEST_CHECK( SIM_APPL_Transact( &sMsg, 100 ) != 0 );
+   if( fSupported )
+   {
+      TEST_CHECK( !( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) );
+      TEST_CHECK_EQ( sMsg.sHeader.iDataSize, ABP_UINT16_SIZEOF );
+      TEST_CHECK_EQ( sMsg.abData[ 0 ] | ( sMsg.abData[ 1 ] << 8 ), APPL_GetNumAdi() );
+   }
+   else
+   {
+      TEST_CHECK( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT );
+      TEST_CHECK_EQ( sMsg.abData[ 0 ], ABP_ERR_UNSUP_OBJ );
+   }
+}
+
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+/*------------------------------------------------------------------------------
+** A registered vendor object gets its commands, with the header as sent, and
+** its response is passed back.
+**------------------------------------------------------------------------------
+*/
+static void CheckVendorObj( void )
+{
+   ABP_MsgType sMsg;
+
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR, &sMsg ), ABP_ERR_UNSUP_OBJ );
+
+   TEST_CHECK_EQ( ABCC_RegisterObject( TEST_OBJ_NUM_VENDOR, VendorObjHandler ),
+                  ABCC_EC_NO_ERROR );
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR, &sMsg ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( test_iNumVendorCmds, 1 );
+   TEST_CHECK_EQ( test_sLastHeader.bDestObj, TEST_OBJ_NUM_VENDOR );
+   TEST_CHECK_EQ( iLeTOi( test_sLastHeader.iInstance ), 2 );
+   TEST_CHECK_EQ( test_sLastHeader.bCmd & ABP_MSG_HEADER_CMD_BITS, TEST_VENDOR_CMD );
+   TEST_CHECK_EQ( test_sLastHeader.bCmdExt0, 3 );
+   TEST_CHECK_EQ( test_sLastHeader.bCmdExt1, 4 );
+   TEST_CHECK_EQ( sMsg.sHeader.iDataSize, 3 );
+   TEST_CHECK_EQ( sMsg.abData[ 0 ], 0x33 );
+   TEST_CHECK_EQ( sMsg.abData[ 2 ], 0x11 );
+
+   /*
+   ** The same handler again is accepted, another one or none is not, and the
+   ** registered handler is kept.
+   */
+   TEST_CHECK_EQ( ABCC_RegisterObject( TEST_OBJ_NUM_VENDOR, VendorObjHandler ),
+                  ABCC_EC_NO_ERROR );
+   TEST_CHECK_EQ( ABCC_RegisterObject( TEST_OBJ_NUM_VENDOR, OtherObjHandler ),
+                  ABCC_EC_PARAMETER_NOT_VALID );
+   TEST_CHECK_EQ( ABCC_RegisterObject( TEST_OBJ_NUM_VENDOR, NULL ),
+                  ABCC_EC_PARAMETER_NOT_VALID );
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR, &sMsg ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( test_iNumVendorCmds, 2 );
+   TEST_CHECK_EQ( test_iNumOtherCmds, 0 );
+
+   /*
+   ** Other objects are not affected.
+   */
+   CheckAppd( TRUE );
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR + 1, &sMsg ), ABP_ERR_UNSUP_OBJ );
+   TEST_CHECK_EQ( test_iNumVendorCmds, 2 );
+
+   ABCC_UnregisterObject( TEST_OBJ_NUM_VENDOR );
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR, &sMsg ), ABP_ERR_UNSUP_OBJ );
+   TEST_CHECK_EQ( test_iNumVendorCmds, 2 );
+
+   /*
+   ** Another handler once the first one is removed.
+   */
+   TEST_CHECK_EQ( ABCC_RegisterObject( TEST_OBJ_NUM_VENDOR, OtherObjHandler ),
+                  ABCC_EC_NO_ERROR );
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR, &sMsg ), ABP_ERR_OBJ_SPECIFIC );
+   TEST_CHECK_EQ( test_iNumOtherCmds, 1 );
+   ABCC_UnregisterObject( TEST_OBJ_NUM_VENDOR );
+}
+
+/*------------------------------------------------------------------------------
+** A host object registered by the application is replaced, removed and
+** registered back.
+**------------------------------------------------------------------------------
+*/
+static void CheckReplaceAppd( void )
+{
+   ABP_MsgType sMsg;
+
+   TEST_CHECK_EQ( ABCC_RegisterObject( ABP_OBJ_NUM_APPD, OtherObjHandler ),
+                  ABCC_EC_PARAMETER_NOT_VALID );
+   CheckAppd( TRUE );
+
+   ABCC_UnregisterObject( ABP_OBJ_NUM_APPD );
+   CheckAppd( FALSE );
+
+   TEST_CHECK_EQ( ABCC_RegisterObject( ABP_OBJ_NUM_APPD, OtherObjHandler ),
+                  ABCC_EC_NO_ERROR );
+   TEST_CHECK_EQ( SendCmd( ABP_OBJ_NUM_APPD, &sMsg ), ABP_ERR_OBJ_SPECIFIC );
+   TEST_CHECK_EQ( test_iNumOtherCmds, 2 );
+
+   ABCC_UnregisterObject( ABP_OBJ_NUM_APPD );
+   TEST_CHECK_EQ( ABCC_RegisterObject( ABP_OBJ_NUM_APPD, AD_ProcObjectRequest ),
+                  ABCC_EC_NO_ERROR );
+   CheckAppd( TRUE );
+}
+#endif
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   ABP_MsgType sMsg;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   CheckAppd( TRUE );
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR, &sMsg ), ABP_ERR_UNSUP_OBJ );
+
+#if ABCC_CFG_OBJ_REGISTRY_ENABLED
+   CheckVendorObj();
+   CheckReplaceAppd();
+
+   /*
+   ** A vendor object stays registered over a restart, where the application
+   ** registers its own objects again.
+   */
+   TEST_CHECK_EQ( ABCC_RegisterObject( TEST_OBJ_NUM_VENDOR, VendorObjHandler ),
+                  ABCC_EC_NO_ERROR );
+   APPL_RestartAbcc();
+   (void)SIM_APPL_RunCycle();
+   TEST_CHECK( SIM_APPL_Start() );
+   CheckAppd( TRUE );
+   TEST_CHECK_EQ( SendCmd( TEST_OBJ_NUM_VENDOR, &sMsg ), ABP_ERR_NO_ERROR );
+   TEST_CHECK_EQ( test_iNumVendorCmds, 3 );
+#endif
+
+   return( TEST_Result() );
+}
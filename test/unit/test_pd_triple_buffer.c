@@ -0,0 +1,77 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Process data triple buffers (ABCC_CFG_PD_TRIPLE_BUFFER_ENABLED): the images
+** have the sizes mapped during setup and carry the raw process data.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "test_util.h"
+
+int main( int argc, char* argv[] )
+{
+   UINT8 abPd[ SIM_MAX_PD_SIZE ];
+   UINT8* pbPd;
+   UINT16 iIndex;
+
+   (void)argc;
+   (void)argv;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+   TEST_CHECK( SIM_GetReadPdSize() > 0 );
+   TEST_CHECK( SIM_GetWritePdSize() > 0 );
+
+   for( iIndex = 0; iIndex < sizeof( abPd ); iIndex++ )
+   {
+      abPd[ iIndex ] = (UINT8)( iIndex * 13 + 5 );
+   }
+
+   /*
+   ** Read image.
+   */
+   SIM_SetReadPd( abPd, SIM_GetReadPdSize() );
+   for( iIndex = 0; iIndex < 5; iIndex++ )
+   {
+      TEST_CHECK( SIM_APPL_RunCycle() == APPL_MODULE_NO_ERROR );
+   }
+
+   pbPd = (UINT8*)ABCC_PdAcquireRead();
+   TEST_CHECK( pbPd != NULL );
+   if( pbPd != NULL )
+   {
+      TEST_CHECK( memcmp( pbPd, abPd, SIM_GetReadPdSize() ) == 0 );
+   }
+   ABCC_PdReleaseRead();
+
+   /*
+   ** Write image.
+   */
+   pbPd = (UINT8*)ABCC_PdAcquireWrite();
+   memcpy( pbPd, &abPd[ 100 ], SIM_GetWritePdSize() );
+   ABCC_PdReleaseWrite();
+   for( iIndex = 0; iIndex < 5; iIndex++ )
+   {
+      TEST_CHECK( SIM_APPL_RunCycle() == APPL_MODULE_NO_ERROR );
+   }
+
+   TEST_CHECK( memcmp( SIM_GetWritePd(), &abPd[ 100 ], SIM_GetWritePdSize() ) == 0 );
+
+   return( TEST_Result() );
+}
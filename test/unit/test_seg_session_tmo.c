@@ -0,0 +1,379 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Segmented responses of the EtherCAT ENUM ADI list and of a large ADI value
+** that are left waiting for their next segment request. An idle session must
+** be reclaimed after ABCC_CFG_SEG_SESSION_TMO_MS, with the done callback
+** called so that the object can start a new response, while each segment
+** request restarts the timeout of its own session. With two sessions in one
+** hash slot both responses are sent interleaved, and one of them times out
+** while the other goes on. With one session a response of another object
+** can be started once the idle one has been reclaimed.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "application_abcc_handler.h"
+#include "application_data_instance_config.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_MAX_VALUE_SIZE            ( 1024 )
+#define TEST_LARGE16_SIZE              ( 200 * ABP_UINT16_SIZEOF )
+
+/*
+** Idle times, in application cycles of 1 ms, just within and well past the
+** session timeout.
+*/
+#define TEST_IDLE_ALIVE                ( ABCC_CFG_SEG_SESSION_TMO_MS - 10 )
+#define TEST_IDLE_TMO                  ( ABCC_CFG_SEG_SESSION_TMO_MS + 10 )
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Segmented Get_Attribute in progress, put together segment by segment.
+**------------------------------------------------------------------------------
+*/
+typedef struct test_SegGet
+{
+   UINT8  bObj;
+   UINT16 iInstance;
+   UINT8  bAttr;
+   UINT8  abValue[ TEST_MAX_VALUE_SIZE ];
+   UINT16 iSize;
+   UINT16 iNumSegments;
+   BOOL   fDone;
+}
+test_SegGetType;
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT32 test_lSeed = 2024;
+
+static test_SegGetType test_sEnumAdis;
+static test_SegGetType test_sLarge16;
+
+/*
+** Expected values, in network format (LSB first).
+*/
+static UINT8  test_abEnumAdis[ TEST_MAX_VALUE_SIZE ];
+static UINT16 test_iEnumAdisSize;
+static UINT8  test_abLarge16[ TEST_LARGE16_SIZE ];
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static UINT8 Random( void )
+{
+   test_lSeed = test_lSeed * 1103515245UL + 12345UL;
+   return( (UINT8)( test_lSeed >> 16 ) );
+}
+
+static void ExpectEnumAdis( void )
+{
+   UINT16 iIndex;
+
+   test_iEnumAdisSize = 0;
+   for( iIndex = 0; iIndex < APPL_GetNumAdi(); iIndex++ )
+   {
+      if( APPL_asAdiEntryList[ iIndex ].bDataType == ABP_ENUM )
+      {
+         test_abEnumAdis[ test_iEnumAdisSize++ ] =
+            (UINT8)APPL_asAdiEntryList[ iIndex ].iInstance;
+         test_abEnumAdis[ test_iEnumAdisSize++ ] =
+            (UINT8)( APPL_asAdiEntryList[ iIndex ].iInstance >> 8 );
+      }
+   }
+
+   TEST_CHECK( test_iEnumAdisSize > 2 * ABCC_CFG_MAX_MSG_SIZE );
+}
+
+/*
+** New random Large16 value, which must not change while it is sent.
+*/
+static void ExpectLarge16( void )
+{
+   UINT16 i;
+
+   for( i = 0; i < 200; i++ )
+   {
+      SIM_aiLarge16[ i ] = (UINT16)( Random() | ( Random() << 8 ) );
+      test_abLarge16[ 2 * i ] = (UINT8)SIM_aiLarge16[ i ];
+      test_abLarge16[ 2 * i + 1 ] = (UINT8)( SIM_aiLarge16[ i ] >> 8 );
+   }
+}
+
+static void StartSegGet( test_SegGetType* psGet, UINT8 bObj,
+                         UINT16 iInstance, UINT8 bAttr )
+{
+   psGet->bObj = bObj;
+   psGet->iInstance = iInstance;
+   psGet->bAttr = bAttr;
+   psGet->iSize = 0;
+   psGet->iNumSegments = 0;
+   psGet->fDone = FALSE;
+}
+
+/*------------------------------------------------------------------------------
+** Sends the Get_Attribute, which is also the request for the next segment,
+** and adds the segment in the response. Only the first segment is flagged
+** SEG_FIRST.
+**------------------------------------------------------------------------------
+** Returns:
+**    Error code of an error response, ABP_ERR_NO_ERROR if none.
+**------------------------------------------------------------------------------
+*/
+static UINT8 NextSegment( test_SegGetType* psGet )
+{
+   ABP_MsgType sMsg;
+
+   TEST_CHECK( !psGet->fDone );
+
+   memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+   sMsg.sHeader.bSourceId = 1;
+   sMsg.sHeader.bDestObj = psGet->bObj;
+   sMsg.sHeader.iInstance = psGet->iInstance;
+   sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+   sMsg.sHeader.bCmdExt0 = psGet->bAttr;
+
+   if( SIM_APPL_Transact( &sMsg, 100 ) == 0 )
+   {
+      TEST_CHECK( FALSE );
+      return( ABP_ERR_GENERAL_ERROR );
+   }
+
+   if( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT )
+   {
+      return( sMsg.abData[ 0 ] );
+   }
+
+   TEST_CHECK_EQ( sMsg.sHeader.bCmdExt0, psGet->bAttr );
+   TEST_CHECK_EQ( sMsg.sHeader.bCmdExt1 & ABP_MSG_CMDEXT1_SEG_FIRST,
+                  psGet->iNumSegments == 0 ? ABP_MSG_CMDEXT1_SEG_FIRST : 0 );
+
+   if( ( psGet->iSize + sMsg.sHeader.iDataSize ) > TEST_MAX_VALUE_SIZE )
+   {
+      TEST_CHECK( FALSE );
+      psGet->fDone = TRUE;
+      return( ABP_ERR_NO_ERROR );
+   }
+
+   memcpy( &psGet->abValue[ psGet->iSize ], sMsg.abData, sMsg.sHeader.iDataSize );
+   psGet->iSize += sMsg.sHeader.iDataSize;
+   psGet->iNumSegments++;
+   psGet->fDone = ( sMsg.sHeader.bCmdExt1 & ABP_MSG_CMDEXT1_SEG_LAST ) != 0;
+
+   return( ABP_ERR_NO_ERROR );
+}
+
+/*------------------------------------------------------------------------------
+** Requests the remaining segments and compares the value with the expected
+** one.
+**------------------------------------------------------------------------------
+*/
+static void Finish( test_SegGetType* psGet, const UINT8* pbExpected,
+                    UINT16 iExpectedSize )
+{
+   while( !psGet->fDone )
+   {
+      if( NextSegment( psGet ) != ABP_ERR_NO_ERROR )
+      {
+         TEST_CHECK( FALSE );
+         break;
+      }
+   }
+
+   TEST_CHECK_EQ( psGet->iSize, iExpectedSize );
+   if( psGet->iSize == iExpectedSize )
+   {
+      TEST_CHECK( memcmp( psGet->abValue, pbExpected, iExpectedSize ) == 0 );
+   }
+}
+
+static void FinishEnumAdis( void )
+{
+   Finish( &test_sEnumAdis, test_abEnumAdis, test_iEnumAdisSize );
+}
+
+static void FinishLarge16( void )
+{
+   Finish( &test_sLarge16, test_abLarge16, TEST_LARGE16_SIZE );
+}
+
+static void StartEnumAdis( void )
+{
+   StartSegGet( &test_sEnumAdis, ABP_OBJ_NUM_ECT, 1, ABP_ECT_IA_ENUM_ADIS );
+   TEST_CHECK_EQ( NextSegment( &test_sEnumAdis ), ABP_ERR_NO_ERROR );
+   TEST_CHECK( !test_sEnumAdis.fDone );
+}
+
+static void StartLarge16( void )
+{
+   ExpectLarge16();
+   StartSegGet( &test_sLarge16, ABP_OBJ_NUM_APPD, SIM_ADI_INST_LARGE16,
+                ABP_APPD_IA_VALUE );
+   TEST_CHECK_EQ( NextSegment( &test_sLarge16 ), ABP_ERR_NO_ERROR );
+   TEST_CHECK( !test_sLarge16.fDone );
+}
+
+static void Idle( UINT16 iNumCycles )
+{
+   UINT16 i;
+
+   for( i = 0; i < iNumCycles; i++ )
+   {
+      TEST_CHECK_EQ( SIM_APPL_RunCycle(), APPL_MODULE_NO_ERROR );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** A session waiting for less than the timeout between its segment requests
+** lives on, in total longer than the timeout.
+**------------------------------------------------------------------------------
+*/
+static void CheckAlive( void )
+{
+   StartEnumAdis();
+   while( !test_sEnumAdis.fDone )
+   {
+      Idle( TEST_IDLE_ALIVE );
+      TEST_CHECK_EQ( NextSegment( &test_sEnumAdis ), ABP_ERR_NO_ERROR );
+   }
+   TEST_CHECK( test_sEnumAdis.iNumSegments * TEST_IDLE_ALIVE >
+               ABCC_CFG_SEG_SESSION_TMO_MS );
+   FinishEnumAdis();
+}
+
+/*------------------------------------------------------------------------------
+** An idle session is reclaimed, and the next request of the same attribute
+** starts a new response from the beginning. The object must have been told,
+** or it would still refuse a new response.
+**------------------------------------------------------------------------------
+*/
+static void CheckTmo( void )
+{
+   StartEnumAdis();
+   (void)NextSegment( &test_sEnumAdis );
+   Idle( TEST_IDLE_TMO );
+   StartEnumAdis();
+   FinishEnumAdis();
+
+   StartLarge16();
+   Idle( TEST_IDLE_TMO );
+   StartLarge16();
+   FinishLarge16();
+}
+
+#if( ABCC_CFG_NUM_SEG_SESSIONS == 1 )
+/*------------------------------------------------------------------------------
+** With one session a response of another object can only be started once the
+** idle one has been reclaimed.
+**------------------------------------------------------------------------------
+*/
+static void CheckReclaimed( void )
+{
+   StartEnumAdis();
+   Idle( TEST_IDLE_TMO );
+   StartLarge16();
+   FinishLarge16();
+
+   StartLarge16();
+   Idle( TEST_IDLE_TMO );
+   StartEnumAdis();
+   FinishEnumAdis();
+}
+#else
+/*------------------------------------------------------------------------------
+** Two responses in progress at the same time, with their segment requests
+** interleaved. Then one of them is left to time out while the other one
+** goes on.
+**------------------------------------------------------------------------------
+*/
+static void CheckConcurrent( void )
+{
+   StartEnumAdis();
+   StartLarge16();
+   while( !test_sEnumAdis.fDone || !test_sLarge16.fDone )
+   {
+      if( !test_sLarge16.fDone )
+      {
+         TEST_CHECK_EQ( NextSegment( &test_sLarge16 ), ABP_ERR_NO_ERROR );
+      }
+      if( !test_sEnumAdis.fDone )
+      {
+         TEST_CHECK_EQ( NextSegment( &test_sEnumAdis ), ABP_ERR_NO_ERROR );
+      }
+   }
+   FinishEnumAdis();
+   FinishLarge16();
+
+   StartEnumAdis();
+   StartLarge16();
+   while( !test_sLarge16.fDone )
+   {
+      Idle( TEST_IDLE_ALIVE / 2 );
+      TEST_CHECK_EQ( NextSegment( &test_sLarge16 ), ABP_ERR_NO_ERROR );
+   }
+   FinishLarge16();
+
+   StartEnumAdis();
+   StartLarge16();
+   Idle( TEST_IDLE_ALIVE );
+   TEST_CHECK_EQ( NextSegment( &test_sEnumAdis ), ABP_ERR_NO_ERROR );
+   Idle( TEST_IDLE_ALIVE );
+   FinishEnumAdis();
+   StartLarge16();
+   FinishLarge16();
+}
+#endif
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   ExpectEnumAdis();
+
+   CheckAlive();
+   CheckTmo();
+#if( ABCC_CFG_NUM_SEG_SESSIONS == 1 )
+   CheckReclaimed();
+#else
+   CheckConcurrent();
+#endif
+   CheckTmo();
+
+   return( TEST_Result() );
+}
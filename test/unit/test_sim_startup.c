@@ -0,0 +1,124 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Driver startup against the simulated module: setup sequence, default map
+** and process data in both directions, host object commands and recovery
+** from CRC errors of the frames towards the host. Built for each operating
+** mode of the simulator, the parallel interface has no CRC to corrupt.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "test_util.h"
+
+/*
+** Default map sizes, see sim_application.h.
+*/
+#define TEST_READ_PD_SIZE  ( 64 * 2 + 128 / 8 + SIM_NUM_MAPPED_ADI * 2 )
+#define TEST_WRITE_PD_SIZE ( 32 * 4 + ( 40 * 3 + 7 ) / 8 + SIM_NUM_MAPPED_ADI * 2 )
+
+int main( void )
+{
+   UINT8 abPd[ SIM_MAX_PD_SIZE ];
+   ABP_MsgType sMsg;
+   UINT16 iIndex;
+   UINT16 iOffset;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   TEST_CHECK_EQ( SIM_GetReadPdSize(), TEST_READ_PD_SIZE );
+   TEST_CHECK_EQ( SIM_GetWritePdSize(), TEST_WRITE_PD_SIZE );
+
+   /*
+   ** Read process data reaches the ADIs.
+   */
+   for( iIndex = 0; iIndex < sizeof( abPd ); iIndex++ )
+   {
+      abPd[ iIndex ] = (UINT8)( iIndex * 7 + 1 );
+   }
+   SIM_SetReadPd( abPd, SIM_GetReadPdSize() );
+
+   for( iIndex = 0; iIndex < 10; iIndex++ )
+   {
+      TEST_CHECK( SIM_APPL_RunCycle() == APPL_MODULE_NO_ERROR );
+   }
+
+   TEST_CHECK( memcmp( SIM_aiArray16, abPd, sizeof( SIM_aiArray16 ) ) == 0 );
+   iOffset = 64 * 2 + 128 / 8;
+   for( iIndex = 0; iIndex < SIM_NUM_MAPPED_ADI; iIndex++ )
+   {
+      TEST_CHECK_EQ( SIM_aiAdi[ iIndex ],
+                     abPd[ iOffset + iIndex * 2 ] |
+                     ( abPd[ iOffset + iIndex * 2 + 1 ] << 8 ) );
+   }
+
+   /*
+   ** ADIs reach the write process data.
+   */
+   for( iIndex = 0; iIndex < SIM_NUM_MAPPED_ADI; iIndex++ )
+   {
+      SIM_aiAdi[ SIM_NUM_MAPPED_ADI + iIndex ] = (UINT16)( 0x1000 + iIndex );
+   }
+
+   for( iIndex = 0; iIndex < 10; iIndex++ )
+   {
+      TEST_CHECK( SIM_APPL_RunCycle() == APPL_MODULE_NO_ERROR );
+   }
+
+   iOffset = 32 * 4 + ( 40 * 3 + 7 ) / 8;
+   for( iIndex = 0; iIndex < SIM_NUM_MAPPED_ADI; iIndex++ )
+   {
+      TEST_CHECK_EQ( SIM_GetWritePd()[ iOffset + iIndex * 2 ] |
+                     ( SIM_GetWritePd()[ iOffset + iIndex * 2 + 1 ] << 8 ),
+                     0x1000 + iIndex );
+   }
+
+   /*
+   ** Get attribute of an ADI through the application data object.
+   */
+   memset( &sMsg, 0, sizeof( sMsg ) );
+   sMsg.sHeader.bSourceId = 1;
+   sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+   sMsg.sHeader.iInstance = SIM_ADI_INST( 40 );
+   sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+   sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+   SIM_aiAdi[ 40 ] = 0xBEEF;
+
+   TEST_CHECK( SIM_APPL_Transact( &sMsg, 100 ) != 0 );
+   TEST_CHECK( ( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) == 0 );
+   TEST_CHECK_EQ( sMsg.sHeader.iDataSize, 2 );
+   TEST_CHECK_EQ( sMsg.abData[ 0 ] | ( sMsg.abData[ 1 ] << 8 ), 0xBEEF );
+
+#if !ABCC_CFG_DRV_PARALLEL_ENABLED
+   /*
+   ** Corrupted MISO frames or pongs are retransmitted without losing the
+   ** message. A serial host only retransmits after the telegram timeout.
+   */
+   SIM_CorruptMisoCrc( 3 );
+   sMsg.sHeader.iDataSize = 0;
+   sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_GET_ATTR;
+   sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+   TEST_CHECK( SIM_APPL_Transact( &sMsg, 100 + 3 * ABCC_CFG_SERIAL_TMO_625 ) != 0 );
+   TEST_CHECK_EQ( sMsg.abData[ 0 ] | ( sMsg.abData[ 1 ] << 8 ), 0xBEEF );
+   TEST_CHECK( SIM_GetStats()->lNumRetransmits > 0 );
+   TEST_CHECK_EQ( SIM_GetStats()->lNumMosiCrcErrors, 0 );
+#endif
+
+   return( TEST_Result() );
+}
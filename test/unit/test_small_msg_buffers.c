@@ -0,0 +1,169 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Small message buffers (ABCC_CFG_NUM_SMALL_MSG_RESOURCES): the driver runs
+** its short commands in them, a short response is received in one, and the
+** link layer rejects a message larger than its buffer. The free stacks of the
+** buffer pool are also shared by several threads allocating and freeing
+** concurrently.
+********************************************************************************
+*/
+
+#include <pthread.h>
+#include <sched.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_memory.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "test_util.h"
+
+#define TEST_NUM_THREADS               ( 4 )
+#define TEST_ALLOCS_PER_THREAD         ( 20000 )
+#define TEST_NUM_FULL_SIZE_MSG         ( ABCC_CFG_MAX_NUM_APPL_CMDS + ABCC_CFG_MAX_NUM_ABCC_CMDS )
+
+static UINT16 test_iFwVersionRespSize;
+static UINT16 test_iFwVersionRespBufSize;
+static BOOL   test_fFwVersionResp;
+static UINT32 test_alNumCorrupted[ TEST_NUM_THREADS ];
+
+static void HandleFwVersionResp( ABP_MsgType* psMsg )
+{
+   test_fFwVersionResp = ( ABCC_VerifyMessage( psMsg ) == ABCC_EC_NO_ERROR );
+   test_iFwVersionRespSize = ABCC_GetMsgDataSize( psMsg );
+   test_iFwVersionRespBufSize = ABCC_MemGetMaxDataSize( psMsg );
+}
+
+/*
+** Allocates, stamps, checks and frees buffers of both classes. A buffer handed
+** out twice at the same time would get the stamp of another thread.
+*/
+static void* AllocFree( void* pxArg )
+{
+   UINT32* plNumCorrupted;
+   ABP_MsgType* psMsg;
+   UINT8 bStamp;
+   UINT32 i;
+
+   plNumCorrupted = (UINT32*)pxArg;
+   bStamp = (UINT8)( plNumCorrupted - test_alNumCorrupted + 1 );
+
+   for( i = 0; i < TEST_ALLOCS_PER_THREAD; i++ )
+   {
+      psMsg = ABCC_MemAllocSize( ( i & 1 ) ? ABCC_CFG_MAX_MSG_SIZE : 0 );
+      if( psMsg == NULL )
+      {
+         sched_yield();
+         continue;
+      }
+
+      psMsg->sHeader.bSourceId = bStamp;
+      if( ( i & 7 ) == 0 )
+      {
+         sched_yield();
+      }
+      if( psMsg->sHeader.bSourceId != bStamp )
+      {
+         ( *plNumCorrupted )++;
+      }
+
+      ABCC_MemFree( &psMsg );
+   }
+
+   return( NULL );
+}
+
+int main( void )
+{
+   ABP_MsgType* psMsg;
+   UINT16 iCycle;
+
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+   TEST_CHECK( SIM_APPL_Start() );
+
+   /*
+   ** A get attribute command in a small buffer.
+   */
+   psMsg = ABCC_GetCmdMsgBufferOfSize( 0 );
+   TEST_CHECK( psMsg != NULL );
+   TEST_CHECK_EQ( ABCC_MemGetMaxDataSize( psMsg ), ABCC_CFG_SMALL_MSG_SIZE );
+
+   ABCC_GetAttribute( psMsg, ABP_OBJ_NUM_ANB, 1, ABP_ANB_IA_FW_VERSION,
+                      ABCC_GetNewSourceId() );
+   TEST_CHECK( ABCC_SendCmdMsg( psMsg, HandleFwVersionResp ) == ABCC_EC_NO_ERROR );
+
+   for( iCycle = 0; ( iCycle < 100 ) && !test_fFwVersionResp; iCycle++ )
+   {
+      TEST_CHECK( SIM_APPL_RunCycle() == APPL_MODULE_NO_ERROR );
+   }
+   TEST_CHECK( test_fFwVersionResp );
+   TEST_CHECK_EQ( test_iFwVersionRespSize, 3 );
+
+   /*
+   ** The response was received in a buffer sized by its header.
+   */
+   TEST_CHECK_EQ( test_iFwVersionRespBufSize, ABCC_CFG_SMALL_MSG_SIZE );
+
+   /*
+   ** A message claiming more data than its small buffer holds is not sent.
+   */
+   psMsg = ABCC_GetCmdMsgBufferOfSize( 0 );
+   TEST_CHECK( psMsg != NULL );
+   ABCC_GetAttribute( psMsg, ABP_OBJ_NUM_ANB, 1, ABP_ANB_IA_FW_VERSION,
+                      ABCC_GetNewSourceId() );
+   ABCC_SetMsgDataSize( psMsg, ABCC_CFG_SMALL_MSG_SIZE + 1 );
+   TEST_CHECK( ABCC_SendCmdMsg( psMsg, HandleFwVersionResp ) == ABCC_EC_WRMSG_SIZE_ERR );
+   TEST_CHECK( ABCC_ReturnMsgBuffer( &psMsg ) == ABCC_EC_NO_ERROR );
+
+   /*
+   ** Concurrent allocation and freeing.
+   */
+   {
+      pthread_t axThread[ TEST_NUM_THREADS ];
+      ABP_MsgType* apsMsg[ ABCC_CFG_NUM_SMALL_MSG_RESOURCES + TEST_NUM_FULL_SIZE_MSG + 1 ];
+      UINT16 iNumMsg;
+      UINT16 t;
+
+      for( t = 0; t < TEST_NUM_THREADS; t++ )
+      {
+         TEST_CHECK( pthread_create( &axThread[ t ], NULL, AllocFree,
+                                     &test_alNumCorrupted[ t ] ) == 0 );
+      }
+      for( t = 0; t < TEST_NUM_THREADS; t++ )
+      {
+         (void)pthread_join( axThread[ t ], NULL );
+         TEST_CHECK_EQ( test_alNumCorrupted[ t ], 0 );
+      }
+
+      /*
+      ** All buffers are back on the free stacks, each one once.
+      */
+      for( iNumMsg = 0; iNumMsg < ( sizeof( apsMsg ) / sizeof( apsMsg[ 0 ] ) ); iNumMsg++ )
+      {
+         apsMsg[ iNumMsg ] = ABCC_MemAllocSize( 0 );
+         if( apsMsg[ iNumMsg ] == NULL )
+         {
+            break;
+         }
+      }
+      TEST_CHECK_EQ( iNumMsg, ABCC_CFG_NUM_SMALL_MSG_RESOURCES + TEST_NUM_FULL_SIZE_MSG );
+
+      while( iNumMsg > 0 )
+      {
+         ABCC_MemFree( &apsMsg[ --iNumMsg ] );
+      }
+   }
+
+   return( TEST_Result() );
+}
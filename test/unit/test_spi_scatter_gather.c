@@ -0,0 +1,449 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** SPI scatter-gather (ABCC_CFG_SPI_SCATTER_GATHER_ENABLED) against the staged
+** SPI frames. Two driver instances, SPI_STAGED without and SPI_SG with
+** scatter-gather, are run in lockstep through the same startup, process data
+** and message traffic in both directions, with messages of several
+** fragments. Every MOSI and MISO frame must be identical, octet by octet,
+** except for the MOSI octets after the end of a message in its last fragment
+** and the CRC, which covers them. Those are not defined, and the simulated
+** module checks the CRC of each path anyway.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_context.h"
+#include "abcc_sim.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+#define TEST_NUM_INSTANCES             ( 2 )
+#define TEST_MAX_CYCLES                ( 10000 )
+#define TEST_NUM_TRAFFIC_CYCLES        ( 2000 )
+#define TEST_LOG_SIZE                  ( 8192 )
+
+/*
+** MOSI frame layout, see abcc_sim.c. The CRC and two pad octets end the
+** frame.
+*/
+#define TEST_MOSI_CTRL                 ( 0 )
+#define TEST_MOSI_MSG_LEN              ( 2 )
+#define TEST_MOSI_DATA                 ( 8 )
+#define TEST_MOSI_CRC_AND_PAD_SIZE     ( 6 )
+
+/*
+** Instance numbers of the simulated application, see sim_application.h.
+*/
+#define TEST_ADI_INST( n )             ( (UINT16)( (n) + 1 ) )
+#define TEST_ADI_INST_ARRAY16          ( 0xF001 )
+#define TEST_ADI_FIRST_WRITE           ( 32 )
+
+/*******************************************************************************
+** Typedefs
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** One driver instance, its simulated module and the frames of the current
+** cycle.
+**------------------------------------------------------------------------------
+*/
+typedef struct test_Instance
+{
+   const ABCC_CtxType* psCtx;
+   void ( *pnSimSetAnbState )( ABP_AnbStateType eState );
+   ABP_AnbStateType ( *pnSimGetAnbState )( void );
+   void ( *pnSimSetSpiMonitor )( SIM_SpiMonitorFuncType pnMonitor );
+   void ( *pnSimSetReadPd )( const void* pxData, UINT16 iSize );
+   BOOL ( *pnSimSendCmd )( const ABP_MsgType* psCmd );
+   BOOL ( *pnSimGetResp )( ABP_MsgType* psResp );
+   const SIM_StatsType* ( *pnSimGetStats )( void );
+   UINT16* paiAdi;
+   SIM_SpiMonitorFuncType pnMonitor;
+   ABCC_MsgHandlerFuncType pnHostResp;
+}
+test_InstanceType;
+
+typedef struct test_Log
+{
+   UINT8  abFrames[ TEST_LOG_SIZE ];
+   UINT16 iSize;
+   UINT16 iNumFrames;
+   BOOL   fOverflow;
+
+   /*
+   ** Message being sent, kept from cycle to cycle.
+   */
+   UINT16 iMsgSize;
+   UINT16 iMsgOffset;
+}
+test_LogType;
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+#define TEST_DECLARE_INSTANCE( prefix )                                        \
+   ABCC_CTX_DECLARE( prefix );                                                 \
+   EXTFUNC void ABCC_INSTANCE_PASTE( prefix, SIM_SetAnbState )( ABP_AnbStateType eState ); \
+   EXTFUNC ABP_AnbStateType ABCC_INSTANCE_PASTE( prefix, SIM_GetAnbState )( void ); \
+   EXTFUNC void ABCC_INSTANCE_PASTE( prefix, SIM_SetSpiMonitor )( SIM_SpiMonitorFuncType pnMonitor ); \
+   EXTFUNC void ABCC_INSTANCE_PASTE( prefix, SIM_SetReadPd )( const void* pxData, UINT16 iSize ); \
+   EXTFUNC BOOL ABCC_INSTANCE_PASTE( prefix, SIM_SendCmd )( const ABP_MsgType* psCmd ); \
+   EXTFUNC BOOL ABCC_INSTANCE_PASTE( prefix, SIM_GetResp )( ABP_MsgType* psResp ); \
+   EXTFUNC const SIM_StatsType* ABCC_INSTANCE_PASTE( prefix, SIM_GetStats )( void ); \
+   EXTVAR UINT16 ABCC_INSTANCE_PASTE( prefix, SIM_aiAdi )[]
+
+#define TEST_INSTANCE( prefix, pnMonitor, pnHostResp )                         \
+   {                                                                           \
+      ABCC_CTX( prefix ),                                                      \
+      ABCC_INSTANCE_PASTE( prefix, SIM_SetAnbState ),                          \
+      ABCC_INSTANCE_PASTE( prefix, SIM_GetAnbState ),                          \
+      ABCC_INSTANCE_PASTE( prefix, SIM_SetSpiMonitor ),                        \
+      ABCC_INSTANCE_PASTE( prefix, SIM_SetReadPd ),                            \
+      ABCC_INSTANCE_PASTE( prefix, SIM_SendCmd ),                              \
+      ABCC_INSTANCE_PASTE( prefix, SIM_GetResp ),                              \
+      ABCC_INSTANCE_PASTE( prefix, SIM_GetStats ),                             \
+      ABCC_INSTANCE_PASTE( prefix, SIM_aiAdi ),                                \
+      pnMonitor,                                                               \
+      pnHostResp                                                               \
+   }
+
+TEST_DECLARE_INSTANCE( SPI_STAGED );
+TEST_DECLARE_INSTANCE( SPI_SG );
+
+static void MonitorStaged( const UINT16* piMosi, const UINT16* piMiso, UINT16 iLength );
+static void MonitorSg( const UINT16* piMosi, const UINT16* piMiso, UINT16 iLength );
+static void HostRespStaged( ABP_MsgType* psMsg );
+static void HostRespSg( ABP_MsgType* psMsg );
+
+static const test_InstanceType test_asInstance[ TEST_NUM_INSTANCES ] =
+{
+   TEST_INSTANCE( SPI_STAGED, MonitorStaged, HostRespStaged ),
+   TEST_INSTANCE( SPI_SG, MonitorSg, HostRespSg )
+};
+
+static test_LogType test_asLog[ TEST_NUM_INSTANCES ];
+static UINT32 test_lNumFramesCompared;
+
+/*
+** Responses to the commands sent by each instance, see SendHostCmd().
+*/
+static UINT16 test_aiNumHostResp[ TEST_NUM_INSTANCES ];
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+/*------------------------------------------------------------------------------
+** Clears the undefined octets of a logged MOSI frame: the message field after
+** the end of the message, all of it if the frame has no message fragment, and
+** the CRC.
+**------------------------------------------------------------------------------
+*/
+static void MaskMosi( test_LogType* psLog, UINT8* pbMosi, UINT16 iLength )
+{
+   UINT16 iFragSize;
+   UINT16 iValid;
+
+   iFragSize = (UINT16)( ( pbMosi[ TEST_MOSI_MSG_LEN ] |
+                           ( pbMosi[ TEST_MOSI_MSG_LEN + 1 ] << 8 ) ) * 2 );
+   iValid = 0;
+
+   if( pbMosi[ TEST_MOSI_CTRL ] & ABP_SPI_CTRL_M )
+   {
+      if( psLog->iMsgOffset == 0 )
+      {
+         psLog->iMsgSize = (UINT16)( sizeof( ABP_MsgHeaderType ) +
+                                     ( pbMosi[ TEST_MOSI_DATA ] |
+                                       ( pbMosi[ TEST_MOSI_DATA + 1 ] << 8 ) ) );
+      }
+
+      if( psLog->iMsgSize > psLog->iMsgOffset )
+      {
+         iValid = (UINT16)( psLog->iMsgSize - psLog->iMsgOffset );
+         if( iValid > iFragSize )
+         {
+            iValid = iFragSize;
+         }
+      }
+
+      psLog->iMsgOffset = (UINT16)( psLog->iMsgOffset + iFragSize );
+      if( pbMosi[ TEST_MOSI_CTRL ] & ABP_SPI_CTRL_LAST_FRAG )
+      {
+         psLog->iMsgOffset = 0;
+      }
+   }
+
+   memset( &pbMosi[ TEST_MOSI_DATA + iValid ], 0, iFragSize - iValid );
+   memset( &pbMosi[ iLength - TEST_MOSI_CRC_AND_PAD_SIZE ], 0,
+           TEST_MOSI_CRC_AND_PAD_SIZE );
+}
+
+static void LogFrame( test_LogType* psLog, const UINT16* piMosi,
+                      const UINT16* piMiso, UINT16 iLength )
+{
+   if( ( psLog->iSize + 2 * iLength ) > TEST_LOG_SIZE )
+   {
+      psLog->fOverflow = TRUE;
+      return;
+   }
+
+   memcpy( &psLog->abFrames[ psLog->iSize ], piMosi, iLength );
+   MaskMosi( psLog, &psLog->abFrames[ psLog->iSize ], iLength );
+   memcpy( &psLog->abFrames[ psLog->iSize + iLength ], piMiso, iLength );
+   psLog->iSize += 2 * iLength;
+   psLog->iNumFrames++;
+}
+
+static void MonitorStaged( const UINT16* piMosi, const UINT16* piMiso, UINT16 iLength )
+{
+   LogFrame( &test_asLog[ 0 ], piMosi, piMiso, iLength );
+}
+
+static void MonitorSg( const UINT16* piMosi, const UINT16* piMiso, UINT16 iLength )
+{
+   LogFrame( &test_asLog[ 1 ], piMosi, piMiso, iLength );
+}
+
+/*
+** A Get of the network type succeeds, a Set of it is refused by the module.
+*/
+static void HostResp( UINT8 bInst, const ABP_MsgType* psMsg )
+{
+   if( psMsg->sHeader.bCmdExt0 == ABP_NW_IA_NW_TYPE )
+   {
+      TEST_CHECK_EQ( ( psMsg->sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) != 0,
+                     ( psMsg->sHeader.bCmd & ABP_MSG_HEADER_CMD_BITS ) ==
+                     ABP_CMD_SET_ATTR );
+   }
+   test_aiNumHostResp[ bInst ]++;
+}
+
+static void HostRespStaged( ABP_MsgType* psMsg )
+{
+   HostResp( 0, psMsg );
+}
+
+static void HostRespSg( ABP_MsgType* psMsg )
+{
+   HostResp( 1, psMsg );
+}
+
+/*------------------------------------------------------------------------------
+** Runs one application cycle of each instance and compares their frames.
+**------------------------------------------------------------------------------
+*/
+static void RunCycle( void )
+{
+   const test_InstanceType* psInst;
+   UINT8 i;
+
+   for( i = 0; i < TEST_NUM_INSTANCES; i++ )
+   {
+      psInst = &test_asInstance[ i ];
+      test_asLog[ i ].iSize = 0;
+      test_asLog[ i ].iNumFrames = 0;
+      test_asLog[ i ].fOverflow = FALSE;
+
+      TEST_CHECK_EQ( APPL_CtxHandleAbcc( psInst->psCtx ), APPL_MODULE_NO_ERROR );
+      ABCC_CtxRunTimerSystem( psInst->psCtx, 1 );
+
+      if( psInst->pnSimGetAnbState() == ABP_ANB_STATE_WAIT_PROCESS )
+      {
+         psInst->pnSimSetAnbState( ABP_ANB_STATE_PROCESS_ACTIVE );
+      }
+   }
+
+   TEST_CHECK( !test_asLog[ 0 ].fOverflow );
+   TEST_CHECK_EQ( test_asLog[ 0 ].iNumFrames, test_asLog[ 1 ].iNumFrames );
+   TEST_CHECK_EQ( test_asLog[ 0 ].iSize, test_asLog[ 1 ].iSize );
+   if( test_asLog[ 0 ].iSize == test_asLog[ 1 ].iSize )
+   {
+      TEST_CHECK( memcmp( test_asLog[ 0 ].abFrames, test_asLog[ 1 ].abFrames,
+                          test_asLog[ 0 ].iSize ) == 0 );
+   }
+   test_lNumFramesCompared += test_asLog[ 0 ].iNumFrames;
+}
+
+/*------------------------------------------------------------------------------
+** Builds a command from the module to the host application data object.
+**------------------------------------------------------------------------------
+*/
+static void BuildAdiCmd( ABP_MsgType* psMsg, UINT8 bSourceId, UINT16 iInstance,
+                         UINT8 bCmd, UINT16 iDataSize )
+{
+   UINT16 i;
+
+   memset( &psMsg->sHeader, 0, sizeof( psMsg->sHeader ) );
+   psMsg->sHeader.bSourceId = bSourceId;
+   psMsg->sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+   psMsg->sHeader.iInstance = iInstance;
+   psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT | bCmd;
+   psMsg->sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+   psMsg->sHeader.iDataSize = iDataSize;
+   for( i = 0; i < iDataSize; i++ )
+   {
+      psMsg->abData[ i ] = (UINT8)( bSourceId + i );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Sends a Get, or with iDataSize octets of data a Set, of the network type to
+** the module from both instances. See HostResp() for the responses.
+**------------------------------------------------------------------------------
+*/
+static void SendHostCmd( UINT8 bSourceId, UINT16 iDataSize )
+{
+   ABP_MsgType* psMsg;
+   UINT16 i;
+   UINT8 bInst;
+
+   for( bInst = 0; bInst < TEST_NUM_INSTANCES; bInst++ )
+   {
+      psMsg = ABCC_CtxGetCmdMsgBuffer( test_asInstance[ bInst ].psCtx );
+      TEST_CHECK( psMsg != NULL );
+      if( psMsg == NULL )
+      {
+         continue;
+      }
+
+      memset( &psMsg->sHeader, 0, sizeof( psMsg->sHeader ) );
+      psMsg->sHeader.bSourceId = bSourceId;
+      psMsg->sHeader.bDestObj = ABP_OBJ_NUM_NW;
+      psMsg->sHeader.iInstance = 1;
+      psMsg->sHeader.bCmd = ABP_MSG_HEADER_C_BIT |
+                            ( iDataSize > 0 ? ABP_CMD_SET_ATTR : ABP_CMD_GET_ATTR );
+      psMsg->sHeader.bCmdExt0 = ABP_NW_IA_NW_TYPE;
+      psMsg->sHeader.iDataSize = iDataSize;
+      for( i = 0; i < iDataSize; i++ )
+      {
+         psMsg->abData[ i ] = (UINT8)( bSourceId ^ i );
+      }
+
+      TEST_CHECK_EQ( ABCC_CtxSendCmdMsg( test_asInstance[ bInst ].psCtx, psMsg,
+                                         test_asInstance[ bInst ].pnHostResp ),
+                     ABCC_EC_NO_ERROR );
+   }
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   ABP_MsgType asMsg[ TEST_NUM_INSTANCES ];
+   UINT8 abReadPd[ 256 ];
+   UINT16 iCycle;
+   UINT16 iNumResp;
+   UINT16 i;
+   UINT8 bInst;
+   BOOL fActive;
+
+   for( bInst = 0; bInst < TEST_NUM_INSTANCES; bInst++ )
+   {
+      test_asInstance[ bInst ].pnSimSetSpiMonitor( test_asInstance[ bInst ].pnMonitor );
+      TEST_CHECK_EQ( ABCC_CtxHwInit( test_asInstance[ bInst ].psCtx ), ABCC_EC_NO_ERROR );
+   }
+
+   /*
+   ** Startup, including the setup commands and the mapping.
+   */
+   fActive = FALSE;
+   for( iCycle = 0; ( iCycle < TEST_MAX_CYCLES ) && !fActive; iCycle++ )
+   {
+      RunCycle();
+      fActive = ( ABCC_CtxAnbState( test_asInstance[ 0 ].psCtx ) == ABP_ANB_STATE_PROCESS_ACTIVE ) &&
+                ( ABCC_CtxAnbState( test_asInstance[ 1 ].psCtx ) == ABP_ANB_STATE_PROCESS_ACTIVE );
+   }
+   TEST_CHECK( fActive );
+
+   /*
+   ** Process data and messages in both directions.
+   */
+   iNumResp = 0;
+   for( iCycle = 0; iCycle < TEST_NUM_TRAFFIC_CYCLES; iCycle++ )
+   {
+      for( i = 0; i < sizeof( abReadPd ); i++ )
+      {
+         abReadPd[ i ] = (UINT8)( iCycle + i );
+      }
+
+      for( bInst = 0; bInst < TEST_NUM_INSTANCES; bInst++ )
+      {
+         test_asInstance[ bInst ].paiAdi[ TEST_ADI_FIRST_WRITE + ( iCycle & 7 ) ] = iCycle;
+         test_asInstance[ bInst ].pnSimSetReadPd( abReadPd, sizeof( abReadPd ) );
+         ABCC_CtxTriggerWrPdUpdate( test_asInstance[ bInst ].psCtx );
+
+         /*
+         ** Several fragments towards the module: Get of a UINT16[ 64 ],
+         ** Set with up to 300 octets.
+         */
+         if( ( iCycle % 50 ) == 0 )
+         {
+            BuildAdiCmd( &asMsg[ bInst ], (UINT8)( iCycle / 50 ),
+                         TEST_ADI_INST_ARRAY16, ABP_CMD_GET_ATTR, 0 );
+            TEST_CHECK( test_asInstance[ bInst ].pnSimSendCmd( &asMsg[ bInst ] ) );
+         }
+         else if( ( iCycle % 50 ) == 25 )
+         {
+            BuildAdiCmd( &asMsg[ bInst ], (UINT8)( iCycle / 50 ),
+                         TEST_ADI_INST( 100 + ( iCycle / 50 ) ),
+                         ABP_CMD_SET_ATTR, ABP_UINT16_SIZEOF );
+            TEST_CHECK( test_asInstance[ bInst ].pnSimSendCmd( &asMsg[ bInst ] ) );
+         }
+      }
+
+      if( ( iCycle % 40 ) == 10 )
+      {
+         SendHostCmd( (UINT8)( 100 + iCycle / 40 ), (UINT16)( ( iCycle * 7 ) % 300 ) );
+      }
+
+      RunCycle();
+
+      for( bInst = 0; bInst < TEST_NUM_INSTANCES; bInst++ )
+      {
+         while( test_asInstance[ bInst ].pnSimGetResp( &asMsg[ bInst ] ) )
+         {
+            TEST_CHECK( !( asMsg[ bInst ].sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) );
+            iNumResp++;
+         }
+      }
+   }
+
+   /*
+   ** The responses were received by both, a good part of the frames carried
+   ** messages, and the module found the CRC of every frame good.
+   */
+   TEST_CHECK_EQ( iNumResp, 2 * 2 * ( TEST_NUM_TRAFFIC_CYCLES / 50 ) );
+   TEST_CHECK( test_lNumFramesCompared > TEST_NUM_TRAFFIC_CYCLES );
+   for( bInst = 0; bInst < TEST_NUM_INSTANCES; bInst++ )
+   {
+      TEST_CHECK_EQ( test_aiNumHostResp[ bInst ], TEST_NUM_TRAFFIC_CYCLES / 40 );
+      TEST_CHECK_EQ( test_asInstance[ bInst ].pnSimGetStats()->lNumMosiCrcErrors, 0 );
+   }
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2024-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** ABCC_GetNewSourceId() called from two threads at once: no two callers may
+** get the same source id while fewer ids than there are have been taken.
+********************************************************************************
+*/
+
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "abcc_types.h"
+#include "abcc.h"
+#include "test_util.h"
+
+#define TEST_IDS_PER_THREAD            ( 120 )
+#define TEST_NUM_ROUNDS                ( 200 )
+
+static UINT8 test_aabSrcId[ 2 ][ TEST_IDS_PER_THREAD ];
+
+static void* TakeIds( void* pxArg )
+{
+   UINT8* pbSrcId;
+   UINT16 i;
+
+   pbSrcId = (UINT8*)pxArg;
+   for( i = 0; i < TEST_IDS_PER_THREAD; i++ )
+   {
+      pbSrcId[ i ] = ABCC_GetNewSourceId();
+      if( ( i & 7 ) == 0 )
+      {
+         sched_yield();
+      }
+   }
+
+   return( NULL );
+}
+
+int main( void )
+{
+   pthread_t xThread;
+   UINT8     abTaken[ 256 ];
+   UINT16    iRound;
+   UINT16    i;
+   UINT8     t;
+
+   for( iRound = 0; iRound < TEST_NUM_ROUNDS; iRound++ )
+   {
+      TEST_CHECK( pthread_create( &xThread, NULL, TakeIds,
+                                  test_aabSrcId[ 0 ] ) == 0 );
+      (void)TakeIds( test_aabSrcId[ 1 ] );
+      (void)pthread_join( xThread, NULL );
+
+      memset( abTaken, 0, sizeof( abTaken ) );
+      for( t = 0; t < 2; t++ )
+      {
+         for( i = 0; i < TEST_IDS_PER_THREAD; i++ )
+         {
+            TEST_CHECK_EQ( abTaken[ test_aabSrcId[ t ][ i ] ], 0 );
+            abTaken[ test_aabSrcId[ t ][ i ] ] = 1;
+         }
+      }
+
+      if( TEST_Result() != 0 )
+      {
+         printf( "Round %u\n", iRound );
+         break;
+      }
+   }
+
+   return( TEST_Result() );
+}
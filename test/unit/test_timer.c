@@ -0,0 +1,203 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Timer service: the timing wheel over several revolutions and with several
+** timers in one slot, stop and restart, a timeout callback restarting its own
+** timer, and long millisecond timeouts.
+********************************************************************************
+*/
+
+#include "abcc_types.h"
+#include "abcc_timer.h"
+#include "test_util.h"
+
+#define TEST_NUM_TIMERS                ( 3 )
+
+static UINT16           test_aiNumTimeouts[ TEST_NUM_TIMERS ];
+static ABCC_TimerHandle test_axTimer[ TEST_NUM_TIMERS ];
+static UINT32           test_lPeriodMs;
+
+static void HandleTimeout0( void )
+{
+   test_aiNumTimeouts[ 0 ]++;
+
+   if( test_lPeriodMs != 0 )
+   {
+      (void)ABCC_TimerStart( test_axTimer[ 0 ], test_lPeriodMs );
+   }
+}
+
+static void HandleTimeout1( void )
+{
+   test_aiNumTimeouts[ 1 ]++;
+}
+
+static void HandleTimeout2( void )
+{
+   test_aiNumTimeouts[ 2 ]++;
+}
+
+/*
+** Ticks one millisecond at a time.
+*/
+static void TickMs( UINT32 lMs )
+{
+   while( lMs-- > 0 )
+   {
+      ABCC_TimerTick( 1 );
+   }
+}
+
+/*
+** Ticks in steps of the longest ABCC_TimerTickUs() delta.
+*/
+static void TickLongMs( UINT32 lMs )
+{
+   while( lMs > 4294967UL )
+   {
+      ABCC_TimerTickUs( 4294967000UL );
+      lMs -= 4294967UL;
+   }
+   ABCC_TimerTickUs( lMs * 1000UL );
+}
+
+int main( void )
+{
+   UINT16 i;
+
+   ABCC_TimerInit();
+   test_axTimer[ 0 ] = ABCC_TimerCreate( HandleTimeout0 );
+   test_axTimer[ 1 ] = ABCC_TimerCreate( HandleTimeout1 );
+   test_axTimer[ 2 ] = ABCC_TimerCreate( HandleTimeout2 );
+   for( i = 0; i < TEST_NUM_TIMERS; i++ )
+   {
+      TEST_CHECK( test_axTimer[ i ] != ABCC_TIMER_NO_HANDLE );
+   }
+
+   /*
+   ** Short timeout.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 0 ], 5 );
+   ABCC_TimerTick( 4 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 0 );
+   ABCC_TimerTick( 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 1 );
+
+   /*
+   ** A timeout of several wheel revolutions passes its slot without expiring
+   ** until the last revolution.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 0 ], 3 * ABCC_CFG_TIMER_WHEEL_SIZE + 5 );
+   TickMs( 3 * ABCC_CFG_TIMER_WHEEL_SIZE + 4 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 1 );
+   TickMs( 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 2 );
+
+   /*
+   ** The same, with one tick passing several revolutions at once.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 0 ], 3 * ABCC_CFG_TIMER_WHEEL_SIZE + 5 );
+   ABCC_TimerTick( 3 * ABCC_CFG_TIMER_WHEEL_SIZE + 4 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 2 );
+   ABCC_TimerTick( 2 * ABCC_CFG_TIMER_WHEEL_SIZE );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 3 );
+
+   /*
+   ** Three timers in one slot, two revolutions apart, and each expires at
+   ** its own tick.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 0 ], 7 );
+   (void)ABCC_TimerStart( test_axTimer[ 1 ], 7 + ABCC_CFG_TIMER_WHEEL_SIZE );
+   (void)ABCC_TimerStart( test_axTimer[ 2 ], 7 + 2 * ABCC_CFG_TIMER_WHEEL_SIZE );
+   TickMs( 7 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 4 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 1 ], 0 );
+   TickMs( ABCC_CFG_TIMER_WHEEL_SIZE );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 1 ], 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 2 ], 0 );
+   TickMs( ABCC_CFG_TIMER_WHEEL_SIZE );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 4 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 1 ], 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 2 ], 1 );
+
+   /*
+   ** Timers expiring at the same tick all expire. Stopping the middle one of
+   ** the slot list keeps the others linked.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 0 ], 3 );
+   (void)ABCC_TimerStart( test_axTimer[ 1 ], 3 );
+   (void)ABCC_TimerStart( test_axTimer[ 2 ], 3 );
+   TEST_CHECK( !ABCC_TimerStop( test_axTimer[ 1 ] ) );
+   TickMs( 3 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 5 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 1 ], 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 2 ], 2 );
+
+   /*
+   ** A stopped timer does not expire.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 1 ], 10 );
+   TickMs( 5 );
+   TEST_CHECK( !ABCC_TimerStop( test_axTimer[ 1 ] ) );
+   TickMs( 10 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 1 ], 1 );
+
+   /*
+   ** Restarting a running timer moves its expiry, and the restart reports
+   ** whether the timer had expired.
+   */
+   TEST_CHECK( !ABCC_TimerStart( test_axTimer[ 1 ], 10 ) );
+   TickMs( 8 );
+   TEST_CHECK( !ABCC_TimerStart( test_axTimer[ 1 ], 10 ) );
+   TickMs( 9 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 1 ], 1 );
+   TickMs( 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 1 ], 2 );
+   TEST_CHECK( ABCC_TimerStart( test_axTimer[ 1 ], 10 ) );
+   TEST_CHECK( !ABCC_TimerStop( test_axTimer[ 1 ] ) );
+
+   /*
+   ** A callback restarting its own timer gives a periodic timer, also when a
+   ** single tick passes several periods.
+   */
+   test_lPeriodMs = 7;
+   (void)ABCC_TimerStart( test_axTimer[ 0 ], test_lPeriodMs );
+   TickMs( 70 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 15 );
+   ABCC_TimerTick( 21 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 16 );
+   TickMs( 7 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 0 ], 17 );
+   test_lPeriodMs = 0;
+   (void)ABCC_TimerStop( test_axTimer[ 0 ] );
+
+   /*
+   ** 4294968 ms does not fit in 32 bits of microseconds but is not clamped.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 2 ], 4294968UL );
+   TickLongMs( 4294967UL );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 2 ], 2 );
+   TickMs( 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 2 ], 3 );
+
+   /*
+   ** The longest timeout is 2^31 - 1 ticks.
+   */
+   (void)ABCC_TimerStart( test_axTimer[ 2 ], 0xFFFFFFFFUL );
+   TickLongMs( 0x7FFFFFFEUL );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 2 ], 3 );
+   TickMs( 1 );
+   TEST_CHECK_EQ( test_aiNumTimeouts[ 2 ], 4 );
+
+   return( TEST_Result() );
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Check macros of the host unit tests. A test program returns TEST_Result()
+** from main(), which is non-zero if any check failed.
+********************************************************************************
+*/
+
+#ifndef TEST_UTIL_H_
+#define TEST_UTIL_H_
+
+#include <stdio.h>
+
+static int test_iNumFailed = 0;
+
+#define TEST_CHECK( cond )                                                     \
+   do                                                                          \
+   {                                                                           \
+      if( !( cond ) )                                                          \
+      {                                                                        \
+         printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond );     \
+         test_iNumFailed++;                                                    \
+      }                                                                        \
+   } while( 0 )
+
+#define TEST_CHECK_EQ( a, b )                                                  \
+   do                                                                          \
+   {                                                                           \
+      unsigned long test_lA = (unsigned long)( a );                            \
+      unsigned long test_lB = (unsigned long)( b );                            \
+      if( test_lA != test_lB )                                                 \
+      {                                                                        \
+         printf( "%s:%d: check failed: %s == %s (0x%lx != 0x%lx)\n",           \
+                 __FILE__, __LINE__, #a, #b, test_lA, test_lB );               \
+         test_iNumFailed++;                                                    \
+      }                                                                        \
+   } while( 0 )
+
+#define TEST_Result()  ( test_iNumFailed == 0 ? 0 : 1 )
+
+#endif  /* inclusion lock */
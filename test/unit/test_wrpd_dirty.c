@@ -0,0 +1,252 @@
+/*******************************************************************************
+********************************************************************************
+**                                                                            **
+** ABCC Driver version edc67ee (2024-10-25)                                   **
+**                                                                            **
+** Delivered with:                                                            **
+**    ABP            c799efc (2024-05-14)                                     **
+**                                                                            */
+/*******************************************************************************
+** Copyright 2013-present HMS Industrial Networks AB.
+** Licensed under the MIT License.
+********************************************************************************
+** File Description:
+** Write process data change tracking (AD_WRPD_DIRTY_TRACKING_ENABLE). Values
+** of write mapped ADIs are changed behind the driver's back, and only the ADIs
+** marked with AD_MarkAdiDirty(), or set by the network, may reach the write
+** process data seen by the simulated module. Clean ADIs keep their old values
+** there, and no write process data is sent when nothing is marked.
+********************************************************************************
+*/
+
+#include <string.h>
+#include "abcc_types.h"
+#include "abp.h"
+#include "abcc.h"
+#include "abcc_sim.h"
+#include "sim_application.h"
+#include "application_abcc_handler.h"
+#include "application_data_object.h"
+#include "test_util.h"
+
+/*******************************************************************************
+** Constants
+********************************************************************************
+*/
+
+/*
+** The default write map (see sim_application.c): Array32, BitsWr and the
+** UINT16 ADIs SIM_NUM_MAPPED_ADI and on.
+*/
+#define TEST_PD_ARRAY32                ( 0 )
+#define TEST_PD_ARRAY32_SIZE           ( 32 * ABP_UINT32_SIZEOF )
+#define TEST_PD_BITS_WR                ( TEST_PD_ARRAY32 + TEST_PD_ARRAY32_SIZE )
+#define TEST_PD_BITS_WR_SIZE           ( ( 40 * 3 ) / 8 )
+#define TEST_PD_ADI                    ( TEST_PD_BITS_WR + TEST_PD_BITS_WR_SIZE )
+#define TEST_PD_SIZE                   ( TEST_PD_ADI + SIM_NUM_MAPPED_ADI * ABP_UINT16_SIZEOF )
+
+#define TEST_FIRST_WRITE_ADI           ( SIM_NUM_MAPPED_ADI )
+#define TEST_NUM_CYCLES                ( 5 )
+
+/*******************************************************************************
+** Private Globals
+********************************************************************************
+*/
+
+static UINT32 test_lSeed = 4711;
+
+/*
+** Write process data the module is expected to have.
+*/
+static UINT8 test_abExpected[ TEST_PD_SIZE ];
+
+/*******************************************************************************
+** Private Services
+********************************************************************************
+*/
+
+static UINT8 Random( void )
+{
+   test_lSeed = test_lSeed * 1103515245UL + 12345UL;
+   return( (UINT8)( test_lSeed >> 16 ) );
+}
+
+static void FillRandom( void* pxData, UINT16 iSize )
+{
+   UINT16 i;
+
+   for( i = 0; i < iSize; i++ )
+   {
+      ( (UINT8*)pxData )[ i ] = Random();
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Changes the values of all write mapped ADIs without telling the driver.
+**------------------------------------------------------------------------------
+*/
+static void ChangeAll( void )
+{
+   FillRandom( SIM_arArray32, sizeof( SIM_arArray32 ) );
+   FillRandom( SIM_abBitsWr, sizeof( SIM_abBitsWr ) );
+   FillRandom( &SIM_aiAdi[ TEST_FIRST_WRITE_ADI ],
+               SIM_NUM_MAPPED_ADI * sizeof( SIM_aiAdi[ 0 ] ) );
+}
+
+/*
+** Expected write process data of the ADIs, from their current values. The
+** network data format is LSB first.
+*/
+static void ExpectArray32( void )
+{
+   memcpy( &test_abExpected[ TEST_PD_ARRAY32 ], SIM_arArray32, TEST_PD_ARRAY32_SIZE );
+}
+
+static void ExpectBitsWr( void )
+{
+   memcpy( &test_abExpected[ TEST_PD_BITS_WR ], SIM_abBitsWr, TEST_PD_BITS_WR_SIZE );
+}
+
+static void ExpectAdi( UINT16 iAdi )
+{
+   UINT16 iOffset;
+
+   iOffset = (UINT16)( TEST_PD_ADI + ( iAdi - TEST_FIRST_WRITE_ADI ) * ABP_UINT16_SIZEOF );
+   test_abExpected[ iOffset ] = (UINT8)SIM_aiAdi[ iAdi ];
+   test_abExpected[ iOffset + 1 ] = (UINT8)( SIM_aiAdi[ iAdi ] >> 8 );
+}
+
+static void ExpectAll( void )
+{
+   UINT16 i;
+
+   ExpectArray32();
+   ExpectBitsWr();
+   for( i = 0; i < SIM_NUM_MAPPED_ADI; i++ )
+   {
+      ExpectAdi( (UINT16)( TEST_FIRST_WRITE_ADI + i ) );
+   }
+}
+
+/*------------------------------------------------------------------------------
+** Runs a few cycles and checks the write process data of the module and the
+** number of write process data updates sent.
+**------------------------------------------------------------------------------
+*/
+static void RunAndCheck( UINT32 lExpectedNumWrPd )
+{
+   UINT32 lNumWrPd;
+   UINT16 i;
+
+   lNumWrPd = SIM_GetStats()->lNumWrPd;
+   for( i = 0; i < TEST_NUM_CYCLES; i++ )
+   {
+      TEST_CHECK_EQ( SIM_APPL_RunCycle(), APPL_MODULE_NO_ERROR );
+   }
+
+   TEST_CHECK_EQ( SIM_GetWritePdSize(), TEST_PD_SIZE );
+   TEST_CHECK( memcmp( SIM_GetWritePd(), test_abExpected, TEST_PD_SIZE ) == 0 );
+   TEST_CHECK_EQ( SIM_GetStats()->lNumWrPd - lNumWrPd, lExpectedNumWrPd );
+}
+
+/*------------------------------------------------------------------------------
+** Sets the value of a UINT16 ADI from the network.
+**------------------------------------------------------------------------------
+*/
+static void NetworkSet( UINT16 iAdi, UINT16 iValue )
+{
+   ABP_MsgType sMsg;
+
+   memset( &sMsg.sHeader, 0, sizeof( sMsg.sHeader ) );
+   sMsg.sHeader.bSourceId = 1;
+   sMsg.sHeader.bDestObj = ABP_OBJ_NUM_APPD;
+   sMsg.sHeader.iInstance = SIM_ADI_INST( iAdi );
+   sMsg.sHeader.bCmd = ABP_MSG_HEADER_C_BIT | ABP_CMD_SET_ATTR;
+   sMsg.sHeader.bCmdExt0 = ABP_APPD_IA_VALUE;
+   sMsg.sHeader.iDataSize = ABP_UINT16_SIZEOF;
+   sMsg.abData[ 0 ] = (UINT8)iValue;
+   sMsg.abData[ 1 ] = (UINT8)( iValue >> 8 );
+
+   TEST_CHECK( SIM_APPL_Transact( &sMsg, 100 ) != 0 );
+   TEST_CHECK( !( sMsg.sHeader.bCmd & ABP_MSG_HEADER_E_BIT ) );
+   TEST_CHECK_EQ( SIM_aiAdi[ iAdi ], iValue );
+}
+
+/*******************************************************************************
+** Public Services
+********************************************************************************
+*/
+
+int main( void )
+{
+   TEST_CHECK( ABCC_HwInit() == ABCC_EC_NO_ERROR );
+
+   /*
+   ** The first update after the mapping is a full one.
+   */
+   ChangeAll();
+   ExpectAll();
+   TEST_CHECK( SIM_APPL_Start() );
+   RunAndCheck( 0 );
+
+   /*
+   ** Nothing marked, nothing sent, even if the values have changed.
+   */
+   ChangeAll();
+   RunAndCheck( 0 );
+
+   /*
+   ** Only the marked ADIs are updated.
+   */
+   AD_MarkAdiDirty( SIM_ADI_INST( TEST_FIRST_WRITE_ADI + 8 ) );
+   ExpectAdi( TEST_FIRST_WRITE_ADI + 8 );
+   RunAndCheck( 1 );
+
+   AD_MarkAdiDirty( SIM_ADI_INST_BITS_WR );
+   AD_MarkAdiDirty( SIM_ADI_INST( TEST_FIRST_WRITE_ADI ) );
+   AD_MarkAdiDirty( SIM_ADI_INST( TEST_FIRST_WRITE_ADI + SIM_NUM_MAPPED_ADI - 1 ) );
+   ExpectBitsWr();
+   ExpectAdi( TEST_FIRST_WRITE_ADI );
+   ExpectAdi( TEST_FIRST_WRITE_ADI + SIM_NUM_MAPPED_ADI - 1 );
+   RunAndCheck( 1 );
+
+   AD_MarkAdiDirty( SIM_ADI_INST_ARRAY32 );
+   ExpectArray32();
+   RunAndCheck( 1 );
+
+   /*
+   ** Instances not write mapped, read mapped or not mapped at all, are
+   ** ignored.
+   */
+   AD_MarkAdiDirty( SIM_ADI_INST( 0 ) );
+   AD_MarkAdiDirty( SIM_ADI_INST_ARRAY16 );
+   AD_MarkAdiDirty( SIM_ADI_INST( SIM_NUM_ADI - 1 ) );
+   RunAndCheck( 0 );
+
+   /*
+   ** A value set from the network is marked by the driver.
+   */
+   NetworkSet( TEST_FIRST_WRITE_ADI + 20, 0x1234 );
+   ExpectAdi( TEST_FIRST_WRITE_ADI + 20 );
+   RunAndCheck( 0 );
+
+   /*
+   ** All of them.
+   */
+   AD_MarkAllAdisDirty();
+   ExpectAll();
+   RunAndCheck( 1 );
+   RunAndCheck( 0 );
+
+   /*
+   ** A full update again after a restart and a new mapping.
+   */
+   ChangeAll();
+   ExpectAll();
+   APPL_RestartAbcc();
+   (void)SIM_APPL_RunCycle();
+   TEST_CHECK( SIM_APPL_Start() );
+   RunAndCheck( 0 );
+
+   return( TEST_Result() );
+}
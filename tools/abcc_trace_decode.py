@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+# Copyright 2024-present HMS Industrial Networks AB.
+# Licensed under the MIT License.
+#
+# Host side decoder for the binary trace ring (ABCC_CFG_TRACE_ENABLED).
+#
+# Reads a raw dump of ABCC_TraceRecordType records, as returned by
+# ABCC_TraceRead(), pairs the BEGIN and END event of each stage and prints
+# the latency of each stage as a histogram.
+#
+# Usage:
+#    abcc_trace_decode.py [--big-endian] [--hex] [--tick-ns N] [--list] dump
+
+import argparse
+import struct
+import sys
+
+# Record layout, see ABCC_TraceRecordType in abcc.h:
+# lTimestamp (UINT32), iEvent, iArg, iSeq, iReserved (UINT16).
+RECORD_FORMAT = "IHHHH"
+RECORD_SIZE = struct.calcsize("<" + RECORD_FORMAT)
+
+TIMESTAMP_MASK = 0xFFFFFFFF
+SEQ_MASK = 0xFFFF
+
+# Driver stages, see ABCC_TraceEventType in abcc.h. The BEGIN event of a
+# stage has an even identifier and the END event is BEGIN + 1. Application
+# events from ABCC_TRACE_USER and upwards are paired the same way.
+TRACE_USER = 0x80
+
+STAGE_NAMES = {
+    0x00: "RUN_DRIVER",
+    0x02: "DRV_TX",
+    0x04: "DRV_RX",
+    0x06: "RD_PD",
+    0x08: "NEW_READ_PD",
+    0x0A: "SEND_MSG",
+    0x0C: "RECEIVE_MSG",
+    0x0E: "CMD_SEQ",
+}
+
+HISTOGRAM_WIDTH = 40
+
+
+def stage_name(stage):
+    if stage in STAGE_NAMES:
+        return STAGE_NAMES[stage]
+    if stage >= TRACE_USER:
+        return "USER_0x%04X" % stage
+    return "EVENT_0x%04X" % stage
+
+
+def event_name(event):
+    if event & 1:
+        return stage_name(event & ~1) + "_END"
+    return stage_name(event) + "_BEGIN"
+
+
+def read_dump(path, is_hex):
+    if is_hex:
+        with open(path, "r") as f:
+            return bytes.fromhex("".join(f.read().split()))
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def parse_records(data, big_endian):
+    fmt = (">" if big_endian else "<") + RECORD_FORMAT
+    if len(data) % RECORD_SIZE:
+        sys.stderr.write("warning: %d trailing octets ignored\n"
+                         % (len(data) % RECORD_SIZE))
+    for i in range(len(data) // RECORD_SIZE):
+        yield struct.unpack_from(fmt, data, i * RECORD_SIZE)
+
+
+class Stage:
+    def __init__(self):
+        self.open = []
+        self.durations = []
+        self.unmatched_end = 0
+
+    def begin(self, timestamp):
+        self.open.append(timestamp)
+
+    def end(self, timestamp):
+        # A stage in interrupt context may nest within the same stage in
+        # application context. The latest BEGIN is the matching one.
+        if not self.open:
+            self.unmatched_end += 1
+            return
+        self.durations.append((timestamp - self.open.pop()) & TIMESTAMP_MASK)
+
+
+def decode(records, list_records):
+    stages = {}
+    num_records = 0
+    num_gaps = 0
+    num_lost = 0
+    prev_seq = None
+
+    for timestamp, event, arg, seq, _ in records:
+        num_records += 1
+
+        if prev_seq is not None and seq != ((prev_seq + 1) & SEQ_MASK):
+            # Records were lost. Stages open across the gap cannot be
+            # measured.
+            lost = (seq - prev_seq - 1) & SEQ_MASK
+            num_gaps += 1
+            num_lost += lost
+            for stage in stages.values():
+                stage.open = []
+            if list_records:
+                print("      --- %d records lost ---" % lost)
+        prev_seq = seq
+
+        if list_records:
+            print("%5u %10u %-24s 0x%04X"
+                  % (seq, timestamp, event_name(event), arg))
+
+        stage = stages.setdefault(event & ~1, Stage())
+        if event & 1:
+            stage.end(timestamp)
+        else:
+            stage.begin(timestamp)
+
+    return stages, num_records, num_gaps, num_lost
+
+
+def format_time(ticks, tick_ns):
+    if tick_ns is None:
+        return "%u" % ticks
+    ns = ticks * tick_ns
+    if ns >= 1000000:
+        return "%.2fms" % (ns / 1000000.0)
+    if ns >= 1000:
+        return "%.2fus" % (ns / 1000.0)
+    return "%.0fns" % ns
+
+
+def percentile(sorted_values, percent):
+    return sorted_values[min(len(sorted_values) - 1,
+                             len(sorted_values) * percent // 100)]
+
+
+def print_histogram(stage_id, stage, tick_ns):
+    durations = sorted(stage.durations)
+    print("%s: %d samples" % (stage_name(stage_id), len(durations)))
+    if stage.unmatched_end or stage.open:
+        print("   unmatched: %d END, %d BEGIN"
+              % (stage.unmatched_end, len(stage.open)))
+    if not durations:
+        print("")
+        return
+
+    print("   min %s  avg %s  p50 %s  p99 %s  max %s"
+          % (format_time(durations[0], tick_ns),
+             format_time(sum(durations) // len(durations), tick_ns),
+             format_time(percentile(durations, 50), tick_ns),
+             format_time(percentile(durations, 99), tick_ns),
+             format_time(durations[-1], tick_ns)))
+
+    # Power of two buckets, bucket n holds durations in [2^(n-1), 2^n).
+    buckets = {}
+    for duration in durations:
+        bucket = duration.bit_length()
+        buckets[bucket] = buckets.get(bucket, 0) + 1
+
+    max_count = max(buckets.values())
+    for bucket in range(min(buckets), max(buckets) + 1):
+        count = buckets.get(bucket, 0)
+        low = 0 if bucket == 0 else 1 << (bucket - 1)
+        bar = (count * HISTOGRAM_WIDTH + max_count - 1) // max_count
+        print("   %10s - %-10s %8d %s"
+              % (format_time(low, tick_ns), format_time(1 << bucket, tick_ns),
+                 count, "#" * bar))
+    print("")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode an ABCC driver trace dump and print per-stage "
+                    "latency histograms.")
+    parser.add_argument("dump",
+                        help="raw dump of ABCC_TraceRecordType records")
+    parser.add_argument("--big-endian", action="store_true",
+                        help="the dump was taken on a big endian target")
+    parser.add_argument("--hex", action="store_true",
+                        help="the dump is text with hex octets, "
+                             "e.g. '1A 00' or '1A00'")
+    parser.add_argument("--tick-ns", type=float, default=None,
+                        help="length of one ABCC_PORT_GetTimestamp() tick "
+                             "in ns, latencies are printed in ticks if "
+                             "omitted")
+    parser.add_argument("--list", action="store_true",
+                        help="print each record before the histograms")
+    args = parser.parse_args()
+
+    data = read_dump(args.dump, args.hex)
+    stages, num_records, num_gaps, num_lost = decode(
+        parse_records(data, args.big_endian), args.list)
+
+    print("%d records, %d gaps, %d records lost"
+          % (num_records, num_gaps, num_lost))
+    print("")
+
+    for stage_id in sorted(stages):
+        print_histogram(stage_id, stages[stage_id], args.tick_ns)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())